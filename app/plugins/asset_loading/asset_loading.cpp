@@ -0,0 +1,57 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asset_loading.h"
+
+#include "gltf_loader.h"
+#include "platform/application.h"
+
+namespace plugins
+{
+AssetLoading::AssetLoading() :
+    AssetLoadingTags("Asset Loading",
+                     "Configure how the samples load their scenes.",
+                     {},
+                     {},
+                     {{"scene-cooking", "Cook the scenes into a binary file the first time they are loaded, and load them back from it"},
+                      {"host-image-copy", "Copy textures from host memory with VK_EXT_host_image_copy when supported, instead of staging buffers"}})
+{
+}
+
+bool AssetLoading::handle_option(std::deque<std::string> &arguments)
+{
+	assert(!arguments.empty() && (arguments[0].substr(0, 2) == "--"));
+	std::string option = arguments[0].substr(2);
+	if (option == "scene-cooking")
+	{
+		vkb::GLTFLoader::set_default_scene_cooking(true);
+
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "host-image-copy")
+	{
+		auto features            = vkb::Application::get_framework_features();
+		features.host_image_copy = true;
+		vkb::Application::set_framework_features(features);
+
+		arguments.pop_front();
+		return true;
+	}
+	return false;
+}
+}        // namespace plugins
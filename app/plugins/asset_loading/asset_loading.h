@@ -0,0 +1,51 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "platform/plugins/plugin_base.h"
+
+namespace plugins
+{
+class AssetLoading;
+
+using AssetLoadingTags = vkb::PluginBase<AssetLoading, vkb::tags::Passive>;
+
+/**
+ * @brief Asset Loading
+ *
+ * Configures how the samples load their scenes. With scene cooking, a scene is baked into a binary file next to its
+ * glTF file the first time it is loaded, and loaded back from it afterwards, without parsing the glTF file nor
+ * decoding its images. Compare the load times logged by the first and second runs.
+ *
+ * With host image copies, textures are copied to their images from host memory with VK_EXT_host_image_copy, when the
+ * device supports it, instead of through staging buffers and queue submissions.
+ *
+ * Usage: vulkan_sample sample mesh_lod --scene-cooking
+ *        vulkan_sample sample afbc --host-image-copy
+ *
+ */
+class AssetLoading : public AssetLoadingTags
+{
+  public:
+	AssetLoading();
+
+	virtual ~AssetLoading() = default;
+
+	bool handle_option(std::deque<std::string> &arguments) override;
+};
+}        // namespace plugins
@@ -18,16 +18,134 @@
 
 #include "benchmark_mode.h"
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+#include <fmt/format.h>
+
+#include "batch_mode/batch_mode.h"
+#include "filesystem/legacy.h"
 #include "platform/platform.h"
+#include "stats/gpu_profiler.h"
+#include "vulkan_sample.h"
 
 namespace plugins
 {
+namespace
+{
+/// Width of the buckets of the frame time histogram, in milliseconds
+constexpr double histogram_bucket_width = 1.0;
+
+struct Statistics
+{
+	size_t count{0};
+	double mean{0.0};
+	double p50{0.0};
+	double p90{0.0};
+	double p99{0.0};
+	double max{0.0};
+};
+
+/**
+ * @brief Computes the statistics of the measured values, ignoring the negative ones which were not measured
+ */
+Statistics compute_statistics(const std::vector<float> &values)
+{
+	std::vector<float> sorted;
+	sorted.reserve(values.size());
+	std::copy_if(values.begin(), values.end(), std::back_inserter(sorted), [](float value) { return value >= 0.0f; });
+
+	Statistics statistics;
+	if (sorted.empty())
+	{
+		return statistics;
+	}
+
+	std::sort(sorted.begin(), sorted.end());
+
+	// Nearest-rank percentiles
+	auto percentile = [&sorted](double p) {
+		size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(sorted.size())));
+		return static_cast<double>(sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1]);
+	};
+
+	double sum = 0.0;
+	for (float value : sorted)
+	{
+		sum += value;
+	}
+
+	statistics.count = sorted.size();
+	statistics.mean  = sum / static_cast<double>(sorted.size());
+	statistics.p50   = percentile(50.0);
+	statistics.p90   = percentile(90.0);
+	statistics.p99   = percentile(99.0);
+	statistics.max   = sorted.back();
+
+	return statistics;
+}
+
+std::string to_json(const Statistics &statistics)
+{
+	if (statistics.count == 0)
+	{
+		return "null";
+	}
+
+	return fmt::format("{{\"count\": {}, \"mean\": {:.4f}, \"p50\": {:.4f}, \"p90\": {:.4f}, \"p99\": {:.4f}, \"max\": {:.4f}}}",
+	                   statistics.count, statistics.mean, statistics.p50, statistics.p90, statistics.p99, statistics.max);
+}
+
+std::string to_csv(const Statistics &statistics)
+{
+	if (statistics.count == 0)
+	{
+		return ",,,";
+	}
+
+	return fmt::format("{:.4f},{:.4f},{:.4f},{:.4f}", statistics.p50, statistics.p90, statistics.p99, statistics.max);
+}
+
+std::string to_csv(float value)
+{
+	return value >= 0.0f ? fmt::format("{:.4f}", value) : "";
+}
+
+void log_statistics(const char *name, const Statistics &statistics)
+{
+	if (statistics.count > 0)
+	{
+		LOGI("\t{:<10} mean {:.3f} ms, p50 {:.3f} ms, p90 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms",
+		     name, statistics.mean, statistics.p50, statistics.p90, statistics.p99, statistics.max);
+	}
+}
+
+const vkb::GpuProfiler *get_gpu_profiler(vkb::Application &app)
+{
+	if (auto *sample = dynamic_cast<vkb::VulkanSampleCpp *>(&app))
+	{
+		return sample->has_render_context() ? sample->get_stats().get_gpu_profiler() : nullptr;
+	}
+	else if (auto *sample = dynamic_cast<vkb::VulkanSampleC *>(&app))
+	{
+		return sample->has_render_context() ? sample->get_stats().get_gpu_profiler() : nullptr;
+	}
+	return nullptr;
+}
+}        // namespace
+
 BenchmarkMode::BenchmarkMode() :
     BenchmarkModeTags("Benchmark Mode",
                       "Log frame averages after running an app.",
-                      {vkb::Hook::OnUpdate, vkb::Hook::OnAppStart, vkb::Hook::OnAppClose},
+                      {vkb::Hook::OnUpdate, vkb::Hook::OnAppStart, vkb::Hook::OnAppClose, vkb::Hook::PostDraw},
                       {},
-                      {{"benchmark", "Enable benchmark mode"}})
+                      {{"benchmark", "Enable benchmark mode"},
+                       {"benchmark-warmup", "Number of frames to run before recording"},
+                       {"benchmark-frames", "Number of frames to record"},
+                       {"benchmark-duration", "Duration to record in seconds"},
+                       {"benchmark-output", "Directory the benchmark reports are written to"}})
 {
 }
 
@@ -45,24 +163,305 @@ bool BenchmarkMode::handle_option(std::deque<std::string> &arguments)
 		arguments.pop_front();
 		return true;
 	}
+	else if (option == "benchmark-warmup")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"benchmark-warmup\" is missing the actual number of frames!");
+			return false;
+		}
+		warmup_frames = static_cast<uint32_t>(std::stoul(arguments[1]));
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "benchmark-frames")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"benchmark-frames\" is missing the actual number of frames!");
+			return false;
+		}
+		frame_limit = static_cast<uint32_t>(std::stoul(arguments[1]));
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "benchmark-duration")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"benchmark-duration\" is missing the actual duration!");
+			return false;
+		}
+		duration_limit = std::stof(arguments[1]);
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "benchmark-output")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"benchmark-output\" is missing the actual directory!");
+			return false;
+		}
+		output_directory = arguments[1];
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
 	return false;
 }
 
 void BenchmarkMode::on_update(float delta_time)
 {
+	current_sample = ~size_t{0};
+
+	if (!recording)
+	{
+		return;
+	}
+
+	if (warmup_remaining > 0)
+	{
+		warmup_remaining--;
+		return;
+	}
+
+	if ((frame_limit > 0 && total_frames >= frame_limit) || (duration_limit > 0.0f && elapsed_time >= duration_limit))
+	{
+		recording = false;
+		LOGI("Benchmark for {} recorded {} frames", app_id, total_frames);
+
+		// Batch mode moves on to the next sample by itself
+		if (!platform->using_plugin<BatchMode>())
+		{
+			platform->close();
+		}
+		return;
+	}
+
 	elapsed_time += delta_time;
 	total_frames++;
+
+	FrameSample sample;
+	sample.frame_time = delta_time * 1000.0f;
+	samples.push_back(sample);
+
+	current_sample = samples.size() - 1;
+	cpu_timer.tick();
+}
+
+void BenchmarkMode::on_post_draw(vkb::rendering::RenderContextC &context)
+{
+	if (current_sample != ~size_t{0})
+	{
+		samples[current_sample].cpu_time = static_cast<float>(cpu_timer.tick<vkb::Timer::Milliseconds>());
+
+		if (auto *gpu_profiler = get_gpu_profiler(platform->get_app()))
+		{
+			pending_gpu_samples[gpu_profiler->get_frame_number()] = current_sample;
+		}
+
+		current_sample = ~size_t{0};
+	}
+
+	collect_gpu_times();
+}
+
+void BenchmarkMode::collect_gpu_times()
+{
+	if (pending_gpu_samples.empty())
+	{
+		return;
+	}
+
+	auto *gpu_profiler = get_gpu_profiler(platform->get_app());
+	if (!gpu_profiler)
+	{
+		return;
+	}
+
+	const auto &frame = gpu_profiler->get_latest_frame();
+	if (frame.frame_number == last_gpu_frame || frame.scopes.empty())
+	{
+		return;
+	}
+	last_gpu_frame = frame.frame_number;
+
+	auto it = pending_gpu_samples.find(frame.frame_number);
+	if (it != pending_gpu_samples.end())
+	{
+		// The GPU time of a frame spans the root scopes of every command buffer it profiled
+		double begin = std::numeric_limits<double>::max();
+		double end   = 0.0;
+		for (const auto &scope : frame.scopes)
+		{
+			if (scope.parent == ~0u)
+			{
+				begin = std::min(begin, scope.begin);
+				end   = std::max(end, scope.begin + scope.duration);
+			}
+		}
+
+		samples[it->second].gpu_time = static_cast<float>(end - begin);
+	}
+
+	// Frames older than the latest one will not be read back anymore
+	for (auto pending = pending_gpu_samples.begin(); pending != pending_gpu_samples.end();)
+	{
+		pending = pending->first <= frame.frame_number ? pending_gpu_samples.erase(pending) : std::next(pending);
+	}
 }
 
-void BenchmarkMode::on_app_start(const std::string &app_id)
+void BenchmarkMode::on_app_start(const std::string &app_info)
 {
-	elapsed_time = 0;
-	total_frames = 0;
+	// Batch mode replaces an application without closing it first
+	if (!app_id.empty())
+	{
+		write_report();
+	}
+
+	app_id           = app_info;
+	recording        = true;
+	warmup_remaining = warmup_frames;
+	elapsed_time     = 0;
+	total_frames     = 0;
+	current_sample   = ~size_t{0};
+	last_gpu_frame   = ~0ull;
+	samples.clear();
+	pending_gpu_samples.clear();
+
 	LOGI("Starting Benchmark for {}", app_id);
 }
 
-void BenchmarkMode::on_app_close(const std::string &app_id)
+void BenchmarkMode::on_app_close(const std::string &app_info)
+{
+	if (!app_id.empty())
+	{
+		write_report();
+	}
+}
+
+std::string BenchmarkMode::get_output_path(const std::string &file) const
+{
+	if (output_directory.empty())
+	{
+		return vkb::fs::path::get(vkb::fs::path::Logs, file);
+	}
+	return output_directory + "/" + file;
+}
+
+void BenchmarkMode::write_report()
 {
-	LOGI("Benchmark for {} completed in {} seconds (ran {} frames, averaged {} fps)", app_id, elapsed_time, total_frames, total_frames / elapsed_time);
+	std::string id = app_id;
+	app_id.clear();
+	recording = false;
+
+	if (samples.empty())
+	{
+		LOGW("Benchmark for {} did not record any frame", id);
+		return;
+	}
+
+	std::vector<float> frame_times, cpu_times, gpu_times;
+	frame_times.reserve(samples.size());
+	cpu_times.reserve(samples.size());
+	gpu_times.reserve(samples.size());
+	for (const auto &sample : samples)
+	{
+		frame_times.push_back(sample.frame_time);
+		cpu_times.push_back(sample.cpu_time);
+		gpu_times.push_back(sample.gpu_time);
+	}
+
+	auto frame_statistics = compute_statistics(frame_times);
+	auto cpu_statistics   = compute_statistics(cpu_times);
+	auto gpu_statistics   = compute_statistics(gpu_times);
+
+	float average_fps = elapsed_time > 0.0f ? total_frames / elapsed_time : 0.0f;
+
+	LOGI("Benchmark for {} completed in {} seconds (ran {} frames, averaged {} fps)", id, elapsed_time, total_frames, average_fps);
+	log_statistics("frame time", frame_statistics);
+	log_statistics("CPU time", cpu_statistics);
+	log_statistics("GPU time", gpu_statistics);
+
+	if (!output_directory.empty() && !vkb::fs::is_directory(output_directory))
+	{
+		vkb::fs::create_directory(output_directory);
+	}
+
+	// Frame time histogram, with fixed width buckets so that reports can be compared
+	size_t              first_bucket = static_cast<size_t>(*std::min_element(frame_times.begin(), frame_times.end()) / histogram_bucket_width);
+	size_t              last_bucket  = static_cast<size_t>(frame_statistics.max / histogram_bucket_width);
+	std::vector<size_t> histogram(last_bucket - first_bucket + 1, 0);
+	for (float frame_time : frame_times)
+	{
+		histogram[static_cast<size_t>(frame_time / histogram_bucket_width) - first_bucket]++;
+	}
+
+	std::string json_path = get_output_path(fmt::format("benchmark_{}.json", id));
+	std::ofstream json{json_path, std::ios::trunc};
+	if (json)
+	{
+		json << "{\n";
+		json << fmt::format("\t\"app\": \"{}\",\n", id);
+		json << fmt::format("\t\"warmup_frames\": {},\n", warmup_frames);
+		json << fmt::format("\t\"frames\": {},\n", total_frames);
+		json << fmt::format("\t\"duration\": {:.4f},\n", elapsed_time);
+		json << fmt::format("\t\"average_fps\": {:.4f},\n", average_fps);
+		json << fmt::format("\t\"frame_time\": {},\n", to_json(frame_statistics));
+		json << fmt::format("\t\"cpu_time\": {},\n", to_json(cpu_statistics));
+		json << fmt::format("\t\"gpu_time\": {},\n", to_json(gpu_statistics));
+		json << fmt::format("\t\"histogram\": {{\n\t\t\"bucket_width\": {:.4f},\n\t\t\"buckets\": [", histogram_bucket_width);
+		for (size_t bucket = 0; bucket < histogram.size(); bucket++)
+		{
+			json << fmt::format("{}\n\t\t\t{{\"begin\": {:.4f}, \"count\": {}}}",
+			                    bucket > 0 ? "," : "", (first_bucket + bucket) * histogram_bucket_width, histogram[bucket]);
+		}
+		json << "\n\t\t]\n\t}\n}\n";
+	}
+	else
+	{
+		LOGE("Failed to write benchmark report {}", json_path);
+	}
+
+	std::string csv_path = get_output_path(fmt::format("benchmark_{}.csv", id));
+	std::ofstream csv{csv_path, std::ios::trunc};
+	if (csv)
+	{
+		csv << "frame,frame_time_ms,cpu_time_ms,gpu_time_ms\n";
+		for (size_t frame = 0; frame < samples.size(); frame++)
+		{
+			csv << fmt::format("{},{},{},{}\n", frame, to_csv(samples[frame].frame_time), to_csv(samples[frame].cpu_time), to_csv(samples[frame].gpu_time));
+		}
+	}
+	else
+	{
+		LOGE("Failed to write benchmark samples {}", csv_path);
+	}
+
+	// One line per application, so that a batch run can be compared at a glance
+	std::ofstream summary{get_output_path("benchmark_summary.csv"), summary_started ? std::ios::app : std::ios::trunc};
+	if (summary)
+	{
+		if (!summary_started)
+		{
+			summary << "app,frames,duration,average_fps,"
+			           "frame_p50,frame_p90,frame_p99,frame_max,"
+			           "cpu_p50,cpu_p90,cpu_p99,cpu_max,"
+			           "gpu_p50,gpu_p90,gpu_p99,gpu_max\n";
+			summary_started = true;
+		}
+		summary << fmt::format("{},{},{:.4f},{:.4f},{},{},{}\n",
+		                       id, total_frames, elapsed_time, average_fps, to_csv(frame_statistics), to_csv(cpu_statistics), to_csv(gpu_statistics));
+	}
+
+	LOGI("Benchmark report written to {}", json_path);
 }
 }        // namespace plugins
@@ -18,7 +18,11 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <vector>
+
 #include "platform/plugins/plugin_base.h"
+#include "timer.h"
 
 namespace plugins
 {
@@ -31,7 +35,16 @@ using BenchmarkModeTags = vkb::PluginBase<BenchmarkMode, vkb::tags::Passive>;
  *
  * When enabled frame time statistics of a samples run will be printed to the console when an application closes. The simulation frame time (delta time) is also locked to 60FPS so that statistics can be compared more accurately across different devices.
  *
- * Usage: vulkan_samples sample afbc --benchmark
+ * After an optional number of warmup frames, the frame time, the CPU time spent from the start of a frame until it was presented, and the GPU time
+ * measured by the GPU profiler of the sample's stats are recorded for every frame. Recording stops after a fixed number of frames or a fixed duration,
+ * which closes the application unless batch mode is running, in which case batch mode moves on to the next sample.
+ *
+ * When an application closes, the percentiles and the frame time histogram are written to benchmark_<app_id>.json, the per frame samples to
+ * benchmark_<app_id>.csv, and a line is added to benchmark_summary.csv, so that a batch run produces a report for every sample.
+ * Reports can be compared with scripts/compare_benchmarks.py.
+ *
+ * Usage: vulkan_samples sample afbc --benchmark --benchmark-warmup 100 --benchmark-frames 1000
+ *        vulkan_samples batch --category performance --duration 20 --benchmark --benchmark-duration 10 --benchmark-output results
  *
  */
 class BenchmarkMode : public BenchmarkModeTags
@@ -44,11 +57,65 @@ class BenchmarkMode : public BenchmarkModeTags
 	virtual void on_update(float delta_time) override;
 	virtual void on_app_start(const std::string &app_info) override;
 	virtual void on_app_close(const std::string &app_info) override;
+	virtual void on_post_draw(vkb::rendering::RenderContextC &context) override;
 
 	bool handle_option(std::deque<std::string> &arguments) override;
 
   private:
+	/// Times of a recorded frame in milliseconds, negative when not measured
+	struct FrameSample
+	{
+		float frame_time{-1.0f};
+
+		float cpu_time{-1.0f};
+
+		float gpu_time{-1.0f};
+	};
+
+	/**
+	 * @brief Picks up the GPU times of the frames read back by the GPU profiler since the last call
+	 */
+	void collect_gpu_times();
+
+	/**
+	 * @brief Logs the statistics of the recorded frames and writes the reports
+	 */
+	void write_report();
+
+	std::string get_output_path(const std::string &file) const;
+
+	uint32_t warmup_frames = 0;
+
+	uint32_t warmup_remaining = 0;
+
+	/// Number of frames to record, or 0 to record until the application closes
+	uint32_t frame_limit = 0;
+
+	/// Duration to record in seconds, or 0 to record until the application closes
+	float duration_limit = 0.0f;
+
+	/// Directory the reports are written to, the logs directory if empty
+	std::string output_directory;
+
+	std::string app_id;
+
+	bool recording = false;
+
+	bool summary_started = false;
+
 	float    elapsed_time = 0.0f;
 	uint32_t total_frames = 0;
+
+	std::vector<FrameSample> samples;
+
+	/// Index of the sample being recorded, or ~0 during warmup
+	size_t current_sample = ~size_t{0};
+
+	/// Recorded samples whose GPU times have not been read back yet, per GPU profiler frame number
+	std::unordered_map<uint64_t, size_t> pending_gpu_samples;
+
+	uint64_t last_gpu_frame = ~0ull;
+
+	vkb::Timer cpu_timer;
 };
-}        // namespace plugins
\ No newline at end of file
+}        // namespace plugins
@@ -0,0 +1,145 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frame_pacing.h"
+
+#include "platform/platform.h"
+#include "vulkan_sample.h"
+
+namespace plugins
+{
+namespace
+{
+template <typename RenderContextType>
+void configure(RenderContextType &render_context, uint32_t max_frames_in_flight, vkb::LatencyMode latency_mode, int timeline_synchronization)
+{
+	render_context.get_frame_pacer().set_max_frames_in_flight(max_frames_in_flight);
+	render_context.get_frame_pacer().set_latency_mode(latency_mode);
+
+	if (timeline_synchronization >= 0)
+	{
+		render_context.set_timeline_synchronization(timeline_synchronization != 0);
+	}
+
+	LOGI("Frames are synchronized with {}", render_context.uses_timeline_synchronization() ? "timeline semaphores" : "fences");
+}
+}        // namespace
+
+FramePacing::FramePacing() :
+    FramePacingTags("Frame Pacing",
+                    "Control the frames in flight, the latency and the synchronization of the render context.",
+                    {vkb::Hook::OnAppStart},
+                    {},
+                    {{"max-frames-in-flight", "Maximum number of frames the CPU can submit ahead of the GPU"},
+                     {"latency-mode", "Either throughput or just-in-time, to start frames as late as possible"},
+                     {"frame-sync", "Either fences or timeline, to track the submissions of frames with fences or timeline semaphores"}})
+{
+}
+
+bool FramePacing::handle_option(std::deque<std::string> &arguments)
+{
+	assert(!arguments.empty() && (arguments[0].substr(0, 2) == "--"));
+	std::string option = arguments[0].substr(2);
+	if (option == "max-frames-in-flight")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"max-frames-in-flight\" is missing the number of frames!");
+			return false;
+		}
+		max_frames_in_flight = static_cast<uint32_t>(std::stoul(arguments[1]));
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "latency-mode")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"latency-mode\" is missing the actual mode!");
+			return false;
+		}
+		if (arguments[1] == "throughput")
+		{
+			latency_mode = vkb::LatencyMode::Throughput;
+		}
+		else if (arguments[1] == "just-in-time")
+		{
+			latency_mode = vkb::LatencyMode::JustInTime;
+
+			// Frames are paced on their presentation when the device can wait for it
+			auto features         = vkb::Application::get_framework_features();
+			features.present_wait = true;
+			vkb::Application::set_framework_features(features);
+		}
+		else
+		{
+			LOGE("Option \"latency-mode\" must be either throughput or just-in-time, not \"{}\"!", arguments[1]);
+			return false;
+		}
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "frame-sync")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"frame-sync\" is missing the synchronization to use!");
+			return false;
+		}
+		if (arguments[1] == "fences")
+		{
+			timeline_synchronization = 0;
+		}
+		else if (arguments[1] == "timeline")
+		{
+			timeline_synchronization = 1;
+
+			auto features               = vkb::Application::get_framework_features();
+			features.timeline_semaphore = true;
+			vkb::Application::set_framework_features(features);
+		}
+		else
+		{
+			LOGE("Option \"frame-sync\" must be either fences or timeline, not \"{}\"!", arguments[1]);
+			return false;
+		}
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	return false;
+}
+
+void FramePacing::on_app_start(const std::string &app_id)
+{
+	auto &app = platform->get_app();
+
+	if (auto *sample = dynamic_cast<vkb::VulkanSampleCpp *>(&app); sample && sample->has_render_context())
+	{
+		configure(sample->get_render_context(), max_frames_in_flight, latency_mode, timeline_synchronization);
+	}
+	else if (auto *sample = dynamic_cast<vkb::VulkanSampleC *>(&app); sample && sample->has_render_context())
+	{
+		configure(sample->get_render_context(), max_frames_in_flight, latency_mode, timeline_synchronization);
+	}
+}
+}        // namespace plugins
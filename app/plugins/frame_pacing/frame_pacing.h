@@ -0,0 +1,69 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "platform/plugins/plugin_base.h"
+#include "rendering/frame_pacer.h"
+
+namespace plugins
+{
+class FramePacing;
+
+using FramePacingTags = vkb::PluginBase<FramePacing, vkb::tags::Passive>;
+
+/**
+ * @brief Frame Pacing
+ *
+ * Configures the frame pacer of the render context of every app that is started.
+ *
+ * The number of frames in flight can be lowered below the number of swapchain images, to reduce the
+ * latency of a frame at the expense of GPU utilization. The just-in-time latency mode only starts a
+ * frame once the previous one has been presented, and delays it so that it is ready just in time for
+ * the next presentation when VK_KHR_present_wait is supported.
+ *
+ * The submissions of the frames are tracked with fences, or with a timeline semaphore per queue when requested and
+ * VK_KHR_timeline_semaphore is supported, to compare the CPU time spent on synchronization. VK_KHR_present_wait and
+ * VK_KHR_timeline_semaphore are only enabled by the options using them.
+ *
+ * The resulting latency and synchronization time can be shown with the frame latency and sync stats.
+ *
+ * Usage: vulkan_sample sample afbc --max-frames-in-flight 1
+ *        vulkan_sample sample afbc --latency-mode just-in-time
+ *        vulkan_sample sample afbc --frame-sync timeline
+ *
+ */
+class FramePacing : public FramePacingTags
+{
+  public:
+	FramePacing();
+
+	virtual ~FramePacing() = default;
+
+	bool handle_option(std::deque<std::string> &arguments) override;
+
+	void on_app_start(const std::string &app_id) override;
+
+  private:
+	uint32_t max_frames_in_flight{0};
+
+	vkb::LatencyMode latency_mode{vkb::LatencyMode::Throughput};
+
+	/// 1 for timeline semaphores, 0 for fences, -1 to keep the default of the render context
+	int timeline_synchronization{-1};
+};
+}        // namespace plugins
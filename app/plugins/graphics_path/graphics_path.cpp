@@ -0,0 +1,221 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graphics_path.h"
+
+#include <algorithm>
+
+#include "platform/platform.h"
+#include "vulkan_sample.h"
+
+namespace plugins
+{
+namespace
+{
+/**
+ * @brief Lets the resource cache of a sample use shader objects
+ * @return False if the sample has no device, or VK_EXT_shader_object or VK_KHR_dynamic_rendering is not enabled
+ */
+template <typename Sample>
+bool enable_shader_objects(Sample &sample)
+{
+	if (!sample.has_device() || !sample.get_device().is_enabled(VK_EXT_SHADER_OBJECT_EXTENSION_NAME) ||
+	    !sample.get_device().is_enabled(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+	{
+		return false;
+	}
+
+	sample.get_device().get_resource_cache().set_shader_objects(true);
+	return true;
+}
+
+/**
+ * @return Whether the resource cache of a sample links its graphics pipelines from pipeline libraries
+ */
+template <typename Sample>
+bool uses_pipeline_libraries(Sample &sample)
+{
+	return sample.has_device() && sample.get_device().is_enabled(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+}
+
+/**
+ * @brief Logs the number of graphics pipelines or shader objects the resource cache of a sample created
+ */
+template <typename Sample>
+void log_created_objects(Sample &sample, bool shader_objects)
+{
+	if (!sample.has_device())
+	{
+		return;
+	}
+
+	auto &resource_cache = sample.get_device().get_resource_cache();
+	if (shader_objects)
+	{
+		LOGI("    {} shader objects created", resource_cache.get_shader_object_count());
+	}
+	else
+	{
+		LOGI("    {} graphics pipelines created", resource_cache.get_internal_state().graphics_pipelines.size());
+	}
+}
+}        // namespace
+
+GraphicsPath::GraphicsPath() :
+    GraphicsPathTags("Graphics Path",
+                     "Bind shaders with pipelines or shader objects, and measure the recording time of both.",
+                     {vkb::Hook::OnUpdate, vkb::Hook::OnAppStart, vkb::Hook::OnAppClose, vkb::Hook::PostDraw},
+                     {},
+                     {{"graphics-path", "How shaders are bound: pipelines (default), pipeline-libraries or shader-objects"}})
+{
+}
+
+bool GraphicsPath::handle_option(std::deque<std::string> &arguments)
+{
+	assert(!arguments.empty() && (arguments[0].substr(0, 2) == "--"));
+	std::string option = arguments[0].substr(2);
+	if (option == "graphics-path")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"graphics-path\" is missing the path to use!");
+			return false;
+		}
+
+		// The extensions of the other paths are only enabled when they are selected
+		auto features = vkb::Application::get_framework_features();
+
+		const std::string &path = arguments[1];
+		if (path == "pipelines")
+		{
+			use_shader_objects = false;
+		}
+		else if (path == "pipeline-libraries")
+		{
+			use_shader_objects                 = false;
+			features.graphics_pipeline_library = true;
+		}
+		else if (path == "shader-objects")
+		{
+			use_shader_objects     = true;
+			features.shader_object = true;
+		}
+		else
+		{
+			LOGE("Option \"graphics-path\" has an unknown path: {}", path);
+			return false;
+		}
+		vkb::Application::set_framework_features(features);
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	return false;
+}
+
+void GraphicsPath::on_update(float delta_time)
+{
+	frame_timer.start();
+}
+
+void GraphicsPath::on_app_start(const std::string &app_id)
+{
+	frame_count      = 0;
+	first_frame_time = 0.0;
+	total_frame_time = 0.0;
+	max_frame_time   = 0.0;
+
+	shader_objects_enabled     = false;
+	pipeline_libraries_enabled = false;
+
+	auto &app = platform->get_app();
+
+	if (auto *sample = dynamic_cast<vkb::VulkanSampleCpp *>(&app))
+	{
+		pipeline_libraries_enabled = uses_pipeline_libraries(*sample);
+	}
+	else if (auto *sample = dynamic_cast<vkb::VulkanSampleC *>(&app))
+	{
+		pipeline_libraries_enabled = uses_pipeline_libraries(*sample);
+	}
+
+	if (use_shader_objects)
+	{
+		if (auto *sample = dynamic_cast<vkb::VulkanSampleCpp *>(&app))
+		{
+			shader_objects_enabled = enable_shader_objects(*sample);
+		}
+		else if (auto *sample = dynamic_cast<vkb::VulkanSampleC *>(&app))
+		{
+			shader_objects_enabled = enable_shader_objects(*sample);
+		}
+
+		if (!shader_objects_enabled)
+		{
+			LOGW("Shader objects are not supported by {}, it binds pipelines instead", app_id);
+		}
+	}
+}
+
+void GraphicsPath::on_app_close(const std::string &app_id)
+{
+	if (frame_count == 0)
+	{
+		return;
+	}
+
+	LOGI("Graphics path of {}: {}", app_id, shader_objects_enabled ? "shader objects" : pipeline_libraries_enabled ? "pipelines linked from libraries" : "pipelines");
+	LOGI("    First frame: {:.3f} ms", first_frame_time);
+	if (frame_count > 1)
+	{
+		LOGI("    Next {} frames: {:.3f} ms mean, {:.3f} ms max", frame_count - 1, total_frame_time / (frame_count - 1), max_frame_time);
+	}
+
+	auto &app = platform->get_app();
+	if (auto *sample = dynamic_cast<vkb::VulkanSampleCpp *>(&app))
+	{
+		log_created_objects(*sample, shader_objects_enabled);
+	}
+	else if (auto *sample = dynamic_cast<vkb::VulkanSampleC *>(&app))
+	{
+		log_created_objects(*sample, shader_objects_enabled);
+	}
+}
+
+void GraphicsPath::on_post_draw(vkb::rendering::RenderContextC &context)
+{
+	if (!frame_timer.is_running())
+	{
+		return;
+	}
+
+	double frame_time = frame_timer.stop<vkb::Timer::Milliseconds>();
+
+	if (frame_count == 0)
+	{
+		first_frame_time = frame_time;
+	}
+	else
+	{
+		total_frame_time += frame_time;
+		max_frame_time = std::max(max_frame_time, frame_time);
+	}
+
+	frame_count++;
+}
+}        // namespace plugins
@@ -0,0 +1,82 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "platform/plugins/plugin_base.h"
+#include "timer.h"
+
+namespace plugins
+{
+class GraphicsPath;
+
+using GraphicsPathTags = vkb::PluginBase<GraphicsPath, vkb::tags::Passive>;
+
+/**
+ * @brief Graphics Path
+ *
+ * Selects how the command buffers of a sample bind their shaders: with pipelines created from the whole
+ * pipeline state, with pipelines linked from cached pipeline libraries (VK_EXT_graphics_pipeline_library),
+ * or with shader objects (VK_EXT_shader_object) and dynamic state commands, which skip the pipeline hashing
+ * and creation. The extensions are only enabled when their path is selected.
+ *
+ * The CPU time of every frame is measured from the update to the end of the draw, which includes
+ * recording and the creation of the pipelines or shader objects. The time of the first frame, where most
+ * of them are created, and the mean and maximum time of the following frames are logged when the app
+ * closes. Run it together with the benchmark mode plugin to compare the paths over the same frames.
+ *
+ * Usage: vulkan_sample sample afbc --benchmark --graphics-path shader-objects
+ *        vulkan_sample sample afbc --benchmark --graphics-path pipeline-libraries
+ *
+ */
+class GraphicsPath : public GraphicsPathTags
+{
+  public:
+	GraphicsPath();
+
+	virtual ~GraphicsPath() = default;
+
+	bool handle_option(std::deque<std::string> &arguments) override;
+
+	void on_update(float delta_time) override;
+
+	void on_app_start(const std::string &app_id) override;
+
+	void on_app_close(const std::string &app_id) override;
+
+	void on_post_draw(vkb::rendering::RenderContextC &context) override;
+
+  private:
+	bool use_shader_objects{false};
+
+	/// Whether the shader objects could be enabled for the current app
+	bool shader_objects_enabled{false};
+
+	/// Whether the current app links its pipelines from pipeline libraries
+	bool pipeline_libraries_enabled{false};
+
+	vkb::Timer frame_timer;
+
+	uint32_t frame_count{0};
+
+	double first_frame_time{0.0};
+
+	double total_frame_time{0.0};
+
+	double max_frame_time{0.0};
+};
+}        // namespace plugins
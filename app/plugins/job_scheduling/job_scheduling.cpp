@@ -0,0 +1,210 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "job_scheduling.h"
+
+#include <cmath>
+
+#include "job_system.h"
+#include "platform/platform.h"
+#include "timer.h"
+#include "vulkan_sample.h"
+
+namespace plugins
+{
+namespace
+{
+constexpr uint32_t frame_count      = 20;
+constexpr uint32_t stage_count      = 8;
+constexpr uint32_t jobs_per_stage   = 64;
+constexpr uint32_t loop_size        = 4096;
+constexpr uint32_t work_per_job     = 2000;
+constexpr uint32_t work_per_element = 200;
+
+/// Spends CPU time like a small job of a frame, such as transforming a few vertices
+float busy_work(uint32_t seed, uint32_t iterations)
+{
+	float value = static_cast<float>(seed);
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		value = std::sin(value) * 0.5f + 1.0f;
+	}
+	return value;
+}
+
+/**
+ * @brief Runs frames made of a task graph, where every job depends on two jobs of the previous stage, and of a parallel loop
+ * @return The time spent in milliseconds
+ */
+double run_workload(vkb::JobSystem &job_system)
+{
+	std::vector<float> graph_results(jobs_per_stage);
+	std::vector<float> loop_results(loop_size);
+
+	vkb::Timer timer;
+	timer.start();
+
+	for (uint32_t frame = 0; frame < frame_count; frame++)
+	{
+		std::vector<vkb::JobHandle> previous_stage;
+		for (uint32_t stage = 0; stage < stage_count; stage++)
+		{
+			std::vector<vkb::JobHandle> current_stage;
+			current_stage.reserve(jobs_per_stage);
+
+			for (uint32_t job = 0; job < jobs_per_stage; job++)
+			{
+				std::vector<vkb::JobHandle> dependencies;
+				if (!previous_stage.empty())
+				{
+					dependencies = {previous_stage[job], previous_stage[(job + 1) % jobs_per_stage]};
+				}
+
+				current_stage.push_back(job_system.schedule(
+				    [&graph_results, job]() { graph_results[job] += busy_work(job, work_per_job); },
+				    vkb::JobPriority::FrameCritical,
+				    dependencies));
+			}
+
+			previous_stage = std::move(current_stage);
+		}
+		job_system.wait(previous_stage);
+
+		job_system.parallel_for(loop_size, [&loop_results](uint32_t begin, uint32_t end) {
+			for (uint32_t i = begin; i < end; i++)
+			{
+				loop_results[i] = busy_work(i, work_per_element);
+			}
+		});
+	}
+
+	return timer.stop<vkb::Timer::Milliseconds>();
+}
+
+void measure_scaling(uint32_t max_worker_count)
+{
+	LOGI("Job system scaling, {} frames of {} graph jobs and a parallel loop of {} elements:", frame_count, stage_count * jobs_per_stage, loop_size);
+
+	double baseline = 0.0;
+	for (uint32_t worker_count = 1; worker_count <= max_worker_count; worker_count++)
+	{
+		vkb::JobSystem job_system{worker_count};
+
+		// Warm up the workers and the caches
+		run_workload(job_system);
+		double time = run_workload(job_system);
+
+		if (worker_count == 1)
+		{
+			baseline = time;
+		}
+
+		// The thread waiting for the jobs runs some of them as well
+		double speedup = baseline / time;
+		LOGI("    {:>2} workers: {:8.2f} ms, {:5.2f}x speedup, {:5.1f}% efficiency", worker_count, time, speedup, 100.0 * speedup * 2.0 / (worker_count + 1));
+	}
+}
+}        // namespace
+
+JobScheduling::JobScheduling() :
+    JobSchedulingTags("Job Scheduling",
+                      "Configure the job system shared by the framework, and measure how it scales.",
+                      {vkb::Hook::OnAppStart},
+                      {},
+                      {{"job-threads", "Number of worker threads of the job system, 0 for one per additional hardware thread"},
+                       {"job-scaling", "Measure the scaling of the job system from 1 to the given number of worker threads"},
+                       {"record-threads", "Number of threads recording the scene subpasses in secondary command buffers"}})
+{
+}
+
+bool JobScheduling::handle_option(std::deque<std::string> &arguments)
+{
+	assert(!arguments.empty() && (arguments[0].substr(0, 2) == "--"));
+	std::string option = arguments[0].substr(2);
+	if (option == "job-threads")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"job-threads\" is missing the number of threads!");
+			return false;
+		}
+		vkb::JobSystem::set_default_worker_count(static_cast<uint32_t>(std::stoul(arguments[1])));
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "job-scaling")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"job-scaling\" is missing the maximum number of threads!");
+			return false;
+		}
+		scaling_worker_count = static_cast<uint32_t>(std::stoul(arguments[1]));
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	else if (option == "record-threads")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"record-threads\" is missing the number of threads!");
+			return false;
+		}
+		record_thread_count = static_cast<uint32_t>(std::stoul(arguments[1]));
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
+	return false;
+}
+
+void JobScheduling::on_app_start(const std::string &app_id)
+{
+	LOGI("Job system of {} is running {} worker threads", app_id, platform->get_job_system().get_worker_count());
+
+	if (scaling_worker_count > 0)
+	{
+		measure_scaling(scaling_worker_count);
+
+		// Only measured once, when the first app starts
+		scaling_worker_count = 0;
+	}
+
+	if (record_thread_count > 0)
+	{
+		auto &app = platform->get_app();
+
+		if (auto *sample = dynamic_cast<vkb::VulkanSampleCpp *>(&app); sample && sample->has_render_pipeline())
+		{
+			sample->get_render_pipeline().set_thread_count(record_thread_count);
+		}
+		else if (auto *sample = dynamic_cast<vkb::VulkanSampleC *>(&app); sample && sample->has_render_pipeline())
+		{
+			sample->get_render_pipeline().set_thread_count(record_thread_count);
+		}
+		else
+		{
+			LOGW("{} does not render with a render pipeline, its command buffers are recorded on a single thread", app_id);
+		}
+	}
+}
+}        // namespace plugins
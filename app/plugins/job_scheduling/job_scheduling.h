@@ -0,0 +1,65 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "platform/plugins/plugin_base.h"
+
+namespace plugins
+{
+class JobScheduling;
+
+using JobSchedulingTags = vkb::PluginBase<JobScheduling, vkb::tags::Passive>;
+
+/**
+ * @brief Job Scheduling
+ *
+ * Configures the job system shared by the framework, which loads assets, records command buffers and
+ * samples counters. By default it has a worker thread per hardware thread besides the main one.
+ *
+ * The scaling of the job system can be measured with a synthetic workload, a task graph and a parallel
+ * loop similar to the work of a frame, run on job systems with 1 up to the given number of workers.
+ * The results are logged when the app starts.
+ *
+ * The scene subpasses of the render pipeline of a sample can be recorded in secondary command buffers by
+ * several threads, to compare the CPU frame time against the number of recording threads together with
+ * the benchmark mode plugin.
+ *
+ * Usage: vulkan_sample sample afbc --job-threads 2
+ *        vulkan_sample sample afbc --job-scaling 8
+ *        vulkan_sample sample afbc --benchmark --record-threads 4
+ *
+ */
+class JobScheduling : public JobSchedulingTags
+{
+  public:
+	JobScheduling();
+
+	virtual ~JobScheduling() = default;
+
+	bool handle_option(std::deque<std::string> &arguments) override;
+
+	void on_app_start(const std::string &app_id) override;
+
+  private:
+	/// Maximum number of workers the scaling is measured up to, 0 to not measure it
+	uint32_t scaling_worker_count{0};
+
+	/// Number of threads recording the scene subpasses, 0 to keep the setting of the sample
+	uint32_t record_thread_count{0};
+};
+}        // namespace plugins
@@ -28,9 +28,11 @@ namespace plugins
 Screenshot::Screenshot() :
     ScreenshotTags("Screenshot",
                    "Save a screenshot of a specific frame",
-                   {vkb::Hook::OnUpdate, vkb::Hook::OnAppStart, vkb::Hook::PostDraw},
+                   {vkb::Hook::OnUpdate, vkb::Hook::OnAppStart, vkb::Hook::OnAppClose, vkb::Hook::PostDraw},
                    {},
-                   {{"screenshot", "Take a screenshot at a given frame"}, {"screenshot-output", "Declare an output name for the image"}})
+                   {{"screenshot", "Take a screenshot at a given frame"},
+                    {"screenshot-every", "Take a screenshot every given number of frames"},
+                    {"screenshot-output", "Declare an output name for the image"}})
 {
 }
 
@@ -51,6 +53,19 @@ bool Screenshot::handle_option(std::deque<std::string> &arguments)
 		arguments.pop_front();
 		return true;
 	}
+	else if (option == "screenshot-every")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"screenshot-every\" is missing the number of frames between screenshots!");
+			return false;
+		}
+		frame_interval = static_cast<uint32_t>(std::stoul(arguments[1]));
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
 	else if (option == "screenshot-output")
 	{
 		if (arguments.size() < 2)
@@ -79,27 +94,55 @@ void Screenshot::on_app_start(const std::string &name)
 	current_frame    = 0;
 }
 
-void Screenshot::on_post_draw(vkb::RenderContext &context)
+void Screenshot::on_app_close(const std::string &app_info)
 {
-	if (current_frame == frame_number)
-	{
-		if (!output_path_set)
-		{
-			// Create generic image path. <app name>-<current timestamp>.png
-			auto        timestamp = std::chrono::system_clock::now();
-			std::time_t now_tt    = std::chrono::system_clock::to_time_t(timestamp);
-			std::tm     tm        = *std::localtime(&now_tt);
+	// Waits for the remaining captures to be written, while the device is still alive
+	capture.reset();
+}
 
-			char buffer[30];
-			strftime(buffer, sizeof(buffer), "%G-%m-%d---%H-%M-%S", &tm);
+void Screenshot::on_post_draw(vkb::rendering::RenderContextC &context)
+{
+	bool single_capture   = frame_number && current_frame == *frame_number;
+	bool interval_capture = frame_interval > 0 && current_frame > 0 && current_frame % frame_interval == 0;
 
-			std::stringstream stream;
-			stream << current_app_name << "-" << buffer;
+	if (!capture && (single_capture || interval_capture))
+	{
+		capture = std::make_unique<vkb::ScreenshotCapture>(context);
+	}
 
-			output_path = stream.str();
-		}
+	if (capture)
+	{
+		capture->poll();
+	}
 
-		screenshot(context, output_path);
+	if (single_capture)
+	{
+		capture->capture(get_output_path());
 	}
+	else if (interval_capture)
+	{
+		capture->capture(get_output_path() + "-" + std::to_string(current_frame));
+	}
+}
+
+std::string Screenshot::get_output_path() const
+{
+	if (output_path_set)
+	{
+		return output_path;
+	}
+
+	// Create generic image path. <app name>-<current timestamp>.png
+	auto        timestamp = std::chrono::system_clock::now();
+	std::time_t now_tt    = std::chrono::system_clock::to_time_t(timestamp);
+	std::tm     tm        = *std::localtime(&now_tt);
+
+	char buffer[30];
+	strftime(buffer, sizeof(buffer), "%G-%m-%d---%H-%M-%S", &tm);
+
+	std::stringstream stream;
+	stream << current_app_name << "-" << buffer;
+
+	return stream.str();
 }
-}        // namespace plugins
\ No newline at end of file
+}        // namespace plugins
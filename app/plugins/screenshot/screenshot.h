@@ -18,8 +18,11 @@
 
 #pragma once
 
+#include <optional>
+
 #include "filesystem/legacy.h"
 #include "platform/plugins/plugin_base.h"
+#include "rendering/screenshot_capture.h"
 
 namespace plugins
 {
@@ -30,9 +33,11 @@ using ScreenshotTags = vkb::PluginBase<Screenshot, vkb::tags::Passive>;
 /**
  * @brief Screenshot
  *
- * Capture a screen shot of the last rendered image at a given frame. The output can also be named
+ * Capture a screen shot of the last rendered image at a given frame, or every Nth frame. The output can also be named
+ * Captures are read back and written to disk in the background, so capturing often does not stall the frame loop
  *
  * Usage: vulkan_sample sample afbc --screenshot 1 --screenshot-output afbc-screenshot
+ *        vulkan_sample sample afbc --screenshot-every 60 --screenshot-output afbc-screenshot
  *
  */
 class Screenshot : public ScreenshotTags
@@ -44,16 +49,25 @@ class Screenshot : public ScreenshotTags
 
 	void on_update(float delta_time) override;
 	void on_app_start(const std::string &app_info) override;
-	void on_post_draw(vkb::RenderContext &context) override;
+	void on_app_close(const std::string &app_info) override;
+	void on_post_draw(vkb::rendering::RenderContextC &context) override;
 
 	bool handle_option(std::deque<std::string> &arguments) override;
 
   private:
-	uint32_t    current_frame = 0;
-	uint32_t    frame_number;
+	std::string get_output_path() const;
+
+	uint32_t current_frame = 0;
+
+	/// Frame of the single capture, only set with --screenshot
+	std::optional<uint32_t> frame_number;
+
+	uint32_t    frame_interval = 0;
 	std::string current_app_name;
 
 	bool        output_path_set = false;
 	std::string output_path;
+
+	std::unique_ptr<vkb::ScreenshotCapture> capture;
 };
 }        // namespace plugins
\ No newline at end of file
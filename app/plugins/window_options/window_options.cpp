@@ -34,6 +34,7 @@ WindowOptions::WindowOptions() :
                        {"fullscreen", "Run in fullscreen mode"},
                        {"headless-surface", "Run in headless surface mode. A Surface and swap-chain is still created using VK_EXT_headless_surface."},
                        {"height", "Initial window height"},
+                       {"offscreen", "Run without a surface or swap-chain, rendering to a ring of offscreen images that are never presented."},
                        {"stretch", "Stretch window to fullscreen (direct-to-display only)"},
                        {"vsync", "Force vsync {ON | OFF}. If not set samples decide how vsync is set"},
                        {"width", "Initial window width"}})
@@ -90,6 +91,14 @@ bool WindowOptions::handle_option(std::deque<std::string> &arguments)
 		arguments.pop_front();
 		return true;
 	}
+	else if (option == "offscreen")
+	{
+		properties.mode = vkb::Window::Mode::Offscreen;
+		platform->set_window_properties(properties);
+
+		arguments.pop_front();
+		return true;
+	}
 	else if (option == "stretch")
 	{
 		properties.mode = vkb::Window::Mode::FullscreenStretch;
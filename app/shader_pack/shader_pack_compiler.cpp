@@ -0,0 +1,147 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @brief Compiles the known variants of the framework shaders into a shader pack
+ *
+ * Run from the root of the repository, as the shaders are read from the shaders directory like at runtime.
+ *
+ * Usage: vkb_shader_pack <output file>
+ */
+
+#include <fstream>
+
+#include <filesystem/filesystem.hpp>
+
+#include "core/util/logging.hpp"
+#include "rendering/subpass.h"
+#include "rendering/subpasses/forward_subpass.h"
+#include "rendering/subpasses/lighting_subpass.h"
+#include "shader_pack.h"
+
+namespace
+{
+/**
+ * @brief The variants of a shader, made of all the combinations of its optional definitions
+ *
+ * Only the definitions the shader refers to need to be listed, see ShaderPack.
+ */
+struct ShaderVariants
+{
+	std::string filename;
+
+	VkShaderStageFlagBits stage;
+
+	/// Definitions of every variant
+	std::vector<std::string> definitions;
+
+	/// Definitions every combination of which is compiled
+	std::vector<std::string> optional_definitions;
+};
+
+std::vector<std::string> lighting_definitions(uint32_t max_light_count)
+{
+	std::vector<std::string> definitions{"MAX_LIGHT_COUNT " + std::to_string(max_light_count)};
+	definitions.insert(definitions.end(), vkb::rendering::light_type_definitions.begin(), vkb::rendering::light_type_definitions.end());
+	return definitions;
+}
+
+/**
+ * @brief The variants the framework requests: the sub mesh variants of the geometry subpasses, the lighting
+ *        definitions of the forward and lighting subpasses, and the default variant of the other shaders
+ */
+std::vector<ShaderVariants> get_framework_variants()
+{
+	return {
+	    {"base.vert", VK_SHADER_STAGE_VERTEX_BIT, {}, {}},
+	    {"base.frag", VK_SHADER_STAGE_FRAGMENT_BIT, lighting_definitions(MAX_FORWARD_LIGHT_COUNT), {"HAS_BASE_COLOR_TEXTURE", "CLUSTERED_LIGHTING", "TEXTURE_STREAMING"}},
+	    {"deferred/geometry.vert", VK_SHADER_STAGE_VERTEX_BIT, {}, {}},
+	    {"deferred/geometry.frag", VK_SHADER_STAGE_FRAGMENT_BIT, {}, {"HAS_BASE_COLOR_TEXTURE"}},
+	    {"deferred/lighting.vert", VK_SHADER_STAGE_VERTEX_BIT, lighting_definitions(MAX_DEFERRED_LIGHT_COUNT), {}},
+	    {"deferred/lighting.frag", VK_SHADER_STAGE_FRAGMENT_BIT, lighting_definitions(MAX_DEFERRED_LIGHT_COUNT), {"CLUSTERED_LIGHTING"}},
+	    {"light_culling.comp", VK_SHADER_STAGE_COMPUTE_BIT, {}, {}},
+	    {"imgui.vert", VK_SHADER_STAGE_VERTEX_BIT, {}, {}},
+	    {"imgui.frag", VK_SHADER_STAGE_FRAGMENT_BIT, {}, {}},
+	    {"postprocessing/postprocessing.vert", VK_SHADER_STAGE_VERTEX_BIT, {}, {}},
+	    {"postprocessing/chromatic_aberration.frag", VK_SHADER_STAGE_FRAGMENT_BIT, {}, {}},
+	    {"postprocessing/outline.frag", VK_SHADER_STAGE_FRAGMENT_BIT, {}, {}},
+	    {"postprocessing/outline_ms_depth.frag", VK_SHADER_STAGE_FRAGMENT_BIT, {}, {}},
+	};
+}
+}        // namespace
+
+int main(int argc, char *argv[])
+{
+	if (argc != 2)
+	{
+		LOGE("Usage: vkb_shader_pack <output file>");
+		return EXIT_FAILURE;
+	}
+
+	vkb::filesystem::init();
+
+	vkb::ShaderPack pack;
+
+	try
+	{
+		for (auto &shader : get_framework_variants())
+		{
+			vkb::ShaderSource source{shader.filename};
+
+			uint32_t combination_count = 1u << shader.optional_definitions.size();
+			for (uint32_t combination = 0; combination < combination_count; combination++)
+			{
+				vkb::ShaderVariant variant;
+				variant.add_definitions(shader.definitions);
+				for (size_t i = 0; i < shader.optional_definitions.size(); i++)
+				{
+					if (combination & (1u << i))
+					{
+						variant.add_define(shader.optional_definitions[i]);
+					}
+				}
+
+				std::vector<uint32_t>            spirv;
+				std::vector<vkb::ShaderResource> resources;
+				std::string                      info_log;
+
+				uint64_t key = vkb::ShaderModule::compile(shader.stage, source, "main", variant, spirv, resources, info_log);
+				pack.add(key, spirv, resources);
+			}
+
+			LOGI("Compiled {} variants of {}", combination_count, shader.filename);
+		}
+	}
+	catch (const std::exception &e)
+	{
+		LOGE("Cannot compile the shader pack: {}", e.what());
+		return EXIT_FAILURE;
+	}
+
+	auto data = pack.serialize();
+
+	std::ofstream file{argv[1], std::ios::binary | std::ios::trunc};
+	file.write(reinterpret_cast<const char *>(data.data()), data.size());
+	if (!file)
+	{
+		LOGE("Cannot write the shader pack to {}", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	LOGI("Wrote {} shader variants to {}", pack.get_entry_count(), argv[1]);
+	return EXIT_SUCCESS;
+}
@@ -117,6 +117,7 @@ set(VKB_WSI_SELECTION "XCB" CACHE STRING "Select WSI target (XCB, XLIB, WAYLAND,
 set(VKB_CLANG_TIDY OFF CACHE STRING "Use CMake Clang Tidy integration")
 set(VKB_CLANG_TIDY_EXTRAS "-header-filter=framework,samples,app;-checks=-*,google-*,-google-runtime-references;--fix;--fix-errors" CACHE STRING "Clang Tidy Parameters")
 set(VKB_PROFILING OFF CACHE BOOL "Enable Tracy profiling")
+set(VKB_SHADER_PACK ON CACHE BOOL "Precompile the variants of the framework shaders into a shader pack at build time.")
 
 set(CMAKE_RUNTIME_OUTPUT_DIRECTORY "bin/${CMAKE_BUILD_TYPE}/${TARGET_ARCH}")
 set(CMAKE_LIBRARY_OUTPUT_DIRECTORY "lib/${CMAKE_BUILD_TYPE}/${TARGET_ARCH}")
@@ -144,3 +145,11 @@ if (ANDROID AND VKB_PROFILING)
 endif()
 
 set(TRACY_ENABLE ${VKB_PROFILING})
+
+if (CMAKE_CROSSCOMPILING AND VKB_SHADER_PACK)
+    message(STATUS "The shader pack is not built when cross compiling, as its compiler runs on the host")
+    set(VKB_SHADER_PACK OFF)
+endif()
+
+# Written to the build directory, where the framework looks it up before the shaders directory
+set(VKB_SHADER_PACK_FILE ${CMAKE_BINARY_DIR}/shaders/framework.spvpack)
@@ -21,6 +21,7 @@
 #include "core/device.h"
 #include "core/swapchain.h"
 #include "gltf_loader.h"
+#include "memory_budget_tracker.h"
 #include "scene_graph/components/image.h"
 #include "scene_graph/components/sampler.h"
 #include "scene_graph/components/sub_mesh.h"
@@ -55,6 +56,13 @@ bool ApiVulkanSample::prepare(const vkb::ApplicationOptions &options)
 	submit_info.signalSemaphoreCount = 1;
 	submit_info.pSignalSemaphores    = &semaphores.render_complete;
 
+	// Rendering offscreen, there is no image to acquire nor to present, so submissions neither wait nor signal
+	if (!get_render_context().has_swapchain())
+	{
+		submit_info.waitSemaphoreCount   = 0;
+		submit_info.signalSemaphoreCount = 0;
+	}
+
 	queue = get_device().get_suitable_graphics_queue().get_handle();
 
 	create_swapchain_buffers();
@@ -493,7 +501,9 @@ void ApiVulkanSample::update_overlay(float delta_time, const std::function<void(
 
 		get_gui().update(delta_time);
 
-		if (get_gui().update_buffers() || get_gui().get_drawer().is_dirty())
+		// The geometry is uploaded by prepare_frame, once the image of the frame is known, which also records the command
+		// buffers again when the Gui draws differently. Settings changed through the drawer may affect the sample itself.
+		if (get_gui().get_drawer().is_dirty())
 		{
 			rebuild_command_buffers();
 			get_gui().get_drawer().clear();
@@ -510,12 +520,26 @@ void ApiVulkanSample::draw_ui(const VkCommandBuffer command_buffer)
 		vkCmdSetViewport(command_buffer, 0, 1, &viewport);
 		vkCmdSetScissor(command_buffer, 0, 1, &scissor);
 
-		get_gui().draw(command_buffer);
+		get_gui().draw(command_buffer, get_frame_index(command_buffer));
 	}
 }
 
+uint32_t ApiVulkanSample::get_frame_index(const VkCommandBuffer command_buffer) const
+{
+	// Command buffers recorded ahead are submitted in the frame of the image they render to
+	auto it = std::find(draw_cmd_buffers.begin(), draw_cmd_buffers.end(), command_buffer);
+	if (it != draw_cmd_buffers.end())
+	{
+		return static_cast<uint32_t>(std::distance(draw_cmd_buffers.begin(), it));
+	}
+	return get_render_context().get_active_frame_index();
+}
+
 void ApiVulkanSample::prepare_frame()
 {
+	// The frames of the render context are not used, so the heap budgets are polled here
+	vkb::MemoryBudgetTracker::get().update();
+
 	if (get_render_context().has_swapchain())
 	{
 		handle_surface_changes();
@@ -533,6 +557,21 @@ void ApiVulkanSample::prepare_frame()
 			VK_CHECK(result);
 		}
 	}
+	else
+	{
+		// Use the offscreen images in turn
+		current_buffer = (current_buffer + 1) % static_cast<uint32_t>(swapchain_buffers.size());
+	}
+
+	// Readers of the last rendered frame, like screenshots, then see the image rendered to
+	get_render_context().set_active_frame_index(current_buffer);
+
+	// The command buffer of the image draws the Gui with the buffers of its frame, and is recorded again whenever the
+	// Gui draws differently, e.g. a window is collapsed or text is edited, or its buffers are reallocated
+	if (has_gui() && get_gui().update_buffers())
+	{
+		rebuild_command_buffers();
+	}
 }
 
 void ApiVulkanSample::submit_frame()
@@ -585,7 +624,8 @@ void ApiVulkanSample::submit_frame()
 	// DO NOT USE
 	// vkDeviceWaitIdle and vkQueueWaitIdle are extremely expensive functions, and are used here purely for demonstrating the vulkan API
 	// without having to concern ourselves with proper syncronization. These functions should NEVER be used inside the render loop like this (every frame).
-	VK_CHECK(get_device().get_queue_by_present(0).wait_idle());
+	const auto &wait_queue = get_render_context().has_swapchain() ? get_device().get_queue_by_present(0) : get_device().get_suitable_graphics_queue();
+	VK_CHECK(wait_queue.wait_idle());
 }
 
 ApiVulkanSample::~ApiVulkanSample()
@@ -609,9 +649,13 @@ ApiVulkanSample::~ApiVulkanSample()
 			vkDestroyFramebuffer(get_device().get_handle(), framebuffers[i], nullptr);
 		}
 
-		for (auto &swapchain_buffer : swapchain_buffers)
+		// Offscreen image views belong to the render targets
+		if (has_render_context() && get_render_context().has_swapchain())
 		{
-			vkDestroyImageView(get_device().get_handle(), swapchain_buffer.view, nullptr);
+			for (auto &swapchain_buffer : swapchain_buffers)
+			{
+				vkDestroyImageView(get_device().get_handle(), swapchain_buffer.view, nullptr);
+			}
 		}
 
 		for (auto &shader_module : shader_modules)
@@ -757,7 +801,7 @@ void ApiVulkanSample::setup_render_pass()
 	attachments[0].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 	attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 	attachments[0].initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
-	attachments[0].finalLayout    = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	attachments[0].finalLayout    = get_render_context().get_final_layout();
 	// Depth attachment
 	attachments[1].format         = depth_format;
 	attachments[1].samples        = VK_SAMPLE_COUNT_1_BIT;
@@ -830,7 +874,7 @@ void ApiVulkanSample::update_render_pass_flags(uint32_t flags)
 	if (flags & RenderPassCreateFlags::ColorAttachmentLoad)
 	{
 		color_attachment_load_op      = VK_ATTACHMENT_LOAD_OP_LOAD;
-		color_attachment_image_layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+		color_attachment_image_layout = get_render_context().get_final_layout();
 	}
 
 	std::array<VkAttachmentDescription, 2> attachments = {};
@@ -842,7 +886,7 @@ void ApiVulkanSample::update_render_pass_flags(uint32_t flags)
 	attachments[0].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 	attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 	attachments[0].initialLayout  = color_attachment_image_layout;
-	attachments[0].finalLayout    = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	attachments[0].finalLayout    = get_render_context().get_final_layout();
 	// Depth attachment
 	attachments[1].format         = depth_format;
 	attachments[1].samples        = VK_SAMPLE_COUNT_1_BIT;
@@ -1031,12 +1075,6 @@ Texture ApiVulkanSample::load_texture(const std::string &file, vkb::sg::Image::C
 	texture.image = vkb::sg::Image::load(file, file, content_type);
 	texture.image->create_vk_image(get_device());
 
-	const auto &queue = get_device().get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
-
-	VkCommandBuffer command_buffer = get_device().create_command_buffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
-
-	vkb::core::BufferC stage_buffer = vkb::core::BufferC::create_staging_buffer(get_device(), texture.image->get_data());
-
 	// Setup buffer copy regions for each mip level
 	std::vector<VkBufferImageCopy> bufferCopyRegions;
 
@@ -1063,31 +1101,7 @@ Texture ApiVulkanSample::load_texture(const std::string &file, vkb::sg::Image::C
 	subresource_range.levelCount              = vkb::to_u32(mipmaps.size());
 	subresource_range.layerCount              = 1;
 
-	// Image barrier for optimal image (target)
-	// Optimal image will be used as destination for the copy
-	vkb::image_layout_transition(command_buffer,
-	                             texture.image->get_vk_image().get_handle(),
-	                             VK_IMAGE_LAYOUT_UNDEFINED,
-	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	                             subresource_range);
-
-	// Copy mip levels from staging buffer
-	vkCmdCopyBufferToImage(
-	    command_buffer,
-	    stage_buffer.get_handle(),
-	    texture.image->get_vk_image().get_handle(),
-	    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	    static_cast<uint32_t>(bufferCopyRegions.size()),
-	    bufferCopyRegions.data());
-
-	// Change texture image layout to shader read after all mip levels have been copied
-	vkb::image_layout_transition(command_buffer,
-	                             texture.image->get_vk_image().get_handle(),
-	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-	                             subresource_range);
-
-	get_device().flush_command_buffer(command_buffer, queue.get_handle());
+	upload_texture(*texture.image, bufferCopyRegions, subresource_range);
 
 	// Calculate valid filter and mipmap modes
 	VkFilter            filter      = VK_FILTER_LINEAR;
@@ -1127,12 +1141,6 @@ Texture ApiVulkanSample::load_texture_array(const std::string &file, vkb::sg::Im
 	texture.image = vkb::sg::Image::load(file, file, content_type);
 	texture.image->create_vk_image(get_device(), VK_IMAGE_VIEW_TYPE_2D_ARRAY);
 
-	const auto &queue = get_device().get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
-
-	VkCommandBuffer command_buffer = get_device().create_command_buffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
-
-	vkb::core::BufferC stage_buffer = vkb::core::BufferC::create_staging_buffer(get_device(), texture.image->get_data());
-
 	// Setup buffer copy regions for each mip level
 	std::vector<VkBufferImageCopy> buffer_copy_regions;
 
@@ -1165,31 +1173,7 @@ Texture ApiVulkanSample::load_texture_array(const std::string &file, vkb::sg::Im
 	subresource_range.levelCount              = vkb::to_u32(mipmaps.size());
 	subresource_range.layerCount              = layers;
 
-	// Image barrier for optimal image (target)
-	// Optimal image will be used as destination for the copy
-	vkb::image_layout_transition(command_buffer,
-	                             texture.image->get_vk_image().get_handle(),
-	                             VK_IMAGE_LAYOUT_UNDEFINED,
-	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	                             subresource_range);
-
-	// Copy mip levels from staging buffer
-	vkCmdCopyBufferToImage(
-	    command_buffer,
-	    stage_buffer.get_handle(),
-	    texture.image->get_vk_image().get_handle(),
-	    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	    static_cast<uint32_t>(buffer_copy_regions.size()),
-	    buffer_copy_regions.data());
-
-	// Change texture image layout to shader read after all mip levels have been copied
-	vkb::image_layout_transition(command_buffer,
-	                             texture.image->get_vk_image().get_handle(),
-	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-	                             subresource_range);
-
-	get_device().flush_command_buffer(command_buffer, queue.get_handle());
+	upload_texture(*texture.image, buffer_copy_regions, subresource_range);
 
 	// Calculate valid filter and mipmap modes
 	VkFilter            filter      = VK_FILTER_LINEAR;
@@ -1226,12 +1210,6 @@ Texture ApiVulkanSample::load_texture_cubemap(const std::string &file, vkb::sg::
 	texture.image = vkb::sg::Image::load(file, file, content_type);
 	texture.image->create_vk_image(get_device(), VK_IMAGE_VIEW_TYPE_CUBE, VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT);
 
-	const auto &queue = get_device().get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
-
-	VkCommandBuffer command_buffer = get_device().create_command_buffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
-
-	vkb::core::BufferC stage_buffer = vkb::core::BufferC::create_staging_buffer(get_device(), texture.image->get_data());
-
 	// Setup buffer copy regions for each mip level
 	std::vector<VkBufferImageCopy> buffer_copy_regions;
 
@@ -1264,31 +1242,7 @@ Texture ApiVulkanSample::load_texture_cubemap(const std::string &file, vkb::sg::
 	subresource_range.levelCount              = vkb::to_u32(mipmaps.size());
 	subresource_range.layerCount              = layers;
 
-	// Image barrier for optimal image (target)
-	// Optimal image will be used as destination for the copy
-	vkb::image_layout_transition(command_buffer,
-	                             texture.image->get_vk_image().get_handle(),
-	                             VK_IMAGE_LAYOUT_UNDEFINED,
-	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	                             subresource_range);
-
-	// Copy mip levels from staging buffer
-	vkCmdCopyBufferToImage(
-	    command_buffer,
-	    stage_buffer.get_handle(),
-	    texture.image->get_vk_image().get_handle(),
-	    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	    static_cast<uint32_t>(buffer_copy_regions.size()),
-	    buffer_copy_regions.data());
-
-	// Change texture image layout to shader read after all mip levels have been copied
-	vkb::image_layout_transition(command_buffer,
-	                             texture.image->get_vk_image().get_handle(),
-	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-	                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-	                             subresource_range);
-
-	get_device().flush_command_buffer(command_buffer, queue.get_handle());
+	upload_texture(*texture.image, buffer_copy_regions, subresource_range);
 
 	// Calculate valid filter and mipmap modes
 	VkFilter            filter      = VK_FILTER_LINEAR;
@@ -1318,6 +1272,47 @@ Texture ApiVulkanSample::load_texture_cubemap(const std::string &file, vkb::sg::
 	return texture;
 }
 
+void ApiVulkanSample::upload_texture(vkb::sg::Image &image, const std::vector<VkBufferImageCopy> &buffer_copy_regions, const VkImageSubresourceRange &subresource_range)
+{
+	// Devices which can copy the image from host memory skip the staging buffer and the queue submission
+	if (image.copy_data_from_host())
+	{
+		return;
+	}
+
+	const auto &queue = get_device().get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
+
+	VkCommandBuffer command_buffer = get_device().create_command_buffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
+
+	vkb::core::BufferC stage_buffer = vkb::core::BufferC::create_staging_buffer(get_device(), image.get_data());
+
+	// Image barrier for optimal image (target)
+	// Optimal image will be used as destination for the copy
+	vkb::image_layout_transition(command_buffer,
+	                             image.get_vk_image().get_handle(),
+	                             VK_IMAGE_LAYOUT_UNDEFINED,
+	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+	                             subresource_range);
+
+	// Copy mip levels from staging buffer
+	vkCmdCopyBufferToImage(
+	    command_buffer,
+	    stage_buffer.get_handle(),
+	    image.get_vk_image().get_handle(),
+	    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+	    static_cast<uint32_t>(buffer_copy_regions.size()),
+	    buffer_copy_regions.data());
+
+	// Change texture image layout to shader read after all mip levels have been copied
+	vkb::image_layout_transition(command_buffer,
+	                             image.get_vk_image().get_handle(),
+	                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+	                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+	                             subresource_range);
+
+	get_device().flush_command_buffer(command_buffer, queue.get_handle());
+}
+
 std::unique_ptr<vkb::sg::SubMesh> ApiVulkanSample::load_model(const std::string &file, uint32_t index, bool storage_buffer, VkBufferUsageFlags additional_buffer_usage_flags)
 {
 	vkb::GLTFLoader loader{get_device()};
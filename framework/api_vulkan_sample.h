@@ -229,6 +229,15 @@ class ApiVulkanSample : public vkb::VulkanSampleC
 	 */
 	Texture load_texture_cubemap(const std::string &file, vkb::sg::Image::ContentType content_type);
 
+	/**
+	 * @brief Uploads the data of a texture image, copied from host memory if the device supports it for the image, or
+	 *        through a staging buffer otherwise, and leaves the image in shader read only layout
+	 * @param image The image to upload, with its Vulkan image created
+	 * @param buffer_copy_regions The regions of the data copied to every mip level and layer of the image
+	 * @param subresource_range The mip levels and layers of the image
+	 */
+	void upload_texture(vkb::sg::Image &image, const std::vector<VkBufferImageCopy> &buffer_copy_regions, const VkImageSubresourceRange &subresource_range);
+
 	/**
 	 * @brief Loads in a single model from a GLTF file
 	 * @param file The filename of the model to load
@@ -371,9 +380,17 @@ class ApiVulkanSample : public vkb::VulkanSampleC
 	 */
 	void draw_ui(const VkCommandBuffer command_buffer);
 
+	/**
+	 * @brief Finds the frame a command buffer is submitted in, which selects the Gui buffers it draws with
+	 * @param command_buffer A command buffer being recorded
+	 * @return The index of the command buffer in draw_cmd_buffers, or the active frame index for other command buffers
+	 */
+	uint32_t get_frame_index(const VkCommandBuffer command_buffer) const;
+
 	/**
 	 * @brief Prepare the frame for workload submission, acquires the next image from the swap chain and
 	 *        sets the default wait and signal semaphores
+	 *        The image becomes the active frame of the render context, and the Gui geometry is uploaded to its buffers
 	 */
 	void prepare_frame();
 
@@ -21,6 +21,10 @@
 #include "common/helpers.h"
 #include "core/buffer.h"
 #include "core/hpp_physical_device.h"
+#include "memory_budget_tracker.h"
+
+#include <deque>
+#include <map>
 
 namespace vkb
 {
@@ -176,7 +180,13 @@ class BufferBlock
 	bool can_allocate(DeviceSizeType size) const;
 
 	DeviceSizeType get_size() const;
-	void           reset();
+
+	/**
+	 * @return The number of bytes handed out since the last reset, including alignment padding
+	 */
+	DeviceSizeType get_used_size() const;
+
+	void reset();
 
   private:
 	/**
@@ -245,6 +255,12 @@ typename BufferBlock<bindingType>::DeviceSizeType BufferBlock<bindingType>::get_
 	return buffer.get_size();
 }
 
+template <vkb::BindingType bindingType>
+typename BufferBlock<bindingType>::DeviceSizeType BufferBlock<bindingType>::get_used_size() const
+{
+	return offset;
+}
+
 template <vkb::BindingType bindingType>
 void BufferBlock<bindingType>::reset()
 {
@@ -299,6 +315,14 @@ vk::DeviceSize BufferBlock<bindingType>::determine_alignment(vk::BufferUsageFlag
  *
  * We re-use descriptor sets: we only need one for the corresponding buffer infos (and we only
  * have one VkBuffer per BufferBlock), then it is bound and we use dynamic offsets.
+ *
+ * Blocks that have not been requested for release_window consecutive resets are destroyed, so a
+ * one-off spike does not pin its memory for the lifetime of the pool. reset() reports when that
+ * happens, as descriptor sets cached on the destroyed VkBuffers must then be dropped by the owner.
+ * The size of newly created blocks follows the high-water mark observed over the same window.
+ *
+ * Under memory pressure, see MemoryBudgetTracker, the blocks which were not requested since the previous reset are
+ * released right away, whatever the release window, and new blocks are not grown past the minimum block size.
  */
 template <vkb::BindingType bindingType>
 class BufferPool
@@ -309,70 +333,234 @@ class BufferPool
 
 	using DeviceType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDevice, vkb::Device>::type;
 
+	/**
+	 * @brief Default number of resets a block may stay unused before it is released
+	 */
+	static constexpr uint32_t DEFAULT_RELEASE_WINDOW = 120;
+
+	/**
+	 * @brief Upper bound for adaptively grown blocks, as a multiple of the minimum block size
+	 */
+	static constexpr uint32_t MAX_BLOCK_SIZE_MULTIPLIER = 16;
+
   public:
-	BufferPool(DeviceType &device, DeviceSizeType block_size, BufferUsageFlagsType usage, VmaMemoryUsage memory_usage = VMA_MEMORY_USAGE_CPU_TO_GPU);
+	/**
+	 * @param device A valid device
+	 * @param block_size Minimum size of the blocks
+	 * @param usage Usage of the underlying buffers
+	 * @param memory_usage Memory usage of the underlying buffers
+	 * @param release_window Number of resets a block may stay unused before it is released, 0 keeps all blocks alive
+	 */
+	BufferPool(DeviceType          &device,
+	           DeviceSizeType       block_size,
+	           BufferUsageFlagsType usage,
+	           VmaMemoryUsage       memory_usage   = VMA_MEMORY_USAGE_CPU_TO_GPU,
+	           uint32_t             release_window = DEFAULT_RELEASE_WINDOW);
 
 	BufferBlock<bindingType> &request_buffer_block(DeviceSizeType minimum_size, bool minimal = false);
 
-	void reset();
+	/**
+	 * @brief Resets all blocks and releases those that have been idle for the whole release window, or since the
+	 *        previous reset under memory pressure
+	 * @return \c true if at least one block was destroyed, meaning descriptor sets referring to its buffer are now dangling
+	 */
+	bool reset();
+
+	/**
+	 * @return The total size of the blocks currently owned by the pool
+	 */
+	DeviceSizeType get_allocated_size() const;
+
+	/**
+	 * @return The largest number of bytes used in a single frame over the release window
+	 */
+	DeviceSizeType get_high_water_mark() const;
+
+	size_t get_block_count() const;
+
+  private:
+	struct PooledBlock
+	{
+		std::unique_ptr<BufferBlockCpp> block;
+		uint32_t                        idle_resets = 0;        /// Number of consecutive resets without the block being requested
+	};
+
+	vk::DeviceSize determine_block_size(vk::DeviceSize minimum_size) const;
+	void           rebuild_free_blocks();
 
   private:
-	vkb::core::HPPDevice                        &device;
-	std::vector<std::unique_ptr<BufferBlockCpp>> buffer_blocks;         /// List of blocks requested (need to be pointers in order to keep their address constant on vector resizing)
-	vk::DeviceSize                               block_size = 0;        /// Minimum size of the blocks
-	vk::BufferUsageFlags                         usage;
-	VmaMemoryUsage                               memory_usage{};
+	vkb::core::HPPDevice                 &device;
+	std::vector<PooledBlock>              buffer_blocks;             /// List of blocks requested (need to be pointers in order to keep their address constant on vector resizing)
+	std::multimap<vk::DeviceSize, size_t> free_blocks;               /// Index of the blocks not requested since the last reset, keyed on their size
+	std::vector<size_t>                   active_blocks;             /// Blocks requested since the last reset, in request order
+	std::deque<vk::DeviceSize>            usage_history;             /// Bytes used per frame, over the release window
+	vk::DeviceSize                        block_size     = 0;        /// Minimum size of the blocks
+	vk::DeviceSize                        high_water     = 0;        /// Maximum of usage_history
+	uint32_t                              release_window = 0;
+	vk::BufferUsageFlags                  usage;
+	VmaMemoryUsage                        memory_usage{};
 };
 
 using BufferPoolC   = BufferPool<vkb::BindingType::C>;
 using BufferPoolCpp = BufferPool<vkb::BindingType::Cpp>;
 
 template <vkb::BindingType bindingType>
-BufferPool<bindingType>::BufferPool(DeviceType &device, DeviceSizeType block_size, BufferUsageFlagsType usage, VmaMemoryUsage memory_usage) :
-    device{reinterpret_cast<vkb::core::HPPDevice &>(device)}, block_size{block_size}, usage{usage}, memory_usage{memory_usage}
+BufferPool<bindingType>::BufferPool(
+    DeviceType &device, DeviceSizeType block_size, BufferUsageFlagsType usage, VmaMemoryUsage memory_usage, uint32_t release_window) :
+    device{reinterpret_cast<vkb::core::HPPDevice &>(device)}, block_size{block_size}, release_window{release_window}, usage{usage}, memory_usage{memory_usage}
 {
 }
 
 template <vkb::BindingType bindingType>
 BufferBlock<bindingType> &BufferPool<bindingType>::request_buffer_block(DeviceSizeType minimum_size, bool minimal)
 {
-	// Find a block in the range of the blocks which can fit the minimum size
-	auto it = minimal ? std::find_if(buffer_blocks.begin(),
-	                                 buffer_blocks.end(),
-	                                 [&minimum_size](auto const &buffer_block) { return (buffer_block->get_size() == minimum_size) && buffer_block->can_allocate(minimum_size); }) :
-	                    std::find_if(buffer_blocks.begin(),
-	                                 buffer_blocks.end(),
-	                                 [&minimum_size](auto const &buffer_block) { return buffer_block->can_allocate(minimum_size); });
-
-	if (it == buffer_blocks.end())
+	BufferBlockCpp *buffer_block = nullptr;
+
+	if (!minimal)
+	{
+		// A block already handed out this frame may still have room left, e.g. after a large request spilled over into a new block
+		auto active_it = std::find_if(active_blocks.rbegin(),
+		                              active_blocks.rend(),
+		                              [this, &minimum_size](size_t index) { return buffer_blocks[index].block->can_allocate(minimum_size); });
+		if (active_it != active_blocks.rend())
+		{
+			buffer_block = buffer_blocks[*active_it].block.get();
+		}
+	}
+
+	if (!buffer_block)
+	{
+		// Free blocks are empty, so the smallest one at least as large as the request fits it
+		auto free_it = free_blocks.lower_bound(minimum_size);
+		if (free_it != free_blocks.end() && (!minimal || free_it->first == minimum_size))
+		{
+			auto &pooled_block       = buffer_blocks[free_it->second];
+			pooled_block.idle_resets = 0;
+			active_blocks.push_back(free_it->second);
+			free_blocks.erase(free_it);
+			buffer_block = pooled_block.block.get();
+		}
+	}
+
+	if (!buffer_block)
 	{
 		LOGD("Building #{} buffer block ({})", buffer_blocks.size(), vk::to_string(usage));
 
-		vk::DeviceSize new_block_size = minimal ? minimum_size : std::max(block_size, minimum_size);
+		vk::DeviceSize new_block_size = minimal ? minimum_size : determine_block_size(minimum_size);
 
-		// Create a new block and get the iterator on it
-		it = buffer_blocks.emplace(buffer_blocks.end(), std::make_unique<BufferBlockCpp>(device, new_block_size, usage, memory_usage));
+		// Create a new block and mark it as active
+		active_blocks.push_back(buffer_blocks.size());
+		buffer_blocks.push_back({std::make_unique<BufferBlockCpp>(device, new_block_size, usage, memory_usage)});
+		buffer_block = buffer_blocks.back().block.get();
 	}
 
 	if constexpr (bindingType == vkb::BindingType::Cpp)
 	{
-		return *it->get();
+		return *buffer_block;
 	}
 	else
 	{
-		return reinterpret_cast<BufferBlockC &>(*it->get());
+		return reinterpret_cast<BufferBlockC &>(*buffer_block);
 	}
 }
 
 template <vkb::BindingType bindingType>
-void BufferPool<bindingType>::reset()
+bool BufferPool<bindingType>::reset()
 {
+	// Record how much of the pool this frame needed, to size new blocks after the recent peak
+	vk::DeviceSize frame_usage = 0;
+	for (auto index : active_blocks)
+	{
+		frame_usage += buffer_blocks[index].block->get_used_size();
+	}
+	usage_history.push_back(frame_usage);
+	while (usage_history.size() > std::max<size_t>(release_window, 1))
+	{
+		usage_history.pop_front();
+	}
+	high_water = *std::max_element(usage_history.begin(), usage_history.end());
+
 	// Attention: Resetting the BufferPool is not supposed to clear the BufferBlocks, but just reset them!
 	//						The actual VkBuffers are used to hash the DescriptorSet in RenderFrame::request_descriptor_set.
-	//						Don't know (for now) how that works with resetted buffers!
-	for (auto &buffer_block : buffer_blocks)
+	//						Blocks are only destroyed once they have been idle over the whole release window, and the caller
+	//						is told so it can drop the descriptor sets that reference them.
+	for (auto &pooled_block : buffer_blocks)
+	{
+		pooled_block.block->reset();
+		++pooled_block.idle_resets;
+	}
+	for (auto index : active_blocks)
+	{
+		buffer_blocks[index].idle_resets = 0;
+	}
+	active_blocks.clear();
+
+	bool under_pressure = MemoryBudgetTracker::get().get_pressure() != MemoryPressure::None;
+
+	bool released = false;
+	if (release_window > 0 || under_pressure)
+	{
+		uint32_t idle_limit = under_pressure ? 0 : release_window;
+
+		auto last = std::remove_if(buffer_blocks.begin(), buffer_blocks.end(), [idle_limit](PooledBlock const &pooled_block) { return pooled_block.idle_resets > idle_limit; });
+		if (last != buffer_blocks.end())
+		{
+			LOGD("Releasing {} idle buffer block(s) ({})", std::distance(last, buffer_blocks.end()), vk::to_string(usage));
+			buffer_blocks.erase(last, buffer_blocks.end());
+			released = true;
+		}
+	}
+
+	rebuild_free_blocks();
+
+	return released;
+}
+
+template <vkb::BindingType bindingType>
+typename BufferPool<bindingType>::DeviceSizeType BufferPool<bindingType>::get_allocated_size() const
+{
+	vk::DeviceSize allocated_size = 0;
+	for (auto const &pooled_block : buffer_blocks)
+	{
+		allocated_size += pooled_block.block->get_size();
+	}
+	return allocated_size;
+}
+
+template <vkb::BindingType bindingType>
+typename BufferPool<bindingType>::DeviceSizeType BufferPool<bindingType>::get_high_water_mark() const
+{
+	return high_water;
+}
+
+template <vkb::BindingType bindingType>
+size_t BufferPool<bindingType>::get_block_count() const
+{
+	return buffer_blocks.size();
+}
+
+template <vkb::BindingType bindingType>
+vk::DeviceSize BufferPool<bindingType>::determine_block_size(vk::DeviceSize minimum_size) const
+{
+	// Growing blocks would take memory ahead of the need while the heaps are short of it
+	if (MemoryBudgetTracker::get().get_pressure() != MemoryPressure::None)
+	{
+		return std::max(block_size, minimum_size);
+	}
+
+	// Aim at covering the recent peak with a handful of blocks, in multiples of the minimum block size
+	vk::DeviceSize adaptive_size = ((high_water / 4 + block_size - 1) / block_size) * block_size;
+	adaptive_size                = std::clamp(adaptive_size, block_size, block_size * MAX_BLOCK_SIZE_MULTIPLIER);
+	return std::max(adaptive_size, minimum_size);
+}
+
+template <vkb::BindingType bindingType>
+void BufferPool<bindingType>::rebuild_free_blocks()
+{
+	free_blocks.clear();
+	for (size_t i = 0; i < buffer_blocks.size(); ++i)
 	{
-		buffer_block->reset();
+		free_blocks.emplace(buffer_blocks[i].block->get_size(), i);
 	}
 }
 
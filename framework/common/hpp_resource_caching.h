@@ -22,7 +22,6 @@
 #include "core/hpp_image_view.h"
 #include "core/hpp_render_pass.h"
 #include "core/hpp_shader_module.h"
-#include "hpp_resource_record.h"
 #include "rendering/hpp_render_target.h"
 #include "resource_caching.h"
 #include <vulkan/vulkan_hash.hpp>
@@ -277,138 +276,3 @@ struct hash<vkb::rendering::HPPRenderTarget>
 };
 
 }        // namespace std
-
-namespace vkb
-{
-namespace common
-{
-/**
- * @brief facade helper functions and structs around the functions and structs in common/resource_caching, providing a vulkan.hpp-based interface
- */
-
-namespace
-{
-template <class T, class... A>
-struct HPPRecordHelper
-{
-	size_t record(HPPResourceRecord & /*recorder*/, A &.../*args*/)
-	{
-		return 0;
-	}
-
-	void index(HPPResourceRecord & /*recorder*/, size_t /*index*/, T & /*resource*/)
-	{}
-};
-
-template <class... A>
-struct HPPRecordHelper<vkb::core::HPPShaderModule, A...>
-{
-	size_t record(HPPResourceRecord &recorder, A &...args)
-	{
-		return recorder.register_shader_module(args...);
-	}
-
-	void index(HPPResourceRecord &recorder, size_t index, vkb::core::HPPShaderModule &shader_module)
-	{
-		recorder.set_shader_module(index, shader_module);
-	}
-};
-
-template <class... A>
-struct HPPRecordHelper<vkb::core::HPPPipelineLayout, A...>
-{
-	size_t record(HPPResourceRecord &recorder, A &...args)
-	{
-		return recorder.register_pipeline_layout(args...);
-	}
-
-	void index(HPPResourceRecord &recorder, size_t index, vkb::core::HPPPipelineLayout &pipeline_layout)
-	{
-		recorder.set_pipeline_layout(index, pipeline_layout);
-	}
-};
-
-template <class... A>
-struct HPPRecordHelper<vkb::core::HPPRenderPass, A...>
-{
-	size_t record(HPPResourceRecord &recorder, A &...args)
-	{
-		return recorder.register_render_pass(args...);
-	}
-
-	void index(HPPResourceRecord &recorder, size_t index, vkb::core::HPPRenderPass &render_pass)
-	{
-		recorder.set_render_pass(index, render_pass);
-	}
-};
-
-template <class... A>
-struct HPPRecordHelper<vkb::core::HPPGraphicsPipeline, A...>
-{
-	size_t record(HPPResourceRecord &recorder, A &...args)
-	{
-		return recorder.register_graphics_pipeline(args...);
-	}
-
-	void index(HPPResourceRecord &recorder, size_t index, vkb::core::HPPGraphicsPipeline &graphics_pipeline)
-	{
-		recorder.set_graphics_pipeline(index, graphics_pipeline);
-	}
-};
-}        // namespace
-
-template <class T, class... A>
-T &request_resource(vkb::core::HPPDevice &device, vkb::HPPResourceRecord *recorder, std::unordered_map<size_t, T> &resources, A &...args)
-{
-	HPPRecordHelper<T, A...> record_helper;
-
-	size_t hash{0U};
-	hash_param(hash, args...);
-
-	auto res_it = resources.find(hash);
-
-	if (res_it != resources.end())
-	{
-		return res_it->second;
-	}
-
-	// If we do not have it already, create and cache it
-	const char *res_type = typeid(T).name();
-	size_t      res_id   = resources.size();
-
-	LOGD("Building #{} cache object ({})", res_id, res_type);
-
-// Only error handle in release
-#ifndef DEBUG
-	try
-	{
-#endif
-		T resource(device, args...);
-
-		auto res_ins_it = resources.emplace(hash, std::move(resource));
-
-		if (!res_ins_it.second)
-		{
-			throw std::runtime_error{std::string{"Insertion error for #"} + std::to_string(res_id) + "cache object (" + res_type + ")"};
-		}
-
-		res_it = res_ins_it.first;
-
-		if (recorder)
-		{
-			size_t index = record_helper.record(*recorder, args...);
-			record_helper.index(*recorder, index, res_it->second);
-		}
-#ifndef DEBUG
-	}
-	catch (const std::exception &e)
-	{
-		LOGE("Creation error for #{} cache object ({})", res_id, res_type);
-		throw e;
-	}
-#endif
-
-	return res_it->second;
-}
-}        // namespace common
-}        // namespace vkb
@@ -19,7 +19,7 @@
 
 #include <common/utils.h>
 
-#include <rendering/hpp_render_context.h>
+#include <rendering/render_context.h>
 #include <scene_graph/hpp_scene.h>
 
 /**
@@ -34,9 +34,9 @@ inline sg::Node &add_free_camera(vkb::scene_graph::HPPScene &scene, const std::s
 	return vkb::add_free_camera(reinterpret_cast<vkb::sg::Scene &>(scene), node_name, static_cast<VkExtent2D>(extent));
 }
 
-inline void screenshot(vkb::rendering::HPPRenderContext &render_context, const std::string &filename)
+inline void screenshot(vkb::rendering::RenderContextCpp &render_context, const std::string &filename)
 {
-	vkb::screenshot(reinterpret_cast<vkb::RenderContext &>(render_context), filename);
+	vkb::screenshot(reinterpret_cast<vkb::rendering::RenderContextC &>(render_context), filename);
 }
 }        // namespace common
 }        // namespace vkb
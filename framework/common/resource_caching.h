@@ -1,4 +1,4 @@
-/* Copyright (c) 2018-2021, Arm Limited and Contributors
+/* Copyright (c) 2018-2025, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -724,8 +724,13 @@ struct RecordHelper<GraphicsPipeline, A...>
 };
 }        // namespace
 
-template <class T, class... A>
-T &request_resource(Device &device, ResourceRecord *recorder, std::unordered_map<std::size_t, T> &resources, A &... args)
+/**
+ * @brief Requests a resource from a cache map, creating it on the given device if it is not found.
+ *        Resources are only recorded when they are C types with a RecordHelper specialization,
+ *        the vulkan.hpp facades are requested without a recorder.
+ */
+template <class T, class DeviceType, class... A>
+T &request_resource(DeviceType &device, ResourceRecord *recorder, std::unordered_map<std::size_t, T> &resources, A &... args)
 {
 	RecordHelper<T, A...> record_helper;
 
@@ -45,10 +45,11 @@ std::string to_snake_case(const std::string &name);
 
 /**
  * @brief Takes a screenshot of the app by writing the swapchain image to file (slow function)
+ *        Use a ScreenshotCapture to capture frames without stalling the frame loop
  * @param render_context The RenderContext to use
  * @param filename The name of the file to save the output to
  */
-void screenshot(RenderContext &render_context, const std::string &filename);
+void screenshot(vkb::rendering::RenderContextC &render_context, const std::string &filename);
 
 /**
  * @brief Adds a light to the scene with the specified parameters
@@ -0,0 +1,393 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cooked_scene.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include <filesystem/filesystem.hpp>
+
+#include "common/helpers.h"
+#include "core/util/logging.hpp"
+
+namespace vkb
+{
+namespace
+{
+constexpr uint32_t cooked_scene_magic = 0x4E435356;        // "VSCN"
+
+/// Bumped whenever the layout of the tables or the content of the blobs change
+constexpr uint32_t cooked_scene_version = 1;
+
+/// Magic, version, key, table size and blob section size
+constexpr size_t header_size = 2 * sizeof(uint32_t) + 3 * sizeof(uint64_t);
+
+/// Every record, image layer and animation channel starts with the size of a string or vector
+constexpr size_t min_record_size = sizeof(size_t);
+
+/**
+ * @brief Fails the stream if the records it announces cannot fit in its remaining bytes, before they are allocated
+ * @return Whether the records can be read
+ */
+bool check_record_count(std::istringstream &is, size_t record_count)
+{
+	auto remaining = static_cast<size_t>(std::max<std::streamsize>(is.rdbuf()->in_avail(), 0));
+	if (record_count > remaining / min_record_size)
+	{
+		is.setstate(std::ios::failbit);
+	}
+	return static_cast<bool>(is);
+}
+
+/**
+ * @brief Image created from its cooked levels, without decoding
+ */
+class CookedImageComponent : public sg::Image
+{
+  public:
+	CookedImageComponent(const CookedImage &image, std::vector<uint8_t> &&data) :
+	    sg::Image{image.name, std::move(data), std::vector<sg::Mipmap>{image.mipmaps}}
+	{
+		set_format(image.format);
+		set_layers(image.layers);
+		set_offsets(image.offsets);
+	}
+
+	virtual ~CookedImageComponent() = default;
+};
+
+void write_record(std::ostringstream &os, const CookedImage &image)
+{
+	write(os, image.name, image.format, image.layers, image.mipmaps, image.offsets.size());
+	for (auto &layer_offsets : image.offsets)
+	{
+		write(os, layer_offsets);
+	}
+	write(os, image.data);
+}
+
+void read_record(std::istringstream &is, CookedImage &image)
+{
+	size_t layer_count{0};
+	read(is, image.name, image.format, image.layers, image.mipmaps, layer_count);
+	if (!is || !check_record_count(is, layer_count))
+	{
+		return;
+	}
+
+	image.offsets.resize(layer_count);
+	for (auto &layer_offsets : image.offsets)
+	{
+		read(is, layer_offsets);
+	}
+	read(is, image.data);
+}
+
+void write_record(std::ostringstream &os, const CookedSampler &sampler)
+{
+	write(os, sampler.name, sampler.min_filter, sampler.mag_filter, sampler.wrap_s, sampler.wrap_t, sampler.wrap_r);
+}
+
+void read_record(std::istringstream &is, CookedSampler &sampler)
+{
+	read(is, sampler.name, sampler.min_filter, sampler.mag_filter, sampler.wrap_s, sampler.wrap_t, sampler.wrap_r);
+}
+
+void write_record(std::ostringstream &os, const CookedTexture &texture)
+{
+	write(os, texture.name, texture.image, texture.sampler);
+}
+
+void read_record(std::istringstream &is, CookedTexture &texture)
+{
+	read(is, texture.name, texture.image, texture.sampler);
+}
+
+void write_record(std::ostringstream &os, const CookedMaterial &material)
+{
+	write(os, material.name, material.base_color_factor, material.metallic_factor, material.roughness_factor, material.emissive,
+	      material.double_sided, material.alpha_cutoff, material.alpha_mode, material.textures);
+}
+
+void read_record(std::istringstream &is, CookedMaterial &material)
+{
+	read(is, material.name, material.base_color_factor, material.metallic_factor, material.roughness_factor, material.emissive,
+	     material.double_sided, material.alpha_cutoff, material.alpha_mode, material.textures);
+}
+
+void write_record(std::ostringstream &os, const CookedSubMesh &sub_mesh)
+{
+	write(os, sub_mesh.name, sub_mesh.index_type, sub_mesh.index_offset, sub_mesh.vertices_count, sub_mesh.vertex_indices,
+	      sub_mesh.attributes, sub_mesh.vertex_buffers, sub_mesh.index_buffer,
+	      sub_mesh.meshlet_buffer, sub_mesh.meshlet_vertex_buffer, sub_mesh.meshlet_triangle_buffer, sub_mesh.meshlet_count,
+	      sub_mesh.lods, sub_mesh.material);
+}
+
+void read_record(std::istringstream &is, CookedSubMesh &sub_mesh)
+{
+	read(is, sub_mesh.name, sub_mesh.index_type, sub_mesh.index_offset, sub_mesh.vertices_count, sub_mesh.vertex_indices,
+	     sub_mesh.attributes, sub_mesh.vertex_buffers, sub_mesh.index_buffer,
+	     sub_mesh.meshlet_buffer, sub_mesh.meshlet_vertex_buffer, sub_mesh.meshlet_triangle_buffer, sub_mesh.meshlet_count,
+	     sub_mesh.lods, sub_mesh.material);
+}
+
+void write_record(std::ostringstream &os, const CookedMesh &mesh)
+{
+	write(os, mesh.name, mesh.sub_meshes);
+}
+
+void read_record(std::istringstream &is, CookedMesh &mesh)
+{
+	read(is, mesh.name, mesh.sub_meshes);
+}
+
+void write_record(std::ostringstream &os, const CookedCamera &camera)
+{
+	write(os, camera.name, camera.aspect_ratio, camera.field_of_view, camera.near_plane, camera.far_plane);
+}
+
+void read_record(std::istringstream &is, CookedCamera &camera)
+{
+	read(is, camera.name, camera.aspect_ratio, camera.field_of_view, camera.near_plane, camera.far_plane);
+}
+
+void write_record(std::ostringstream &os, const CookedLight &light)
+{
+	write(os, light.name, light.type, light.properties);
+}
+
+void read_record(std::istringstream &is, CookedLight &light)
+{
+	read(is, light.name, light.type, light.properties);
+}
+
+void write_record(std::ostringstream &os, const CookedNode &node)
+{
+	write(os, node.id, node.name, node.translation, node.rotation, node.scale, node.children, node.mesh, node.camera, node.light);
+}
+
+void read_record(std::istringstream &is, CookedNode &node)
+{
+	read(is, node.id, node.name, node.translation, node.rotation, node.scale, node.children, node.mesh, node.camera, node.light);
+}
+
+void write_record(std::ostringstream &os, const CookedAnimation &animation)
+{
+	write(os, animation.name, animation.start_time, animation.end_time, animation.channels.size());
+	for (auto &channel : animation.channels)
+	{
+		write(os, channel.node, channel.target, channel.type, channel.inputs, channel.outputs);
+	}
+}
+
+void read_record(std::istringstream &is, CookedAnimation &animation)
+{
+	size_t channel_count{0};
+	read(is, animation.name, animation.start_time, animation.end_time, channel_count);
+	if (!is || !check_record_count(is, channel_count))
+	{
+		return;
+	}
+
+	animation.channels.resize(channel_count);
+	for (auto &channel : animation.channels)
+	{
+		read(is, channel.node, channel.target, channel.type, channel.inputs, channel.outputs);
+	}
+}
+
+template <class T>
+void write_table(std::ostringstream &os, const std::vector<T> &table)
+{
+	write(os, table.size());
+	for (auto &record : table)
+	{
+		write_record(os, record);
+	}
+}
+
+/**
+ * @brief Appends records serialized in memory to the file, so that only one table is held in memory at a time
+ */
+template <class... T>
+void stream(std::ofstream &file, const T &...records)
+{
+	std::ostringstream os;
+	write(os, records...);
+	auto data = os.str();
+	file.write(data.data(), data.size());
+}
+
+template <class T>
+void stream_table(std::ofstream &file, const std::vector<T> &table)
+{
+	std::ostringstream os;
+	write_table(os, table);
+	auto data = os.str();
+	file.write(data.data(), data.size());
+}
+
+template <class T>
+void read_table(std::istringstream &is, std::vector<T> &table)
+{
+	size_t record_count{0};
+	read(is, record_count);
+	if (!is || !check_record_count(is, record_count))
+	{
+		return;
+	}
+
+	table.resize(record_count);
+	for (auto &record : table)
+	{
+		read_record(is, record);
+	}
+}
+}        // namespace
+
+std::unique_ptr<sg::Image> CookedScene::create_image(const CookedImage &image, std::vector<uint8_t> &&data)
+{
+	return std::make_unique<CookedImageComponent>(image, std::move(data));
+}
+
+CookedBlob CookedScene::add_blob(const void *data, size_t size)
+{
+	std::lock_guard<std::mutex> lock{blob_mutex};
+
+	CookedBlob blob{blob_data.size(), size};
+	blob_data.insert(blob_data.end(), static_cast<const uint8_t *>(data), static_cast<const uint8_t *>(data) + size);
+
+	return blob;
+}
+
+bool CookedScene::load(const std::string &cooked_file, uint64_t expected_key)
+{
+	auto fs = vkb::filesystem::get();
+	if (!fs->is_file(cooked_file))
+	{
+		return false;
+	}
+
+	auto file_size = fs->stat_file(cooked_file).size;
+	if (file_size < header_size)
+	{
+		LOGW("Ignoring invalid cooked scene {}", cooked_file);
+		return false;
+	}
+
+	auto               header_data = fs->read_chunk(cooked_file, 0, header_size);
+	std::istringstream header{std::string{header_data.begin(), header_data.end()}};
+
+	uint32_t magic{0};
+	uint32_t version{0};
+	uint64_t file_key{0};
+	uint64_t table_size{0};
+	uint64_t blob_size{0};
+	read(header, magic, version, file_key, table_size, blob_size);
+
+	if (!header || magic != cooked_scene_magic || version != cooked_scene_version || header_size + table_size + blob_size != file_size)
+	{
+		LOGW("Ignoring invalid cooked scene {}", cooked_file);
+		return false;
+	}
+
+	if (file_key != expected_key)
+	{
+		LOGI("Cooked scene {} is out of date", cooked_file);
+		return false;
+	}
+
+	auto               table_data = fs->read_chunk(cooked_file, header_size, table_size);
+	std::istringstream is{std::string{table_data.begin(), table_data.end()}};
+
+	read_table(is, images);
+	read_table(is, samplers);
+	read(is, default_sampler_filters);
+	read_table(is, textures);
+	read_table(is, materials);
+	read_table(is, sub_meshes);
+	read_table(is, meshes);
+	read_table(is, cameras);
+	read_table(is, lights);
+	read_table(is, nodes);
+	read_table(is, animations);
+
+	if (!is || nodes.empty())
+	{
+		LOGW("Ignoring truncated cooked scene {}", cooked_file);
+		return false;
+	}
+
+	key                 = file_key;
+	file                = cooked_file;
+	blob_section_offset = header_size + table_size;
+
+	return true;
+}
+
+std::vector<uint8_t> CookedScene::read_blob(const CookedBlob &blob) const
+{
+	if (blob.size == 0)
+	{
+		return {};
+	}
+
+	return vkb::filesystem::get()->read_chunk(file, blob_section_offset + blob.offset, blob.size);
+}
+
+void CookedScene::save(const std::string &cooked_file) const
+{
+	std::ofstream file{cooked_file, std::ios::binary | std::ios::trunc};
+	if (!file.is_open())
+	{
+		// The asset directory may be read-only, the scene is cooked again next time
+		LOGW("Cannot write cooked scene {}", cooked_file);
+		return;
+	}
+
+	// The header is written last, once the size of the tables is known, so that an interrupted write leaves an invalid file
+	file.write(std::string(header_size, '\0').data(), header_size);
+
+	stream_table(file, images);
+	stream_table(file, samplers);
+	stream(file, default_sampler_filters);
+	stream_table(file, textures);
+	stream_table(file, materials);
+	stream_table(file, sub_meshes);
+	stream_table(file, meshes);
+	stream_table(file, cameras);
+	stream_table(file, lights);
+	stream_table(file, nodes);
+	stream_table(file, animations);
+
+	uint64_t table_size = static_cast<uint64_t>(file.tellp()) - header_size;
+
+	file.write(reinterpret_cast<const char *>(blob_data.data()), blob_data.size());
+
+	file.seekp(0);
+	stream(file, cooked_scene_magic, cooked_scene_version, key, table_size, static_cast<uint64_t>(blob_data.size()));
+
+	file.close();
+	if (!file)
+	{
+		LOGW("Cannot write cooked scene {}", cooked_file);
+		std::remove(cooked_file.c_str());
+	}
+}
+}        // namespace vkb
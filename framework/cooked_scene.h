@@ -0,0 +1,324 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/glm_common.h"
+#include "common/vk_common.h"
+#include "scene_graph/components/image.h"
+#include "scene_graph/components/light.h"
+#include "scene_graph/components/material.h"
+#include "scene_graph/components/sub_mesh.h"
+#include "scene_graph/scripts/animation.h"
+
+namespace vkb
+{
+/**
+ * @brief Range of the blob section of a cooked scene file
+ */
+struct CookedBlob
+{
+	/// Offset from the start of the blob section, in bytes
+	uint64_t offset{0};
+
+	uint64_t size{0};
+};
+
+/// Index of a cooked component which does not exist
+constexpr uint32_t no_cooked_component = ~0u;
+
+struct CookedImage
+{
+	std::string name;
+
+	VkFormat format{VK_FORMAT_UNDEFINED};
+
+	uint32_t layers{1};
+
+	std::vector<sg::Mipmap> mipmaps;
+
+	/// Offsets of the mipmaps of every array layer in the data
+	std::vector<std::vector<VkDeviceSize>> offsets;
+
+	/// Every level of the image, transcoded and mipmapped as it is uploaded
+	CookedBlob data;
+};
+
+/**
+ * @brief Sampler as declared in glTF, created again with GLTFLoader::parse_sampler
+ */
+struct CookedSampler
+{
+	std::string name;
+
+	int32_t min_filter{-1};
+
+	int32_t mag_filter{-1};
+
+	int32_t wrap_s{-1};
+
+	int32_t wrap_t{-1};
+
+	int32_t wrap_r{-1};
+};
+
+struct CookedTexture
+{
+	std::string name;
+
+	uint32_t image{no_cooked_component};
+
+	uint32_t sampler{no_cooked_component};
+};
+
+struct CookedMaterial
+{
+	std::string name;
+
+	glm::vec4 base_color_factor{0.0f};
+
+	float metallic_factor{0.0f};
+
+	float roughness_factor{0.0f};
+
+	glm::vec3 emissive{0.0f};
+
+	bool double_sided{false};
+
+	float alpha_cutoff{0.5f};
+
+	sg::AlphaMode alpha_mode{sg::AlphaMode::Opaque};
+
+	/// Textures by material slot, as indices into the cooked textures
+	std::map<std::string, uint32_t> textures;
+};
+
+struct CookedSubMeshLod
+{
+	CookedBlob index_buffer;
+
+	VkIndexType index_type{};
+
+	uint32_t index_count{0};
+
+	float error{0.0f};
+};
+
+struct CookedSubMesh
+{
+	std::string name;
+
+	VkIndexType index_type{};
+
+	uint32_t index_offset{0};
+
+	uint32_t vertices_count{0};
+
+	uint32_t vertex_indices{0};
+
+	std::map<std::string, sg::VertexAttribute> attributes;
+
+	/// Vertex buffers by name, in the layout they are drawn with
+	std::map<std::string, CookedBlob> vertex_buffers;
+
+	/// Empty if the sub mesh is not indexed
+	CookedBlob index_buffer;
+
+	CookedBlob meshlet_buffer;
+
+	CookedBlob meshlet_vertex_buffer;
+
+	CookedBlob meshlet_triangle_buffer;
+
+	uint32_t meshlet_count{0};
+
+	std::vector<CookedSubMeshLod> lods;
+
+	/// Index into the cooked materials
+	uint32_t material{no_cooked_component};
+};
+
+struct CookedMesh
+{
+	std::string name;
+
+	/// Indices into the cooked sub meshes
+	std::vector<uint32_t> sub_meshes;
+};
+
+struct CookedCamera
+{
+	std::string name;
+
+	float aspect_ratio{1.0f};
+
+	float field_of_view{0.0f};
+
+	float near_plane{0.0f};
+
+	float far_plane{0.0f};
+};
+
+struct CookedLight
+{
+	std::string name;
+
+	sg::LightType type{sg::LightType::Directional};
+
+	sg::LightProperties properties;
+};
+
+struct CookedNode
+{
+	size_t id{0};
+
+	std::string name;
+
+	glm::vec3 translation{0.0f};
+
+	glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+
+	glm::vec3 scale{1.0f};
+
+	/// Indices into the cooked nodes, in the order they were added
+	std::vector<uint32_t> children;
+
+	uint32_t mesh{no_cooked_component};
+
+	uint32_t camera{no_cooked_component};
+
+	uint32_t light{no_cooked_component};
+};
+
+struct CookedAnimationChannel
+{
+	/// Index into the cooked nodes
+	uint32_t node{no_cooked_component};
+
+	sg::AnimationTarget target{sg::AnimationTarget::Translation};
+
+	sg::AnimationType type{sg::AnimationType::Linear};
+
+	std::vector<float> inputs;
+
+	std::vector<glm::vec4> outputs;
+};
+
+struct CookedAnimation
+{
+	std::string name;
+
+	float start_time{0.0f};
+
+	float end_time{0.0f};
+
+	std::vector<CookedAnimationChannel> channels;
+};
+
+/**
+ * @brief Scene baked by the GLTFLoader into a single binary file, to be loaded back without parsing the glTF file,
+ *        extracting its accessors nor decoding its images
+ *
+ * The file starts with tables describing the components of the scene and how they connect, followed by a blob section
+ * holding the vertex and index buffers in the layout they are drawn with, and the images with their whole mip chain in
+ * the format they are uploaded in. Loading reads the tables only, the blobs are then read one by one straight into the
+ * data uploaded to the GPU, so the file is never held in memory as a whole.
+ *
+ * Cooked scenes are keyed by a hash of the glTF file and of the loader options they were cooked with.
+ */
+class CookedScene
+{
+  public:
+	/// Suffix of the cooked scene file, appended to the name of the asset
+	static constexpr const char *file_suffix = ".cooked";
+
+	/**
+	 * @brief Creates an image from the cooked description of its levels
+	 * @param image Cooked image
+	 * @param data Content of its blob
+	 */
+	static std::unique_ptr<sg::Image> create_image(const CookedImage &image, std::vector<uint8_t> &&data);
+
+	/**
+	 * @brief Appends data to the blob section, may be called from several threads
+	 * @return The range of the data in the blob section
+	 */
+	CookedBlob add_blob(const void *data, size_t size);
+
+	/**
+	 * @brief Reads the tables of a cooked scene file
+	 * @param file Path of the cooked scene file
+	 * @param key Key of the scene expected
+	 * @return Whether the file exists, is valid and was cooked with the key
+	 */
+	bool load(const std::string &file, uint64_t key);
+
+	/**
+	 * @brief Reads a blob from the file loaded
+	 */
+	std::vector<uint8_t> read_blob(const CookedBlob &blob) const;
+
+	/**
+	 * @brief Writes the tables, one at a time, and the blobs added straight to the file, without assembling it in memory
+	 */
+	void save(const std::string &file) const;
+
+	uint64_t key{0};
+
+	std::vector<CookedImage> images;
+
+	std::vector<CookedSampler> samplers;
+
+	/// Default samplers added by the loader after the glTF ones, with these filters
+	std::vector<int32_t> default_sampler_filters;
+
+	std::vector<CookedTexture> textures;
+
+	std::vector<CookedMaterial> materials;
+
+	std::vector<CookedSubMesh> sub_meshes;
+
+	std::vector<CookedMesh> meshes;
+
+	std::vector<CookedCamera> cameras;
+
+	std::vector<CookedLight> lights;
+
+	/// Nodes of the scene, the root last
+	std::vector<CookedNode> nodes;
+
+	std::vector<CookedAnimation> animations;
+
+  private:
+	/// File the tables were loaded from
+	std::string file;
+
+	/// Offset of the blob section in the file
+	uint64_t blob_section_offset{0};
+
+	/// Blob section of the scene being cooked
+	std::vector<uint8_t> blob_data;
+
+	std::mutex blob_mutex;
+};
+}        // namespace vkb
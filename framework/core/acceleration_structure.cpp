@@ -1,4 +1,4 @@
-/* Copyright (c) 2021-2024, Sascha Willems
+/* Copyright (c) 2021-2025, Sascha Willems
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -32,10 +32,8 @@ AccelerationStructure::AccelerationStructure(Device                        &devi
 
 AccelerationStructure::~AccelerationStructure()
 {
-	if (handle != VK_NULL_HANDLE)
-	{
-		vkDestroyAccelerationStructureKHR(device.get_handle(), handle, nullptr);
-	}
+	release_uncompacted();
+	destroy_handle();
 }
 
 uint64_t AccelerationStructure::add_triangle_geometry(vkb::core::BufferC &vertex_buffer,
@@ -130,45 +128,46 @@ void AccelerationStructure::update_instance_geometry(uint64_t
 	geometries[instance_UID].updated                = true;
 }
 
-void AccelerationStructure::build(VkQueue queue, VkBuildAccelerationStructureFlagsKHR flags, VkBuildAccelerationStructureModeKHR mode)
+const VkAccelerationStructureBuildSizesInfoKHR &AccelerationStructure::prepare_build(VkBuildAccelerationStructureFlagsKHR flags, VkBuildAccelerationStructureModeKHR mode)
 {
 	assert(!geometries.empty());
 
-	std::vector<VkAccelerationStructureGeometryKHR>       acceleration_structure_geometries;
-	std::vector<VkAccelerationStructureBuildRangeInfoKHR> acceleration_structure_build_range_infos;
-	std::vector<uint32_t>                                 primitive_counts;
+	// An update refits an existing structure, so the first build is always a full one
+	if (handle == VK_NULL_HANDLE)
+	{
+		mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
+	}
+
+	// An update has to provide the same geometries as the build it refits, so all of them are gathered in both modes
+	std::vector<uint32_t> primitive_counts;
+	build_geometries.clear();
+	build_range_infos.clear();
 	for (auto &geometry : geometries)
 	{
-		if (mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR && !geometry.second.updated)
-		{
-			continue;
-		}
-		acceleration_structure_geometries.push_back(geometry.second.geometry);
+		build_geometries.push_back(geometry.second.geometry);
 		// Infer build range info from geometry
 		VkAccelerationStructureBuildRangeInfoKHR build_range_info;
 		build_range_info.primitiveCount  = geometry.second.primitive_count;
 		build_range_info.primitiveOffset = 0;
 		build_range_info.firstVertex     = 0;
 		build_range_info.transformOffset = geometry.second.transform_offset;
-		acceleration_structure_build_range_infos.push_back(build_range_info);
+		build_range_infos.push_back(build_range_info);
 		primitive_counts.push_back(geometry.second.primitive_count);
 		geometry.second.updated = false;
 	}
 
-	VkAccelerationStructureBuildGeometryInfoKHR build_geometry_info{};
-	build_geometry_info.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
-	build_geometry_info.type  = type;
-	build_geometry_info.flags = flags;
-	build_geometry_info.mode  = mode;
-	if (mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR && handle != VK_NULL_HANDLE)
-	{
-		build_geometry_info.srcAccelerationStructure = handle;
-		build_geometry_info.dstAccelerationStructure = handle;
-	}
-	build_geometry_info.geometryCount = static_cast<uint32_t>(acceleration_structure_geometries.size());
-	build_geometry_info.pGeometries   = acceleration_structure_geometries.data();
+	build_flags = flags;
+
+	build_geometry_info               = {};
+	build_geometry_info.sType         = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
+	build_geometry_info.type          = type;
+	build_geometry_info.flags         = flags;
+	build_geometry_info.mode          = mode;
+	build_geometry_info.geometryCount = static_cast<uint32_t>(build_geometries.size());
+	build_geometry_info.pGeometries   = build_geometries.data();
 
 	// Get required build sizes
+	build_sizes_info       = {};
 	build_sizes_info.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR;
 	vkGetAccelerationStructureBuildSizesKHR(
 	    device.get_handle(),
@@ -177,54 +176,148 @@ void AccelerationStructure::build(VkQueue queue, VkBuildAccelerationStructureFla
 	    primitive_counts.data(),
 	    &build_sizes_info);
 
-	// Create a buffer for the acceleration structure
-	if (!buffer || buffer->get_size() != build_sizes_info.accelerationStructureSize)
+	// A full build only needs new storage when it outgrows the current one, an update refits in place
+	if (mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR && (!buffer || buffer->get_size() < build_sizes_info.accelerationStructureSize))
 	{
-		buffer = std::make_unique<vkb::core::BufferC>(
-		    device,
-		    build_sizes_info.accelerationStructureSize,
-		    VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
-		    VMA_MEMORY_USAGE_GPU_ONLY);
+		destroy_handle();
+		create_handle(build_sizes_info.accelerationStructureSize);
+	}
 
-		VkAccelerationStructureCreateInfoKHR acceleration_structure_create_info{};
-		acceleration_structure_create_info.sType  = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
-		acceleration_structure_create_info.buffer = buffer->get_handle();
-		acceleration_structure_create_info.size   = build_sizes_info.accelerationStructureSize;
-		acceleration_structure_create_info.type   = type;
-		VkResult result                           = vkCreateAccelerationStructureKHR(device.get_handle(), &acceleration_structure_create_info, nullptr, &handle);
-
-		if (result != VK_SUCCESS)
-		{
-			throw VulkanException{result, "Could not create acceleration structure"};
-		}
+	if (mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR)
+	{
+		build_geometry_info.srcAccelerationStructure = handle;
 	}
+	build_geometry_info.dstAccelerationStructure = handle;
 
-	// Get the acceleration structure's handle
-	VkAccelerationStructureDeviceAddressInfoKHR acceleration_device_address_info{};
-	acceleration_device_address_info.sType                 = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
-	acceleration_device_address_info.accelerationStructure = handle;
-	device_address                                         = vkGetAccelerationStructureDeviceAddressKHR(device.get_handle(), &acceleration_device_address_info);
+	return build_sizes_info;
+}
 
-	// Create a scratch buffer as a temporary storage for the acceleration structure build
-	scratch_buffer = std::make_unique<vkb::core::BufferC>(
-	    device,
-	    build_sizes_info.buildScratchSize,
-	    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
-	    VMA_MEMORY_USAGE_GPU_ONLY);
+VkAccelerationStructureBuildGeometryInfoKHR AccelerationStructure::get_build_geometry_info(VkDeviceAddress scratch_address) const
+{
+	VkAccelerationStructureBuildGeometryInfoKHR geometry_info = build_geometry_info;
+	geometry_info.scratchData.deviceAddress                   = scratch_address;
+	return geometry_info;
+}
+
+const VkAccelerationStructureBuildRangeInfoKHR *AccelerationStructure::get_build_range_infos() const
+{
+	return build_range_infos.data();
+}
+
+void AccelerationStructure::build(VkQueue queue, VkBuildAccelerationStructureFlagsKHR flags, VkBuildAccelerationStructureModeKHR mode)
+{
+	prepare_build(flags, mode);
+
+	VkDeviceSize scratch_size = build_geometry_info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR ? build_sizes_info.updateScratchSize : build_sizes_info.buildScratchSize;
 
-	build_geometry_info.scratchData.deviceAddress = scratch_buffer->get_device_address();
-	build_geometry_info.dstAccelerationStructure  = handle;
+	VkAccelerationStructureBuildGeometryInfoKHR geometry_info = get_build_geometry_info(request_scratch_buffer(scratch_size));
 
 	// Build the acceleration structure on the device via a one-time command buffer submission
 	VkCommandBuffer command_buffer       = device.create_command_buffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
-	auto            as_build_range_infos = &*acceleration_structure_build_range_infos.data();
+	auto            as_build_range_infos = get_build_range_infos();
 	vkCmdBuildAccelerationStructuresKHR(
 	    command_buffer,
 	    1,
-	    &build_geometry_info,
+	    &geometry_info,
 	    &as_build_range_infos);
 	device.flush_command_buffer(command_buffer, queue);
-	scratch_buffer.reset();
+
+	// Structures that are never updated do not need to hold on to their scratch memory
+	if (!(flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR))
+	{
+		scratch_buffer.reset();
+	}
+}
+
+void AccelerationStructure::compact(VkCommandBuffer command_buffer, VkDeviceSize compacted_size)
+{
+	assert(handle != VK_NULL_HANDLE && uncompacted_handle == VK_NULL_HANDLE);
+
+	uncompacted_handle = handle;
+	uncompacted_buffer = std::move(buffer);
+	handle             = VK_NULL_HANDLE;
+
+	create_handle(compacted_size);
+
+	VkCopyAccelerationStructureInfoKHR copy_info{};
+	copy_info.sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR;
+	copy_info.src   = uncompacted_handle;
+	copy_info.dst   = handle;
+	copy_info.mode  = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR;
+	vkCmdCopyAccelerationStructureKHR(command_buffer, &copy_info);
+}
+
+void AccelerationStructure::release_uncompacted()
+{
+	if (uncompacted_handle != VK_NULL_HANDLE)
+	{
+		vkDestroyAccelerationStructureKHR(device.get_handle(), uncompacted_handle, nullptr);
+		uncompacted_handle = VK_NULL_HANDLE;
+	}
+	uncompacted_buffer.reset();
+}
+
+VkDeviceSize AccelerationStructure::get_size() const
+{
+	return buffer ? buffer->get_size() : 0;
+}
+
+VkBuildAccelerationStructureFlagsKHR AccelerationStructure::get_build_flags() const
+{
+	return build_flags;
+}
+
+void AccelerationStructure::create_handle(VkDeviceSize size)
+{
+	// Create a buffer for the acceleration structure
+	buffer = std::make_unique<vkb::core::BufferC>(
+	    device,
+	    size,
+	    VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+	    VMA_MEMORY_USAGE_GPU_ONLY);
+
+	VkAccelerationStructureCreateInfoKHR acceleration_structure_create_info{};
+	acceleration_structure_create_info.sType  = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
+	acceleration_structure_create_info.buffer = buffer->get_handle();
+	acceleration_structure_create_info.size   = size;
+	acceleration_structure_create_info.type   = type;
+	VkResult result                           = vkCreateAccelerationStructureKHR(device.get_handle(), &acceleration_structure_create_info, nullptr, &handle);
+
+	if (result != VK_SUCCESS)
+	{
+		throw VulkanException{result, "Could not create acceleration structure"};
+	}
+
+	// Get the acceleration structure's handle
+	VkAccelerationStructureDeviceAddressInfoKHR acceleration_device_address_info{};
+	acceleration_device_address_info.sType                 = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
+	acceleration_device_address_info.accelerationStructure = handle;
+	device_address                                         = vkGetAccelerationStructureDeviceAddressKHR(device.get_handle(), &acceleration_device_address_info);
+}
+
+void AccelerationStructure::destroy_handle()
+{
+	if (handle != VK_NULL_HANDLE)
+	{
+		vkDestroyAccelerationStructureKHR(device.get_handle(), handle, nullptr);
+		handle = VK_NULL_HANDLE;
+	}
+	buffer.reset();
+	device_address = 0;
+}
+
+VkDeviceAddress AccelerationStructure::request_scratch_buffer(VkDeviceSize size)
+{
+	// Create a scratch buffer as a temporary storage for the acceleration structure build
+	if (!scratch_buffer || scratch_buffer->get_size() < size)
+	{
+		scratch_buffer = std::make_unique<vkb::core::BufferC>(
+		    device,
+		    size,
+		    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+		    VMA_MEMORY_USAGE_GPU_ONLY);
+	}
+	return scratch_buffer->get_device_address();
 }
 
 VkAccelerationStructureKHR AccelerationStructure::get_handle() const
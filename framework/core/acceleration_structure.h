@@ -1,4 +1,4 @@
-/* Copyright (c) 2021-2024, Sascha Willems
+/* Copyright (c) 2021-2025, Sascha Willems
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -107,6 +107,7 @@ class AccelerationStructure
 
 	/**
 	 * @brief Builds the acceleration structure on the device (requires at least one geometry to be added)
+	 *        The scratch buffer is kept between builds and only reallocated when a build needs more scratch memory
 	 * @param queue Queue to use for the build process
 	 * @param flags Build flags
 	 * @param mode Build mode (build or update)
@@ -115,6 +116,50 @@ class AccelerationStructure
 	           VkBuildAccelerationStructureFlagsKHR flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR,
 	           VkBuildAccelerationStructureModeKHR  mode  = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR);
 
+	/**
+	 * @brief Gathers the geometries, queries the build sizes and (re)creates the acceleration structure storage if needed
+	 *        Used by AccelerationStructureBuilder to batch the builds of many acceleration structures,
+	 *        the build itself is described by get_build_geometry_info() and get_build_range_infos()
+	 * @param flags Build flags
+	 * @param mode Build mode (build or update)
+	 * @return The sizes required by the build
+	 */
+	const VkAccelerationStructureBuildSizesInfoKHR &prepare_build(VkBuildAccelerationStructureFlagsKHR flags, VkBuildAccelerationStructureModeKHR mode);
+
+	/**
+	 * @return The build geometry info of the last prepare_build() call, using the given scratch memory
+	 */
+	VkAccelerationStructureBuildGeometryInfoKHR get_build_geometry_info(VkDeviceAddress scratch_address) const;
+
+	/**
+	 * @return The build ranges of the last prepare_build() call, one per geometry
+	 */
+	const VkAccelerationStructureBuildRangeInfoKHR *get_build_range_infos() const;
+
+	/**
+	 * @brief Moves the built acceleration structure into a new, smaller one by recording a compacting copy
+	 *        The original structure stays alive until release_uncompacted() is called, once the copy has completed.
+	 *        Requires a build with VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR.
+	 * @param command_buffer Command buffer to record the copy into
+	 * @param compacted_size Size reported by a VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR query
+	 */
+	void compact(VkCommandBuffer command_buffer, VkDeviceSize compacted_size);
+
+	/**
+	 * @brief Destroys the original structure left behind by compact()
+	 */
+	void release_uncompacted();
+
+	/**
+	 * @return The size of the memory backing the acceleration structure
+	 */
+	VkDeviceSize get_size() const;
+
+	/**
+	 * @return The flags of the last build, which an update has to repeat
+	 */
+	VkBuildAccelerationStructureFlagsKHR get_build_flags() const;
+
 	VkAccelerationStructureKHR get_handle() const;
 
 	const VkAccelerationStructureKHR *get() const;
@@ -132,6 +177,16 @@ class AccelerationStructure
 	}
 
   private:
+	void create_handle(VkDeviceSize size);
+
+	void destroy_handle();
+
+	/**
+	 * @brief Makes sure the scratch buffer holds at least size bytes
+	 * @return The device address of the scratch buffer
+	 */
+	VkDeviceAddress request_scratch_buffer(VkDeviceSize size);
+
 	Device &device;
 
 	VkAccelerationStructureKHR handle{VK_NULL_HANDLE};
@@ -152,6 +207,19 @@ class AccelerationStructure
 
 	std::unique_ptr<vkb::core::BufferC> scratch_buffer;
 
+	VkBuildAccelerationStructureFlagsKHR build_flags{};
+
+	VkAccelerationStructureBuildGeometryInfoKHR build_geometry_info{};
+
+	std::vector<VkAccelerationStructureGeometryKHR> build_geometries;
+
+	std::vector<VkAccelerationStructureBuildRangeInfoKHR> build_range_infos;
+
+	/// Original structure and storage, kept alive by compact() until the compacting copy has completed
+	VkAccelerationStructureKHR uncompacted_handle{VK_NULL_HANDLE};
+
+	std::unique_ptr<vkb::core::BufferC> uncompacted_buffer;
+
 	std::map<uint64_t, Geometry> geometries{};
 
 	std::unique_ptr<vkb::core::BufferC> buffer{nullptr};
@@ -0,0 +1,273 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "acceleration_structure_builder.h"
+
+#include "device.h"
+#include "timer.h"
+
+namespace vkb
+{
+namespace core
+{
+namespace
+{
+VkDeviceSize align_up(VkDeviceSize value, VkDeviceSize alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+}        // namespace
+
+AccelerationStructureBuilder::AccelerationStructureBuilder(Device &device, VkDeviceSize scratch_budget) :
+    device{device},
+    scratch_budget{scratch_budget}
+{
+	VkPhysicalDeviceAccelerationStructurePropertiesKHR acceleration_structure_properties{};
+	acceleration_structure_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR;
+
+	VkPhysicalDeviceProperties2 device_properties{};
+	device_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+	device_properties.pNext = &acceleration_structure_properties;
+	vkGetPhysicalDeviceProperties2(device.get_gpu().get_handle(), &device_properties);
+
+	scratch_alignment = std::max<VkDeviceSize>(acceleration_structure_properties.minAccelerationStructureScratchOffsetAlignment, 1);
+}
+
+void AccelerationStructureBuilder::add(AccelerationStructure &acceleration_structure, VkBuildAccelerationStructureFlagsKHR flags)
+{
+	requests.push_back({&acceleration_structure, flags, VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR, 0});
+}
+
+void AccelerationStructureBuilder::add_update(AccelerationStructure &acceleration_structure)
+{
+	assert(acceleration_structure.get_handle() != VK_NULL_HANDLE && "The acceleration structure must be built before it is updated");
+	assert((acceleration_structure.get_build_flags() & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR) && "The acceleration structure was not built to allow updates");
+
+	requests.push_back({&acceleration_structure, acceleration_structure.get_build_flags(), VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR, 0});
+}
+
+void AccelerationStructureBuilder::build(VkQueue queue)
+{
+	statistics = {};
+
+	if (requests.empty())
+	{
+		return;
+	}
+
+	Timer timer;
+	timer.start();
+
+	uint32_t     query_count     = 0;
+	VkDeviceSize largest_scratch = 0;
+	for (auto &request : requests)
+	{
+		auto &build_sizes    = request.acceleration_structure->prepare_build(request.flags, request.mode);
+		bool  is_update      = request.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+		request.scratch_size = align_up(is_update ? build_sizes.updateScratchSize : build_sizes.buildScratchSize, scratch_alignment);
+		largest_scratch      = std::max(largest_scratch, request.scratch_size);
+
+		// A refit keeps the storage of the original build, so only full builds are compacted
+		if (is_update)
+		{
+			statistics.update_count++;
+		}
+		else if (request.flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR)
+		{
+			request.query = query_count++;
+		}
+
+		statistics.original_size += request.acceleration_structure->get_size();
+	}
+	statistics.structure_count = to_u32(requests.size());
+
+	// The arena is reused across calls, and over-allocated so that its base can be aligned
+	VkDeviceSize arena_size = std::max(scratch_budget, largest_scratch);
+	if (!scratch_buffer || scratch_buffer->get_size() < arena_size + scratch_alignment)
+	{
+		scratch_buffer = std::make_unique<vkb::core::BufferC>(
+		    device,
+		    arena_size + scratch_alignment,
+		    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+		    VMA_MEMORY_USAGE_GPU_ONLY);
+		scratch_buffer->set_debug_name("Acceleration structure scratch arena");
+	}
+	statistics.scratch_size = scratch_buffer->get_size();
+
+	VkDeviceAddress scratch_address = align_up(scratch_buffer->get_device_address(), scratch_alignment);
+
+	if (query_count > query_pool_size)
+	{
+		VkQueryPoolCreateInfo query_pool_create_info{};
+		query_pool_create_info.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		query_pool_create_info.queryType  = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR;
+		query_pool_create_info.queryCount = query_count;
+
+		query_pool      = std::make_unique<QueryPool>(device, query_pool_create_info);
+		query_pool_size = query_count;
+	}
+
+	VkCommandBuffer command_buffer = device.create_command_buffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
+
+	if (query_count > 0)
+	{
+		vkCmdResetQueryPool(command_buffer, query_pool->get_handle(), 0, query_count);
+	}
+
+	// Split the requests into batches whose scratch ranges fit in the arena
+	size_t       first_request  = 0;
+	VkDeviceSize scratch_offset = 0;
+	for (size_t i = 0; i < requests.size(); i++)
+	{
+		if (scratch_offset + requests[i].scratch_size > arena_size)
+		{
+			record_batch(command_buffer, first_request, i, scratch_address);
+			first_request  = i;
+			scratch_offset = 0;
+		}
+		scratch_offset += requests[i].scratch_size;
+	}
+	record_batch(command_buffer, first_request, requests.size(), scratch_address);
+
+	device.flush_command_buffer(command_buffer, queue);
+
+	statistics.build_time = timer.stop<Timer::Milliseconds>();
+
+	if (query_count > 0)
+	{
+		compact(queue, query_count);
+	}
+	else
+	{
+		statistics.final_size = statistics.original_size;
+	}
+
+	// Refits happen every frame, so only report the builds that create structures
+	if (statistics.update_count < statistics.structure_count)
+	{
+		LOGI("Built {} acceleration structures in {} batches in {:.2f} ms, compacted {} in {:.2f} ms, {} KiB saved",
+		     statistics.structure_count, statistics.batch_count, statistics.build_time,
+		     statistics.compacted_count, statistics.compaction_time,
+		     (statistics.original_size - statistics.final_size) / 1024);
+	}
+
+	requests.clear();
+}
+
+const AccelerationStructureBuilder::Statistics &AccelerationStructureBuilder::get_statistics() const
+{
+	return statistics;
+}
+
+void AccelerationStructureBuilder::record_batch(VkCommandBuffer command_buffer, size_t first, size_t last, VkDeviceAddress scratch_address)
+{
+	std::vector<VkAccelerationStructureBuildGeometryInfoKHR>     build_geometry_infos;
+	std::vector<const VkAccelerationStructureBuildRangeInfoKHR *> build_range_infos;
+	std::vector<VkAccelerationStructureKHR>                       compacted_handles;
+	uint32_t                                                      first_query = 0;
+
+	for (size_t i = first; i < last; i++)
+	{
+		auto &request = requests[i];
+
+		build_geometry_infos.push_back(request.acceleration_structure->get_build_geometry_info(scratch_address));
+		build_range_infos.push_back(request.acceleration_structure->get_build_range_infos());
+		scratch_address += request.scratch_size;
+
+		if (request.query != ~0u)
+		{
+			if (compacted_handles.empty())
+			{
+				first_query = request.query;
+			}
+			compacted_handles.push_back(request.acceleration_structure->get_handle());
+		}
+	}
+
+	vkCmdBuildAccelerationStructuresKHR(
+	    command_buffer,
+	    to_u32(build_geometry_infos.size()),
+	    build_geometry_infos.data(),
+	    build_range_infos.data());
+
+	// Makes the builds visible to the compacted size queries, and lets the next batch reuse the scratch arena
+	VkMemoryBarrier barrier{};
+	barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+	barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+	vkCmdPipelineBarrier(command_buffer,
+	                     VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+	                     VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+	                     0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+	if (!compacted_handles.empty())
+	{
+		vkCmdWriteAccelerationStructuresPropertiesKHR(command_buffer,
+		                                              to_u32(compacted_handles.size()),
+		                                              compacted_handles.data(),
+		                                              VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
+		                                              query_pool->get_handle(),
+		                                              first_query);
+	}
+
+	statistics.batch_count++;
+}
+
+void AccelerationStructureBuilder::compact(VkQueue queue, uint32_t query_count)
+{
+	Timer timer;
+	timer.start();
+
+	std::vector<VkDeviceSize> compacted_sizes(query_count);
+	VK_CHECK(query_pool->get_results(0, query_count, compacted_sizes.size() * sizeof(VkDeviceSize), compacted_sizes.data(), sizeof(VkDeviceSize),
+	                                 VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+
+	VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+	for (auto &request : requests)
+	{
+		VkDeviceSize size = request.acceleration_structure->get_size();
+
+		// Only structures that actually shrink are worth a copy
+		if (request.query != ~0u && compacted_sizes[request.query] < size)
+		{
+			if (command_buffer == VK_NULL_HANDLE)
+			{
+				command_buffer = device.create_command_buffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
+			}
+
+			size = compacted_sizes[request.query];
+			request.acceleration_structure->compact(command_buffer, size);
+			statistics.compacted_count++;
+		}
+
+		statistics.final_size += size;
+	}
+
+	if (command_buffer != VK_NULL_HANDLE)
+	{
+		device.flush_command_buffer(command_buffer, queue);
+
+		for (auto &request : requests)
+		{
+			request.acceleration_structure->release_uncompacted();
+		}
+	}
+
+	statistics.compaction_time = timer.stop<Timer::Milliseconds>();
+}
+}        // namespace core
+}        // namespace vkb
@@ -0,0 +1,152 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "common/helpers.h"
+#include "common/vk_common.h"
+#include "core/acceleration_structure.h"
+#include "core/query_pool.h"
+
+namespace vkb
+{
+class Device;
+
+namespace core
+{
+/**
+ * @brief Builds many acceleration structures with a single submission
+ *
+ * Queued structures are built with as few vkCmdBuildAccelerationStructuresKHR calls as the scratch
+ * arena allows: every build of a batch gets its own aligned range of one shared scratch buffer, and
+ * consecutive batches are separated by a barrier so they can reuse it. The scratch buffer is kept
+ * between build() calls and only grows when a single build does not fit.
+ *
+ * Structures queued with VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR have their compacted
+ * size queried during the build and are then copied into right-sized storage with a second submission.
+ * Compaction moves a structure, so device addresses must be read (e.g. for TLAS instances) after build().
+ *
+ * Refits of updatable structures are queued with add_update() and share the same scratch arena, so a builder
+ * kept alive for the lifetime of a sample refits its dynamic geometry every frame without any scratch allocation.
+ */
+class AccelerationStructureBuilder
+{
+  public:
+	struct Statistics
+	{
+		uint32_t structure_count{0};
+
+		uint32_t batch_count{0};
+
+		uint32_t compacted_count{0};
+
+		uint32_t update_count{0};
+
+		/// Time spent building, including the wait for the device, in milliseconds
+		double build_time{0.0};
+
+		/// Time spent compacting, including the wait for the device, in milliseconds
+		double compaction_time{0.0};
+
+		/// Size of the structures as built
+		VkDeviceSize original_size{0};
+
+		/// Size of the structures after compaction
+		VkDeviceSize final_size{0};
+
+		VkDeviceSize scratch_size{0};
+	};
+
+	/**
+	 * @param device A valid Vulkan device
+	 * @param scratch_budget Size of the scratch arena shared by the builds of a batch
+	 */
+	AccelerationStructureBuilder(Device &device, VkDeviceSize scratch_budget = 32 * 1024 * 1024);
+
+	AccelerationStructureBuilder(const AccelerationStructureBuilder &) = delete;
+
+	AccelerationStructureBuilder(AccelerationStructureBuilder &&) = delete;
+
+	AccelerationStructureBuilder &operator=(const AccelerationStructureBuilder &) = delete;
+
+	AccelerationStructureBuilder &operator=(AccelerationStructureBuilder &&) = delete;
+
+	/**
+	 * @brief Queues a full build of an acceleration structure, which must outlive the next build() call
+	 * @param acceleration_structure Acceleration structure with at least one geometry
+	 * @param flags Build flags, include VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR to compact it
+	 */
+	void add(AccelerationStructure                &acceleration_structure,
+	         VkBuildAccelerationStructureFlagsKHR flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR);
+
+	/**
+	 * @brief Queues a refit of an acceleration structure, which must outlive the next build() call
+	 * @param acceleration_structure Acceleration structure built with VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR
+	 */
+	void add_update(AccelerationStructure &acceleration_structure);
+
+	/**
+	 * @brief Builds or refits, and compacts where requested, every queued acceleration structure, then waits for the device
+	 * @param queue Queue to use for the build process
+	 */
+	void build(VkQueue queue);
+
+	/**
+	 * @return Statistics of the last build() call
+	 */
+	const Statistics &get_statistics() const;
+
+  private:
+	struct Request
+	{
+		AccelerationStructure *acceleration_structure;
+
+		VkBuildAccelerationStructureFlagsKHR flags;
+
+		VkBuildAccelerationStructureModeKHR mode;
+
+		VkDeviceSize scratch_size;
+
+		/// Index of the compacted size query, or ~0 if the structure is not compacted
+		uint32_t query{~0u};
+	};
+
+	/**
+	 * @brief Records the builds of requests [first, last) in one call, then the compacted size queries
+	 */
+	void record_batch(VkCommandBuffer command_buffer, size_t first, size_t last, VkDeviceAddress scratch_address);
+
+	void compact(VkQueue queue, uint32_t query_count);
+
+	Device &device;
+
+	VkDeviceSize scratch_budget;
+
+	VkDeviceSize scratch_alignment{256};
+
+	std::vector<Request> requests;
+
+	std::unique_ptr<vkb::core::BufferC> scratch_buffer;
+
+	std::unique_ptr<QueryPool> query_pool;
+
+	uint32_t query_pool_size{0};
+
+	Statistics statistics;
+};
+}        // namespace core
+}        // namespace vkb
@@ -25,9 +25,10 @@
 #include "core/physical_device.h"
 #include "hpp_resource_binding_state.h"
 #include "rendering/hpp_pipeline_state.h"
-#include "rendering/hpp_render_frame.h"
+#include "rendering/render_frame.h"
 #include "rendering/hpp_render_target.h"
 #include "rendering/subpass.h"
+#include "shader_object_cache.h"
 
 namespace vkb
 {
@@ -175,6 +176,7 @@ class CommandBuffer
 	void                   draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance);
 	void                   draw_indexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance);
 	void                   draw_indexed_indirect(vkb::core::Buffer<bindingType> const &buffer, DeviceSizeType offset, uint32_t draw_count, uint32_t stride);
+	void                   draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z);
 	void                   end();
 	void                   end_query(QueryPoolType const &query_pool, uint32_t query);
 	void                   end_render_pass();
@@ -186,6 +188,7 @@ class CommandBuffer
 	                                       std::vector<std::unique_ptr<vkb::rendering::Subpass<bindingType>>> const &subpasses);
 	void                   image_memory_barrier(ImageViewType const &image_view, ImageMemoryBarrierType const &memory_barrier) const;
 	void                   next_subpass();
+	void                   next_subpass(SubpassContentsType contents);
 
 	/**
 	 * @brief Records byte data into the command buffer to be pushed as push constants to each draw call
@@ -252,6 +255,10 @@ class CommandBuffer
 	                                                 vkb::core::HPPFramebuffer const       &framebuffer,
 	                                                 std::vector<vk::ClearValue> const     &clear_values,
 	                                                 vk::SubpassContents                    contents);
+	void                      begin_rendering_impl(vkb::rendering::HPPRenderTarget const            &render_target,
+	                                               std::vector<vkb::common::HPPLoadStoreInfo> const &load_store_infos,
+	                                               std::vector<vk::ClearValue> const                &clear_values,
+	                                               vkb::rendering::SubpassCpp const                 &subpass);
 	void                      bind_vertex_buffers_impl(uint32_t                                                               first_binding,
 	                                                   std::vector<std::reference_wrapper<const vkb::core::BufferCpp>> const &buffers,
 	                                                   std::vector<vk::DeviceSize> const                                     &offsets);
@@ -264,12 +271,15 @@ class CommandBuffer
 	void                      flush_impl(vkb::core::HPPDevice &device, vk::PipelineBindPoint pipeline_bind_point);
 	void                      flush_descriptor_state_impl(vk::PipelineBindPoint pipeline_bind_point);
 	void                      flush_pipeline_state_impl(vkb::core::HPPDevice &device, vk::PipelineBindPoint pipeline_bind_point);
+	void                      flush_shader_object_state_impl(vkb::core::HPPDevice &device, vk::PipelineBindPoint pipeline_bind_point);
 	vkb::core::HPPRenderPass &get_render_pass_impl(vkb::core::HPPDevice                                           &device,
 	                                               vkb::rendering::HPPRenderTarget const                          &render_target,
 	                                               std::vector<vkb::common::HPPLoadStoreInfo> const               &load_store_infos,
 	                                               std::vector<std::unique_ptr<vkb::rendering::SubpassCpp>> const &subpasses);
 	void                      image_memory_barrier_impl(vkb::core::HPPImageView const &image_view, vkb::common::HPPImageMemoryBarrier const &memory_barrier) const;
+	void                      next_subpass_impl(vk::SubpassContents contents);
 	vk::Result                reset_impl(vkb::CommandBufferResetMode reset_mode);
+	bool                      uses_shader_objects(vk::PipelineBindPoint pipeline_bind_point) const;
 
   private:
 	vkb::core::CommandPoolCpp                                              &command_pool;
@@ -287,6 +297,13 @@ class CommandBuffer
 	// If true, it becomes the responsibility of the caller to update ANY descriptor bindings
 	// that contain update after bind, as they wont be implicitly updated
 	bool update_after_bind = false;
+
+	// If true, shader objects are bound and the pipeline state is set with dynamic state commands, instead of pipelines.
+	// Graphics shader objects are only bound inside dynamic rendering, render passes keep using pipelines
+	bool shader_objects = false;
+
+	// If true, the current render pass was begun with dynamic rendering instead of a VkRenderPass
+	bool dynamic_rendering = false;
 };
 
 using CommandBufferC   = CommandBuffer<vkb::BindingType::C>;
@@ -380,6 +397,9 @@ inline void CommandBuffer<bindingType>::begin_impl(vk::CommandBufferUsageFlags
 	descriptor_set_layout_binding_state.clear();
 	stored_push_constants.clear();
 
+	shader_objects    = this->get_device().get_resource_cache().uses_shader_objects();
+	dynamic_rendering = false;
+
 	vk::CommandBufferBeginInfo       begin_info(flags);
 	vk::CommandBufferInheritanceInfo inheritance;
 
@@ -395,6 +415,13 @@ inline void CommandBuffer<bindingType>::begin_impl(vk::CommandBufferUsageFlags
 		inheritance.subpass     = subpass_index;
 
 		begin_info.pInheritanceInfo = &inheritance;
+
+		// Pipelines must be created for the subpass the commands are executed in
+		pipeline_state.set_subpass_index(subpass_index);
+
+		auto blend_state = pipeline_state.get_color_blend_state();
+		blend_state.attachments.resize(current_render_pass->get_color_output_count(subpass_index));
+		pipeline_state.set_color_blend_state(blend_state);
 	}
 
 	this->get_resource().begin(begin_info);
@@ -425,6 +452,25 @@ inline void CommandBuffer<bindingType>::begin_render_pass(RenderTargetType const
 	resource_binding_state.reset();
 	descriptor_set_layout_binding_state.clear();
 
+	// Graphics shader objects must be bound inside dynamic rendering, which replaces a render pass with a single subpass.
+	// Passes with several subpasses or input attachments, or recorded in secondary command buffers, keep using pipelines
+	if (shader_objects && (level == vk::CommandBufferLevel::ePrimary) && (subpasses.size() == 1) && subpasses[0]->get_input_attachments().empty() &&
+	    (static_cast<vk::SubpassContents>(contents) == vk::SubpassContents::eInline))
+	{
+		if constexpr (bindingType == vkb::BindingType::Cpp)
+		{
+			begin_rendering_impl(render_target, load_store_infos, clear_values, *subpasses[0]);
+		}
+		else
+		{
+			begin_rendering_impl(reinterpret_cast<vkb::rendering::HPPRenderTarget const &>(render_target),
+			                     reinterpret_cast<std::vector<vkb::common::HPPLoadStoreInfo> const &>(load_store_infos),
+			                     reinterpret_cast<std::vector<vk::ClearValue> const &>(clear_values),
+			                     reinterpret_cast<vkb::rendering::SubpassCpp const &>(*subpasses[0]));
+		}
+		return;
+	}
+
 	auto &render_pass = get_render_pass(render_target, load_store_infos, subpasses);
 	auto &framebuffer = this->get_device().get_resource_cache().request_framebuffer(render_target, render_pass);
 
@@ -461,6 +507,7 @@ inline void CommandBuffer<bindingType>::begin_render_pass_impl(vkb::rendering::H
 {
 	current_render_pass = &render_pass;
 	current_framebuffer = &framebuffer;
+	dynamic_rendering   = false;
 
 	// Begin render pass
 	vk::RenderPassBeginInfo begin_info(current_render_pass->get_handle(), current_framebuffer->get_handle(), {{}, render_target.get_extent()}, clear_values);
@@ -488,6 +535,90 @@ inline void CommandBuffer<bindingType>::begin_render_pass_impl(vkb::rendering::H
 	pipeline_state.set_color_blend_state(blend_state);
 }
 
+template <vkb::BindingType bindingType>
+inline void CommandBuffer<bindingType>::begin_rendering_impl(vkb::rendering::HPPRenderTarget const            &render_target,
+                                                             std::vector<vkb::common::HPPLoadStoreInfo> const &load_store_infos,
+                                                             std::vector<vk::ClearValue> const                &clear_values,
+                                                             vkb::rendering::SubpassCpp const                 &subpass)
+{
+	current_render_pass = nullptr;
+	current_framebuffer = nullptr;
+	dynamic_rendering   = true;
+
+	auto const &attachments = render_target.get_attachments();
+	auto const &views       = render_target.get_views();
+
+	// The attachments are used in the layouts a render pass with this single subpass would use, so that it starts and ends in them
+	auto get_attachment_info = [&](uint32_t attachment, vk::ImageLayout default_layout) {
+		vk::RenderingAttachmentInfoKHR attachment_info;
+		attachment_info.imageView   = views[attachment].get_handle();
+		attachment_info.imageLayout = attachments[attachment].initial_layout == vk::ImageLayout::eUndefined ? default_layout : attachments[attachment].initial_layout;
+		if (attachment < load_store_infos.size())
+		{
+			attachment_info.loadOp  = load_store_infos[attachment].load_op;
+			attachment_info.storeOp = load_store_infos[attachment].store_op;
+		}
+		if (attachment < clear_values.size())
+		{
+			attachment_info.clearValue = clear_values[attachment];
+		}
+		return attachment_info;
+	};
+
+	std::vector<vk::RenderingAttachmentInfoKHR> color_attachments;
+	for (auto o_attachment : subpass.get_output_attachments())
+	{
+		if (!vkb::common::is_depth_format(attachments[o_attachment].format))
+		{
+			color_attachments.push_back(get_attachment_info(o_attachment, vk::ImageLayout::eColorAttachmentOptimal));
+		}
+	}
+
+	auto const &color_resolve_attachments = subpass.get_color_resolve_attachments();
+	for (size_t i = 0; i < std::min(color_attachments.size(), color_resolve_attachments.size()); ++i)
+	{
+		auto resolve_info                       = get_attachment_info(color_resolve_attachments[i], vk::ImageLayout::eColorAttachmentOptimal);
+		color_attachments[i].resolveMode        = vk::ResolveModeFlagBits::eAverage;
+		color_attachments[i].resolveImageView   = resolve_info.imageView;
+		color_attachments[i].resolveImageLayout = resolve_info.imageLayout;
+	}
+
+	vk::RenderingInfoKHR rendering_info({}, {{}, render_target.get_extent()}, 1, 0, color_attachments);
+
+	vk::RenderingAttachmentInfoKHR depth_attachment;
+	vk::RenderingAttachmentInfoKHR stencil_attachment;
+	if (!subpass.get_disable_depth_stencil_attachment())
+	{
+		auto it = std::find_if(attachments.begin(), attachments.end(), [](auto const &attachment) { return vkb::common::is_depth_format(attachment.format); });
+		if (it != attachments.end())
+		{
+			depth_attachment = get_attachment_info(to_u32(std::distance(attachments.begin(), it)), vk::ImageLayout::eDepthStencilAttachmentOptimal);
+
+			// Like the render passes, only the depth aspect is resolved
+			stencil_attachment = depth_attachment;
+			if (subpass.get_depth_stencil_resolve_mode() != vk::ResolveModeFlagBits::eNone)
+			{
+				auto resolve_info                   = get_attachment_info(subpass.get_depth_stencil_resolve_attachment(), vk::ImageLayout::eDepthStencilAttachmentOptimal);
+				depth_attachment.resolveMode        = subpass.get_depth_stencil_resolve_mode();
+				depth_attachment.resolveImageView   = resolve_info.imageView;
+				depth_attachment.resolveImageLayout = resolve_info.imageLayout;
+			}
+
+			rendering_info.pDepthAttachment = &depth_attachment;
+			if (vkb::common::is_depth_stencil_format(it->format))
+			{
+				rendering_info.pStencilAttachment = &stencil_attachment;
+			}
+		}
+	}
+
+	this->get_resource().beginRenderingKHR(rendering_info);
+
+	auto blend_state = pipeline_state.get_color_blend_state();
+	blend_state.attachments.resize(color_attachments.size());
+	pipeline_state.set_color_blend_state(blend_state);
+}
+
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::bind_buffer(
     vkb::core::Buffer<bindingType> const &buffer, DeviceSizeType offset, DeviceSizeType range, uint32_t set, uint32_t binding, uint32_t array_element)
@@ -805,6 +936,13 @@ inline void CommandBuffer<bindingType>::draw_indexed_indirect(vkb::core::Buffer<
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void CommandBuffer<bindingType>::draw_mesh_tasks(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+{
+	flush(vk::PipelineBindPoint::eGraphics);
+	this->get_resource().drawMeshTasksEXT(group_count_x, group_count_y, group_count_z);
+}
+
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::end()
 {
@@ -827,7 +965,15 @@ inline void CommandBuffer<bindingType>::end_query(QueryPoolType const &query_poo
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::end_render_pass()
 {
-	this->get_resource().endRenderPass();
+	if (dynamic_rendering)
+	{
+		this->get_resource().endRenderingKHR();
+		dynamic_rendering = false;
+	}
+	else
+	{
+		this->get_resource().endRenderPass();
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -969,6 +1115,27 @@ inline void CommandBuffer<bindingType>::image_memory_barrier_impl(vkb::core::HPP
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::next_subpass()
 {
+	next_subpass_impl(vk::SubpassContents::eInline);
+}
+
+template <vkb::BindingType bindingType>
+inline void CommandBuffer<bindingType>::next_subpass(SubpassContentsType contents)
+{
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		next_subpass_impl(contents);
+	}
+	else
+	{
+		next_subpass_impl(static_cast<vk::SubpassContents>(contents));
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline void CommandBuffer<bindingType>::next_subpass_impl(vk::SubpassContents contents)
+{
+	assert(!dynamic_rendering && "Dynamic rendering is only begun for render passes with a single subpass");
+
 	// Increment subpass index
 	pipeline_state.set_subpass_index(pipeline_state.get_subpass_index() + 1);
 
@@ -984,7 +1151,7 @@ inline void CommandBuffer<bindingType>::next_subpass()
 	// Clear stored push constants
 	stored_push_constants.clear();
 
-	this->get_resource().nextSubpass(vk::SubpassContents::eInline);
+	this->get_resource().nextSubpass(contents);
 }
 
 template <vkb::BindingType bindingType>
@@ -1168,13 +1335,17 @@ inline void CommandBuffer<bindingType>::set_rasterization_state(RasterizationSta
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::set_scissor(uint32_t first_scissor, std::vector<Rect2DType> const &scissors)
 {
-	if constexpr (bindingType == vkb::BindingType::Cpp)
+	std::vector<vk::Rect2D> const &scissors_ = reinterpret_cast<std::vector<vk::Rect2D> const &>(scissors);
+
+	// Shader objects require the scissor count to be dynamic as well
+	if (uses_shader_objects(vk::PipelineBindPoint::eGraphics))
 	{
-		this->get_resource().setScissor(first_scissor, scissors);
+		assert(first_scissor == 0 && "Scissors are set from the first one with shader objects");
+		this->get_resource().setScissorWithCountEXT(scissors_);
 	}
 	else
 	{
-		this->get_resource().setScissor(first_scissor, reinterpret_cast<std::vector<vk::Rect2D> const &>(scissors));
+		this->get_resource().setScissor(first_scissor, scissors_);
 	}
 }
 
@@ -1220,13 +1391,17 @@ inline void CommandBuffer<bindingType>::set_vertex_input_state(VertexInputStateT
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::set_viewport(uint32_t first_viewport, std::vector<ViewportType> const &viewports)
 {
-	if constexpr (bindingType == vkb::BindingType::Cpp)
+	std::vector<vk::Viewport> const &viewports_ = reinterpret_cast<std::vector<vk::Viewport> const &>(viewports);
+
+	// Shader objects require the viewport count to be dynamic as well
+	if (uses_shader_objects(vk::PipelineBindPoint::eGraphics))
 	{
-		this->get_resource().setViewport(first_viewport, viewports);
+		assert(first_viewport == 0 && "Viewports are set from the first one with shader objects");
+		this->get_resource().setViewportWithCountEXT(viewports_);
 	}
 	else
 	{
-		this->get_resource().setViewport(first_viewport, reinterpret_cast<std::vector<vk::Viewport> const &>(viewports));
+		this->get_resource().setViewport(first_viewport, viewports_);
 	}
 }
 
@@ -1256,6 +1431,13 @@ inline void CommandBuffer<bindingType>::update_buffer(vkb::core::Buffer<bindingT
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline bool CommandBuffer<bindingType>::uses_shader_objects(vk::PipelineBindPoint pipeline_bind_point) const
+{
+	// Graphics shader objects cannot be bound in a VkRenderPass, those passes keep using pipelines
+	return shader_objects && ((pipeline_bind_point != vk::PipelineBindPoint::eGraphics) || dynamic_rendering);
+}
+
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::write_timestamp(PipelineStagFlagBitsType pipeline_stage, QueryPoolType const &query_pool, uint32_t query)
 {
@@ -1453,6 +1635,12 @@ inline void CommandBuffer<bindingType>::flush_pipeline_state_impl(vkb::core::HPP
 
 	pipeline_state.clear_dirty();
 
+	if (uses_shader_objects(pipeline_bind_point))
+	{
+		flush_shader_object_state_impl(device, pipeline_bind_point);
+		return;
+	}
+
 	// Create and bind pipeline
 	if (pipeline_bind_point == vk::PipelineBindPoint::eGraphics)
 	{
@@ -1473,6 +1661,118 @@ inline void CommandBuffer<bindingType>::flush_pipeline_state_impl(vkb::core::HPP
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void CommandBuffer<bindingType>::flush_shader_object_state_impl(vkb::core::HPPDevice &device, vk::PipelineBindPoint pipeline_bind_point)
+{
+	if (pipeline_bind_point != vk::PipelineBindPoint::eGraphics && pipeline_bind_point != vk::PipelineBindPoint::eCompute)
+	{
+		throw "Only graphics and compute pipeline bind points are supported now";
+	}
+
+	auto const &binding = device.get_resource_cache().request_shader_objects(pipeline_state);
+
+	this->get_resource().bindShadersEXT(vk::ArrayProxy<const vk::ShaderStageFlagBits>(to_u32(binding.stages.size()), reinterpret_cast<vk::ShaderStageFlagBits const *>(binding.stages.data())),
+	                                    vk::ArrayProxy<const vk::ShaderEXT>(to_u32(binding.shaders.size()), reinterpret_cast<vk::ShaderEXT const *>(binding.shaders.data())));
+
+	if (pipeline_bind_point == vk::PipelineBindPoint::eCompute)
+	{
+		return;
+	}
+
+	// Every state a pipeline would be created with is set dynamically instead
+	auto const &features = device.get_gpu().get_requested_features();
+
+	auto const &vertex_input_state = pipeline_state.get_vertex_input_state();
+
+	std::vector<vk::VertexInputBindingDescription2EXT> vertex_bindings;
+	for (auto const &vertex_binding : vertex_input_state.bindings)
+	{
+		vertex_bindings.emplace_back(vertex_binding.binding, vertex_binding.stride, vertex_binding.inputRate, 1);
+	}
+
+	std::vector<vk::VertexInputAttributeDescription2EXT> vertex_attributes;
+	for (auto const &vertex_attribute : vertex_input_state.attributes)
+	{
+		vertex_attributes.emplace_back(vertex_attribute.location, vertex_attribute.binding, vertex_attribute.format, vertex_attribute.offset);
+	}
+
+	this->get_resource().setVertexInputEXT(vertex_bindings, vertex_attributes);
+
+	auto const &input_assembly_state = pipeline_state.get_input_assembly_state();
+	this->get_resource().setPrimitiveTopologyEXT(input_assembly_state.topology);
+	this->get_resource().setPrimitiveRestartEnableEXT(input_assembly_state.primitive_restart_enable);
+
+	auto const &rasterization_state = pipeline_state.get_rasterization_state();
+	this->get_resource().setRasterizerDiscardEnableEXT(rasterization_state.rasterizer_discard_enable);
+	this->get_resource().setCullModeEXT(rasterization_state.cull_mode);
+	this->get_resource().setFrontFaceEXT(rasterization_state.front_face);
+	this->get_resource().setDepthBiasEnableEXT(rasterization_state.depth_bias_enable);
+	this->get_resource().setPolygonModeEXT(rasterization_state.polygon_mode);
+	if (features.depthClamp)
+	{
+		this->get_resource().setDepthClampEnableEXT(rasterization_state.depth_clamp_enable);
+	}
+
+	// Sample shading cannot be set dynamically, so it is ignored with shader objects
+	auto const &multisample_state = pipeline_state.get_multisample_state();
+	this->get_resource().setRasterizationSamplesEXT(multisample_state.rasterization_samples);
+
+	std::vector<vk::SampleMask> sample_mask((static_cast<uint32_t>(multisample_state.rasterization_samples) + 31) / 32,
+	                                        multisample_state.sample_mask ? multisample_state.sample_mask : ~0u);
+	this->get_resource().setSampleMaskEXT(multisample_state.rasterization_samples, sample_mask.data());
+	this->get_resource().setAlphaToCoverageEnableEXT(multisample_state.alpha_to_coverage_enable);
+	if (features.alphaToOne)
+	{
+		this->get_resource().setAlphaToOneEnableEXT(multisample_state.alpha_to_one_enable);
+	}
+
+	auto const &depth_stencil_state = pipeline_state.get_depth_stencil_state();
+	this->get_resource().setDepthTestEnableEXT(depth_stencil_state.depth_test_enable);
+	this->get_resource().setDepthWriteEnableEXT(depth_stencil_state.depth_write_enable);
+	this->get_resource().setDepthCompareOpEXT(depth_stencil_state.depth_compare_op);
+	this->get_resource().setDepthBoundsTestEnableEXT(depth_stencil_state.depth_bounds_test_enable);
+	this->get_resource().setStencilTestEnableEXT(depth_stencil_state.stencil_test_enable);
+	this->get_resource().setStencilOpEXT(vk::StencilFaceFlagBits::eFront,
+	                                     static_cast<vk::StencilOp>(depth_stencil_state.front.fail_op),
+	                                     static_cast<vk::StencilOp>(depth_stencil_state.front.pass_op),
+	                                     static_cast<vk::StencilOp>(depth_stencil_state.front.depth_fail_op),
+	                                     static_cast<vk::CompareOp>(depth_stencil_state.front.compare_op));
+	this->get_resource().setStencilOpEXT(vk::StencilFaceFlagBits::eBack,
+	                                     static_cast<vk::StencilOp>(depth_stencil_state.back.fail_op),
+	                                     static_cast<vk::StencilOp>(depth_stencil_state.back.pass_op),
+	                                     static_cast<vk::StencilOp>(depth_stencil_state.back.depth_fail_op),
+	                                     static_cast<vk::CompareOp>(depth_stencil_state.back.compare_op));
+
+	auto const &color_blend_state = pipeline_state.get_color_blend_state();
+	if (features.logicOp)
+	{
+		this->get_resource().setLogicOpEnableEXT(color_blend_state.logic_op_enable);
+		this->get_resource().setLogicOpEXT(color_blend_state.logic_op);
+	}
+
+	if (!color_blend_state.attachments.empty())
+	{
+		std::vector<vk::Bool32>                blend_enables;
+		std::vector<vk::ColorBlendEquationEXT> blend_equations;
+		std::vector<vk::ColorComponentFlags>   write_masks;
+		for (auto const &attachment : color_blend_state.attachments)
+		{
+			blend_enables.push_back(attachment.blend_enable);
+			blend_equations.emplace_back(attachment.src_color_blend_factor,
+			                             attachment.dst_color_blend_factor,
+			                             attachment.color_blend_op,
+			                             attachment.src_alpha_blend_factor,
+			                             attachment.dst_alpha_blend_factor,
+			                             attachment.alpha_blend_op);
+			write_masks.push_back(attachment.color_write_mask);
+		}
+
+		this->get_resource().setColorBlendEnableEXT(0, blend_enables);
+		this->get_resource().setColorBlendEquationEXT(0, blend_equations);
+		this->get_resource().setColorWriteMaskEXT(0, write_masks);
+	}
+}
+
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::flush_push_constants()
 {
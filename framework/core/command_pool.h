@@ -24,12 +24,14 @@
 namespace vkb
 {
 class Device;
-class RenderFrame;
 
 namespace rendering
 {
-class HPPRenderFrame;
-}
+template <vkb::BindingType bindingType>
+class RenderFrame;
+using RenderFrameC   = RenderFrame<vkb::BindingType::C>;
+using RenderFrameCpp = RenderFrame<vkb::BindingType::Cpp>;
+}        // namespace rendering
 
 namespace core
 {
@@ -62,7 +64,7 @@ class CommandPool
 	using CommandPoolType        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::CommandPool, VkCommandPool>::type;
 
 	using DeviceType      = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDevice, vkb::Device>::type;
-	using RenderFrameType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPRenderFrame, vkb::RenderFrame>::type;
+	using RenderFrameType = vkb::rendering::RenderFrame<bindingType>;
 
   public:
 	CommandPool(DeviceType                 &device,
@@ -92,7 +94,7 @@ class CommandPool
   private:
 	vkb::core::HPPDevice                    &device;
 	vk::CommandPool                          handle             = nullptr;
-	vkb::rendering::HPPRenderFrame          *render_frame       = nullptr;
+	vkb::rendering::RenderFrameCpp          *render_frame       = nullptr;
 	size_t                                   thread_index       = 0;
 	uint32_t                                 queue_family_index = 0;
 	std::vector<vkb::core::CommandBufferCpp> primary_command_buffers;
@@ -116,7 +118,7 @@ namespace core
 template <vkb::BindingType bindingType>
 inline vkb::core::CommandPool<bindingType>::CommandPool(
     DeviceType &device_, uint32_t queue_family_index, RenderFrameType *render_frame_, size_t thread_index, vkb::CommandBufferResetMode reset_mode) :
-    device{reinterpret_cast<vkb::core::HPPDevice &>(device_)}, render_frame{reinterpret_cast<vkb::rendering::HPPRenderFrame *>(render_frame_)}, thread_index{thread_index}, reset_mode{reset_mode}
+    device{reinterpret_cast<vkb::core::HPPDevice &>(device_)}, render_frame{reinterpret_cast<vkb::rendering::RenderFrameCpp *>(render_frame_)}, thread_index{thread_index}, reset_mode{reset_mode}
 {
 	vk::CommandPoolCreateFlags flags;
 	switch (reset_mode)
@@ -191,7 +193,7 @@ inline typename vkb::core::CommandPool<bindingType>::RenderFrameType *CommandPoo
 	}
 	else
 	{
-		return reinterpret_cast<vkb::RenderFrame *>(render_frame);
+		return reinterpret_cast<vkb::rendering::RenderFrameC *>(render_frame);
 	}
 }
 
@@ -19,6 +19,7 @@
 
 #include "core/command_buffer.h"
 #include "core/device.h"
+#include "stats/gpu_profiler.h"
 
 #include <glm/gtc/type_ptr.hpp>
 #include <unordered_map>
@@ -188,6 +189,8 @@ ScopedDebugLabel::ScopedDebugLabel(const DebugUtils &debug_utils, VkCommandBuffe
 		this->command_buffer = command_buffer;
 
 		debug_utils.cmd_begin_label(command_buffer, name, color);
+
+		profiled = GpuProfiler::begin_scope(command_buffer, name);
 	}
 }
 
@@ -198,6 +201,11 @@ ScopedDebugLabel::ScopedDebugLabel(const vkb::core::CommandBufferC &command_buff
 
 ScopedDebugLabel::~ScopedDebugLabel()
 {
+	if (profiled)
+	{
+		GpuProfiler::end_scope(command_buffer);
+	}
+
 	if (command_buffer != VK_NULL_HANDLE)
 	{
 		debug_utils->cmd_end_label(command_buffer);
@@ -146,6 +146,7 @@ class DummyDebugUtils final : public DebugUtils
  *        If any of EXT_debug_utils or EXT_debug_marker is available, this:
  *        - Begins a debug label / marker on construction
  *        - Ends it on destruction
+ *        If the command buffer is profiled by a GpuProfiler, the label is also timed as a GPU profiler scope.
  */
 class ScopedDebugLabel final
 {
@@ -160,6 +161,7 @@ class ScopedDebugLabel final
   private:
 	const DebugUtils *debug_utils;
 	VkCommandBuffer   command_buffer;
+	bool              profiled{false};
 };
 
 }        // namespace vkb
\ No newline at end of file
@@ -195,6 +195,26 @@ Device::Device(PhysicalDevice                        &gpu,
 
 	command_pool = std::make_unique<vkb::core::CommandPoolC>(*this, get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, 0).get_family_index());
 	fence_pool   = std::make_unique<FencePool>(*this);
+
+	if (is_enabled(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+	{
+		resource_cache.enable_pipeline_libraries();
+	}
+
+	// The layouts are checked for every image created, they are only queried once
+	if (is_enabled(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME))
+	{
+		VkPhysicalDeviceHostImageCopyPropertiesEXT host_image_copy_properties{};
+		host_image_copy_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
+		VkPhysicalDeviceProperties2KHR properties{};
+		properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+		properties.pNext = &host_image_copy_properties;
+		vkGetPhysicalDeviceProperties2KHR(gpu.get_handle(), &properties);
+
+		host_image_copy_dst_layouts.resize(host_image_copy_properties.copyDstLayoutCount);
+		host_image_copy_properties.pCopyDstLayouts = host_image_copy_dst_layouts.data();
+		vkGetPhysicalDeviceProperties2KHR(gpu.get_handle(), &properties);
+	}
 }
 
 Device::Device(PhysicalDevice &gpu, VkDevice &vulkan_device, VkSurfaceKHR surface) :
@@ -272,6 +292,55 @@ bool Device::is_image_format_supported(VkFormat format) const
 	return result != VK_ERROR_FORMAT_NOT_SUPPORTED;
 }
 
+bool Device::is_host_image_copy_optimal(VkFormat format, VkImageUsageFlags usage, VkImageCreateFlags flags) const
+{
+	if (!is_enabled(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME))
+	{
+		return false;
+	}
+
+	// Host transfers are an extension flag, only reported through VkFormatProperties3
+	VkFormatProperties3KHR format_properties_3{};
+	format_properties_3.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR;
+	VkFormatProperties2KHR format_properties_2{};
+	format_properties_2.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2_KHR;
+	format_properties_2.pNext = &format_properties_3;
+	vkGetPhysicalDeviceFormatProperties2KHR(gpu.get_handle(), format, &format_properties_2);
+
+	if ((format_properties_3.optimalTilingFeatures & VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT_EXT) == 0)
+	{
+		return false;
+	}
+
+	// The copy replaces the upload and its barriers only if it can leave the image ready to sample
+	if (std::find(host_image_copy_dst_layouts.begin(), host_image_copy_dst_layouts.end(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) == host_image_copy_dst_layouts.end())
+	{
+		return false;
+	}
+
+	VkHostImageCopyDevicePerformanceQueryEXT performance_query{};
+	performance_query.sType = VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY_EXT;
+	VkImageFormatProperties2KHR image_format_properties{};
+	image_format_properties.sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2_KHR;
+	image_format_properties.pNext = &performance_query;
+
+	VkPhysicalDeviceImageFormatInfo2KHR image_format_info{};
+	image_format_info.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2_KHR;
+	image_format_info.format = format;
+	image_format_info.type   = VK_IMAGE_TYPE_2D;
+	image_format_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	image_format_info.usage  = usage | VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+	image_format_info.flags  = flags;
+
+	if (vkGetPhysicalDeviceImageFormatProperties2KHR(gpu.get_handle(), &image_format_info, &image_format_properties) != VK_SUCCESS)
+	{
+		return false;
+	}
+
+	// Otherwise the implementation may lay out host transfer images in a way which is slower to access on the device
+	return performance_query.optimalDeviceAccess;
+}
+
 uint32_t Device::get_memory_type(uint32_t bits, VkMemoryPropertyFlags properties, VkBool32 *memory_type_found) const
 {
 	for (uint32_t i = 0; i < gpu.get_memory_properties().memoryTypeCount; i++)
@@ -555,7 +624,7 @@ VkResult Device::wait_idle() const
 	return vkDeviceWaitIdle(get_handle());
 }
 
-ResourceCache &Device::get_resource_cache()
+ResourceCacheC &Device::get_resource_cache()
 {
 	return resource_cache;
 }
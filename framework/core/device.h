@@ -105,6 +105,17 @@ class Device : public vkb::core::VulkanResourceC<VkDevice>
 	 */
 	bool is_image_format_supported(VkFormat format) const;
 
+	/**
+	 * @brief Checks whether images can be copied to from host memory with VK_EXT_host_image_copy, without a staging buffer
+	 *        The format must support host transfers with optimal tiling, the copy must be able to leave the image in
+	 *        shader read only layout, and host transfers must not make device access to the image any slower.
+	 * @param format The format of the image
+	 * @param usage The usage of the image, besides VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT
+	 * @param flags The create flags of the image
+	 * @return True if the image should be created with VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT and copied to from the host
+	 */
+	bool is_host_image_copy_optimal(VkFormat format, VkImageUsageFlags usage, VkImageCreateFlags flags = 0) const;
+
 	const Queue &get_queue(uint32_t queue_family_index, uint32_t queue_index);
 
 	const Queue &get_queue_by_flags(VkQueueFlags queue_flags, uint32_t queue_index) const;
@@ -210,7 +221,7 @@ class Device : public vkb::core::VulkanResourceC<VkDevice>
 
 	VkResult wait_idle() const;
 
-	ResourceCache &get_resource_cache();
+	ResourceCacheC &get_resource_cache();
 
   private:
 	const PhysicalDevice &gpu;
@@ -223,12 +234,15 @@ class Device : public vkb::core::VulkanResourceC<VkDevice>
 
 	std::vector<std::vector<Queue>> queues;
 
+	/// Layouts host image copies can leave images in, if VK_EXT_host_image_copy is enabled
+	std::vector<VkImageLayout> host_image_copy_dst_layouts;
+
 	/// A command pool associated to the primary queue
 	std::unique_ptr<vkb::core::CommandPoolC> command_pool;
 
 	/// A fence pool associated to the primary queue
 	std::unique_ptr<FencePool> fence_pool;
 
-	ResourceCache resource_cache;
+	ResourceCacheC resource_cache;
 };
 }        // namespace vkb
@@ -17,6 +17,7 @@
 
 #include "core/hpp_debug.h"
 #include "core/command_buffer.h"
+#include "stats/gpu_profiler.h"
 
 namespace vkb
 {
@@ -94,6 +95,8 @@ HPPScopedDebugLabel::HPPScopedDebugLabel(const HPPDebugUtils &debug_utils,
 		this->command_buffer = command_buffer;
 
 		debug_utils.cmd_begin_label(command_buffer, name.c_str(), color);
+
+		profiled = vkb::GpuProfiler::begin_scope(static_cast<VkCommandBuffer>(command_buffer), name.c_str());
 	}
 }
 
@@ -106,6 +109,11 @@ HPPScopedDebugLabel::HPPScopedDebugLabel(const vkb::core::CommandBufferCpp &comm
 
 HPPScopedDebugLabel::~HPPScopedDebugLabel()
 {
+	if (profiled)
+	{
+		vkb::GpuProfiler::end_scope(static_cast<VkCommandBuffer>(command_buffer));
+	}
+
 	if (command_buffer)
 	{
 		debug_utils->cmd_end_label(command_buffer);
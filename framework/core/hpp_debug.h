@@ -133,6 +133,7 @@ class HPPDummyDebugUtils final : public vkb::core::HPPDebugUtils
  *        If any of EXT_debug_utils or EXT_debug_marker is available, this:
  *        - Begins a debug label / marker on construction
  *        - Ends it on destruction
+ *        If the command buffer is profiled by a GpuProfiler, the label is also timed as a GPU profiler scope.
  */
 class HPPScopedDebugLabel final
 {
@@ -146,6 +147,7 @@ class HPPScopedDebugLabel final
   private:
 	const vkb::core::HPPDebugUtils *debug_utils;
 	vk::CommandBuffer               command_buffer;
+	bool                            profiled{false};
 };
 
 }        // namespace core
@@ -162,7 +162,7 @@ HPPDevice::HPPDevice(vkb::core::HPPPhysicalDevice               &gpu,
 	{
 		vk::QueueFamilyProperties const &queue_family_property = queue_family_properties[queue_family_index];
 
-		vk::Bool32 present_supported = gpu.get_handle().getSurfaceSupportKHR(queue_family_index, surface);
+		vk::Bool32 present_supported = surface ? gpu.get_handle().getSurfaceSupportKHR(queue_family_index, surface) : false;
 
 		for (uint32_t queue_index = 0U; queue_index < queue_family_property.queueCount; ++queue_index)
 		{
@@ -175,6 +175,11 @@ HPPDevice::HPPDevice(vkb::core::HPPPhysicalDevice               &gpu,
 	command_pool = std::make_unique<vkb::core::CommandPoolCpp>(
 	    *this, get_queue_by_flags(vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute, 0).get_family_index());
 	fence_pool = std::make_unique<vkb::HPPFencePool>(*this);
+
+	if (is_enabled(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+	{
+		resource_cache.enable_pipeline_libraries();
+	}
 }
 
 HPPDevice::~HPPDevice()
@@ -418,7 +423,7 @@ vkb::HPPFencePool &HPPDevice::get_fence_pool()
 	return *fence_pool;
 }
 
-vkb::HPPResourceCache &HPPDevice::get_resource_cache()
+vkb::ResourceCacheCpp &HPPDevice::get_resource_cache()
 {
 	return resource_cache;
 }
@@ -18,8 +18,12 @@
 #pragma once
 
 #include "core/hpp_debug.h"
+#include "core/hpp_descriptor_set.h"
+#include "core/hpp_framebuffer.h"
+#include "core/hpp_pipeline_layout.h"
+#include "core/hpp_render_pass.h"
 #include "hpp_fence_pool.h"
-#include "hpp_resource_cache.h"
+#include "resource_cache.h"
 
 namespace vkb
 {
@@ -127,7 +131,7 @@ class HPPDevice : public vkb::core::VulkanResourceCpp<vk::Device>
 
 	vkb::HPPFencePool &get_fence_pool();
 
-	vkb::HPPResourceCache &get_resource_cache();
+	vkb::ResourceCacheCpp &get_resource_cache();
 
   private:
 	vkb::core::HPPPhysicalDevice const &gpu;
@@ -146,7 +150,7 @@ class HPPDevice : public vkb::core::VulkanResourceCpp<vk::Device>
 	/// A fence pool associated to the primary queue
 	std::unique_ptr<vkb::HPPFencePool> fence_pool;
 
-	vkb::HPPResourceCache resource_cache;
+	vkb::ResourceCacheCpp resource_cache;
 };
 }        // namespace core
 }        // namespace vkb
@@ -433,6 +433,12 @@ vkb::core::HPPPhysicalDevice &HPPInstance::get_suitable_gpu(vk::SurfaceKHR surfa
 	{
 		if (gpu->get_properties().deviceType == vk::PhysicalDeviceType::eDiscreteGpu)
 		{
+			// Without a surface, when rendering offscreen, any discrete GPU will do
+			if (!surface)
+			{
+				return *gpu;
+			}
+
 			// See if it work with the surface
 			size_t queue_count = gpu->get_queue_family_properties().size();
 			for (uint32_t queue_idx = 0; static_cast<size_t>(queue_idx) < queue_count; queue_idx++)
@@ -149,6 +149,15 @@ class HPPPhysicalDevice
 		return *static_cast<HPPStructureType *>(it->second.get());
 	}
 
+	/**
+	 * @brief Checks whether an extension features struct was added to the structure chain used for device creation
+	 * @param structure_type The structure type of the extension features struct
+	 */
+	bool has_extension_features(vk::StructureType structure_type) const
+	{
+		return extension_features.find(structure_type) != extension_features.end();
+	}
+
 	/**
 	 * @brief Request an optional features flag
 	 *
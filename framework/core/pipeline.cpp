@@ -23,134 +23,99 @@
 
 namespace vkb
 {
-Pipeline::Pipeline(Device &device) :
-    device{device}
-{}
-
-Pipeline::Pipeline(Pipeline &&other) :
-    device{other.device},
-    handle{other.handle},
-    state{other.state}
+namespace
 {
-	other.handle = VK_NULL_HANDLE;
-}
-
-Pipeline::~Pipeline()
+/**
+ * @brief The create info of a graphics pipeline, or of a graphics pipeline library, and the state it points to
+ */
+struct GraphicsPipelineCreateInfo
 {
-	// Destroy pipeline
-	if (handle != VK_NULL_HANDLE)
-	{
-		vkDestroyPipeline(device.get_handle(), handle, nullptr);
-	}
-}
+	/**
+	 * @param parts The parts of the pipeline to create, all of them for a complete pipeline
+	 */
+	GraphicsPipelineCreateInfo(Device &device, PipelineState &pipeline_state, VkGraphicsPipelineLibraryFlagsEXT parts);
 
-VkPipeline Pipeline::get_handle() const
-{
-	return handle;
-}
+	GraphicsPipelineCreateInfo(const GraphicsPipelineCreateInfo &) = delete;
 
-const PipelineState &Pipeline::get_state() const
-{
-	return state;
-}
+	~GraphicsPipelineCreateInfo();
 
-ComputePipeline::ComputePipeline(Device &        device,
-                                 VkPipelineCache pipeline_cache,
-                                 PipelineState & pipeline_state) :
-    Pipeline{device}
-{
-	const ShaderModule *shader_module = pipeline_state.get_pipeline_layout().get_shader_modules().front();
+	GraphicsPipelineCreateInfo &operator=(const GraphicsPipelineCreateInfo &) = delete;
 
-	if (shader_module->get_stage() != VK_SHADER_STAGE_COMPUTE_BIT)
-	{
-		throw VulkanException{VK_ERROR_INVALID_SHADER_NV, "Shader module stage is not compute"};
-	}
+	Device &device;
 
-	VkPipelineShaderStageCreateInfo stage{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
+	std::vector<VkShaderModule> shader_modules;
 
-	stage.stage = shader_module->get_stage();
-	stage.pName = shader_module->get_entry_point().c_str();
+	std::vector<VkPipelineShaderStageCreateInfo> stage_create_infos;
 
-	// Create the Vulkan handle
-	VkShaderModuleCreateInfo vk_create_info{VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+	std::vector<uint8_t> specialization_data;
 
-	vk_create_info.codeSize = shader_module->get_binary().size() * sizeof(uint32_t);
-	vk_create_info.pCode    = shader_module->get_binary().data();
+	std::vector<VkSpecializationMapEntry> map_entries;
 
-	VkResult result = vkCreateShaderModule(device.get_handle(), &vk_create_info, nullptr, &stage.module);
-	if (result != VK_SUCCESS)
-	{
-		throw VulkanException{result};
-	}
+	VkSpecializationInfo specialization_info{};
 
-	device.get_debug_utils().set_debug_name(device.get_handle(),
-	                                        VK_OBJECT_TYPE_SHADER_MODULE, reinterpret_cast<uint64_t>(stage.module),
-	                                        shader_module->get_debug_name().c_str());
+	VkPipelineVertexInputStateCreateInfo vertex_input_state{VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
 
-	// Create specialization info from tracked state.
-	std::vector<uint8_t>                  data{};
-	std::vector<VkSpecializationMapEntry> map_entries{};
+	VkPipelineInputAssemblyStateCreateInfo input_assembly_state{VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
 
-	const auto specialization_constant_state = pipeline_state.get_specialization_constant_state().get_specialization_constant_state();
+	VkPipelineViewportStateCreateInfo viewport_state{VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
 
-	for (const auto specialization_constant : specialization_constant_state)
-	{
-		map_entries.push_back({specialization_constant.first, to_u32(data.size()), specialization_constant.second.size()});
-		data.insert(data.end(), specialization_constant.second.begin(), specialization_constant.second.end());
-	}
+	VkPipelineRasterizationStateCreateInfo rasterization_state{VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
 
-	VkSpecializationInfo specialization_info{};
-	specialization_info.mapEntryCount = to_u32(map_entries.size());
-	specialization_info.pMapEntries   = map_entries.data();
-	specialization_info.dataSize      = data.size();
-	specialization_info.pData         = data.data();
+	VkPipelineMultisampleStateCreateInfo multisample_state{VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
 
-	stage.pSpecializationInfo = &specialization_info;
+	VkPipelineDepthStencilStateCreateInfo depth_stencil_state{VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO};
 
-	VkComputePipelineCreateInfo create_info{VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+	VkPipelineColorBlendStateCreateInfo color_blend_state{VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
 
-	create_info.layout = pipeline_state.get_pipeline_layout().get_handle();
-	create_info.stage  = stage;
+	std::array<VkDynamicState, 9> dynamic_states{
+	    VK_DYNAMIC_STATE_VIEWPORT,
+	    VK_DYNAMIC_STATE_SCISSOR,
+	    VK_DYNAMIC_STATE_LINE_WIDTH,
+	    VK_DYNAMIC_STATE_DEPTH_BIAS,
+	    VK_DYNAMIC_STATE_BLEND_CONSTANTS,
+	    VK_DYNAMIC_STATE_DEPTH_BOUNDS,
+	    VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK,
+	    VK_DYNAMIC_STATE_STENCIL_WRITE_MASK,
+	    VK_DYNAMIC_STATE_STENCIL_REFERENCE,
+	};
 
-	result = vkCreateComputePipelines(device.get_handle(), pipeline_cache, 1, &create_info, nullptr, &handle);
+	VkPipelineDynamicStateCreateInfo dynamic_state{VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO};
 
-	if (result != VK_SUCCESS)
-	{
-		throw VulkanException{result, "Cannot create ComputePipelines"};
-	}
+	VkGraphicsPipelineCreateInfo create_info{VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+};
 
-	vkDestroyShaderModule(device.get_handle(), stage.module, nullptr);
-}
+constexpr VkGraphicsPipelineLibraryFlagsEXT all_graphics_pipeline_parts = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT |
+                                                                          VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
+                                                                          VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT |
+                                                                          VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
 
-GraphicsPipeline::GraphicsPipeline(Device &        device,
-                                   VkPipelineCache pipeline_cache,
-                                   PipelineState & pipeline_state) :
-    Pipeline{device}
+GraphicsPipelineCreateInfo::GraphicsPipelineCreateInfo(Device &device, PipelineState &pipeline_state, VkGraphicsPipelineLibraryFlagsEXT parts) :
+    device{device}
 {
-	std::vector<VkShaderModule> shader_modules;
-
-	std::vector<VkPipelineShaderStageCreateInfo> stage_create_infos;
-
 	// Create specialization info from tracked state. This is shared by all shaders.
-	std::vector<uint8_t>                  data{};
-	std::vector<VkSpecializationMapEntry> map_entries{};
-
 	const auto specialization_constant_state = pipeline_state.get_specialization_constant_state().get_specialization_constant_state();
 
 	for (const auto specialization_constant : specialization_constant_state)
 	{
-		map_entries.push_back({specialization_constant.first, to_u32(data.size()), specialization_constant.second.size()});
-		data.insert(data.end(), specialization_constant.second.begin(), specialization_constant.second.end());
+		map_entries.push_back({specialization_constant.first, to_u32(specialization_data.size()), specialization_constant.second.size()});
+		specialization_data.insert(specialization_data.end(), specialization_constant.second.begin(), specialization_constant.second.end());
 	}
 
-	VkSpecializationInfo specialization_info{};
 	specialization_info.mapEntryCount = to_u32(map_entries.size());
 	specialization_info.pMapEntries   = map_entries.data();
-	specialization_info.dataSize      = data.size();
-	specialization_info.pData         = data.data();
+	specialization_info.dataSize      = specialization_data.size();
+	specialization_info.pData         = specialization_data.data();
 
 	for (const ShaderModule *shader_module : pipeline_state.get_pipeline_layout().get_shader_modules())
 	{
+		// The fragment shader is the only shader of its part, the other shaders are pre-rasterization shaders
+		auto part = shader_module->get_stage() == VK_SHADER_STAGE_FRAGMENT_BIT ? VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT :
+		                                                                          VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+		if (!(parts & part))
+		{
+			continue;
+		}
+
 		VkPipelineShaderStageCreateInfo stage_create_info{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
 
 		stage_create_info.stage = shader_module->get_stage();
@@ -178,31 +143,21 @@ GraphicsPipeline::GraphicsPipeline(Device &        device,
 		shader_modules.push_back(stage_create_info.module);
 	}
 
-	VkGraphicsPipelineCreateInfo create_info{VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
-
 	create_info.stageCount = to_u32(stage_create_infos.size());
 	create_info.pStages    = stage_create_infos.data();
 
-	VkPipelineVertexInputStateCreateInfo vertex_input_state{VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
-
 	vertex_input_state.pVertexAttributeDescriptions    = pipeline_state.get_vertex_input_state().attributes.data();
 	vertex_input_state.vertexAttributeDescriptionCount = to_u32(pipeline_state.get_vertex_input_state().attributes.size());
 
 	vertex_input_state.pVertexBindingDescriptions    = pipeline_state.get_vertex_input_state().bindings.data();
 	vertex_input_state.vertexBindingDescriptionCount = to_u32(pipeline_state.get_vertex_input_state().bindings.size());
 
-	VkPipelineInputAssemblyStateCreateInfo input_assembly_state{VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
-
 	input_assembly_state.topology               = pipeline_state.get_input_assembly_state().topology;
 	input_assembly_state.primitiveRestartEnable = pipeline_state.get_input_assembly_state().primitive_restart_enable;
 
-	VkPipelineViewportStateCreateInfo viewport_state{VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
-
 	viewport_state.viewportCount = pipeline_state.get_viewport_state().viewport_count;
 	viewport_state.scissorCount  = pipeline_state.get_viewport_state().scissor_count;
 
-	VkPipelineRasterizationStateCreateInfo rasterization_state{VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
-
 	rasterization_state.depthClampEnable        = pipeline_state.get_rasterization_state().depth_clamp_enable;
 	rasterization_state.rasterizerDiscardEnable = pipeline_state.get_rasterization_state().rasterizer_discard_enable;
 	rasterization_state.polygonMode             = pipeline_state.get_rasterization_state().polygon_mode;
@@ -213,8 +168,6 @@ GraphicsPipeline::GraphicsPipeline(Device &        device,
 	rasterization_state.depthBiasSlopeFactor    = 1.0f;
 	rasterization_state.lineWidth               = 1.0f;
 
-	VkPipelineMultisampleStateCreateInfo multisample_state{VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
-
 	multisample_state.sampleShadingEnable   = pipeline_state.get_multisample_state().sample_shading_enable;
 	multisample_state.rasterizationSamples  = pipeline_state.get_multisample_state().rasterization_samples;
 	multisample_state.minSampleShading      = pipeline_state.get_multisample_state().min_sample_shading;
@@ -226,8 +179,6 @@ GraphicsPipeline::GraphicsPipeline(Device &        device,
 		multisample_state.pSampleMask = &pipeline_state.get_multisample_state().sample_mask;
 	}
 
-	VkPipelineDepthStencilStateCreateInfo depth_stencil_state{VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO};
-
 	depth_stencil_state.depthTestEnable       = pipeline_state.get_depth_stencil_state().depth_test_enable;
 	depth_stencil_state.depthWriteEnable      = pipeline_state.get_depth_stencil_state().depth_write_enable;
 	depth_stencil_state.depthCompareOp        = pipeline_state.get_depth_stencil_state().depth_compare_op;
@@ -248,8 +199,6 @@ GraphicsPipeline::GraphicsPipeline(Device &        device,
 	depth_stencil_state.back.writeMask        = ~0U;
 	depth_stencil_state.back.reference        = ~0U;
 
-	VkPipelineColorBlendStateCreateInfo color_blend_state{VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
-
 	color_blend_state.logicOpEnable     = pipeline_state.get_color_blend_state().logic_op_enable;
 	color_blend_state.logicOp           = pipeline_state.get_color_blend_state().logic_op;
 	color_blend_state.attachmentCount   = to_u32(pipeline_state.get_color_blend_state().attachments.size());
@@ -259,48 +208,256 @@ GraphicsPipeline::GraphicsPipeline(Device &        device,
 	color_blend_state.blendConstants[2] = 1.0f;
 	color_blend_state.blendConstants[3] = 1.0f;
 
-	std::array<VkDynamicState, 9> dynamic_states{
-	    VK_DYNAMIC_STATE_VIEWPORT,
-	    VK_DYNAMIC_STATE_SCISSOR,
-	    VK_DYNAMIC_STATE_LINE_WIDTH,
-	    VK_DYNAMIC_STATE_DEPTH_BIAS,
-	    VK_DYNAMIC_STATE_BLEND_CONSTANTS,
-	    VK_DYNAMIC_STATE_DEPTH_BOUNDS,
-	    VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK,
-	    VK_DYNAMIC_STATE_STENCIL_WRITE_MASK,
-	    VK_DYNAMIC_STATE_STENCIL_REFERENCE,
-	};
-
-	VkPipelineDynamicStateCreateInfo dynamic_state{VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO};
-
 	dynamic_state.pDynamicStates    = dynamic_states.data();
 	dynamic_state.dynamicStateCount = to_u32(dynamic_states.size());
 
-	create_info.pVertexInputState   = &vertex_input_state;
-	create_info.pInputAssemblyState = &input_assembly_state;
-	create_info.pViewportState      = &viewport_state;
-	create_info.pRasterizationState = &rasterization_state;
-	create_info.pMultisampleState   = &multisample_state;
-	create_info.pDepthStencilState  = &depth_stencil_state;
-	create_info.pColorBlendState    = &color_blend_state;
-	create_info.pDynamicState       = &dynamic_state;
+	// Only the state of the parts being created is given, the dynamic states of the other parts are ignored
+	if (parts & VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT)
+	{
+		create_info.pVertexInputState   = &vertex_input_state;
+		create_info.pInputAssemblyState = &input_assembly_state;
+	}
+
+	if (parts & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT)
+	{
+		create_info.pViewportState      = &viewport_state;
+		create_info.pRasterizationState = &rasterization_state;
+	}
 
-	create_info.layout     = pipeline_state.get_pipeline_layout().get_handle();
-	create_info.renderPass = pipeline_state.get_render_pass()->get_handle();
-	create_info.subpass    = pipeline_state.get_subpass_index();
+	if (parts & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT)
+	{
+		create_info.pMultisampleState  = &multisample_state;
+		create_info.pDepthStencilState = &depth_stencil_state;
+	}
 
-	auto result = vkCreateGraphicsPipelines(device.get_handle(), pipeline_cache, 1, &create_info, nullptr, &handle);
+	if (parts & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT)
+	{
+		create_info.pMultisampleState = &multisample_state;
+		create_info.pColorBlendState  = &color_blend_state;
+	}
 
-	if (result != VK_SUCCESS)
+	if (parts != VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT)
 	{
-		throw VulkanException{result, "Cannot create GraphicsPipelines"};
+		create_info.pDynamicState = &dynamic_state;
+		create_info.renderPass    = pipeline_state.get_render_pass()->get_handle();
+		create_info.subpass       = pipeline_state.get_subpass_index();
 	}
 
+	if (parts & (VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT | VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT))
+	{
+		create_info.layout = pipeline_state.get_pipeline_layout().get_handle();
+	}
+}
+
+GraphicsPipelineCreateInfo::~GraphicsPipelineCreateInfo()
+{
 	for (auto shader_module : shader_modules)
 	{
 		vkDestroyShaderModule(device.get_handle(), shader_module, nullptr);
 	}
+}
+}        // namespace
+
+Pipeline::Pipeline(Device &device) :
+    device{device}
+{}
+
+Pipeline::Pipeline(Pipeline &&other) :
+    device{other.device},
+    handle{other.handle},
+    state{other.state}
+{
+	other.handle = VK_NULL_HANDLE;
+}
+
+Pipeline::~Pipeline()
+{
+	// Destroy pipeline
+	if (handle != VK_NULL_HANDLE)
+	{
+		vkDestroyPipeline(device.get_handle(), handle, nullptr);
+	}
+}
+
+VkPipeline Pipeline::get_handle() const
+{
+	return handle;
+}
+
+const PipelineState &Pipeline::get_state() const
+{
+	return state;
+}
+
+ComputePipeline::ComputePipeline(Device &        device,
+                                 VkPipelineCache pipeline_cache,
+                                 PipelineState & pipeline_state) :
+    Pipeline{device}
+{
+	const ShaderModule *shader_module = pipeline_state.get_pipeline_layout().get_shader_modules().front();
+
+	if (shader_module->get_stage() != VK_SHADER_STAGE_COMPUTE_BIT)
+	{
+		throw VulkanException{VK_ERROR_INVALID_SHADER_NV, "Shader module stage is not compute"};
+	}
+
+	VkPipelineShaderStageCreateInfo stage{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
+
+	stage.stage = shader_module->get_stage();
+	stage.pName = shader_module->get_entry_point().c_str();
+
+	// Create the Vulkan handle
+	VkShaderModuleCreateInfo vk_create_info{VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+
+	vk_create_info.codeSize = shader_module->get_binary().size() * sizeof(uint32_t);
+	vk_create_info.pCode    = shader_module->get_binary().data();
+
+	VkResult result = vkCreateShaderModule(device.get_handle(), &vk_create_info, nullptr, &stage.module);
+	if (result != VK_SUCCESS)
+	{
+		throw VulkanException{result};
+	}
+
+	device.get_debug_utils().set_debug_name(device.get_handle(),
+	                                        VK_OBJECT_TYPE_SHADER_MODULE, reinterpret_cast<uint64_t>(stage.module),
+	                                        shader_module->get_debug_name().c_str());
+
+	// Create specialization info from tracked state.
+	std::vector<uint8_t>                  data{};
+	std::vector<VkSpecializationMapEntry> map_entries{};
+
+	const auto specialization_constant_state = pipeline_state.get_specialization_constant_state().get_specialization_constant_state();
+
+	for (const auto specialization_constant : specialization_constant_state)
+	{
+		map_entries.push_back({specialization_constant.first, to_u32(data.size()), specialization_constant.second.size()});
+		data.insert(data.end(), specialization_constant.second.begin(), specialization_constant.second.end());
+	}
+
+	VkSpecializationInfo specialization_info{};
+	specialization_info.mapEntryCount = to_u32(map_entries.size());
+	specialization_info.pMapEntries   = map_entries.data();
+	specialization_info.dataSize      = data.size();
+	specialization_info.pData         = data.data();
+
+	stage.pSpecializationInfo = &specialization_info;
+
+	VkComputePipelineCreateInfo create_info{VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+
+	create_info.layout = pipeline_state.get_pipeline_layout().get_handle();
+	create_info.stage  = stage;
+
+	result = vkCreateComputePipelines(device.get_handle(), pipeline_cache, 1, &create_info, nullptr, &handle);
+
+	if (result != VK_SUCCESS)
+	{
+		throw VulkanException{result, "Cannot create ComputePipelines"};
+	}
+
+	vkDestroyShaderModule(device.get_handle(), stage.module, nullptr);
+}
+
+GraphicsPipeline::GraphicsPipeline(Device &        device,
+                                   VkPipelineCache pipeline_cache,
+                                   PipelineState & pipeline_state) :
+    Pipeline{device}
+{
+	GraphicsPipelineCreateInfo pipeline_create_info{device, pipeline_state, all_graphics_pipeline_parts};
+
+	auto result = vkCreateGraphicsPipelines(device.get_handle(), pipeline_cache, 1, &pipeline_create_info.create_info, nullptr, &handle);
+
+	if (result != VK_SUCCESS)
+	{
+		throw VulkanException{result, "Cannot create GraphicsPipelines"};
+	}
+
+	state = pipeline_state;
+}
+
+GraphicsPipeline::GraphicsPipeline(Device &                       device,
+                                   VkPipelineCache                pipeline_cache,
+                                   PipelineState &                pipeline_state,
+                                   const std::vector<VkPipeline> &libraries,
+                                   bool                           link_time_optimization) :
+    Pipeline{device}
+{
+	handle = link_libraries(device, pipeline_cache, pipeline_state.get_pipeline_layout().get_handle(), libraries, link_time_optimization);
+
+	state = pipeline_state;
+}
+
+VkPipeline GraphicsPipeline::link_libraries(Device &device, VkPipelineCache pipeline_cache, VkPipelineLayout pipeline_layout, const std::vector<VkPipeline> &libraries, bool link_time_optimization)
+{
+	VkPipelineLibraryCreateInfoKHR library_info{VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR};
+	library_info.libraryCount = to_u32(libraries.size());
+	library_info.pLibraries   = libraries.data();
+
+	VkGraphicsPipelineCreateInfo create_info{VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+	create_info.pNext  = &library_info;
+	create_info.layout = pipeline_layout;
+
+	if (link_time_optimization)
+	{
+		create_info.flags = VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+	}
+
+	VkPipeline pipeline{VK_NULL_HANDLE};
+
+	auto result = vkCreateGraphicsPipelines(device.get_handle(), pipeline_cache, 1, &create_info, nullptr, &pipeline);
+
+	if (result != VK_SUCCESS)
+	{
+		throw VulkanException{result, "Cannot link GraphicsPipelines"};
+	}
+
+	return pipeline;
+}
+
+VkPipeline GraphicsPipeline::replace_handle(VkPipeline new_handle)
+{
+	std::swap(handle, new_handle);
+	return new_handle;
+}
+
+PipelineLibrary::PipelineLibrary(Device &                    device,
+                                 VkPipelineCache             pipeline_cache,
+                                 PipelineState &             pipeline_state,
+                                 GraphicsPipelineLibraryPart part) :
+    Pipeline{device}
+{
+	VkGraphicsPipelineLibraryCreateInfoEXT library_info{VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT};
+	library_info.flags = get_library_flags(part);
+
+	GraphicsPipelineCreateInfo pipeline_create_info{device, pipeline_state, library_info.flags};
+
+	// The link time optimization info is retained to link optimized pipelines from the library later
+	pipeline_create_info.create_info.pNext = &library_info;
+	pipeline_create_info.create_info.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+	auto result = vkCreateGraphicsPipelines(device.get_handle(), pipeline_cache, 1, &pipeline_create_info.create_info, nullptr, &handle);
+
+	if (result != VK_SUCCESS)
+	{
+		throw VulkanException{result, "Cannot create graphics pipeline library"};
+	}
 
 	state = pipeline_state;
 }
+
+VkGraphicsPipelineLibraryFlagsEXT PipelineLibrary::get_library_flags(GraphicsPipelineLibraryPart part)
+{
+	switch (part)
+	{
+		case GraphicsPipelineLibraryPart::VertexInput:
+			return VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+		case GraphicsPipelineLibraryPart::PreRasterization:
+			return VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+		case GraphicsPipelineLibraryPart::FragmentShader:
+			return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+		case GraphicsPipelineLibraryPart::FragmentOutput:
+			return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+	}
+
+	return 0;
+}
 }        // namespace vkb
@@ -74,5 +74,57 @@ class GraphicsPipeline : public Pipeline
 	GraphicsPipeline(Device &        device,
 	                 VkPipelineCache pipeline_cache,
 	                 PipelineState & pipeline_state);
+
+	/**
+	 * @brief Links a graphics pipeline from graphics pipeline libraries
+	 * @param libraries One library of every part, see PipelineLibrary
+	 * @param link_time_optimization Whether the pipeline is optimized across the libraries, which is slower to link
+	 */
+	GraphicsPipeline(Device &                       device,
+	                 VkPipelineCache                pipeline_cache,
+	                 PipelineState &                pipeline_state,
+	                 const std::vector<VkPipeline> &libraries,
+	                 bool                           link_time_optimization = false);
+
+	/**
+	 * @brief Links graphics pipeline libraries, the caller owns the returned pipeline
+	 */
+	static VkPipeline link_libraries(Device &device, VkPipelineCache pipeline_cache, VkPipelineLayout pipeline_layout, const std::vector<VkPipeline> &libraries, bool link_time_optimization);
+
+	/**
+	 * @brief Replaces the handle by an equivalent pipeline, such as an optimized link of the same libraries
+	 * @return The previous handle, which the caller must destroy once it is not in use anymore
+	 */
+	VkPipeline replace_handle(VkPipeline new_handle);
+};
+
+/**
+ * @brief The independent parts of a graphics pipeline, which can be created as graphics pipeline libraries
+ */
+enum class GraphicsPipelineLibraryPart
+{
+	VertexInput,
+	PreRasterization,
+	FragmentShader,
+	FragmentOutput
+};
+
+/**
+ * @brief A part of a graphics pipeline, created with VK_EXT_graphics_pipeline_library from the state of the pipeline
+ *        relevant to that part only, and linked into a GraphicsPipeline
+ */
+class PipelineLibrary : public Pipeline
+{
+  public:
+	PipelineLibrary(PipelineLibrary &&) = default;
+
+	virtual ~PipelineLibrary() = default;
+
+	PipelineLibrary(Device &                    device,
+	                VkPipelineCache             pipeline_cache,
+	                PipelineState &             pipeline_state,
+	                GraphicsPipelineLibraryPart part);
+
+	static VkGraphicsPipelineLibraryFlagsEXT get_library_flags(GraphicsPipelineLibraryPart part);
 };
 }        // namespace vkb
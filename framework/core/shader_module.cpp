@@ -21,6 +21,7 @@
 #include "device.h"
 #include "filesystem/legacy.h"
 #include "glsl_compiler.h"
+#include "shader_pack.h"
 #include "spirv_reflection.h"
 
 namespace vkb
@@ -77,6 +78,37 @@ inline std::vector<uint8_t> convert_to_bytes(std::vector<std::string> &lines)
 	return bytes;
 }
 
+/**
+ * @brief Compiles a source with its includes expanded to SPIR-V, and reflects its resources
+ */
+inline void compile_variant(VkShaderStageFlagBits        stage,
+                            const std::string           &filename,
+                            const std::vector<uint8_t>  &glsl_final_source,
+                            const std::string           &entry_point,
+                            const ShaderVariant         &shader_variant,
+                            std::vector<uint32_t>       &spirv,
+                            std::vector<ShaderResource> &resources,
+                            std::string                 &info_log)
+{
+	// Compile the GLSL source
+	GLSLCompiler glsl_compiler;
+
+	if (!glsl_compiler.compile_to_spirv(stage, glsl_final_source, entry_point, shader_variant, spirv, info_log))
+	{
+		LOGE("Shader compilation failed for shader \"{}\"", filename);
+		LOGE("{}", info_log);
+		throw VulkanException{VK_ERROR_INITIALIZATION_FAILED};
+	}
+
+	SPIRVReflection spirv_reflection;
+
+	// Reflect all shader resources
+	if (!spirv_reflection.reflect_shader_resources(stage, spirv, resources, shader_variant))
+	{
+		throw VulkanException{VK_ERROR_INITIALIZATION_FAILED};
+	}
+}
+
 ShaderModule::ShaderModule(Device &device, VkShaderStageFlagBits stage, const ShaderSource &glsl_source, const std::string &entry_point, const ShaderVariant &shader_variant) :
     device{device},
     stage{stage},
@@ -100,24 +132,16 @@ ShaderModule::ShaderModule(Device &device, VkShaderStageFlagBits stage, const Sh
 	}
 
 	// Precompile source into the final spirv bytecode
-	auto glsl_final_source = precompile_shader(source);
-
-	// Compile the GLSL source
-	GLSLCompiler glsl_compiler;
-
-	if (!glsl_compiler.compile_to_spirv(stage, convert_to_bytes(glsl_final_source), entry_point, shader_variant, spirv, info_log))
-	{
-		LOGE("Shader compilation failed for shader \"{}\"", glsl_source.get_filename());
-		LOGE("{}", info_log);
-		throw VulkanException{VK_ERROR_INITIALIZATION_FAILED};
-	}
+	auto glsl_final_lines  = precompile_shader(source);
+	auto glsl_final_source = convert_to_bytes(glsl_final_lines);
 
-	SPIRVReflection spirv_reflection;
+	// Variants compiled offline are taken from the shader pack, together with their reflected resources
+	bool packed = ShaderPack::is_packable(shader_variant) &&
+	              ShaderPack::get().find(ShaderPack::get_key(stage, glsl_final_source, entry_point, shader_variant), spirv, resources);
 
-	// Reflect all shader resources
-	if (!spirv_reflection.reflect_shader_resources(stage, spirv, resources, shader_variant))
+	if (!packed)
 	{
-		throw VulkanException{VK_ERROR_INITIALIZATION_FAILED};
+		compile_variant(stage, glsl_source.get_filename(), glsl_final_source, entry_point, shader_variant, spirv, resources, info_log);
 	}
 
 	// Generate a unique id, determined by source and variant
@@ -139,6 +163,22 @@ ShaderModule::ShaderModule(ShaderModule &&other) :
 	other.stage = {};
 }
 
+uint64_t ShaderModule::compile(VkShaderStageFlagBits        stage,
+                               const ShaderSource          &glsl_source,
+                               const std::string           &entry_point,
+                               const ShaderVariant         &shader_variant,
+                               std::vector<uint32_t>       &spirv,
+                               std::vector<ShaderResource> &resources,
+                               std::string                 &info_log)
+{
+	auto glsl_final_lines  = precompile_shader(glsl_source.get_source());
+	auto glsl_final_source = convert_to_bytes(glsl_final_lines);
+
+	compile_variant(stage, glsl_source.get_filename(), glsl_final_source, entry_point, shader_variant, spirv, resources, info_log);
+
+	return ShaderPack::get_key(stage, glsl_final_source, entry_point, shader_variant);
+}
+
 size_t ShaderModule::get_id() const
 {
 	return id;
@@ -209,6 +209,22 @@ class ShaderModule
 
 	ShaderModule &operator=(ShaderModule &&) = delete;
 
+	/**
+	 * @brief Compiles a shader variant to SPIR-V and reflects its resources, without looking it up in the shader pack
+	 * @param[out] spirv The generated SPIR-V code
+	 * @param[out] resources The resources reflected from the SPIR-V code
+	 * @param[out] info_log Stores any log messages during the compilation process
+	 * @return The key of the variant in a shader pack
+	 * @throws VulkanException if the compilation or the reflection fails
+	 */
+	static uint64_t compile(VkShaderStageFlagBits        stage,
+	                        const ShaderSource          &glsl_source,
+	                        const std::string           &entry_point,
+	                        const ShaderVariant         &shader_variant,
+	                        std::vector<uint32_t>       &spirv,
+	                        std::vector<ShaderResource> &resources,
+	                        std::string                 &info_log);
+
 	size_t get_id() const;
 
 	VkShaderStageFlagBits get_stage() const;
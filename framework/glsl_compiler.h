@@ -51,6 +51,11 @@ class GLSLCompiler
 	 */
 	static void reset_target_environment();
 
+	/**
+	 * @brief Whether a target environment other than the default one is set
+	 */
+	static bool has_target_environment();
+
 	/**
 	 * @brief Compiles GLSL to SPIRV code
 	 * @param stage The Vulkan shader stage flag
@@ -19,8 +19,11 @@
 #define TINYGLTF_IMPLEMENTATION
 #include "gltf_loader.h"
 
+#include <cstring>
 #include <limits>
+#include <numeric>
 #include <queue>
+#include <string_view>
 
 #include "common/error.h"
 
@@ -28,14 +31,21 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include <core/util/profiling.hpp>
+#include <filesystem/filesystem.hpp>
 
 #include "api_vulkan_sample.h"
 #include "common/utils.h"
 #include "common/vk_common.h"
+#include "cooked_scene.h"
 #include "core/device.h"
 #include "core/image.h"
 #include "core/util/logging.hpp"
 #include "filesystem/legacy.h"
+#include "job_system.h"
+#include "mesh_optimizer.h"
+#include "memory_budget_tracker.h"
+#include "mesh_simplifier.h"
+#include "meshlet_builder.h"
 #include "scene_graph/components/camera.h"
 #include "scene_graph/components/image.h"
 #include "scene_graph/components/image/astc.h"
@@ -51,7 +61,11 @@
 #include "scene_graph/scene.h"
 #include "scene_graph/scripts/animation.h"
 
-#include <ctpl_stl.h>
+#if defined(_WIN32)
+#	include <psapi.h>
+#elif defined(__linux__) || defined(__ANDROID__) || defined(__APPLE__)
+#	include <sys/resource.h>
+#endif
 
 namespace vkb
 {
@@ -398,6 +412,414 @@ static inline bool texture_needs_srgb_colorspace(const std::string &name)
 	return false;
 }
 
+/**
+ * @brief Reads the indices of a triangle list primitive as 32 bit indices, or generates them if it has none
+ * @return False if the index type is not supported
+ */
+bool get_triangle_indices(const tinygltf::Model &model, const tinygltf::Primitive &primitive, size_t vertex_count, std::vector<uint32_t> &indices)
+{
+	if (primitive.indices < 0)
+	{
+		indices.resize(vertex_count);
+		std::iota(indices.begin(), indices.end(), 0);
+		return true;
+	}
+
+	auto   index_data  = get_attribute_data(&model, primitive.indices);
+	size_t index_count = get_attribute_size(&model, primitive.indices);
+
+	indices.resize(index_count);
+	switch (model.accessors[primitive.indices].componentType)
+	{
+		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+			std::copy(index_data.begin(), index_data.begin() + index_count, indices.begin());
+			break;
+		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+			for (size_t i = 0; i < index_count; i++)
+			{
+				indices[i] = *reinterpret_cast<const uint16_t *>(index_data.data() + i * sizeof(uint16_t));
+			}
+			break;
+		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+			std::memcpy(indices.data(), index_data.data(), index_count * sizeof(uint32_t));
+			break;
+		default:
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Reads the positions and triangle indices of a primitive, to build its meshlets or levels of detail
+ * @return False if the primitive is not a triangle list with float positions
+ */
+bool get_triangles(const tinygltf::Model &model, const tinygltf::Primitive &primitive, std::vector<glm::vec3> &positions, std::vector<uint32_t> &indices)
+{
+	auto position_attribute = primitive.attributes.find("POSITION");
+	if (primitive.mode != TINYGLTF_MODE_TRIANGLES || position_attribute == primitive.attributes.end() ||
+	    get_attribute_format(&model, position_attribute->second) != VK_FORMAT_R32G32B32_SFLOAT)
+	{
+		return false;
+	}
+
+	auto   position_data   = get_attribute_data(&model, position_attribute->second);
+	size_t position_stride = get_attribute_stride(&model, position_attribute->second);
+
+	positions.resize(get_attribute_size(&model, position_attribute->second));
+	for (size_t i = 0; i < positions.size(); i++)
+	{
+		std::memcpy(&positions[i], position_data.data() + i * position_stride, sizeof(glm::vec3));
+	}
+
+	return get_triangle_indices(model, primitive, positions.size(), indices);
+}
+
+/**
+ * @brief Reads the positions and triangle indices of an optimized primitive, whose positions are never quantized
+ */
+void get_triangles(const OptimizedMesh &mesh, std::vector<glm::vec3> &positions, std::vector<uint32_t> &indices)
+{
+	auto &position = mesh.attributes.at("position");
+
+	positions.resize(mesh.vertex_count);
+	for (size_t i = 0; i < positions.size(); i++)
+	{
+		std::memcpy(&positions[i], mesh.vertex_data.data() + i * position.stride + position.offset, sizeof(glm::vec3));
+	}
+
+	indices = mesh.indices;
+}
+
+/**
+ * @brief Checks that the mesh shader can draw a sub mesh, which reads its attributes from storage buffers as floats
+ */
+bool has_meshlet_formats(const sg::SubMesh &submesh)
+{
+	const std::map<std::string, VkFormat> float_formats{{"position", VK_FORMAT_R32G32B32_SFLOAT},
+	                                                    {"normal", VK_FORMAT_R32G32B32_SFLOAT},
+	                                                    {"texcoord_0", VK_FORMAT_R32G32_SFLOAT}};
+	for (auto &float_format : float_formats)
+	{
+		sg::VertexAttribute attribute;
+		if (submesh.get_attribute(float_format.first, attribute) && attribute.format != float_format.second)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Levels of detail created for the sub meshes of a scene
+ */
+struct LodStats
+{
+	/// Triangles of the sub meshes, then of every level of detail
+	std::vector<size_t> triangle_counts;
+
+	size_t sub_mesh_count{0};
+
+	/// Time spent simplifying, in seconds
+	double simplification_time{0.0};
+};
+
+/**
+ * @brief Simplifies the triangles of a sub mesh into its levels of detail, each from the full triangle list so that their
+ *        errors are measured against the original surface. Levels which would not drop a tenth of the triangles of the
+ *        previous one are skipped, as simplification stopped on locked vertices.
+ */
+void create_lods(vkb::Device                  &device,
+                 sg::SubMesh                  &submesh,
+                 const std::vector<glm::vec3> &positions,
+                 const std::vector<uint32_t>  &indices,
+                 const std::vector<float>     &ratios,
+                 VkBufferUsageFlags            additional_buffer_usage_flags,
+                 LodStats                     &stats)
+{
+	Timer timer;
+	timer.start();
+
+	stats.triangle_counts.resize(ratios.size() + 1, 0);
+	stats.triangle_counts[0] += indices.size() / 3;
+	stats.sub_mesh_count++;
+
+	size_t previous_index_count = indices.size();
+	float  previous_error       = 0.0f;
+
+	for (auto ratio : ratios)
+	{
+		float error = 0.0f;
+		auto  lod   = MeshSimplifier::simplify(positions, indices, static_cast<size_t>(indices.size() * ratio), error);
+
+		if (lod.empty() || lod.size() * 10 > previous_index_count * 9)
+		{
+			break;
+		}
+
+		// Simplified triangles are ordered for the vertex cache like optimized sub meshes
+		std::vector<uint32_t> cluster_offsets;
+		lod = MeshOptimizer::optimize_vertex_cache(lod, positions.size(), cluster_offsets);
+
+		sg::SubMeshLod submesh_lod;
+		submesh_lod.index_count = to_u32(lod.size());
+		submesh_lod.error       = std::max(error, previous_error);
+
+		std::vector<uint8_t> index_data;
+		if (positions.size() <= std::numeric_limits<uint16_t>::max() + 1u)
+		{
+			std::vector<uint16_t> lod_indices{lod.begin(), lod.end()};
+			index_data.assign(reinterpret_cast<const uint8_t *>(lod_indices.data()), reinterpret_cast<const uint8_t *>(lod_indices.data() + lod_indices.size()));
+			submesh_lod.index_type = VK_INDEX_TYPE_UINT16;
+		}
+		else
+		{
+			index_data.assign(reinterpret_cast<const uint8_t *>(lod.data()), reinterpret_cast<const uint8_t *>(lod.data() + lod.size()));
+			submesh_lod.index_type = VK_INDEX_TYPE_UINT32;
+		}
+
+		submesh_lod.index_buffer = std::make_unique<vkb::core::BufferC>(device,
+		                                                                index_data.size(),
+		                                                                VK_BUFFER_USAGE_INDEX_BUFFER_BIT | additional_buffer_usage_flags,
+		                                                                VMA_MEMORY_USAGE_CPU_TO_GPU);
+		submesh_lod.index_buffer->set_debug_name(fmt::format("{}: LOD {} index buffer", submesh.get_name(), submesh.lods.size() + 1));
+		submesh_lod.index_buffer->update(index_data);
+
+		stats.triangle_counts[submesh.lods.size() + 1] += lod.size() / 3;
+
+		previous_index_count = lod.size();
+		previous_error       = submesh_lod.error;
+		submesh.lods.push_back(std::move(submesh_lod));
+	}
+
+	stats.simplification_time += timer.stop();
+}
+
+/**
+ * @brief Reads the attributes and triangle indices of a primitive, to optimize it
+ * @return False if the primitive can't be optimized, which needs triangles with float positions
+ */
+bool get_mesh_optimizer_input(const tinygltf::Model &model, const tinygltf::Primitive &primitive, std::map<std::string, MeshAttributeInput> &attributes, std::vector<uint32_t> &indices)
+{
+	auto position_attribute = primitive.attributes.find("POSITION");
+	if (primitive.mode != TINYGLTF_MODE_TRIANGLES || position_attribute == primitive.attributes.end() ||
+	    get_attribute_format(&model, position_attribute->second) != VK_FORMAT_R32G32B32_SFLOAT)
+	{
+		return false;
+	}
+
+	for (auto &attribute : primitive.attributes)
+	{
+		std::string attrib_name = attribute.first;
+		std::transform(attrib_name.begin(), attrib_name.end(), attrib_name.begin(), ::tolower);
+
+		MeshAttributeInput input;
+		input.format = get_attribute_format(&model, attribute.second);
+		input.stride = to_u32(get_attribute_stride(&model, attribute.second));
+		input.data   = get_attribute_data(&model, attribute.second);
+
+		attributes.emplace(attrib_name, std::move(input));
+	}
+
+	size_t vertex_count = get_attribute_size(&model, position_attribute->second);
+	if (!get_triangle_indices(model, primitive, vertex_count, indices))
+	{
+		return false;
+	}
+
+	// Indices out of range would be read out of bounds by the optimizer, leave such primitives to the validation layers
+	return std::all_of(indices.begin(), indices.end(), [vertex_count](uint32_t index) { return index < vertex_count; });
+}
+
+/**
+ * @brief Waits for the images loaded by jobs, and uploads them to the GPU unless their levels are streamed
+ *        Images the device can copy to from the host are copied directly, the others go through staging buffers.
+ */
+std::vector<std::unique_ptr<sg::Image>> upload_images(vkb::Device &device, std::vector<std::future<std::unique_ptr<sg::Image>>> &image_futures, bool texture_streaming)
+{
+	std::vector<std::unique_ptr<sg::Image>> images;
+
+	auto image_count = image_futures.size();
+
+	// Upload images to GPU. We do this in batches of 64MB of data to avoid needing
+	// double the amount of memory (all the images and all the corresponding buffers).
+	// This helps keep memory footprint lower which is helpful on smaller devices.
+	size_t image_index = 0;
+
+	if (texture_streaming)
+	{
+		for (; image_index < image_count; image_index++)
+		{
+			images.push_back(image_futures[image_index].get());
+		}
+
+		return images;
+	}
+
+	Timer timer;
+	timer.start();
+
+	size_t host_copy_count = 0;
+	size_t host_copy_size  = 0;
+	size_t staged_size     = 0;
+	size_t submit_count    = 0;
+
+	while (image_index < image_count)
+	{
+		std::vector<vkb::core::BufferC> transient_buffers;
+
+		vkb::core::CommandBufferC *command_buffer = nullptr;
+
+		size_t batch_size = 0;
+
+		// Deal with 64MB of image data at a time to keep memory footprint low
+		while (image_index < image_count && batch_size < 64 * 1024 * 1024)
+		{
+			// Wait for this image to complete loading, then stage for upload
+			images.push_back(image_futures[image_index].get());
+
+			auto &image = images[image_index];
+
+			image_index++;
+
+			if (image->copy_data_from_host())
+			{
+				host_copy_count++;
+				host_copy_size += image->get_data().size();
+
+				image->clear_data();
+				continue;
+			}
+
+			if (!command_buffer)
+			{
+				command_buffer = &device.request_command_buffer();
+				command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, 0);
+			}
+
+			core::Buffer stage_buffer = vkb::core::BufferC::create_staging_buffer(device, image->get_data());
+
+			batch_size += image->get_data().size();
+
+			upload_image_to_gpu(*command_buffer, stage_buffer, *image);
+
+			transient_buffers.push_back(std::move(stage_buffer));
+		}
+
+		// Nothing to submit if the whole batch was copied from the host
+		if (!command_buffer)
+		{
+			continue;
+		}
+
+		command_buffer->end();
+
+		auto &queue = device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
+
+		queue.submit(*command_buffer, device.request_fence());
+
+		device.get_fence_pool().wait();
+		device.get_fence_pool().reset();
+		device.get_command_pool().reset_pool();
+		device.wait_idle();
+
+		// Remove the staging buffers for the batch we just processed
+		transient_buffers.clear();
+
+		staged_size += batch_size;
+		submit_count++;
+	}
+
+	if (image_count > 0)
+	{
+		LOGI("Uploaded {} images in {:.3f} s: {} ({:.1f} MB) copied from the host, {} ({:.1f} MB) through staging buffers in {} submissions",
+		     image_count,
+		     timer.stop(),
+		     host_copy_count,
+		     host_copy_size / (1024.0 * 1024.0),
+		     image_count - host_copy_count,
+		     staged_size / (1024.0 * 1024.0),
+		     submit_count);
+	}
+
+	return images;
+}
+
+/**
+ * @brief Peak resident set size of the process, in bytes, or 0 if the platform does not report it
+ */
+size_t get_peak_resident_set_size()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters{};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.PeakWorkingSetSize;
+	}
+	return 0;
+#elif defined(__linux__) || defined(__ANDROID__) || defined(__APPLE__)
+	rusage usage{};
+	getrusage(RUSAGE_SELF, &usage);
+#	if defined(__APPLE__)
+	return static_cast<size_t>(usage.ru_maxrss);
+#	else
+	// Reported in kilobytes
+	return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#	endif
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @brief Indices of components in a list, to cook the references between them
+ */
+template <class T>
+std::unordered_map<const T *, uint32_t> get_component_indices(const std::vector<T *> &components)
+{
+	std::unordered_map<const T *, uint32_t> indices;
+	for (size_t i = 0; i < components.size(); i++)
+	{
+		indices.emplace(components[i], to_u32(i));
+	}
+	return indices;
+}
+
+template <class T>
+uint32_t find_component_index(const std::unordered_map<const T *, uint32_t> &indices, const T *component)
+{
+	auto it = indices.find(component);
+	return it != indices.end() ? it->second : no_cooked_component;
+}
+
+void cook_image(CookedScene &cooked, size_t image_index, const sg::Image &image)
+{
+	auto &cooked_image = cooked.images[image_index];
+
+	cooked_image.name    = image.get_name();
+	cooked_image.format  = image.get_format();
+	cooked_image.layers  = image.get_layers();
+	cooked_image.mipmaps = image.get_mipmaps();
+	cooked_image.offsets = image.get_offsets();
+	cooked_image.data    = cooked.add_blob(image.get_data().data(), image.get_data().size());
+}
+
+/**
+ * @brief Reads back a buffer of the scene into the blobs of the cooked scene, the loader creates them host visible
+ */
+CookedBlob cook_buffer(CookedScene &cooked, vkb::core::BufferC *buffer)
+{
+	if (!buffer)
+	{
+		return {};
+	}
+
+	auto blob = cooked.add_blob(buffer->map(), buffer->get_size());
+	buffer->unmap();
+
+	return blob;
+}
 }        // namespace
 
 std::unordered_map<std::string, bool> GLTFLoader::supported_extensions = {
@@ -408,17 +830,47 @@ GLTFLoader::GLTFLoader(Device &device) :
 {
 }
 
+GLTFLoader::~GLTFLoader() = default;
+
 std::unique_ptr<sg::Scene> GLTFLoader::read_scene_from_file(const std::string &file_name, int scene_index, VkBufferUsageFlags additional_buffer_usage_flags)
 {
 	PROFILE_SCOPE("Load GLTF Scene");
 
+	Timer timer;
+	timer.start();
+
+	std::string gltf_file = vkb::fs::path::get(vkb::fs::path::Type::Assets) + file_name;
+
+	cooked_scene.reset();
+
+	meshlet_stats = {};
+
+	if (scene_cooking && vkb::filesystem::get()->is_file(gltf_file))
+	{
+		auto cooked_scene_file = gltf_file + CookedScene::file_suffix;
+		auto key               = get_cooked_scene_key(gltf_file, scene_index);
+
+		CookedScene cooked;
+		if (cooked.load(cooked_scene_file, key))
+		{
+			if (auto scene = load_cooked_scene(cooked, additional_buffer_usage_flags))
+			{
+				LOGI("Loaded {} from its cooked scene in {:.3f} s, peak resident set size {:.1f} MB",
+				     file_name, timer.stop(), get_peak_resident_set_size() / (1024.0 * 1024.0));
+				return scene;
+			}
+		}
+
+		// The scene is cooked while it is read from the glTF file
+		cooked_scene      = std::make_unique<CookedScene>();
+		cooked_scene->key = key;
+	}
+
 	std::string err;
 	std::string warn;
 
 	tinygltf::TinyGLTF gltf_loader;
 
-	std::string gltf_file = vkb::fs::path::get(vkb::fs::path::Type::Assets) + file_name;
-
 	bool importResult = gltf_loader.LoadASCIIFromFile(&model, &err, &warn, gltf_file.c_str());
 
 	if (!importResult)
@@ -448,7 +900,31 @@ std::unique_ptr<sg::Scene> GLTFLoader::read_scene_from_file(const std::string &f
 		model_path.clear();
 	}
 
-	return std::make_unique<sg::Scene>(load_scene(scene_index, additional_buffer_usage_flags));
+	meshlet_cache_file        = gltf_file + MeshletBuilder::cache_suffix;
+	optimized_mesh_cache_file = gltf_file + MeshOptimizer::cache_suffix;
+
+	auto degraded_allocation_count = MemoryBudgetTracker::get().get_degraded_allocation_count();
+
+	auto scene = std::make_unique<sg::Scene>(load_scene(scene_index, additional_buffer_usage_flags));
+
+	if (cooked_scene)
+	{
+		// Textures degraded to fit the memory budget of this run are not cooked
+		if (MemoryBudgetTracker::get().get_degraded_allocation_count() != degraded_allocation_count)
+		{
+			LOGW("Not cooking {}, some of its textures were degraded to stay within the memory budget", file_name);
+		}
+		else
+		{
+			cooked_scene->save(gltf_file + CookedScene::file_suffix);
+		}
+		cooked_scene.reset();
+	}
+
+	LOGI("Loaded {} from its glTF file in {:.3f} s, peak resident set size {:.1f} MB",
+	     file_name, timer.stop(), get_peak_resident_set_size() / (1024.0 * 1024.0));
+
+	return scene;
 }
 
 std::unique_ptr<sg::SubMesh> GLTFLoader::read_model_from_file(const std::string &file_name, uint32_t index, bool storage_buffer, VkBufferUsageFlags additional_buffer_usage_flags)
@@ -495,6 +971,42 @@ std::unique_ptr<sg::SubMesh> GLTFLoader::read_model_from_file(const std::string
 	return std::move(load_model(index, storage_buffer, additional_buffer_usage_flags));
 }
 
+void GLTFLoader::set_texture_streaming(bool enabled)
+{
+	texture_streaming = enabled;
+}
+
+void GLTFLoader::set_meshlets(bool enabled)
+{
+	meshlets = enabled;
+}
+
+const MeshletBuildStats &GLTFLoader::get_meshlet_stats() const
+{
+	return meshlet_stats;
+}
+
+void GLTFLoader::set_mesh_optimization(bool enabled, bool quantize)
+{
+	mesh_optimization = enabled;
+	mesh_quantization = quantize;
+}
+
+void GLTFLoader::set_lods(const std::vector<float> &ratios)
+{
+	lod_ratios = ratios;
+}
+
+void GLTFLoader::set_scene_cooking(bool enabled)
+{
+	scene_cooking = enabled;
+}
+
+void GLTFLoader::set_default_scene_cooking(bool enabled)
+{
+	default_scene_cooking = enabled;
+}
+
 sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_buffer_usage_flags)
 {
 	PROFILE_SCOPE("Process Scene");
@@ -550,83 +1062,45 @@ sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_
 	Timer timer;
 	timer.start();
 
-	// Load images
-	auto thread_count = std::thread::hardware_concurrency();
-	thread_count      = thread_count == 0 ? 1 : thread_count;
-	ctpl::thread_pool thread_pool(thread_count);
+	// Load images, on the job system shared with the rest of the framework
+	auto &job_system = JobSystem::get();
 
 	auto image_count = to_u32(model.images.size());
 
+	if (cooked_scene)
+	{
+		cooked_scene->images.resize(image_count);
+	}
+
 	std::vector<std::future<std::unique_ptr<sg::Image>>> image_component_futures;
 	for (size_t image_index = 0; image_index < image_count; image_index++)
 	{
-		auto fut = thread_pool.push(
-		    [this, image_index](size_t) {
+		auto fut = job_system.async(
+		    [this, image_index]() {
 			    auto image = parse_image(model.images[image_index]);
 
 			    LOGI("Loaded gltf image #{} ({})", image_index, model.images[image_index].uri.c_str());
 
+			    // Recorded before the upload releases the data
+			    if (cooked_scene)
+			    {
+				    cook_image(*cooked_scene, image_index, *image);
+			    }
+
 			    return image;
-		    });
+		    },
+		    JobPriority::Background);
 
 		image_component_futures.push_back(std::move(fut));
 	}
 
-	std::vector<std::unique_ptr<sg::Image>> image_components;
-
-	// Upload images to GPU. We do this in batches of 64MB of data to avoid needing
-	// double the amount of memory (all the images and all the corresponding buffers).
-	// This helps keep memory footprint lower which is helpful on smaller devices.
-	size_t image_index = 0;
-	while (image_index < image_count)
-	{
-		std::vector<vkb::core::BufferC> transient_buffers;
-
-		auto &command_buffer = device.request_command_buffer();
-
-		command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, 0);
-
-		size_t batch_size = 0;
-
-		// Deal with 64MB of image data at a time to keep memory footprint low
-		while (image_index < image_count && batch_size < 64 * 1024 * 1024)
-		{
-			// Wait for this image to complete loading, then stage for upload
-			image_components.push_back(image_component_futures[image_index].get());
-
-			auto &image = image_components[image_index];
-
-			core::Buffer stage_buffer = vkb::core::BufferC::create_staging_buffer(device, image->get_data());
-
-			batch_size += image->get_data().size();
-
-			upload_image_to_gpu(command_buffer, stage_buffer, *image);
-
-			transient_buffers.push_back(std::move(stage_buffer));
-
-			image_index++;
-		}
-
-		command_buffer.end();
-
-		auto &queue = device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
-
-		queue.submit(command_buffer, device.request_fence());
-
-		device.get_fence_pool().wait();
-		device.get_fence_pool().reset();
-		device.get_command_pool().reset_pool();
-		device.wait_idle();
-
-		// Remove the staging buffers for the batch we just processed
-		transient_buffers.clear();
-	}
+	auto image_components = upload_images(device, image_component_futures, texture_streaming);
 
 	scene.set_components(std::move(image_components));
 
 	auto elapsed_time = timer.stop();
 
-	LOGI("Time spent loading images: {} seconds across {} threads.", vkb::to_string(elapsed_time), thread_count);
+	LOGI("Time spent loading images: {} seconds across {} threads.", vkb::to_string(elapsed_time), job_system.get_worker_count());
 
 	// Load textures
 	auto images                  = scene.get_components<sg::Image>();
@@ -732,6 +1206,20 @@ sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_
 	// Load meshes
 	auto materials = scene.get_components<sg::PBRMaterial>();
 
+	MeshletBuilder meshlet_builder;
+	if (meshlets)
+	{
+		meshlet_builder.load_cache(meshlet_cache_file);
+	}
+
+	MeshOptimizer mesh_optimizer{mesh_quantization};
+	if (mesh_optimization)
+	{
+		mesh_optimizer.load_cache(optimized_mesh_cache_file);
+	}
+
+	LodStats lod_stats;
+
 	for (auto &gltf_mesh : model.meshes)
 	{
 		PROFILE_SCOPE("Processing Mesh");
@@ -745,60 +1233,49 @@ sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_
 			auto submesh_name = fmt::format("'{}' mesh, primitive #{}", gltf_mesh.name, i_primitive);
 			auto submesh      = std::make_unique<sg::SubMesh>(std::move(submesh_name));
 
-			for (auto &attribute : gltf_primitive.attributes)
-			{
-				std::string attrib_name = attribute.first;
-				std::transform(attrib_name.begin(), attrib_name.end(), attrib_name.begin(), ::tolower);
-
-				auto vertex_data = get_attribute_data(&model, attribute.second);
+			// The mesh shader reads the vertices of the meshlets from storage buffers
+			VkBufferUsageFlags meshlet_usage_flags = meshlets ? VK_BUFFER_USAGE_STORAGE_BUFFER_BIT : 0;
 
-				if (attrib_name == "position")
-				{
-					assert(attribute.second < model.accessors.size());
-					submesh->vertices_count = to_u32(model.accessors[attribute.second].count);
-				}
+			std::map<std::string, MeshAttributeInput> optimizer_attributes;
+			std::vector<uint32_t>                     optimizer_indices;
+			const OptimizedMesh                      *optimized_mesh = nullptr;
+			if (mesh_optimization && get_mesh_optimizer_input(model, gltf_primitive, optimizer_attributes, optimizer_indices))
+			{
+				optimized_mesh = &mesh_optimizer.request(optimizer_attributes, optimizer_indices);
+			}
 
+			if (optimized_mesh)
+			{
 				vkb::core::BufferC buffer{device,
-				                          vertex_data.size(),
-				                          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | additional_buffer_usage_flags,
+				                          optimized_mesh->vertex_data.size(),
+				                          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | meshlet_usage_flags | additional_buffer_usage_flags,
 				                          VMA_MEMORY_USAGE_CPU_TO_GPU};
-				buffer.update(vertex_data);
-				buffer.set_debug_name(fmt::format("'{}' mesh, primitive #{}: '{}' vertex buffer",
-				                                  gltf_mesh.name, i_primitive, attrib_name));
-
-				submesh->vertex_buffers.insert(std::make_pair(attrib_name, std::move(buffer)));
-
-				sg::VertexAttribute attrib;
-				attrib.format = get_attribute_format(&model, attribute.second);
-				attrib.stride = to_u32(get_attribute_stride(&model, attribute.second));
+				buffer.update(optimized_mesh->vertex_data);
+				buffer.set_debug_name(fmt::format("'{}' mesh, primitive #{}: interleaved vertex buffer", gltf_mesh.name, i_primitive));
 
-				submesh->set_attribute(attrib_name, attrib);
-			}
-
-			if (gltf_primitive.indices >= 0)
-			{
-				submesh->vertex_indices = to_u32(get_attribute_size(&model, gltf_primitive.indices));
+				submesh->vertex_buffers.insert(std::make_pair("vertex_buffer", std::move(buffer)));
 
-				auto format = get_attribute_format(&model, gltf_primitive.indices);
+				for (auto &attribute : optimized_mesh->attributes)
+				{
+					submesh->set_attribute(attribute.first, attribute.second);
+				}
 
-				auto index_data = get_attribute_data(&model, gltf_primitive.indices);
+				submesh->vertices_count = optimized_mesh->vertex_count;
+				submesh->vertex_indices = to_u32(optimized_mesh->indices.size());
 
-				switch (format)
+				// Remapped vertices mostly fit 16 bit indices
+				std::vector<uint8_t> index_data;
+				if (optimized_mesh->vertex_count <= std::numeric_limits<uint16_t>::max() + 1u)
 				{
-					case VK_FORMAT_R8_UINT:
-						// Converts uint8 data into uint16 data, still represented by a uint8 vector
-						index_data          = convert_underlying_data_stride(index_data, 1, 2);
-						submesh->index_type = VK_INDEX_TYPE_UINT16;
-						break;
-					case VK_FORMAT_R16_UINT:
-						submesh->index_type = VK_INDEX_TYPE_UINT16;
-						break;
-					case VK_FORMAT_R32_UINT:
-						submesh->index_type = VK_INDEX_TYPE_UINT32;
-						break;
-					default:
-						LOGE("gltf primitive has invalid format type");
-						break;
+					std::vector<uint16_t> indices{optimized_mesh->indices.begin(), optimized_mesh->indices.end()};
+					index_data.assign(reinterpret_cast<const uint8_t *>(indices.data()), reinterpret_cast<const uint8_t *>(indices.data() + indices.size()));
+					submesh->index_type = VK_INDEX_TYPE_UINT16;
+				}
+				else
+				{
+					index_data.assign(reinterpret_cast<const uint8_t *>(optimized_mesh->indices.data()),
+					                  reinterpret_cast<const uint8_t *>(optimized_mesh->indices.data() + optimized_mesh->indices.size()));
+					submesh->index_type = VK_INDEX_TYPE_UINT32;
 				}
 
 				submesh->index_buffer = std::make_unique<vkb::core::BufferC>(device,
@@ -812,7 +1289,119 @@ sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_
 			}
 			else
 			{
-				submesh->vertices_count = to_u32(get_attribute_size(&model, gltf_primitive.attributes.at("POSITION")));
+				for (auto &attribute : gltf_primitive.attributes)
+				{
+					std::string attrib_name = attribute.first;
+					std::transform(attrib_name.begin(), attrib_name.end(), attrib_name.begin(), ::tolower);
+
+					auto vertex_data = get_attribute_data(&model, attribute.second);
+
+					if (attrib_name == "position")
+					{
+						assert(attribute.second < model.accessors.size());
+						submesh->vertices_count = to_u32(model.accessors[attribute.second].count);
+					}
+
+					vkb::core::BufferC buffer{device,
+					                          vertex_data.size(),
+					                          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | meshlet_usage_flags | additional_buffer_usage_flags,
+					                          VMA_MEMORY_USAGE_CPU_TO_GPU};
+					buffer.update(vertex_data);
+					buffer.set_debug_name(fmt::format("'{}' mesh, primitive #{}: '{}' vertex buffer",
+					                                  gltf_mesh.name, i_primitive, attrib_name));
+
+					submesh->vertex_buffers.insert(std::make_pair(attrib_name, std::move(buffer)));
+
+					sg::VertexAttribute attrib;
+					attrib.format = get_attribute_format(&model, attribute.second);
+					attrib.stride = to_u32(get_attribute_stride(&model, attribute.second));
+
+					submesh->set_attribute(attrib_name, attrib);
+				}
+
+				if (gltf_primitive.indices >= 0)
+				{
+					submesh->vertex_indices = to_u32(get_attribute_size(&model, gltf_primitive.indices));
+
+					auto format = get_attribute_format(&model, gltf_primitive.indices);
+
+					auto index_data = get_attribute_data(&model, gltf_primitive.indices);
+
+					switch (format)
+					{
+						case VK_FORMAT_R8_UINT:
+							// Converts uint8 data into uint16 data, still represented by a uint8 vector
+							index_data          = convert_underlying_data_stride(index_data, 1, 2);
+							submesh->index_type = VK_INDEX_TYPE_UINT16;
+							break;
+						case VK_FORMAT_R16_UINT:
+							submesh->index_type = VK_INDEX_TYPE_UINT16;
+							break;
+						case VK_FORMAT_R32_UINT:
+							submesh->index_type = VK_INDEX_TYPE_UINT32;
+							break;
+						default:
+							LOGE("gltf primitive has invalid format type");
+							break;
+					}
+
+					submesh->index_buffer = std::make_unique<vkb::core::BufferC>(device,
+					                                                             index_data.size(),
+					                                                             VK_BUFFER_USAGE_INDEX_BUFFER_BIT | additional_buffer_usage_flags,
+					                                                             VMA_MEMORY_USAGE_GPU_TO_CPU);
+					submesh->index_buffer->set_debug_name(fmt::format("'{}' mesh, primitive #{}: index buffer",
+					                                                  gltf_mesh.name, i_primitive));
+
+					submesh->index_buffer->update(index_data);
+				}
+				else
+				{
+					submesh->vertices_count = to_u32(get_attribute_size(&model, gltf_primitive.attributes.at("POSITION")));
+				}
+			}
+
+			std::vector<glm::vec3> positions;
+			std::vector<uint32_t>  triangle_indices;
+			bool                   triangles = false;
+			if (meshlets || !lod_ratios.empty())
+			{
+				if (optimized_mesh)
+				{
+					get_triangles(*optimized_mesh, positions, triangle_indices);
+					triangles = true;
+				}
+				else
+				{
+					triangles = get_triangles(model, gltf_primitive, positions, triangle_indices);
+				}
+			}
+
+			if (triangles && !lod_ratios.empty())
+			{
+				create_lods(device, *submesh, positions, triangle_indices, lod_ratios, additional_buffer_usage_flags, lod_stats);
+			}
+
+			if (triangles && meshlets && has_meshlet_formats(*submesh))
+			{
+				const auto &meshlet_data = meshlet_builder.request(positions, triangle_indices);
+
+				if (!meshlet_data.meshlets.empty())
+				{
+					auto create_meshlet_buffer = [&](const auto &data, const char *name) {
+						auto buffer = std::make_unique<vkb::core::BufferC>(device,
+						                                                   data.size() * sizeof(data[0]),
+						                                                   VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | additional_buffer_usage_flags,
+						                                                   VMA_MEMORY_USAGE_CPU_TO_GPU);
+						buffer->set_debug_name(fmt::format("'{}' mesh, primitive #{}: meshlet {} buffer", gltf_mesh.name, i_primitive, name));
+						buffer->update(data);
+						return buffer;
+					};
+
+					submesh->meshlet_buffer          = create_meshlet_buffer(meshlet_data.meshlets, "description");
+					submesh->meshlet_vertex_buffer   = create_meshlet_buffer(meshlet_data.vertices, "vertex");
+					submesh->meshlet_triangle_buffer = create_meshlet_buffer(meshlet_data.triangles, "triangle");
+					submesh->meshlet_count           = to_u32(meshlet_data.meshlets.size());
+				}
 			}
 
 			if (gltf_primitive.material < 0)
@@ -830,7 +1419,29 @@ sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_
 			scene.add_component(std::move(submesh));
 		}
 
-		scene.add_component(std::move(mesh));
+		scene.add_component(std::move(mesh));
+	}
+
+	if (mesh_optimization)
+	{
+		mesh_optimizer.log_stats();
+		mesh_optimizer.save_cache(optimized_mesh_cache_file);
+	}
+
+	if (lod_stats.sub_mesh_count > 0)
+	{
+		LOGI("Created the levels of detail of {} sub meshes in {:.3f} ms", lod_stats.sub_mesh_count, lod_stats.simplification_time * 1000.0);
+		for (size_t level = 0; level < lod_stats.triangle_counts.size(); level++)
+		{
+			LOGI("    LOD {}: {} triangles", level, lod_stats.triangle_counts[level]);
+		}
+	}
+
+	if (meshlets)
+	{
+		meshlet_builder.log_stats();
+		meshlet_builder.save_cache(meshlet_cache_file);
+		meshlet_stats = meshlet_builder.get_stats();
 	}
 
 	device.get_fence_pool().wait();
@@ -1076,9 +1687,21 @@ sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_
 	scene.set_root_node(*root_node);
 	nodes.push_back(std::move(root_node));
 
+	if (cooked_scene)
+	{
+		cook_scene(scene, nodes);
+	}
+
 	// Store nodes into the scene
 	scene.set_nodes(std::move(nodes));
 
+	add_default_camera_and_light(scene);
+
+	return scene;
+}
+
+void GLTFLoader::add_default_camera_and_light(sg::Scene &scene)
+{
 	// Create node for the default camera
 	auto camera_node = std::make_unique<sg::Node>(-1, "default_camera");
 
@@ -1095,6 +1718,538 @@ sg::Scene GLTFLoader::load_scene(int scene_index, VkBufferUsageFlags additional_
 		// Add a default light if none are present
 		vkb::add_directional_light(scene, glm::quat({glm::radians(-90.0f), 0.0f, glm::radians(30.0f)}));
 	}
+}
+
+uint64_t GLTFLoader::get_cooked_scene_key(const std::string &gltf_file, int scene_index) const
+{
+	auto source = vkb::filesystem::get()->read_file_binary(gltf_file);
+
+	size_t key = std::hash<std::string_view>{}({reinterpret_cast<const char *>(source.data()), source.size()});
+	hash_combine(key, scene_index);
+	hash_combine(key, texture_streaming);
+	hash_combine(key, meshlets);
+	hash_combine(key, mesh_optimization);
+	hash_combine(key, mesh_quantization);
+	for (auto ratio : lod_ratios)
+	{
+		hash_combine(key, ratio);
+	}
+
+	return key;
+}
+
+void GLTFLoader::cook_scene(sg::Scene &scene, const std::vector<std::unique_ptr<sg::Node>> &nodes)
+{
+	PROFILE_SCOPE("Cook Scene");
+
+	auto &cooked = *cooked_scene;
+
+	auto images = scene.get_components<sg::Image>();
+	for (size_t i = 0; i < images.size(); i++)
+	{
+		// sRGB formats were coerced after the images were recorded
+		cooked.images[i].format = images[i]->get_format();
+	}
+
+	for (auto &gltf_sampler : model.samplers)
+	{
+		cooked.samplers.push_back({gltf_sampler.name, gltf_sampler.minFilter, gltf_sampler.magFilter, gltf_sampler.wrapS, gltf_sampler.wrapT, gltf_sampler.wrapR});
+	}
+
+	// The default linear sampler follows the glTF ones, then the default nearest sampler if a texture needed it
+	auto samplers = scene.get_components<sg::Sampler>();
+	for (size_t i = model.samplers.size(); i < samplers.size(); i++)
+	{
+		cooked.default_sampler_filters.push_back(i == model.samplers.size() ? TINYGLTF_TEXTURE_FILTER_LINEAR : TINYGLTF_TEXTURE_FILTER_NEAREST);
+	}
+
+	auto image_indices   = get_component_indices(images);
+	auto sampler_indices = get_component_indices(samplers);
+
+	auto textures = scene.get_components<sg::Texture>();
+	for (auto texture : textures)
+	{
+		cooked.textures.push_back({texture->get_name(),
+		                           find_component_index<sg::Image>(image_indices, texture->get_image()),
+		                           find_component_index<sg::Sampler>(sampler_indices, texture->get_sampler())});
+	}
+
+	auto texture_indices = get_component_indices(textures);
+
+	auto materials = scene.get_components<sg::PBRMaterial>();
+	for (auto material : materials)
+	{
+		CookedMaterial cooked_material;
+		cooked_material.name              = material->get_name();
+		cooked_material.base_color_factor = material->base_color_factor;
+		cooked_material.metallic_factor   = material->metallic_factor;
+		cooked_material.roughness_factor  = material->roughness_factor;
+		cooked_material.emissive          = material->emissive;
+		cooked_material.double_sided      = material->double_sided;
+		cooked_material.alpha_cutoff      = material->alpha_cutoff;
+		cooked_material.alpha_mode        = material->alpha_mode;
+
+		for (auto &texture : material->textures)
+		{
+			cooked_material.textures[texture.first] = find_component_index<sg::Texture>(texture_indices, texture.second);
+		}
+
+		cooked.materials.push_back(std::move(cooked_material));
+	}
+
+	auto material_indices = get_component_indices(materials);
+
+	auto submeshes = scene.get_components<sg::SubMesh>();
+	for (auto submesh : submeshes)
+	{
+		CookedSubMesh cooked_submesh;
+		cooked_submesh.name           = submesh->get_name();
+		cooked_submesh.index_type     = submesh->index_type;
+		cooked_submesh.index_offset   = submesh->index_offset;
+		cooked_submesh.vertices_count = submesh->vertices_count;
+		cooked_submesh.vertex_indices = submesh->vertex_indices;
+		cooked_submesh.attributes.insert(submesh->get_attributes().begin(), submesh->get_attributes().end());
+
+		for (auto &vertex_buffer : submesh->vertex_buffers)
+		{
+			cooked_submesh.vertex_buffers[vertex_buffer.first] = cook_buffer(cooked, &vertex_buffer.second);
+		}
+
+		cooked_submesh.index_buffer            = cook_buffer(cooked, submesh->index_buffer.get());
+		cooked_submesh.meshlet_buffer          = cook_buffer(cooked, submesh->meshlet_buffer.get());
+		cooked_submesh.meshlet_vertex_buffer   = cook_buffer(cooked, submesh->meshlet_vertex_buffer.get());
+		cooked_submesh.meshlet_triangle_buffer = cook_buffer(cooked, submesh->meshlet_triangle_buffer.get());
+		cooked_submesh.meshlet_count           = submesh->meshlet_count;
+
+		for (auto &lod : submesh->lods)
+		{
+			cooked_submesh.lods.push_back({cook_buffer(cooked, lod.index_buffer.get()), lod.index_type, lod.index_count, lod.error});
+		}
+
+		cooked_submesh.material = find_component_index(material_indices, static_cast<const sg::PBRMaterial *>(submesh->get_material()));
+
+		cooked.sub_meshes.push_back(std::move(cooked_submesh));
+	}
+
+	auto submesh_indices = get_component_indices(submeshes);
+
+	auto meshes = scene.get_components<sg::Mesh>();
+	for (auto mesh : meshes)
+	{
+		CookedMesh cooked_mesh;
+		cooked_mesh.name = mesh->get_name();
+		for (auto submesh : mesh->get_submeshes())
+		{
+			cooked_mesh.sub_meshes.push_back(find_component_index<sg::SubMesh>(submesh_indices, submesh));
+		}
+
+		cooked.meshes.push_back(std::move(cooked_mesh));
+	}
+
+	auto cameras = scene.get_components<sg::Camera>();
+	for (auto camera : cameras)
+	{
+		CookedCamera cooked_camera;
+		cooked_camera.name = camera->get_name();
+
+		if (auto perspective_camera = dynamic_cast<sg::PerspectiveCamera *>(camera))
+		{
+			cooked_camera.aspect_ratio  = perspective_camera->get_aspect_ratio();
+			cooked_camera.field_of_view = perspective_camera->get_field_of_view();
+			cooked_camera.near_plane    = perspective_camera->get_near_plane();
+			cooked_camera.far_plane     = perspective_camera->get_far_plane();
+		}
+
+		cooked.cameras.push_back(std::move(cooked_camera));
+	}
+
+	auto lights = scene.get_components<sg::Light>();
+	for (auto light : lights)
+	{
+		cooked.lights.push_back({light->get_name(), light->get_light_type(), light->get_properties()});
+	}
+
+	auto mesh_indices   = get_component_indices(meshes);
+	auto camera_indices = get_component_indices(cameras);
+	auto light_indices  = get_component_indices(lights);
+
+	std::unordered_map<const sg::Node *, uint32_t> node_indices;
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		node_indices.emplace(nodes[i].get(), to_u32(i));
+	}
+
+	for (auto &node : nodes)
+	{
+		auto &transform = node->get_transform();
+
+		CookedNode cooked_node;
+		cooked_node.id          = node->get_id();
+		cooked_node.name        = node->get_name();
+		cooked_node.translation = transform.get_translation();
+		cooked_node.rotation    = transform.get_rotation();
+		cooked_node.scale       = transform.get_scale();
+
+		for (auto child : node->get_children())
+		{
+			cooked_node.children.push_back(find_component_index<sg::Node>(node_indices, child));
+		}
+
+		if (node->has_component<sg::Mesh>())
+		{
+			cooked_node.mesh = find_component_index<sg::Mesh>(mesh_indices, &node->get_component<sg::Mesh>());
+		}
+
+		if (node->has_component<sg::Camera>())
+		{
+			cooked_node.camera = find_component_index<sg::Camera>(camera_indices, &node->get_component<sg::Camera>());
+		}
+
+		if (node->has_component<sg::Light>())
+		{
+			cooked_node.light = find_component_index<sg::Light>(light_indices, &node->get_component<sg::Light>());
+		}
+
+		cooked.nodes.push_back(std::move(cooked_node));
+	}
+
+	for (auto animation : scene.get_components<sg::Animation>())
+	{
+		CookedAnimation cooked_animation;
+		cooked_animation.name       = animation->get_name();
+		cooked_animation.start_time = animation->get_start_time();
+		cooked_animation.end_time   = animation->get_end_time();
+
+		for (auto &channel : animation->get_channels())
+		{
+			cooked_animation.channels.push_back({find_component_index<sg::Node>(node_indices, &channel.node),
+			                                     channel.target,
+			                                     channel.sampler.type,
+			                                     channel.sampler.inputs,
+			                                     channel.sampler.outputs});
+		}
+
+		cooked.animations.push_back(std::move(cooked_animation));
+	}
+}
+
+std::unique_ptr<sg::Scene> GLTFLoader::load_cooked_scene(const CookedScene &cooked, VkBufferUsageFlags additional_buffer_usage_flags)
+{
+	PROFILE_SCOPE("Load Cooked Scene");
+
+	// ASTC images are cooked as they are uploaded, decoded or not depending on the device which cooked them
+	for (auto &cooked_image : cooked.images)
+	{
+		if (sg::is_astc(cooked_image.format) && !device.is_image_format_supported(cooked_image.format))
+		{
+			LOGW("Cooked scene has ASTC images, which this device does not support");
+			return nullptr;
+		}
+	}
+
+	auto scene = std::make_unique<sg::Scene>();
+
+	scene->set_name("gltf_scene");
+
+	// Load lights
+	std::vector<std::unique_ptr<sg::Light>> light_components;
+	for (auto &cooked_light : cooked.lights)
+	{
+		auto light = std::make_unique<sg::Light>(cooked_light.name);
+		light->set_light_type(cooked_light.type);
+		light->set_properties(cooked_light.properties);
+
+		light_components.push_back(std::move(light));
+	}
+
+	scene->set_components(std::move(light_components));
+
+	// Load samplers
+	std::vector<std::unique_ptr<sg::Sampler>> sampler_components;
+	for (auto &cooked_sampler : cooked.samplers)
+	{
+		tinygltf::Sampler gltf_sampler;
+		gltf_sampler.name      = cooked_sampler.name;
+		gltf_sampler.minFilter = cooked_sampler.min_filter;
+		gltf_sampler.magFilter = cooked_sampler.mag_filter;
+		gltf_sampler.wrapS     = cooked_sampler.wrap_s;
+		gltf_sampler.wrapT     = cooked_sampler.wrap_t;
+		gltf_sampler.wrapR     = cooked_sampler.wrap_r;
+
+		sampler_components.push_back(parse_sampler(gltf_sampler));
+	}
+
+	for (auto filter : cooked.default_sampler_filters)
+	{
+		sampler_components.push_back(create_default_sampler(filter));
+	}
+
+	scene->set_components(std::move(sampler_components));
+
+	Timer timer;
+	timer.start();
+
+	// Load images, their levels are read straight from the blobs
+	auto &job_system = JobSystem::get();
+
+	std::vector<std::future<std::unique_ptr<sg::Image>>> image_component_futures;
+	for (auto &cooked_image : cooked.images)
+	{
+		auto fut = job_system.async(
+		    [this, &cooked, &cooked_image]() {
+			    auto image = CookedScene::create_image(cooked_image, cooked.read_blob(cooked_image.data));
+
+			    if (!texture_streaming)
+			    {
+				    image->create_vk_image(device);
+			    }
+
+			    return image;
+		    },
+		    JobPriority::Background);
+
+		image_component_futures.push_back(std::move(fut));
+	}
+
+	scene->set_components(upload_images(device, image_component_futures, texture_streaming));
+
+	auto elapsed_time = timer.stop();
+
+	LOGI("Time spent loading cooked images: {} seconds across {} threads.", vkb::to_string(elapsed_time), job_system.get_worker_count());
+
+	// Load textures
+	auto images   = scene->get_components<sg::Image>();
+	auto samplers = scene->get_components<sg::Sampler>();
+
+	for (auto &cooked_texture : cooked.textures)
+	{
+		tinygltf::Texture gltf_texture;
+		gltf_texture.name = cooked_texture.name;
+
+		auto texture = parse_texture(gltf_texture);
+		texture->set_image(*images.at(cooked_texture.image));
+		texture->set_sampler(*samplers.at(cooked_texture.sampler));
+
+		scene->add_component(std::move(texture));
+	}
+
+	// Load materials
+	auto textures = scene->get_components<sg::Texture>();
+
+	for (auto &cooked_material : cooked.materials)
+	{
+		auto material = std::make_unique<sg::PBRMaterial>(cooked_material.name);
+
+		material->base_color_factor = cooked_material.base_color_factor;
+		material->metallic_factor   = cooked_material.metallic_factor;
+		material->roughness_factor  = cooked_material.roughness_factor;
+		material->emissive          = cooked_material.emissive;
+		material->double_sided      = cooked_material.double_sided;
+		material->alpha_cutoff      = cooked_material.alpha_cutoff;
+		material->alpha_mode        = cooked_material.alpha_mode;
+
+		for (auto &texture : cooked_material.textures)
+		{
+			material->textures[texture.first] = textures.at(texture.second);
+		}
+
+		scene->add_component(std::move(material));
+	}
+
+	// Load meshes
+	auto materials = scene->get_components<sg::PBRMaterial>();
+
+	// The mesh shader reads the vertices of the meshlets from storage buffers
+	VkBufferUsageFlags meshlet_usage_flags = meshlets ? VK_BUFFER_USAGE_STORAGE_BUFFER_BIT : 0;
+
+	auto create_buffer = [&](const CookedBlob &blob, VkBufferUsageFlags usage, VmaMemoryUsage memory_usage, const std::string &name) {
+		auto data = cooked.read_blob(blob);
+
+		vkb::core::BufferC buffer{device, data.size(), usage | additional_buffer_usage_flags, memory_usage};
+		buffer.update(data);
+		buffer.set_debug_name(name);
+
+		return buffer;
+	};
+
+	for (auto &cooked_submesh : cooked.sub_meshes)
+	{
+		auto submesh = std::make_unique<sg::SubMesh>(cooked_submesh.name);
+
+		for (auto &vertex_buffer : cooked_submesh.vertex_buffers)
+		{
+			auto buffer = create_buffer(vertex_buffer.second,
+			                            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | meshlet_usage_flags,
+			                            VMA_MEMORY_USAGE_CPU_TO_GPU,
+			                            fmt::format("{}: '{}' vertex buffer", cooked_submesh.name, vertex_buffer.first));
+
+			submesh->vertex_buffers.insert(std::make_pair(vertex_buffer.first, std::move(buffer)));
+		}
+
+		for (auto &attribute : cooked_submesh.attributes)
+		{
+			submesh->set_attribute(attribute.first, attribute.second);
+		}
+
+		submesh->index_type     = cooked_submesh.index_type;
+		submesh->index_offset   = cooked_submesh.index_offset;
+		submesh->vertices_count = cooked_submesh.vertices_count;
+		submesh->vertex_indices = cooked_submesh.vertex_indices;
+
+		if (cooked_submesh.index_buffer.size > 0)
+		{
+			submesh->index_buffer = std::make_unique<vkb::core::BufferC>(create_buffer(cooked_submesh.index_buffer,
+			                                                                           VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+			                                                                           VMA_MEMORY_USAGE_GPU_TO_CPU,
+			                                                                           fmt::format("{}: index buffer", cooked_submesh.name)));
+		}
+
+		if (cooked_submesh.meshlet_count > 0)
+		{
+			auto create_meshlet_buffer = [&](const CookedBlob &blob, const char *name) {
+				return std::make_unique<vkb::core::BufferC>(create_buffer(blob,
+				                                                          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+				                                                          VMA_MEMORY_USAGE_CPU_TO_GPU,
+				                                                          fmt::format("{}: meshlet {} buffer", cooked_submesh.name, name)));
+			};
+
+			submesh->meshlet_buffer          = create_meshlet_buffer(cooked_submesh.meshlet_buffer, "description");
+			submesh->meshlet_vertex_buffer   = create_meshlet_buffer(cooked_submesh.meshlet_vertex_buffer, "vertex");
+			submesh->meshlet_triangle_buffer = create_meshlet_buffer(cooked_submesh.meshlet_triangle_buffer, "triangle");
+			submesh->meshlet_count           = cooked_submesh.meshlet_count;
+		}
+
+		for (auto &cooked_lod : cooked_submesh.lods)
+		{
+			sg::SubMeshLod lod;
+			lod.index_buffer = std::make_unique<vkb::core::BufferC>(create_buffer(cooked_lod.index_buffer,
+			                                                                      VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+			                                                                      VMA_MEMORY_USAGE_CPU_TO_GPU,
+			                                                                      fmt::format("{}: LOD {} index buffer", cooked_submesh.name, submesh->lods.size() + 1)));
+			lod.index_type   = cooked_lod.index_type;
+			lod.index_count  = cooked_lod.index_count;
+			lod.error        = cooked_lod.error;
+
+			submesh->lods.push_back(std::move(lod));
+		}
+
+		submesh->set_material(*materials.at(cooked_submesh.material));
+
+		scene->add_component(std::move(submesh));
+	}
+
+	auto submeshes = scene->get_components<sg::SubMesh>();
+
+	for (auto &cooked_mesh : cooked.meshes)
+	{
+		tinygltf::Mesh gltf_mesh;
+		gltf_mesh.name = cooked_mesh.name;
+
+		auto mesh = parse_mesh(gltf_mesh);
+		for (auto submesh_index : cooked_mesh.sub_meshes)
+		{
+			mesh->add_submesh(*submeshes.at(submesh_index));
+		}
+
+		scene->add_component(std::move(mesh));
+	}
+
+	// Load cameras
+	for (auto &cooked_camera : cooked.cameras)
+	{
+		tinygltf::Camera gltf_camera;
+		gltf_camera.name                    = cooked_camera.name;
+		gltf_camera.type                    = "perspective";
+		gltf_camera.perspective.aspectRatio = cooked_camera.aspect_ratio;
+		gltf_camera.perspective.yfov        = cooked_camera.field_of_view;
+		gltf_camera.perspective.znear       = cooked_camera.near_plane;
+		gltf_camera.perspective.zfar        = cooked_camera.far_plane;
+
+		scene->add_component(parse_camera(gltf_camera));
+	}
+
+	// Load nodes
+	auto meshes  = scene->get_components<sg::Mesh>();
+	auto cameras = scene->get_components<sg::Camera>();
+	auto lights  = scene->get_components<sg::Light>();
+
+	std::vector<std::unique_ptr<sg::Node>> nodes;
+
+	for (auto &cooked_node : cooked.nodes)
+	{
+		auto node = std::make_unique<sg::Node>(cooked_node.id, cooked_node.name);
+
+		auto &transform = node->get_transform();
+		transform.set_translation(cooked_node.translation);
+		transform.set_rotation(cooked_node.rotation);
+		transform.set_scale(cooked_node.scale);
+
+		if (cooked_node.mesh != no_cooked_component)
+		{
+			auto mesh = meshes.at(cooked_node.mesh);
+			node->set_component(*mesh);
+			mesh->add_node(*node);
+		}
+
+		if (cooked_node.camera != no_cooked_component)
+		{
+			auto camera = cameras.at(cooked_node.camera);
+			node->set_component(*camera);
+			camera->set_node(*node);
+		}
+
+		if (cooked_node.light != no_cooked_component)
+		{
+			auto light = lights.at(cooked_node.light);
+			node->set_component(*light);
+			light->set_node(*node);
+		}
+
+		nodes.push_back(std::move(node));
+	}
+
+	for (size_t node_index = 0; node_index < nodes.size(); node_index++)
+	{
+		for (auto child_index : cooked.nodes[node_index].children)
+		{
+			auto &child = *nodes.at(child_index);
+
+			child.set_parent(*nodes[node_index]);
+			nodes[node_index]->add_child(child);
+		}
+	}
+
+	// Load animations
+	std::vector<std::unique_ptr<sg::Animation>> animations;
+
+	for (auto &cooked_animation : cooked.animations)
+	{
+		auto animation = std::make_unique<sg::Animation>(cooked_animation.name);
+
+		for (auto &channel : cooked_animation.channels)
+		{
+			sg::AnimationSampler sampler;
+			sampler.type    = channel.type;
+			sampler.inputs  = channel.inputs;
+			sampler.outputs = channel.outputs;
+
+			animation->add_channel(*nodes.at(channel.node), channel.target, sampler);
+		}
+
+		animation->update_times(cooked_animation.start_time, cooked_animation.end_time);
+
+		animations.push_back(std::move(animation));
+	}
+
+	scene->set_components(std::move(animations));
+
+	// The root node was cooked last
+	scene->set_root_node(*nodes.back());
+
+	// Store nodes into the scene
+	scene->set_nodes(std::move(nodes));
+
+	add_default_camera_and_light(*scene);
 
 	return scene;
 }
@@ -1492,6 +2647,17 @@ std::unique_ptr<sg::Image> GLTFLoader::parse_image(tinygltf::Image &gltf_image)
 		}
 	}
 
+	if (texture_streaming)
+	{
+		// The streamer uploads the levels from the CPU, and creates the Vulkan image itself
+		if (image->get_mipmaps().size() == 1 && get_bits_per_pixel(image->get_format()) == 32)
+		{
+			image->generate_mipmaps();
+		}
+
+		return image;
+	}
+
 	image->create_vk_image(device);
 
 	return image;
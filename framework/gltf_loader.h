@@ -26,6 +26,7 @@
 #define TINYGLTF_NO_EXTERNAL_IMAGE
 #include <tiny_gltf.h>
 
+#include "meshlet_builder.h"
 #include "timer.h"
 
 #include "vulkan/vulkan.h"
@@ -34,6 +35,7 @@
 
 namespace vkb
 {
+class CookedScene;
 class Device;
 
 namespace sg
@@ -73,7 +75,7 @@ class GLTFLoader
   public:
 	GLTFLoader(Device &device);
 
-	virtual ~GLTFLoader() = default;
+	virtual ~GLTFLoader();
 
 	std::unique_ptr<sg::Scene> read_scene_from_file(const std::string &file_name, int scene_index = -1, VkBufferUsageFlags additional_buffer_usage_flags = 0);
 
@@ -83,6 +85,50 @@ class GLTFLoader
 	 */
 	std::unique_ptr<sg::SubMesh> read_model_from_file(const std::string &file_name, uint32_t index, bool storage_buffer = false, VkBufferUsageFlags additional_buffer_usage_flags = 0);
 
+	/**
+	 * @brief Keeps the images of the scenes read next on the CPU with their whole mip chain, without Vulkan images,
+	 *        for their levels to be streamed by a TextureStreamer
+	 */
+	void set_texture_streaming(bool enabled);
+
+	/**
+	 * @brief Builds the meshlets of the triangle sub meshes of the scenes read next, for them to be drawn with task and mesh
+	 *        shaders, see MeshletBuilder. The vertex buffers are created as storage buffers as well.
+	 */
+	void set_meshlets(bool enabled);
+
+	/**
+	 * @return Meshlets found in the cache or built for the last scene read, empty if it was read from its cooked scene
+	 */
+	const MeshletBuildStats &get_meshlet_stats() const;
+
+	/**
+	 * @brief Optimizes the triangle sub meshes of the scenes read next for the vertex cache, overdraw and vertex fetch,
+	 *        see MeshOptimizer. Their attributes are interleaved in a single "vertex_buffer", instead of a vertex buffer
+	 *        per attribute.
+	 * @param quantize Whether to quantize normals, tangents and texture coordinates to 16 bits
+	 */
+	void set_mesh_optimization(bool enabled, bool quantize = false);
+
+	/**
+	 * @brief Creates levels of detail of the triangle sub meshes of the scenes read next, simplified with MeshSimplifier
+	 *        into index buffers which share the vertex buffers of their sub mesh
+	 * @param ratios Fraction of the triangles of the sub mesh kept by every level, from the finest to the coarsest
+	 */
+	void set_lods(const std::vector<float> &ratios);
+
+	/**
+	 * @brief Cooks the scenes read next into a binary file next to their glTF file the first time they are read, and reads
+	 *        them back from it afterwards, as long as the glTF file and the options of the loader are the same.
+	 *        See CookedScene.
+	 */
+	void set_scene_cooking(bool enabled);
+
+	/**
+	 * @brief Selects whether the loaders created next cook their scenes, before set_scene_cooking is called
+	 */
+	static void set_default_scene_cooking(bool enabled);
+
   protected:
 	virtual std::unique_ptr<sg::Node> parse_node(const tinygltf::Node &gltf_node, size_t index) const;
 
@@ -133,9 +179,55 @@ class GLTFLoader
 	/// The extensions that the GLTFLoader can load mapped to whether they should be enabled or not
 	static std::unordered_map<std::string, bool> supported_extensions;
 
+	bool texture_streaming{false};
+
+	bool meshlets{false};
+
+	/// Cache of the meshlets of the scene read, next to its file
+	std::string meshlet_cache_file;
+
+	MeshletBuildStats meshlet_stats;
+
+	bool mesh_optimization{false};
+
+	bool mesh_quantization{false};
+
+	/// Cache of the optimized meshes of the scene read, next to its file
+	std::string optimized_mesh_cache_file;
+
+	/// Fraction of the triangles kept by every level of detail, none if empty
+	std::vector<float> lod_ratios;
+
+	/// Static so that it can be selected from the command line, before the samples are created
+	inline static bool default_scene_cooking{false};
+
+	bool scene_cooking{default_scene_cooking};
+
+	/// Scene cooked while it is read from its glTF file, if it has to be cooked
+	std::unique_ptr<CookedScene> cooked_scene;
+
   private:
 	sg::Scene load_scene(int scene_index = -1, VkBufferUsageFlags additional_buffer_usage_flags = 0);
 
+	/**
+	 * @brief Hashes the glTF file and the options of the loader which change the scene read
+	 */
+	uint64_t get_cooked_scene_key(const std::string &gltf_file, int scene_index) const;
+
+	/**
+	 * @brief Creates the scene cooked in a file, without the glTF file
+	 * @return The scene, or nullptr if the cooked scene can't be loaded on this device
+	 */
+	std::unique_ptr<sg::Scene> load_cooked_scene(const CookedScene &cooked, VkBufferUsageFlags additional_buffer_usage_flags);
+
+	/**
+	 * @brief Records the scene read from the glTF file in the scene being cooked, its images having been recorded as they were loaded
+	 * @param nodes Nodes of the scene, the root last
+	 */
+	void cook_scene(sg::Scene &scene, const std::vector<std::unique_ptr<sg::Node>> &nodes);
+
+	void add_default_camera_and_light(sg::Scene &scene);
+
 	std::unique_ptr<sg::SubMesh> load_model(uint32_t index, bool storage_buffer = false, VkBufferUsageFlags additional_buffer_usage_flags = 0);
 };
 }        // namespace vkb
@@ -20,8 +20,10 @@
 
 #include <map>
 #include <numeric>
+#include <utility>
 
 #include "common/error.h"
+#include "common/helpers.h"
 
 #include "common/glm_common.h"
 #include <glm/gtc/matrix_transform.hpp>
@@ -30,16 +32,24 @@
 #include "common/utils.h"
 #include "common/vk_common.h"
 #include "common/vk_initializers.h"
+#include "core/command_buffer.h"
 #include "core/descriptor_set.h"
 #include "core/descriptor_set_layout.h"
+#include "core/image.h"
+#include "core/image_view.h"
 #include "core/pipeline.h"
 #include "core/pipeline_layout.h"
+#include "core/sampler.h"
 #include "core/shader_module.h"
 #include "core/util/logging.hpp"
+#include "debug_info.h"
 #include "filesystem/legacy.h"
 #include "imgui_internal.h"
+#include "platform/input_events.h"
 #include "platform/window.h"
 #include "rendering/render_context.h"
+#include "stats/hpp_stats.h"
+#include "stats/stats.h"
 #include "timer.h"
 #include "vulkan_sample.h"
 
@@ -62,6 +72,51 @@ void upload_draw_data(const ImDrawData *draw_data, uint8_t *vertex_data, uint8_t
 	}
 }
 
+/**
+ * @brief Hashes the parts of the draw data that are baked into recorded draw commands: the display size, the vertex
+ *        and index counts of every draw list, and the element count, clip rectangle and texture of every draw command
+ *        The vertices and indices themselves are uploaded every frame, so they are left out.
+ */
+size_t hash_draw_commands(const ImDrawData *draw_data)
+{
+	size_t hash = 0;
+	hash_combine(hash, draw_data->DisplaySize.x);
+	hash_combine(hash, draw_data->DisplaySize.y);
+
+	for (int n = 0; n < draw_data->CmdListsCount; n++)
+	{
+		const ImDrawList *cmd_list = draw_data->CmdLists[n];
+		hash_combine(hash, cmd_list->VtxBuffer.Size);
+		hash_combine(hash, cmd_list->IdxBuffer.Size);
+
+		for (const ImDrawCmd &cmd : cmd_list->CmdBuffer)
+		{
+			hash_combine(hash, cmd.ElemCount);
+			hash_combine(hash, cmd.ClipRect.x);
+			hash_combine(hash, cmd.ClipRect.y);
+			hash_combine(hash, cmd.ClipRect.z);
+			hash_combine(hash, cmd.ClipRect.w);
+			hash_combine(hash, cmd.TextureId);
+		}
+	}
+	return hash;
+}
+
+/**
+ * @brief Returns the capacity an explicitly updated GUI buffer needs to hold required_size bytes
+ *        Capacities grow by half of their size at a time, so a GUI whose geometry fluctuates from
+ *        frame to frame settles on a buffer large enough for all of them and stops reallocating
+ */
+VkDeviceSize grow_buffer_capacity(VkDeviceSize capacity, VkDeviceSize required_size)
+{
+	capacity = std::max<VkDeviceSize>(capacity, 4096);
+	while (capacity < required_size)
+	{
+		capacity += capacity / 2;
+	}
+	return capacity;
+}
+
 inline void reset_graph_max_value(StatGraphData &graph_data)
 {
 	// If it does not have a fixed max
@@ -73,28 +128,35 @@ inline void reset_graph_max_value(StatGraphData &graph_data)
 }
 }        // namespace
 
-bool Gui::visible = true;
+template <vkb::BindingType bindingType>
+bool Gui<bindingType>::visible = true;
 
-const double Gui::press_time_ms = 200.0f;
+template <vkb::BindingType bindingType>
+const double Gui<bindingType>::press_time_ms = 200.0f;
 
-const float Gui::overlay_alpha = 0.3f;
+template <vkb::BindingType bindingType>
+const float Gui<bindingType>::overlay_alpha = 0.3f;
 
-const std::string Gui::default_font = "Roboto-Regular";
+template <vkb::BindingType bindingType>
+const std::string Gui<bindingType>::default_font = "Roboto-Regular";
 
-const ImGuiWindowFlags Gui::common_flags = ImGuiWindowFlags_NoMove |
-                                           ImGuiWindowFlags_NoScrollbar |
-                                           ImGuiWindowFlags_NoTitleBar |
-                                           ImGuiWindowFlags_NoResize |
-                                           ImGuiWindowFlags_AlwaysAutoResize |
-                                           ImGuiWindowFlags_NoSavedSettings |
-                                           ImGuiWindowFlags_NoFocusOnAppearing;
+template <vkb::BindingType bindingType>
+const ImGuiWindowFlags Gui<bindingType>::common_flags = ImGuiWindowFlags_NoMove |
+                                                        ImGuiWindowFlags_NoScrollbar |
+                                                        ImGuiWindowFlags_NoTitleBar |
+                                                        ImGuiWindowFlags_NoResize |
+                                                        ImGuiWindowFlags_AlwaysAutoResize |
+                                                        ImGuiWindowFlags_NoSavedSettings |
+                                                        ImGuiWindowFlags_NoFocusOnAppearing;
 
-const ImGuiWindowFlags Gui::options_flags = Gui::common_flags;
+template <vkb::BindingType bindingType>
+const ImGuiWindowFlags Gui<bindingType>::options_flags = Gui<bindingType>::common_flags;
 
-const ImGuiWindowFlags Gui::info_flags = Gui::common_flags | ImGuiWindowFlags_NoInputs;
+template <vkb::BindingType bindingType>
+const ImGuiWindowFlags Gui<bindingType>::info_flags = Gui<bindingType>::common_flags | ImGuiWindowFlags_NoInputs;
 
-Gui::Gui(VulkanSampleC &sample_, const Window &window, const Stats *stats, const float font_size, bool explicit_update) :
-    sample{sample_},
+Gui<bindingType>::Gui(VulkanSample<bindingType> &sample_, const Window &window, const StatsType *stats, const float font_size, bool explicit_update) :
+    sample{reinterpret_cast<VulkanSampleC &>(sample_)},
     content_scale_factor{window.get_content_scale_factor()},
     dpi_factor{window.get_dpi_factor() * content_scale_factor},
     explicit_update{explicit_update},
@@ -259,15 +321,15 @@ Gui::Gui(VulkanSampleC &sample_, const Window &window, const Stats *stats, const
 
 	if (explicit_update)
 	{
-		vertex_buffer = std::make_unique<vkb::core::BufferC>(sample.get_render_context().get_device(), 1, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU);
-		vertex_buffer->set_debug_name("GUI vertex buffer");
-
-		index_buffer = std::make_unique<vkb::core::BufferC>(sample.get_render_context().get_device(), 1, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU);
-		index_buffer->set_debug_name("GUI index buffer");
+		// The buffers of a frame are created by its first update
+		size_t frame_count = std::max<size_t>(sample.get_render_context().get_render_frames().size(), 1);
+		frame_vertex_buffers.resize(frame_count);
+		frame_index_buffers.resize(frame_count);
 	}
 }
 
-void Gui::prepare(const VkPipelineCache pipeline_cache, const VkRenderPass render_pass, const std::vector<VkPipelineShaderStageCreateInfo> &shader_stages)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::prepare(const PipelineCacheType pipeline_cache, const RenderPassType render_pass, const std::vector<PipelineShaderStageCreateInfoType> &shader_stages)
 {
 	// Descriptor pool
 	std::vector<VkDescriptorPoolSize> pool_sizes = {
@@ -329,7 +391,7 @@ void Gui::prepare(const VkPipelineCache pipeline_cache, const VkRenderPass rende
 	VkPipelineDynamicStateCreateInfo dynamic_state =
 	    vkb::initializers::pipeline_dynamic_state_create_info(dynamic_state_enables);
 
-	VkGraphicsPipelineCreateInfo pipeline_create_info = vkb::initializers::pipeline_create_info(pipeline_layout->get_handle(), render_pass);
+	VkGraphicsPipelineCreateInfo pipeline_create_info = vkb::initializers::pipeline_create_info(pipeline_layout->get_handle(), static_cast<VkRenderPass>(render_pass));
 
 	pipeline_create_info.pInputAssemblyState = &input_assembly_state;
 	pipeline_create_info.pRasterizationState = &rasterization_state;
@@ -339,7 +401,7 @@ void Gui::prepare(const VkPipelineCache pipeline_cache, const VkRenderPass rende
 	pipeline_create_info.pDepthStencilState  = &depth_stencil_state;
 	pipeline_create_info.pDynamicState       = &dynamic_state;
 	pipeline_create_info.stageCount          = static_cast<uint32_t>(shader_stages.size());
-	pipeline_create_info.pStages             = shader_stages.data();
+	pipeline_create_info.pStages             = reinterpret_cast<const VkPipelineShaderStageCreateInfo *>(shader_stages.data());
 	pipeline_create_info.subpass             = subpass;
 
 	// Vertex bindings an attributes based on ImGui vertex definition
@@ -359,10 +421,11 @@ void Gui::prepare(const VkPipelineCache pipeline_cache, const VkRenderPass rende
 
 	pipeline_create_info.pVertexInputState = &vertex_input_state_create_info;
 
-	VK_CHECK(vkCreateGraphicsPipelines(sample.get_render_context().get_device().get_handle(), pipeline_cache, 1, &pipeline_create_info, nullptr, &pipeline));
-}        // namespace vkb
+	VK_CHECK(vkCreateGraphicsPipelines(sample.get_render_context().get_device().get_handle(), static_cast<VkPipelineCache>(pipeline_cache), 1, &pipeline_create_info, nullptr, &pipeline));
+}
 
-void Gui::update(const float delta_time)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::update(const float delta_time)
 {
 	if (visible != prev_visible)
 	{
@@ -386,7 +449,8 @@ void Gui::update(const float delta_time)
 	ImGui::Render();
 }
 
-bool Gui::update_buffers()
+template <vkb::BindingType bindingType>
+bool Gui<bindingType>::update_buffers()
 {
 	ImDrawData *draw_data = ImGui::GetDrawData();
 	bool        updated   = false;
@@ -404,43 +468,62 @@ bool Gui::update_buffers()
 		return false;
 	}
 
-	if ((vertex_buffer->get_handle() == VK_NULL_HANDLE) || (vertex_buffer_size != last_vertex_buffer_size))
+	// Each frame in flight has its own buffers, so the geometry written for this frame never races a frame the GPU still reads
+	size_t frame_index = get_frame_buffer_index();
+	if (frame_index >= frame_vertex_buffers.size())
 	{
-		last_vertex_buffer_size = vertex_buffer_size;
-		updated                 = true;
+		frame_vertex_buffers.resize(frame_index + 1);
+		frame_index_buffers.resize(frame_index + 1);
+	}
 
-		vertex_buffer.reset();
-		vertex_buffer = std::make_unique<vkb::core::BufferC>(sample.get_render_context().get_device(), vertex_buffer_size,
-		                                                     VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-		                                                     VMA_MEMORY_USAGE_GPU_TO_CPU);
+	auto &vertex_buffer = frame_vertex_buffers[frame_index];
+	auto &index_buffer  = frame_index_buffers[frame_index];
+
+	// The draw commands recorded ahead bake in the counts, offsets and scissors of the draw data they were recorded with
+	size_t draw_commands_hash = hash_draw_commands(draw_data);
+	if (draw_commands_hash != recorded_draw_commands_hash)
+	{
+		recorded_draw_commands_hash = draw_commands_hash;
+		updated                     = true;
+	}
+
+	// The buffers are persistently mapped and only reallocated when the geometry outgrows them, at which point the
+	// draw commands recorded against them hold stale handles as well
+	if (!vertex_buffer || (vertex_buffer_size > vertex_buffer->get_size()))
+	{
+		updated = true;
+
+		VkDeviceSize capacity = grow_buffer_capacity(vertex_buffer ? vertex_buffer->get_size() : 0, vertex_buffer_size);
+		vertex_buffer         = std::make_unique<vkb::core::BufferC>(sample.get_render_context().get_device(), capacity,
+		                                                             VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+		                                                             VMA_MEMORY_USAGE_CPU_TO_GPU,
+		                                                             VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT);
 		vertex_buffer->set_debug_name("GUI vertex buffer");
 	}
 
-	if ((index_buffer->get_handle() == VK_NULL_HANDLE) || (index_buffer_size != last_index_buffer_size))
+	if (!index_buffer || (index_buffer_size > index_buffer->get_size()))
 	{
-		last_index_buffer_size = index_buffer_size;
-		updated                = true;
+		updated = true;
 
-		index_buffer.reset();
-		index_buffer = std::make_unique<vkb::core::BufferC>(sample.get_render_context().get_device(), index_buffer_size,
-		                                                    VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-		                                                    VMA_MEMORY_USAGE_GPU_TO_CPU);
+		VkDeviceSize capacity = grow_buffer_capacity(index_buffer ? index_buffer->get_size() : 0, index_buffer_size);
+		index_buffer          = std::make_unique<vkb::core::BufferC>(sample.get_render_context().get_device(), capacity,
+		                                                             VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+		                                                             VMA_MEMORY_USAGE_CPU_TO_GPU,
+		                                                             VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT);
 		index_buffer->set_debug_name("GUI index buffer");
 	}
 
 	// Upload data
 	upload_draw_data(draw_data, vertex_buffer->map(), index_buffer->map());
 
-	vertex_buffer->flush();
-	index_buffer->flush();
-
-	vertex_buffer->unmap();
-	index_buffer->unmap();
+	vertex_buffer->flush(0, vertex_buffer_size);
+	index_buffer->flush(0, index_buffer_size);
 
 	return updated;
 }
 
-vkb::BufferAllocationC Gui::update_buffers(vkb::core::CommandBufferC &command_buffer)
+template <vkb::BindingType bindingType>
+vkb::BufferAllocationC Gui<bindingType>::update_buffers(vkb::core::CommandBufferC &command_buffer)
 {
 	ImDrawData *draw_data = ImGui::GetDrawData();
 
@@ -457,39 +540,46 @@ vkb::BufferAllocationC Gui::update_buffers(vkb::core::CommandBufferC &command_bu
 		return vkb::BufferAllocationC{};
 	}
 
-	std::vector<uint8_t> vertex_data(vertex_buffer_size);
-	std::vector<uint8_t> index_data(index_buffer_size);
+	auto vertex_allocation = sample.get_render_context().get_active_frame().allocate_buffer(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, vertex_buffer_size);
+	auto index_allocation  = sample.get_render_context().get_active_frame().allocate_buffer(VK_BUFFER_USAGE_INDEX_BUFFER_BIT, index_buffer_size);
 
-	upload_draw_data(draw_data, vertex_data.data(), index_data.data());
+	// Buffer pool blocks are persistently mapped, so the draw lists are copied straight into them
+	auto &vertex_block = vertex_allocation.get_buffer();
+	auto &index_block  = index_allocation.get_buffer();
 
-	auto vertex_allocation = sample.get_render_context().get_active_frame().allocate_buffer(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, vertex_buffer_size);
+	upload_draw_data(draw_data, vertex_block.map() + vertex_allocation.get_offset(), index_block.map() + index_allocation.get_offset());
 
-	vertex_allocation.update(vertex_data);
+	vertex_block.flush(vertex_allocation.get_offset(), vertex_buffer_size);
+	index_block.flush(index_allocation.get_offset(), index_buffer_size);
 
 	std::vector<std::reference_wrapper<const vkb::core::BufferC>> buffers;
-	buffers.emplace_back(std::ref(vertex_allocation.get_buffer()));
+	buffers.emplace_back(std::ref(vertex_block));
 
 	std::vector<VkDeviceSize> offsets{vertex_allocation.get_offset()};
 
 	command_buffer.bind_vertex_buffers(0, buffers, offsets);
 
-	auto index_allocation = sample.get_render_context().get_active_frame().allocate_buffer(VK_BUFFER_USAGE_INDEX_BUFFER_BIT, index_buffer_size);
-
-	index_allocation.update(index_data);
-
-	command_buffer.bind_index_buffer(index_allocation.get_buffer(), index_allocation.get_offset(), VK_INDEX_TYPE_UINT16);
+	command_buffer.bind_index_buffer(index_block, index_allocation.get_offset(), VK_INDEX_TYPE_UINT16);
 
 	return vertex_allocation;
 }
 
-void Gui::resize(const uint32_t width, const uint32_t height) const
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::resize(const uint32_t width, const uint32_t height) const
 {
 	auto &io         = ImGui::GetIO();
 	io.DisplaySize.x = static_cast<float>(width);
 	io.DisplaySize.y = static_cast<float>(height);
 }
 
-void Gui::draw(vkb::core::CommandBufferC &command_buffer)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::draw(vkb::core::CommandBuffer<bindingType> &command_buffer)
+{
+	draw_impl(reinterpret_cast<vkb::core::CommandBufferC &>(command_buffer));
+}
+
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::draw_impl(vkb::core::CommandBufferC &command_buffer)
 {
 	if (!visible)
 	{
@@ -598,11 +688,17 @@ void Gui::draw(vkb::core::CommandBufferC &command_buffer)
 	}
 	else
 	{
-		vertex_buffers.push_back(*vertex_buffer);
+		size_t frame_index = get_frame_buffer_index();
+		if ((frame_index >= frame_vertex_buffers.size()) || !frame_vertex_buffers[frame_index] || !frame_index_buffers[frame_index])
+		{
+			return;
+		}
+
+		vertex_buffers.push_back(*frame_vertex_buffers[frame_index]);
 		vertex_offsets.push_back(0);
 		command_buffer.bind_vertex_buffers(0, vertex_buffers, vertex_offsets);
 
-		command_buffer.bind_index_buffer(*index_buffer, 0, VK_INDEX_TYPE_UINT16);
+		command_buffer.bind_index_buffer(*frame_index_buffers[frame_index], 0, VK_INDEX_TYPE_UINT16);
 	}
 
 	// Render commands
@@ -671,12 +767,32 @@ void Gui::draw(vkb::core::CommandBufferC &command_buffer)
 	}
 }
 
-void Gui::draw(VkCommandBuffer command_buffer)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::draw(CommandBufferHandleType command_buffer)
 {
-	draw(command_buffer, pipeline, pipeline_layout->get_handle(), descriptor_set);
+	draw_impl(static_cast<VkCommandBuffer>(command_buffer), pipeline, pipeline_layout->get_handle(), descriptor_set, get_frame_buffer_index());
 }
 
-void Gui::draw(VkCommandBuffer command_buffer, const VkPipeline pipeline, const VkPipelineLayout pipeline_layout, const VkDescriptorSet descriptor_set)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::draw(CommandBufferHandleType command_buffer, const PipelineType pipeline, const PipelineLayoutType pipeline_layout, const DescriptorSetType descriptor_set)
+{
+	draw_impl(static_cast<VkCommandBuffer>(command_buffer), static_cast<VkPipeline>(pipeline), static_cast<VkPipelineLayout>(pipeline_layout), static_cast<VkDescriptorSet>(descriptor_set), get_frame_buffer_index());
+}
+
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::draw(CommandBufferHandleType command_buffer, size_t frame_index)
+{
+	draw_impl(static_cast<VkCommandBuffer>(command_buffer), pipeline, pipeline_layout->get_handle(), descriptor_set, frame_index);
+}
+
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::draw(CommandBufferHandleType command_buffer, const PipelineType pipeline, const PipelineLayoutType pipeline_layout, const DescriptorSetType descriptor_set, size_t frame_index)
+{
+	draw_impl(static_cast<VkCommandBuffer>(command_buffer), static_cast<VkPipeline>(pipeline), static_cast<VkPipelineLayout>(pipeline_layout), static_cast<VkDescriptorSet>(descriptor_set), frame_index);
+}
+
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::draw_impl(VkCommandBuffer command_buffer, const VkPipeline pipeline, const VkPipelineLayout pipeline_layout, const VkDescriptorSet descriptor_set, size_t frame_index)
 {
 	if (!visible)
 	{
@@ -688,7 +804,8 @@ void Gui::draw(VkCommandBuffer command_buffer, const VkPipeline pipeline, const
 	int32_t     vertex_offset = 0;
 	int32_t     index_offset  = 0;
 
-	if ((!draw_data) || (draw_data->CmdListsCount == 0))
+	if ((!draw_data) || (draw_data->CmdListsCount == 0) || (frame_index >= frame_vertex_buffers.size()) ||
+	    !frame_vertex_buffers[frame_index] || !frame_index_buffers[frame_index])
 	{
 		return;
 	}
@@ -703,10 +820,10 @@ void Gui::draw(VkCommandBuffer command_buffer, const VkPipeline pipeline, const
 	vkCmdPushConstants(command_buffer, pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(glm::mat4), &push_transform);
 
 	VkDeviceSize vertex_offsets[1]    = {0};
-	VkBuffer     vertex_buffer_handle = vertex_buffer->get_handle();
+	VkBuffer     vertex_buffer_handle = frame_vertex_buffers[frame_index]->get_handle();
 	vkCmdBindVertexBuffers(command_buffer, 0, 1, &vertex_buffer_handle, vertex_offsets);
 
-	VkBuffer index_buffer_handle = index_buffer->get_handle();
+	VkBuffer index_buffer_handle = frame_index_buffers[frame_index]->get_handle();
 	vkCmdBindIndexBuffer(command_buffer, index_buffer_handle, 0, VK_INDEX_TYPE_UINT16);
 
 	for (int32_t i = 0; i < draw_data->CmdListsCount; i++)
@@ -735,7 +852,8 @@ void Gui::draw(VkCommandBuffer command_buffer, const VkPipeline pipeline, const
 	}
 }
 
-Gui::~Gui()
+template <vkb::BindingType bindingType>
+Gui<bindingType>::~Gui()
 {
 	vkDestroyDescriptorPool(sample.get_render_context().get_device().get_handle(), descriptor_pool, nullptr);
 	vkDestroyDescriptorSetLayout(sample.get_render_context().get_device().get_handle(), descriptor_set_layout, nullptr);
@@ -744,32 +862,38 @@ Gui::~Gui()
 	ImGui::DestroyContext();
 }
 
-void Gui::show_demo_window()
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_demo_window()
 {
 	ImGui::ShowDemoWindow();
 }
 
-Gui::StatsView &Gui::get_stats_view()
+template <vkb::BindingType bindingType>
+typename Gui<bindingType>::StatsView &Gui<bindingType>::get_stats_view()
 {
 	return stats_view;
 }
 
-Drawer &Gui::get_drawer()
+template <vkb::BindingType bindingType>
+Drawer &Gui<bindingType>::get_drawer()
 {
 	return drawer;
 }
 
-VkSampler Gui::get_sampler() const
+template <vkb::BindingType bindingType>
+typename Gui<bindingType>::SamplerType Gui<bindingType>::get_sampler() const
 {
-	return sampler->get_handle();
+	return static_cast<SamplerType>(sampler->get_handle());
 }
 
-VkImageView Gui::get_font_image_view() const
+template <vkb::BindingType bindingType>
+typename Gui<bindingType>::ImageViewType Gui<bindingType>::get_font_image_view() const
 {
-	return font_image_view->get_handle();
+	return static_cast<ImageViewType>(font_image_view->get_handle());
 }
 
-Font &Gui::get_font(const std::string &font_name)
+template <vkb::BindingType bindingType>
+Font &Gui<bindingType>::get_font(const std::string &font_name)
 {
 	assert(!fonts.empty() && "No fonts exist");
 
@@ -786,17 +910,25 @@ Font &Gui::get_font(const std::string &font_name)
 	}
 }
 
-bool Gui::is_debug_view_active() const
+template <vkb::BindingType bindingType>
+bool Gui<bindingType>::is_debug_view_active() const
 {
 	return debug_view.active;
 }
 
-void Gui::set_subpass(const uint32_t subpass)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::set_subpass(const uint32_t subpass)
 {
 	this->subpass = subpass;
 }
 
-Gui::StatsView::StatsView(const Stats *stats)
+template <vkb::BindingType bindingType>
+size_t Gui<bindingType>::get_frame_buffer_index() const
+{
+	return std::as_const(sample.get_render_context()).get_active_frame_index();
+}
+
+Gui<bindingType>::StatsView::StatsView(const StatsType *stats)
 {
 	if (stats == nullptr)
 	{
@@ -812,7 +944,8 @@ Gui::StatsView::StatsView(const Stats *stats)
 	}
 }
 
-void Gui::StatsView::reset_max_value(const StatIndex index)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::StatsView::reset_max_value(const StatIndex index)
 {
 	auto pr = graph_map.find(index);
 	if (pr != graph_map.end())
@@ -821,7 +954,8 @@ void Gui::StatsView::reset_max_value(const StatIndex index)
 	}
 }
 
-void Gui::StatsView::reset_max_values()
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::StatsView::reset_max_values()
 {
 	// For every entry in the map
 	std::for_each(graph_map.begin(),
@@ -829,7 +963,8 @@ void Gui::StatsView::reset_max_values()
 	              [](auto &pr) { reset_graph_max_value(pr.second); });
 }
 
-void Gui::show_top_window(const std::string &app_name, const Stats *stats, DebugInfo *debug_info)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_top_window(const std::string &app_name, const StatsType *stats, const DebugInfo *debug_info)
 {
 	// Transparent background
 	ImGui::SetNextWindowBgAlpha(overlay_alpha);
@@ -867,7 +1002,8 @@ void Gui::show_top_window(const std::string &app_name, const Stats *stats, Debug
 	ImGui::End();
 }
 
-void Gui::show_app_info(const std::string &app_name)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_app_info(const std::string &app_name)
 {
 	// Sample name
 	ImGui::Text("%s", app_name.c_str());
@@ -879,7 +1015,8 @@ void Gui::show_app_info(const std::string &app_name)
 	ImGui::Text("%s", device_name_label.c_str());
 }
 
-void Gui::show_debug_window(DebugInfo &debug_info, const ImVec2 &position)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_debug_window(const DebugInfo &debug_info, const ImVec2 &position)
 {
 	auto &io    = ImGui::GetIO();
 	auto &style = ImGui::GetStyle();
@@ -928,7 +1065,8 @@ void Gui::show_debug_window(DebugInfo &debug_info, const ImVec2 &position)
 	ImGui::End();
 }
 
-void Gui::show_stats(const Stats &stats)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_stats(const StatsType &stats)
 {
 	for (const auto &stat_index : stats.get_requested_stats())
 	{
@@ -974,9 +1112,64 @@ void Gui::show_stats(const Stats &stats)
 			ImGui::Text("%s", graph_label.str().c_str());
 		}
 	}
+
+	if (auto *gpu_profiler = stats.get_gpu_profiler())
+	{
+		show_gpu_profile(*gpu_profiler);
+	}
 }
 
-void Gui::show_options_window(std::function<void()> body, const uint32_t lines)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_gpu_profile(const GpuProfiler &gpu_profiler)
+{
+	const auto &scopes = gpu_profiler.get_latest_frame().scopes;
+	if (scopes.empty() || !ImGui::TreeNode("GPU passes"))
+	{
+		return;
+	}
+
+	// Scopes are ordered depth first, those deeper than the open tree nodes belong to a collapsed node
+	uint32_t open_depth = 0;
+	for (size_t i = 0; i < scopes.size(); i++)
+	{
+		const auto &scope = scopes[i];
+
+		while (open_depth > scope.depth)
+		{
+			ImGui::TreePop();
+			open_depth--;
+		}
+
+		if (scope.depth > open_depth)
+		{
+			continue;
+		}
+
+		bool               has_children = i + 1 < scopes.size() && scopes[i + 1].depth > scope.depth;
+		ImGuiTreeNodeFlags flags        = has_children ? ImGuiTreeNodeFlags_None : ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+
+		if (ImGui::TreeNodeEx(reinterpret_cast<void *>(i), flags, "%s: %.3f ms", scope.name.c_str(), scope.average_duration) && has_children)
+		{
+			open_depth++;
+		}
+	}
+
+	while (open_depth > 0)
+	{
+		ImGui::TreePop();
+		open_depth--;
+	}
+
+	if (ImGui::Button("Save as JSON"))
+	{
+		gpu_profiler.write_json(vkb::fs::path::get(vkb::fs::path::Logs, "gpu_profile.json"));
+	}
+
+	ImGui::TreePop();
+}
+
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_options_window(std::function<void()> body, const uint32_t lines)
 {
 	// Add padding around the text so that the options are not
 	// too close to the edges and are easier to interact with.
@@ -1005,7 +1198,8 @@ void Gui::show_options_window(std::function<void()> body, const uint32_t lines)
 	ImGui::PopStyleVar();
 }
 
-void Gui::show_simple_window(const std::string &name, uint32_t last_fps, std::function<void()> body)
+template <vkb::BindingType bindingType>
+void Gui<bindingType>::show_simple_window(const std::string &name, uint32_t last_fps, std::function<void()> body)
 {
 	ImGuiIO &io = ImGui::GetIO();
 
@@ -1026,7 +1220,8 @@ void Gui::show_simple_window(const std::string &name, uint32_t last_fps, std::fu
 	ImGui::PopStyleVar();
 }
 
-bool Gui::input_event(const InputEvent &input_event)
+template <vkb::BindingType bindingType>
+bool Gui<bindingType>::input_event(const InputEvent &input_event)
 {
 	auto &io                 = ImGui::GetIO();
 	auto  capture_move_event = false;
@@ -1136,4 +1331,7 @@ bool Gui::input_event(const InputEvent &input_event)
 	return capture_move_event;
 }
 
+
+template class Gui<vkb::BindingType::C>;
+template class Gui<vkb::BindingType::Cpp>;
 }        // namespace vkb
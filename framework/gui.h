@@ -20,26 +20,51 @@
 
 #include <cstdint>
 #include <functional>
-#include <future>
 #include <imgui.h>
 #include <imgui_internal.h>
-#include <thread>
+#include <map>
+#include <memory>
 
-#include "core/buffer.h"
-#include "core/command_buffer.h"
-#include "core/sampler.h"
-#include "debug_info.h"
+#include "buffer_pool.h"
+#include "common/vk_common.h"
 #include "drawer.h"
 #include "filesystem/legacy.h"
-#include "platform/input_events.h"
-#include "rendering/render_context.h"
-#include "stats/stats.h"
-#include "vulkan_sample.h"
+#include "stats/stats_common.h"
+#include "timer.h"
 
 namespace vkb
 {
+class DebugInfo;
+class GpuProfiler;
+class InputEvent;
+class PipelineLayout;
+class Stats;
 class Window;
 
+template <vkb::BindingType bindingType>
+class VulkanSample;
+using VulkanSampleC = VulkanSample<vkb::BindingType::C>;
+
+namespace core
+{
+template <vkb::BindingType bindingType>
+class Buffer;
+using BufferC = Buffer<vkb::BindingType::C>;
+
+template <vkb::BindingType bindingType>
+class CommandBuffer;
+using CommandBufferC = CommandBuffer<vkb::BindingType::C>;
+
+class Image;
+class ImageView;
+class Sampler;
+}        // namespace core
+
+namespace stats
+{
+class HPPStats;
+}
+
 /**
  * @brief Helper structure for fonts loaded from TTF
  */
@@ -79,10 +104,26 @@ struct Font
 
 /**
  * @brief Vulkan helper class for Dear ImGui
+ *
+ * Both bindings share a single implementation, working on the C types. The members are defined
+ * in gui.cpp and explicitly instantiated for vkb::BindingType::C and vkb::BindingType::Cpp.
  */
+template <vkb::BindingType bindingType>
 class Gui
 {
   public:
+	using CommandBufferHandleType           = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::CommandBuffer, VkCommandBuffer>::type;
+	using DescriptorSetType                 = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DescriptorSet, VkDescriptorSet>::type;
+	using ImageViewType                     = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::ImageView, VkImageView>::type;
+	using PipelineCacheType                 = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::PipelineCache, VkPipelineCache>::type;
+	using PipelineLayoutType                = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::PipelineLayout, VkPipelineLayout>::type;
+	using PipelineShaderStageCreateInfoType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::PipelineShaderStageCreateInfo, VkPipelineShaderStageCreateInfo>::type;
+	using PipelineType                      = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::Pipeline, VkPipeline>::type;
+	using RenderPassType                    = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::RenderPass, VkRenderPass>::type;
+	using SamplerType                       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::Sampler, VkSampler>::type;
+
+	using StatsType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::stats::HPPStats, vkb::Stats>::type;
+
 	/**
 	 * @brief Helper class for drawing statistics
 	 */
@@ -93,7 +134,7 @@ class Gui
 		 * @brief Constructs a StatsView
 		 * @param stats Const pointer to the Stats data object; may be null
 		 */
-		StatsView(const Stats *stats);
+		StatsView(const StatsType *stats);
 
 		/**
 		 * @brief Resets the max values for the stats
@@ -148,14 +189,14 @@ class Gui
 	 * @param font_size The font size
 	 * @param explicit_update If true, update buffers every frame
 	 */
-	Gui(VulkanSampleC &sample, const Window &window, const Stats *stats = nullptr, const float font_size = 21.0f, bool explicit_update = false);
+	Gui(VulkanSample<bindingType> &sample, const Window &window, const StatsType *stats = nullptr, const float font_size = 21.0f, bool explicit_update = false);
 
 	/**
 	 * @brief Destroys the Gui
 	 */
 	~Gui();
 
-	void prepare(const VkPipelineCache pipeline_cache, const VkRenderPass render_pass, const std::vector<VkPipelineShaderStageCreateInfo> &shader_stages);
+	void prepare(const PipelineCacheType pipeline_cache, const RenderPassType render_pass, const std::vector<PipelineShaderStageCreateInfoType> &shader_stages);
 
 	/**
 	 * @brief Handles resizing of the window
@@ -176,19 +217,24 @@ class Gui
 	 */
 	void update(const float delta_time);
 
+	/**
+	 * @brief Uploads the geometry of the Gui into the buffers of the active frame, if updated explicitly
+	 * @return True if the draw commands changed or a buffer was reallocated, in which case the draw commands recorded
+	 *         with the previous draw data have to be recorded again
+	 */
 	bool update_buffers();
 
 	/**
 	 * @brief Draws the Gui
 	 * @param command_buffer Command buffer to register draw-commands
 	 */
-	void draw(vkb::core::CommandBufferC &command_buffer);
+	void draw(vkb::core::CommandBuffer<bindingType> &command_buffer);
 
 	/**
 	 * @brief Draws the Gui
 	 * @param command_buffer Command buffer to register draw-commands
 	 */
-	void draw(VkCommandBuffer command_buffer);
+	void draw(CommandBufferHandleType command_buffer);
 
 	/**
 	 * @brief Draws the Gui using an external pipeline
@@ -197,7 +243,25 @@ class Gui
 	 * @param pipeline_layout PipelineLayout for given pieline
 	 * @param descriptor_set DescriptorSet to bind to perform draw-commands
 	 */
-	void draw(VkCommandBuffer command_buffer, const VkPipeline pipeline, const VkPipelineLayout pipeline_layout, const VkDescriptorSet descriptor_set);
+	void draw(CommandBufferHandleType command_buffer, const PipelineType pipeline, const PipelineLayoutType pipeline_layout, const DescriptorSetType descriptor_set);
+
+	/**
+	 * @brief Draws the Gui with the explicitly updated buffers of a frame, for command buffers recorded ahead of the frame
+	 *        they are submitted in rather than during the active frame
+	 * @param command_buffer Command buffer to register draw-commands
+	 * @param frame_index Index of the frame the command buffer is submitted in
+	 */
+	void draw(CommandBufferHandleType command_buffer, size_t frame_index);
+
+	/**
+	 * @brief Draws the Gui using an external pipeline, with the explicitly updated buffers of a frame
+	 * @param command_buffer Command buffer to register draw-commands
+	 * @param pipeline Pipeline to bind to perform draw-commands
+	 * @param pipeline_layout PipelineLayout for given pieline
+	 * @param descriptor_set DescriptorSet to bind to perform draw-commands
+	 * @param frame_index Index of the frame the command buffer is submitted in
+	 */
+	void draw(CommandBufferHandleType command_buffer, const PipelineType pipeline, const PipelineLayoutType pipeline_layout, const DescriptorSetType descriptor_set, size_t frame_index);
 
 	/**
 	 * @brief Shows an overlay top window with app info and maybe stats
@@ -205,7 +269,7 @@ class Gui
 	 * @param stats Statistics to show (can be null)
 	 * @param debug_info Debug info to show (can be null)
 	 */
-	void show_top_window(const std::string &app_name, const Stats *stats = nullptr, DebugInfo *debug_info = nullptr);
+	void show_top_window(const std::string &app_name, const StatsType *stats = nullptr, const DebugInfo *debug_info = nullptr);
 
 	/**
 	 * @brief Shows the ImGui Demo window
@@ -223,13 +287,19 @@ class Gui
 	 * @param debug_info The object holding the data fields to be displayed
 	 * @param position The absolute position to set
 	 */
-	void show_debug_window(DebugInfo &debug_info, const ImVec2 &position);
+	void show_debug_window(const DebugInfo &debug_info, const ImVec2 &position);
 
 	/**
 	 * @brief Shows a child with statistics
 	 * @param stats Statistics to show
 	 */
-	void show_stats(const Stats &stats);
+	void show_stats(const StatsType &stats);
+
+	/**
+	 * @brief Shows the per-pass GPU time breakdown of a GPU profiler as a tree
+	 * @param gpu_profiler GPU profiler to show the latest frame of
+	 */
+	void show_gpu_profile(const GpuProfiler &gpu_profiler);
 
 	/**
 	 * @brief Shows an options windows, to be filled by the sample,
@@ -257,9 +327,9 @@ class Gui
 
 	void set_subpass(const uint32_t subpass);
 
-	VkSampler get_sampler() const;
+	SamplerType get_sampler() const;
 
-	VkImageView get_font_image_view() const;
+	ImageViewType get_font_image_view() const;
 
   private:
 	/**
@@ -274,6 +344,15 @@ class Gui
 	 */
 	BufferAllocationC update_buffers(vkb::core::CommandBufferC &command_buffer);
 
+	void draw_impl(vkb::core::CommandBufferC &command_buffer);
+
+	void draw_impl(VkCommandBuffer command_buffer, const VkPipeline pipeline, const VkPipelineLayout pipeline_layout, const VkDescriptorSet descriptor_set, size_t frame_index);
+
+	/**
+	 * @return The index of the explicitly updated buffers of the active frame
+	 */
+	size_t get_frame_buffer_index() const;
+
 	static const double press_time_ms;
 
 	static const float overlay_alpha;
@@ -286,13 +365,13 @@ class Gui
 
 	VulkanSampleC &sample;
 
-	std::unique_ptr<vkb::core::BufferC> vertex_buffer;
+	/// Explicitly updated geometry, a vertex buffer and an index buffer per frame of the render context
+	std::vector<std::unique_ptr<vkb::core::BufferC>> frame_vertex_buffers;
 
-	std::unique_ptr<vkb::core::BufferC> index_buffer;
+	std::vector<std::unique_ptr<vkb::core::BufferC>> frame_index_buffers;
 
-	size_t last_vertex_buffer_size;
-
-	size_t last_index_buffer_size;
+	/// Hash of the draw commands the command buffers recorded ahead draw, see update_buffers()
+	size_t recorded_draw_commands_hash{0};
 
 	///  Scale factor to apply due to a difference between the window and GL pixel sizes
 	float content_scale_factor{1.0f};
@@ -338,8 +417,14 @@ class Gui
 	uint32_t subpass = 0;
 };
 
-void Gui::new_frame()
+template <vkb::BindingType bindingType>
+inline void Gui<bindingType>::new_frame()
 {
 	ImGui::NewFrame();
 }
+
+using GuiC   = Gui<vkb::BindingType::C>;
+using GuiCpp = Gui<vkb::BindingType::Cpp>;
 }        // namespace vkb
+
+#include "vulkan_sample.h"
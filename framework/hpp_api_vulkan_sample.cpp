@@ -48,6 +48,13 @@ bool HPPApiVulkanSample::prepare(const vkb::ApplicationOptions &options)
 	submit_info.setWaitSemaphores(semaphores.acquired_image_ready);
 	submit_info.setSignalSemaphores(semaphores.render_complete);
 
+	// Rendering offscreen, there is no image to acquire nor to present, so submissions neither wait nor signal
+	if (!get_render_context().has_swapchain())
+	{
+		submit_info.waitSemaphoreCount   = 0;
+		submit_info.signalSemaphoreCount = 0;
+	}
+
 	queue = get_device().get_suitable_graphics_queue().get_handle();
 
 	create_swapchain_buffers();
@@ -458,7 +465,9 @@ void HPPApiVulkanSample::update_overlay(float delta_time, const std::function<vo
 
 		get_gui().update(delta_time);
 
-		if (get_gui().update_buffers() || get_gui().get_drawer().is_dirty())
+		// The geometry is uploaded by prepare_frame, once the image of the frame is known, which also records the command
+		// buffers again when the Gui draws differently. Settings changed through the drawer may affect the sample itself.
+		if (get_gui().get_drawer().is_dirty())
 		{
 			rebuild_command_buffers();
 			get_gui().get_drawer().clear();
@@ -473,10 +482,21 @@ void HPPApiVulkanSample::draw_ui(const vk::CommandBuffer command_buffer)
 		command_buffer.setViewport(0, vk::Viewport(0.0f, 0.0f, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.0f, 1.0f));
 		command_buffer.setScissor(0, vk::Rect2D({0, 0}, extent));
 
-		get_gui().draw(command_buffer);
+		get_gui().draw(command_buffer, get_frame_index(command_buffer));
 	}
 }
 
+uint32_t HPPApiVulkanSample::get_frame_index(const vk::CommandBuffer command_buffer) const
+{
+	// Command buffers recorded ahead are submitted in the frame of the image they render to
+	auto it = std::find(draw_cmd_buffers.begin(), draw_cmd_buffers.end(), command_buffer);
+	if (it != draw_cmd_buffers.end())
+	{
+		return static_cast<uint32_t>(std::distance(draw_cmd_buffers.begin(), it));
+	}
+	return get_render_context().get_active_frame_index();
+}
+
 void HPPApiVulkanSample::prepare_frame()
 {
 	if (get_render_context().has_swapchain())
@@ -498,6 +518,21 @@ void HPPApiVulkanSample::prepare_frame()
 		// VK_SUBOPTIMAL_KHR is a success code and means that acquire was successful and semaphore is signaled but image is suboptimal
 		// allow rendering frame to suboptimal swapchain as otherwise we would have to manually unsignal semaphore and acquire image again
 	}
+	else
+	{
+		// Use the offscreen images in turn
+		current_buffer = (current_buffer + 1) % static_cast<uint32_t>(swapchain_buffers.size());
+	}
+
+	// Readers of the last rendered frame, like screenshots, then see the image rendered to
+	get_render_context().set_active_frame_index(current_buffer);
+
+	// The command buffer of the image draws the Gui with the buffers of its frame, and is recorded again whenever the
+	// Gui draws differently, e.g. a window is collapsed or text is edited, or its buffers are reallocated
+	if (has_gui() && get_gui().update_buffers())
+	{
+		rebuild_command_buffers();
+	}
 }
 
 void HPPApiVulkanSample::submit_frame()
@@ -548,7 +583,8 @@ void HPPApiVulkanSample::submit_frame()
 	// DO NOT USE
 	// vkDeviceWaitIdle and vkQueueWaitIdle are extremely expensive functions, and are used here purely for demonstrating the vulkan API
 	// without having to concern ourselves with proper syncronization. These functions should NEVER be used inside the render loop like this (every frame).
-	get_device().get_queue_by_present(0).get_handle().waitIdle();
+	const auto &wait_queue = get_render_context().has_swapchain() ? get_device().get_queue_by_present(0) : get_device().get_suitable_graphics_queue();
+	wait_queue.get_handle().waitIdle();
 }
 
 HPPApiVulkanSample::~HPPApiVulkanSample()
@@ -568,9 +604,13 @@ HPPApiVulkanSample::~HPPApiVulkanSample()
 			device.destroyFramebuffer(framebuffer);
 		}
 
-		for (auto &swapchain_buffer : swapchain_buffers)
+		// Offscreen image views belong to the render targets
+		if (has_render_context() && get_render_context().has_swapchain())
 		{
-			device.destroyImageView(swapchain_buffer.view);
+			for (auto &swapchain_buffer : swapchain_buffers)
+			{
+				device.destroyImageView(swapchain_buffer.view);
+			}
 		}
 
 		for (auto &shader_module : shader_modules)
@@ -681,7 +721,7 @@ void HPPApiVulkanSample::setup_render_pass()
 	attachments[0].stencilLoadOp  = vk::AttachmentLoadOp::eDontCare;
 	attachments[0].stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
 	attachments[0].initialLayout  = vk::ImageLayout::eUndefined;
-	attachments[0].finalLayout    = vk::ImageLayout::ePresentSrcKHR;
+	attachments[0].finalLayout    = get_render_context().get_final_layout();
 	// Depth attachment
 	attachments[1].format         = depth_format;
 	attachments[1].samples        = vk::SampleCountFlagBits::e1;
@@ -733,7 +773,7 @@ void HPPApiVulkanSample::update_render_pass_flags(RenderPassCreateFlags flags)
 	if (flags & RenderPassCreateFlags::ColorAttachmentLoad)
 	{
 		color_attachment_load_op      = vk::AttachmentLoadOp::eLoad;
-		color_attachment_image_layout = vk::ImageLayout::ePresentSrcKHR;
+		color_attachment_image_layout = get_render_context().get_final_layout();
 	}
 
 	std::array<vk::AttachmentDescription, 2> attachments = {};
@@ -745,7 +785,7 @@ void HPPApiVulkanSample::update_render_pass_flags(RenderPassCreateFlags flags)
 	attachments[0].stencilLoadOp  = vk::AttachmentLoadOp::eDontCare;
 	attachments[0].stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
 	attachments[0].initialLayout  = color_attachment_image_layout;
-	attachments[0].finalLayout    = vk::ImageLayout::ePresentSrcKHR;
+	attachments[0].finalLayout    = get_render_context().get_final_layout();
 	// Depth attachment
 	attachments[1].format         = depth_format;
 	attachments[1].samples        = vk::SampleCountFlagBits::e1;
@@ -19,7 +19,7 @@
 
 #include <camera.h>
 #include <common/hpp_error.h>
-#include <hpp_gui.h>
+#include <gui.h>
 #include <scene_graph/components/hpp_image.h>
 #include <scene_graph/components/hpp_sub_mesh.h>
 
@@ -329,9 +329,17 @@ class HPPApiVulkanSample : public vkb::VulkanSampleCpp
 	 */
 	void draw_ui(const vk::CommandBuffer command_buffer);
 
+	/**
+	 * @brief Finds the frame a command buffer is submitted in, which selects the Gui buffers it draws with
+	 * @param command_buffer A command buffer being recorded
+	 * @return The index of the command buffer in draw_cmd_buffers, or the active frame index for other command buffers
+	 */
+	uint32_t get_frame_index(const vk::CommandBuffer command_buffer) const;
+
 	/**
 	 * @brief Prepare the frame for workload submission, acquires the next image from the swap chain and
 	 *        sets the default wait and signal semaphores
+	 *        The image becomes the active frame of the render context, and the Gui geometry is uploaded to its buffers
 	 */
 	void prepare_frame();
 
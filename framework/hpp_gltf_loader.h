@@ -48,5 +48,12 @@ class HPPGLTFLoader : private vkb::GLTFLoader
 	{
 		return std::unique_ptr<vkb::scene_graph::HPPScene>(reinterpret_cast<vkb::scene_graph::HPPScene *>(vkb::GLTFLoader::read_scene_from_file(file_name, scene_index).release()));
 	}
+
+	using vkb::GLTFLoader::get_meshlet_stats;
+	using vkb::GLTFLoader::set_meshlets;
+	using vkb::GLTFLoader::set_lods;
+	using vkb::GLTFLoader::set_mesh_optimization;
+	using vkb::GLTFLoader::set_scene_cooking;
+	using vkb::GLTFLoader::set_texture_streaming;
 };
 }        // namespace vkb
@@ -0,0 +1,56 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "timeline_semaphore.h"
+#include <vulkan/vulkan.hpp>
+
+namespace vkb
+{
+namespace core
+{
+class HPPDevice;
+}
+
+/**
+ * @brief facade class around vkb::TimelineSemaphore, providing a vulkan.hpp-based interface
+ *
+ * See vkb::TimelineSemaphore for documentation
+ */
+class HPPTimelineSemaphore : private vkb::TimelineSemaphore
+{
+  public:
+	using vkb::TimelineSemaphore::get_completed_value;
+	using vkb::TimelineSemaphore::get_last_value;
+	using vkb::TimelineSemaphore::request_value;
+
+	HPPTimelineSemaphore(vkb::core::HPPDevice &device, uint64_t initial_value = 0) :
+	    vkb::TimelineSemaphore(reinterpret_cast<vkb::Device &>(device), initial_value)
+	{}
+
+	vk::Semaphore get_handle() const
+	{
+		return static_cast<vk::Semaphore>(vkb::TimelineSemaphore::get_handle());
+	}
+
+	vk::Result wait(uint64_t value, uint64_t timeout = std::numeric_limits<uint64_t>::max()) const
+	{
+		return static_cast<vk::Result>(vkb::TimelineSemaphore::wait(value, timeout));
+	}
+};
+}        // namespace vkb
@@ -0,0 +1,539 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "job_system.h"
+
+#include <algorithm>
+
+#include "core/util/logging.hpp"
+
+namespace vkb
+{
+struct Job
+{
+	JobSystem::Task task;
+
+	JobPriority priority{JobPriority::Background};
+
+	uint32_t affinity{JobSystem::any_worker};
+
+	/// Dependencies which have not run yet, plus one while the job is being scheduled
+	std::atomic<uint32_t> pending_dependencies{1};
+
+	/// Protects the continuations, and the transition to done
+	std::mutex mutex;
+
+	/// Jobs depending on this one
+	std::vector<std::shared_ptr<Job>> continuations;
+
+	std::atomic<bool> done{false};
+};
+
+namespace
+{
+std::mutex instance_mutex;
+
+std::unique_ptr<JobSystem> instance;
+
+uint32_t default_worker_count{0};
+
+/// Job system the calling thread is a worker of, and its index in it
+thread_local const JobSystem *current_job_system{nullptr};
+thread_local uint32_t         current_thread_index{0};
+
+uint32_t get_lane(JobPriority priority)
+{
+	return static_cast<uint32_t>(priority);
+}
+}        // namespace
+
+JobHandle::JobHandle(std::shared_ptr<Job> job) :
+    job{std::move(job)}
+{
+}
+
+bool JobHandle::is_valid() const
+{
+	return job != nullptr;
+}
+
+bool JobHandle::is_done() const
+{
+	return !job || job->done;
+}
+
+bool JobHandle::operator==(const JobHandle &other) const
+{
+	return job == other.job;
+}
+
+bool JobHandle::operator!=(const JobHandle &other) const
+{
+	return job != other.job;
+}
+
+JobSystem::JobSystem(uint32_t worker_count)
+{
+	if (worker_count == 0)
+	{
+		// The thread scheduling the jobs runs some of them while waiting for them
+		worker_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+	}
+
+	workers.reserve(worker_count);
+	for (uint32_t index = 0; index < worker_count; index++)
+	{
+		workers.push_back(std::make_unique<Worker>());
+	}
+
+	// Workers are only started once all of them exist, as they steal from each other
+	for (uint32_t index = 0; index < worker_count; index++)
+	{
+		workers[index]->thread = std::thread([this, index]() { worker_loop(index); });
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	std::vector<DelayedJob> dropped_jobs;
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+		std::swap(dropped_jobs, delayed_jobs);
+		next_due = Clock::time_point::max().time_since_epoch().count();
+	}
+
+	// Threads waiting for the dropped jobs would never return otherwise, the jobs depending on them are queued before stopping
+	for (auto &dropped_job : dropped_jobs)
+	{
+		dropped_job.job->task = nullptr;
+		complete(dropped_job.job);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+		stopping = true;
+	}
+	work_condition.notify_all();
+
+	for (auto &worker : workers)
+	{
+		worker->thread.join();
+	}
+}
+
+JobSystem &JobSystem::get()
+{
+	std::lock_guard<std::mutex> lock(instance_mutex);
+
+	if (!instance)
+	{
+		instance = std::make_unique<JobSystem>(default_worker_count);
+		LOGI("Job system started with {} worker threads", instance->get_worker_count());
+	}
+
+	return *instance;
+}
+
+void JobSystem::set_default_worker_count(uint32_t worker_count)
+{
+	std::lock_guard<std::mutex> lock(instance_mutex);
+
+	default_worker_count = worker_count;
+
+	if (instance && instance->get_worker_count() != worker_count)
+	{
+		instance.reset();
+	}
+}
+
+void JobSystem::shutdown()
+{
+	std::lock_guard<std::mutex> lock(instance_mutex);
+
+	instance.reset();
+}
+
+uint32_t JobSystem::get_worker_count() const
+{
+	return static_cast<uint32_t>(workers.size());
+}
+
+uint32_t JobSystem::get_thread_index() const
+{
+	return current_job_system == this ? current_thread_index : 0;
+}
+
+JobHandle JobSystem::schedule(Task task, JobPriority priority, const std::vector<JobHandle> &dependencies, uint32_t affinity)
+{
+	auto job      = std::make_shared<Job>();
+	job->task     = std::move(task);
+	job->priority = priority;
+	job->affinity = affinity;
+
+	for (const auto &dependency : dependencies)
+	{
+		if (!dependency.job)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::mutex> lock(dependency.job->mutex);
+		if (!dependency.job->done)
+		{
+			job->pending_dependencies++;
+			dependency.job->continuations.push_back(job);
+		}
+	}
+
+	// The job is ready if its dependencies have run in the meantime
+	if (job->pending_dependencies.fetch_sub(1) == 1)
+	{
+		enqueue(job);
+	}
+
+	return JobHandle{job};
+}
+
+JobHandle JobSystem::schedule_after(Clock::duration delay, Task task, JobPriority priority)
+{
+	auto job      = std::make_shared<Job>();
+	job->task     = std::move(task);
+	job->priority = priority;
+
+	auto due = Clock::now() + delay;
+
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+
+		delayed_jobs.push_back({due, job});
+		std::push_heap(delayed_jobs.begin(), delayed_jobs.end(), [](const DelayedJob &a, const DelayedJob &b) { return a.due > b.due; });
+
+		next_due = delayed_jobs.front().due.time_since_epoch().count();
+	}
+
+	// A sleeping worker must wake up earlier if this job is the next one due
+	work_condition.notify_one();
+
+	return JobHandle{job};
+}
+
+bool JobSystem::cancel(const JobHandle &handle)
+{
+	if (!handle.job)
+	{
+		return false;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+
+		auto it = std::find_if(delayed_jobs.begin(), delayed_jobs.end(), [&handle](const DelayedJob &delayed_job) { return delayed_job.job == handle.job; });
+		if (it == delayed_jobs.end())
+		{
+			return false;
+		}
+
+		delayed_jobs.erase(it);
+		std::make_heap(delayed_jobs.begin(), delayed_jobs.end(), [](const DelayedJob &a, const DelayedJob &b) { return a.due > b.due; });
+
+		next_due = delayed_jobs.empty() ? Clock::time_point::max().time_since_epoch().count() : delayed_jobs.front().due.time_since_epoch().count();
+	}
+
+	handle.job->task = nullptr;
+	complete(handle.job);
+
+	return true;
+}
+
+void JobSystem::wait(const JobHandle &handle)
+{
+	if (!handle.job)
+	{
+		return;
+	}
+
+	uint32_t lanes = handle.job->priority == JobPriority::FrameCritical ? 1 : lane_count;
+
+	while (!handle.job->done)
+	{
+		if (auto job = find_job(lanes))
+		{
+			run(job);
+			continue;
+		}
+
+		waiting_threads++;
+		{
+			std::unique_lock<std::mutex> lock(completion_mutex);
+			completion_condition.wait(lock, [this, &handle, lanes]() { return handle.job->done || has_queued_jobs(lanes); });
+		}
+		waiting_threads--;
+	}
+}
+
+void JobSystem::wait(const std::vector<JobHandle> &handles)
+{
+	for (const auto &handle : handles)
+	{
+		wait(handle);
+	}
+}
+
+void JobSystem::parallel_for(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)> &func, JobPriority priority, uint32_t grain_size)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	// A few parts per thread balance the load when parts take different times
+	uint32_t part_count = grain_size > 0 ? (count + grain_size - 1) / grain_size : std::min(count, (get_worker_count() + 1) * 4);
+	uint32_t part_size  = (count + part_count - 1) / part_count;
+	part_count          = (count + part_size - 1) / part_size;
+
+	std::vector<JobHandle> handles;
+	handles.reserve(part_count - 1);
+
+	for (uint32_t part = 1; part < part_count; part++)
+	{
+		uint32_t begin = part * part_size;
+		uint32_t end   = std::min(count, begin + part_size);
+
+		handles.push_back(schedule([&func, begin, end]() { func(begin, end); }, priority));
+	}
+
+	func(0, std::min(count, part_size));
+
+	wait(handles);
+}
+
+void JobSystem::worker_loop(uint32_t index)
+{
+	current_job_system   = this;
+	current_thread_index = index + 1;
+
+	while (true)
+	{
+		if (Clock::now().time_since_epoch().count() >= next_due)
+		{
+			promote_delayed_jobs();
+		}
+
+		if (auto job = find_job(lane_count))
+		{
+			run(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleep_mutex);
+
+		if (has_queued_jobs(lane_count))
+		{
+			continue;
+		}
+
+		if (stopping)
+		{
+			break;
+		}
+
+		if (delayed_jobs.empty())
+		{
+			work_condition.wait(lock);
+		}
+		else
+		{
+			work_condition.wait_until(lock, delayed_jobs.front().due);
+		}
+	}
+}
+
+void JobSystem::enqueue(const std::shared_ptr<Job> &job)
+{
+	uint32_t worker_count = get_worker_count();
+	uint32_t thread_index = get_thread_index();
+	uint32_t index;
+
+	if (job->affinity != any_worker)
+	{
+		index = job->affinity % worker_count;
+	}
+	else if (thread_index > 0)
+	{
+		// Jobs scheduled by a job are likely to use the same data, and are kept on the same worker
+		index = thread_index - 1;
+	}
+	else
+	{
+		index = next_worker++ % worker_count;
+	}
+
+	uint32_t lane = get_lane(job->priority);
+
+	{
+		std::lock_guard<std::mutex> lock(workers[index]->mutex);
+		workers[index]->lanes[lane].push_back(job);
+	}
+
+	queued_jobs[lane]++;
+
+	notify();
+}
+
+std::shared_ptr<Job> JobSystem::find_job(uint32_t lanes)
+{
+	uint32_t worker_count = get_worker_count();
+	uint32_t thread_index = get_thread_index();
+
+	for (uint32_t lane = 0; lane < lanes; lane++)
+	{
+		if (queued_jobs[lane] == 0)
+		{
+			continue;
+		}
+
+		// The most recent job of the calling worker
+		if (thread_index > 0)
+		{
+			auto                       &worker = *workers[thread_index - 1];
+			std::lock_guard<std::mutex> lock(worker.mutex);
+
+			if (!worker.lanes[lane].empty())
+			{
+				auto job = std::move(worker.lanes[lane].back());
+				worker.lanes[lane].pop_back();
+				queued_jobs[lane]--;
+				return job;
+			}
+		}
+
+		// The oldest job of another worker, starting with the next one to spread the thieves
+		uint32_t start = thread_index > 0 ? thread_index : next_worker.load();
+		for (uint32_t offset = 0; offset < worker_count; offset++)
+		{
+			uint32_t index = (start + offset) % worker_count;
+			if (index + 1 == thread_index)
+			{
+				continue;
+			}
+
+			auto                       &worker = *workers[index];
+			std::lock_guard<std::mutex> lock(worker.mutex);
+
+			if (!worker.lanes[lane].empty())
+			{
+				auto job = std::move(worker.lanes[lane].front());
+				worker.lanes[lane].pop_front();
+				queued_jobs[lane]--;
+				return job;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+void JobSystem::run(const std::shared_ptr<Job> &job)
+{
+	job->task();
+
+	// Release the resources captured by the task
+	job->task = nullptr;
+
+	complete(job);
+}
+
+void JobSystem::complete(const std::shared_ptr<Job> &job)
+{
+	std::vector<std::shared_ptr<Job>> continuations;
+	{
+		std::lock_guard<std::mutex> lock(job->mutex);
+		job->done = true;
+		std::swap(continuations, job->continuations);
+	}
+
+	for (auto &continuation : continuations)
+	{
+		if (continuation->pending_dependencies.fetch_sub(1) == 1)
+		{
+			enqueue(continuation);
+		}
+	}
+
+	if (waiting_threads > 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock(completion_mutex);
+		}
+		completion_condition.notify_all();
+	}
+}
+
+void JobSystem::promote_delayed_jobs()
+{
+	std::vector<std::shared_ptr<Job>> due_jobs;
+
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+
+		auto now = Clock::now();
+		while (!delayed_jobs.empty() && delayed_jobs.front().due <= now)
+		{
+			std::pop_heap(delayed_jobs.begin(), delayed_jobs.end(), [](const DelayedJob &a, const DelayedJob &b) { return a.due > b.due; });
+			due_jobs.push_back(std::move(delayed_jobs.back().job));
+			delayed_jobs.pop_back();
+		}
+
+		next_due = delayed_jobs.empty() ? Clock::time_point::max().time_since_epoch().count() : delayed_jobs.front().due.time_since_epoch().count();
+	}
+
+	for (auto &job : due_jobs)
+	{
+		job->pending_dependencies = 0;
+		enqueue(job);
+	}
+}
+
+void JobSystem::notify()
+{
+	{
+		// Taking the lock orders the notification after the check of a worker about to sleep
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+	}
+	work_condition.notify_one();
+
+	if (waiting_threads > 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock(completion_mutex);
+		}
+		completion_condition.notify_all();
+	}
+}
+
+bool JobSystem::has_queued_jobs(uint32_t lanes) const
+{
+	for (uint32_t lane = 0; lane < lanes; lane++)
+	{
+		if (queued_jobs[lane] > 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+}        // namespace vkb
@@ -0,0 +1,292 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace vkb
+{
+/**
+ * @brief Lane a job is queued in, jobs of the first lanes are run first
+ */
+enum class JobPriority
+{
+	/// Work the current frame waits for, such as recording command buffers
+	FrameCritical,
+
+	/// Work which can span several frames, such as loading or streaming assets and sampling counters
+	Background
+};
+
+struct Job;
+
+/**
+ * @brief Refers to a scheduled job, to wait for it or to make other jobs depend on it
+ */
+class JobHandle
+{
+  public:
+	JobHandle() = default;
+
+	/**
+	 * @return Whether the handle refers to a job
+	 */
+	bool is_valid() const;
+
+	/**
+	 * @return Whether the job has run or was dropped without running, an invalid handle is always done
+	 */
+	bool is_done() const;
+
+	bool operator==(const JobHandle &other) const;
+
+	bool operator!=(const JobHandle &other) const;
+
+  private:
+	friend class JobSystem;
+
+	explicit JobHandle(std::shared_ptr<Job> job);
+
+	std::shared_ptr<Job> job;
+};
+
+/**
+ * @brief A work-stealing job system shared by the subsystems of the framework
+ *
+ * Every worker thread owns a deque per priority lane. A worker pushes the jobs it schedules to its own deques
+ * and pops the most recent one, which is likely still in its caches, while idle workers steal the oldest job
+ * of another worker. Jobs scheduled from other threads are spread over the workers, or queued to the worker
+ * given as affinity hint so that jobs touching the same data run on the same core.
+ *
+ * Jobs can depend on other jobs, which builds a task graph: a job is only queued once all its dependencies
+ * have run. Threads waiting for a job help running the queued jobs instead of blocking, and a thread waiting
+ * for frame-critical work only helps with frame-critical jobs, so that it is not held up by a long background job.
+ *
+ * The process-wide job system returned by get() is the one used by the framework, so that the asset loader,
+ * the command buffer recording and the stats sampling share the cores instead of each creating threads.
+ * Jobs must not throw, use async() to get the result or the exception of a job through a future.
+ */
+class JobSystem
+{
+  public:
+	using Task  = std::function<void()>;
+	using Clock = std::chrono::steady_clock;
+
+	/// Affinity of a job which can run on any worker
+	static constexpr uint32_t any_worker = ~0u;
+
+	/**
+	 * @param worker_count Number of worker threads, 0 for one per hardware thread besides the calling one
+	 */
+	explicit JobSystem(uint32_t worker_count = 0);
+
+	JobSystem(const JobSystem &) = delete;
+
+	JobSystem(JobSystem &&) = delete;
+
+	/**
+	 * @brief Runs the queued jobs and joins the workers
+	 *        Delayed jobs which are not due yet are dropped: they are done without running, and the jobs depending on them run
+	 */
+	~JobSystem();
+
+	JobSystem &operator=(const JobSystem &) = delete;
+
+	JobSystem &operator=(JobSystem &&) = delete;
+
+	/**
+	 * @return The process-wide job system, created on first use
+	 */
+	static JobSystem &get();
+
+	/**
+	 * @brief Sets the number of workers of the process-wide job system, recreating it if it was already created
+	 * @param worker_count Number of worker threads, 0 for one per hardware thread besides the main one
+	 */
+	static void set_default_worker_count(uint32_t worker_count);
+
+	/**
+	 * @brief Destroys the process-wide job system, a later call to get() creates a new one
+	 */
+	static void shutdown();
+
+	uint32_t get_worker_count() const;
+
+	/**
+	 * @return The index of the calling thread, from 1 to the worker count for the workers of this job system and 0 for
+	 *         any other thread, to index per-thread resources such as command pools
+	 */
+	uint32_t get_thread_index() const;
+
+	/**
+	 * @brief Schedules a job
+	 * @param task The work of the job
+	 * @param priority The lane the job is queued in
+	 * @param dependencies Jobs which must have run before this one starts
+	 * @param affinity Index of the worker the job is preferably run on, from 0 to the worker count - 1
+	 * @return A handle to the job
+	 */
+	JobHandle schedule(Task task, JobPriority priority = JobPriority::Background, const std::vector<JobHandle> &dependencies = {}, uint32_t affinity = any_worker);
+
+	/**
+	 * @brief Schedules a job which is queued once a delay has elapsed, for work repeated at an interval
+	 */
+	JobHandle schedule_after(Clock::duration delay, Task task, JobPriority priority = JobPriority::Background);
+
+	/**
+	 * @brief Drops a delayed job which is not due yet, it is then done without running
+	 * @return Whether the job was dropped, false if it is already queued, running or done
+	 */
+	bool cancel(const JobHandle &handle);
+
+	/**
+	 * @brief Schedules a job returning a value
+	 * @return A future holding the result of the job, or the exception it has thrown
+	 */
+	template <typename Func>
+	std::future<std::invoke_result_t<Func>> async(Func &&func, JobPriority priority = JobPriority::Background, const std::vector<JobHandle> &dependencies = {});
+
+	/**
+	 * @brief Waits for a job, running the queued jobs meanwhile
+	 */
+	void wait(const JobHandle &handle);
+
+	/**
+	 * @brief Waits for several jobs, running the queued jobs meanwhile
+	 */
+	void wait(const std::vector<JobHandle> &handles);
+
+	/**
+	 * @brief Splits a range in jobs and waits for them, the calling thread runs part of the range
+	 * @param count Size of the range
+	 * @param func Called with the first index and the end of a part of the range
+	 * @param priority The lane the jobs are queued in
+	 * @param grain_size Minimum size of a part, 0 to split the range in a few parts per worker
+	 */
+	void parallel_for(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)> &func, JobPriority priority = JobPriority::FrameCritical, uint32_t grain_size = 0);
+
+  private:
+	static constexpr size_t lane_count = 2;
+
+	struct Worker
+	{
+		std::mutex mutex;
+
+		/// Jobs of every lane, the owner pops from the back and thieves from the front
+		std::array<std::deque<std::shared_ptr<Job>>, lane_count> lanes;
+
+		std::thread thread;
+	};
+
+	struct DelayedJob
+	{
+		Clock::time_point due;
+
+		std::shared_ptr<Job> job;
+	};
+
+	void worker_loop(uint32_t index);
+
+	/**
+	 * @brief Queues a job whose dependencies have run
+	 */
+	void enqueue(const std::shared_ptr<Job> &job);
+
+	/**
+	 * @brief Pops a job of the calling worker, or steals one from another worker
+	 * @param lanes Number of lanes to look into, from the most critical one
+	 */
+	std::shared_ptr<Job> find_job(uint32_t lanes);
+
+	/**
+	 * @brief Runs a job and completes it
+	 */
+	void run(const std::shared_ptr<Job> &job);
+
+	/**
+	 * @brief Marks a job as done, queues the jobs depending on it which are now ready and wakes the threads waiting for it
+	 */
+	void complete(const std::shared_ptr<Job> &job);
+
+	/**
+	 * @brief Queues the delayed jobs which are due
+	 */
+	void promote_delayed_jobs();
+
+	/**
+	 * @brief Wakes a sleeping worker and the threads waiting for a job
+	 */
+	void notify();
+
+	bool has_queued_jobs(uint32_t lanes) const;
+
+	std::vector<std::unique_ptr<Worker>> workers;
+
+	/// Number of jobs in the deques of every lane
+	std::array<std::atomic<uint32_t>, lane_count> queued_jobs{};
+
+	/// Worker the next job scheduled from another thread is queued to
+	std::atomic<uint32_t> next_worker{0};
+
+	/// Protects the delayed jobs, and is used by idle workers to sleep
+	std::mutex sleep_mutex;
+
+	std::condition_variable work_condition;
+
+	/// Delayed jobs, as a heap on their due time
+	std::vector<DelayedJob> delayed_jobs;
+
+	/// Due time of the first delayed job, checked by busy workers without locking
+	std::atomic<Clock::rep> next_due{Clock::time_point::max().time_since_epoch().count()};
+
+	/// Used by the threads waiting for a job to sleep when there is no job to help with
+	std::mutex completion_mutex;
+
+	std::condition_variable completion_condition;
+
+	/// Number of threads waiting for a job
+	std::atomic<uint32_t> waiting_threads{0};
+
+	bool stopping{false};
+};
+
+template <typename Func>
+std::future<std::invoke_result_t<Func>> JobSystem::async(Func &&func, JobPriority priority, const std::vector<JobHandle> &dependencies)
+{
+	using Result = std::invoke_result_t<Func>;
+
+	// std::function requires a copyable callable, so the packaged task is shared
+	auto task   = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+	auto future = task->get_future();
+
+	schedule([task]() { (*task)(); }, priority, dependencies);
+
+	return future;
+}
+}        // namespace vkb
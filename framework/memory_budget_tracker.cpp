@@ -0,0 +1,209 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_budget_tracker.h"
+
+#include <algorithm>
+#include <array>
+
+#include "core/allocated.h"
+#include "core/util/logging.hpp"
+
+namespace vkb
+{
+namespace
+{
+const char *to_string(MemoryPressure pressure)
+{
+	switch (pressure)
+	{
+		case MemoryPressure::High:
+			return "high";
+		case MemoryPressure::Critical:
+			return "critical";
+		default:
+			return "none";
+	}
+}
+}        // namespace
+
+MemoryBudgetTracker &MemoryBudgetTracker::get()
+{
+	static MemoryBudgetTracker tracker;
+	return tracker;
+}
+
+MemoryPressure MemoryBudgetTracker::get_heap_pressure(VkDeviceSize usage, VkDeviceSize budget)
+{
+	if (usage > budget * critical_pressure_ratio)
+	{
+		return MemoryPressure::Critical;
+	}
+
+	if (usage > budget * high_pressure_ratio)
+	{
+		return MemoryPressure::High;
+	}
+
+	return MemoryPressure::None;
+}
+
+void MemoryBudgetTracker::update()
+{
+	auto allocator = allocated::get_memory_allocator();
+	if (allocator == VK_NULL_HANDLE)
+	{
+		return;
+	}
+
+	const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+	vmaGetMemoryProperties(allocator, &memory_properties);
+
+	std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets{};
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+
+		// VMA queries the budgets of VK_EXT_memory_budget again when the frame index changes
+		vmaSetCurrentFrameIndex(allocator, ++frame_index);
+		vmaGetHeapBudgets(allocator, budgets.data());
+	}
+
+	std::vector<HeapBudget> new_heap_budgets(memory_properties->memoryHeapCount);
+	for (uint32_t heap_index = 0; heap_index < memory_properties->memoryHeapCount; heap_index++)
+	{
+		auto &heap_budget = new_heap_budgets[heap_index];
+
+		heap_budget.flags  = memory_properties->memoryHeaps[heap_index].flags;
+		heap_budget.usage  = budgets[heap_index].usage;
+		heap_budget.budget = budgets[heap_index].budget;
+	}
+
+	set_heap_budgets(std::move(new_heap_budgets));
+}
+
+void MemoryBudgetTracker::set_heap_budgets(std::vector<HeapBudget> &&new_heap_budgets)
+{
+	MemoryPressure new_pressure = MemoryPressure::None;
+	for (auto &heap_budget : new_heap_budgets)
+	{
+		heap_budget.pressure = get_heap_pressure(heap_budget.usage, heap_budget.budget);
+		new_pressure         = std::max(new_pressure, heap_budget.pressure);
+	}
+
+	std::vector<PressureCallback> callbacks;
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+
+		heap_budgets = new_heap_budgets;
+
+		if (new_pressure == pressure)
+		{
+			return;
+		}
+
+		pressure = new_pressure;
+
+		for (auto &pressure_callback : pressure_callbacks)
+		{
+			callbacks.push_back(pressure_callback.second);
+		}
+	}
+
+	LOGI("Memory pressure is now {}", to_string(new_pressure));
+	for (uint32_t heap_index = 0; heap_index < new_heap_budgets.size(); heap_index++)
+	{
+		auto &heap_budget = new_heap_budgets[heap_index];
+		if (heap_budget.pressure != MemoryPressure::None)
+		{
+			LOGW("Memory heap {} uses {:.1f} of its {:.1f} MB budget",
+			     heap_index,
+			     heap_budget.usage / (1024.0 * 1024.0),
+			     heap_budget.budget / (1024.0 * 1024.0));
+		}
+	}
+
+	// Called without the lock, so that the callbacks can query the tracker
+	for (auto &callback : callbacks)
+	{
+		callback(new_pressure);
+	}
+}
+
+std::vector<HeapBudget> MemoryBudgetTracker::get_heap_budgets() const
+{
+	std::lock_guard<std::mutex> lock{mutex};
+	return heap_budgets;
+}
+
+MemoryPressure MemoryBudgetTracker::get_pressure() const
+{
+	std::lock_guard<std::mutex> lock{mutex};
+	return pressure;
+}
+
+bool MemoryBudgetTracker::can_allocate(VkDeviceSize size) const
+{
+	auto allocator = allocated::get_memory_allocator();
+	if (allocator == VK_NULL_HANDLE)
+	{
+		return true;
+	}
+
+	// The heap VMA picks for device local images and buffers
+	VmaAllocationCreateInfo allocation_create_info{};
+	allocation_create_info.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+
+	uint32_t memory_type_index = 0;
+	if (vmaFindMemoryTypeIndex(allocator, ~0u, &allocation_create_info, &memory_type_index) != VK_SUCCESS)
+	{
+		return true;
+	}
+
+	const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+	vmaGetMemoryProperties(allocator, &memory_properties);
+
+	std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets{};
+	vmaGetHeapBudgets(allocator, budgets.data());
+
+	auto &budget = budgets[memory_properties->memoryTypes[memory_type_index].heapIndex];
+
+	return budget.usage + size <= budget.budget * critical_pressure_ratio;
+}
+
+uint32_t MemoryBudgetTracker::add_pressure_callback(PressureCallback &&callback)
+{
+	std::lock_guard<std::mutex> lock{mutex};
+	pressure_callbacks.emplace(next_callback_id, std::move(callback));
+	return next_callback_id++;
+}
+
+void MemoryBudgetTracker::remove_pressure_callback(uint32_t id)
+{
+	std::lock_guard<std::mutex> lock{mutex};
+	pressure_callbacks.erase(id);
+}
+
+void MemoryBudgetTracker::record_degraded_allocation()
+{
+	degraded_allocation_count++;
+}
+
+uint32_t MemoryBudgetTracker::get_degraded_allocation_count() const
+{
+	return degraded_allocation_count;
+}
+}        // namespace vkb
@@ -0,0 +1,156 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "common/vk_common.h"
+
+namespace vkb
+{
+/**
+ * @brief How close the usage of the memory heaps is to their budget
+ */
+enum class MemoryPressure
+{
+	/// Every heap is below the high pressure ratio of its budget
+	None,
+
+	/// A heap is above the high pressure ratio of its budget, new allocations should be deferred
+	High,
+
+	/// A heap is above the critical pressure ratio of its budget, memory which is not needed should be released
+	Critical
+};
+
+/**
+ * @brief Usage and budget of a memory heap
+ */
+struct HeapBudget
+{
+	VkMemoryHeapFlags flags{0};
+
+	/// Bytes used by the process in the heap
+	VkDeviceSize usage{0};
+
+	/// Bytes the process can use in the heap before allocations may fail or degrade performance
+	VkDeviceSize budget{0};
+
+	MemoryPressure pressure{MemoryPressure::None};
+};
+
+/**
+ * @brief Tracks the usage of the memory heaps against their budget, across the allocations of the VMA allocator
+ *
+ * The heap budgets are polled once per frame by the render contexts. With VK_EXT_memory_budget the budgets come
+ * from the driver and account for the other processes, otherwise VMA estimates them as 80% of the heap sizes.
+ * When the pressure of the most used heap changes, the pressure callbacks are called, so that the caches and the
+ * streaming systems can release memory or defer their allocations. The texture loaders check can_allocate() before
+ * creating images, to degrade textures rather than fail with VK_ERROR_OUT_OF_DEVICE_MEMORY.
+ */
+class MemoryBudgetTracker
+{
+  public:
+	using PressureCallback = std::function<void(MemoryPressure)>;
+
+	/// Fraction of the budget of a heap above which its pressure is high
+	static constexpr float high_pressure_ratio = 0.8f;
+
+	/// Fraction of the budget of a heap above which its pressure is critical
+	static constexpr float critical_pressure_ratio = 0.95f;
+
+	/**
+	 * @return The process-wide tracker, for the process-wide VMA allocator
+	 */
+	static MemoryBudgetTracker &get();
+
+	/**
+	 * @return The pressure of a heap using the given bytes of its budget
+	 */
+	static MemoryPressure get_heap_pressure(VkDeviceSize usage, VkDeviceSize budget);
+
+	/**
+	 * @brief Polls the heap budgets, and calls the pressure callbacks if the pressure changed
+	 *        Does nothing before the allocator is created.
+	 */
+	void update();
+
+	/**
+	 * @brief Sets the usage and budget of every heap, computes their pressure, and calls the pressure callbacks if the
+	 *        pressure of the most used heap changed. Called by update() with the budgets polled from VMA, or directly to
+	 *        simulate memory pressure.
+	 */
+	void set_heap_budgets(std::vector<HeapBudget> &&new_heap_budgets);
+
+	/**
+	 * @return The usage and budget of every heap, as of the last update
+	 */
+	std::vector<HeapBudget> get_heap_budgets() const;
+
+	/**
+	 * @return The pressure of the most used heap, as of the last update
+	 */
+	MemoryPressure get_pressure() const;
+
+	/**
+	 * @brief Checks whether device local memory can be allocated without bringing its heap to critical pressure
+	 *        The budgets are queried again, so that allocations made since the last update are accounted for.
+	 * @param size Bytes to allocate
+	 */
+	bool can_allocate(VkDeviceSize size) const;
+
+	/**
+	 * @brief Registers a callback called with the new pressure whenever it changes
+	 * @return An identifier to remove the callback with
+	 */
+	uint32_t add_pressure_callback(PressureCallback &&callback);
+
+	void remove_pressure_callback(uint32_t id);
+
+	/**
+	 * @brief Counts an allocation which was reduced or skipped to stay within the budget
+	 */
+	void record_degraded_allocation();
+
+	/**
+	 * @return The number of allocations reduced or skipped to stay within the budget since the start of the process
+	 */
+	uint32_t get_degraded_allocation_count() const;
+
+  private:
+	MemoryBudgetTracker() = default;
+
+	mutable std::mutex mutex;
+
+	std::vector<HeapBudget> heap_budgets;
+
+	MemoryPressure pressure{MemoryPressure::None};
+
+	std::map<uint32_t, PressureCallback> pressure_callbacks;
+
+	uint32_t next_callback_id{0};
+
+	uint32_t frame_index{0};
+
+	std::atomic<uint32_t> degraded_allocation_count{0};
+};
+}        // namespace vkb
@@ -0,0 +1,612 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mesh_optimizer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+#include <filesystem/filesystem.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include "common/helpers.h"
+#include "core/util/logging.hpp"
+#include "timer.h"
+
+namespace vkb
+{
+namespace
+{
+constexpr uint32_t cache_magic = 0x54504F56;        // "VOPT"
+
+/// Bumped whenever the meshes optimized from the same attributes and indices change
+constexpr uint32_t cache_version = 1;
+
+constexpr uint32_t invalid_vertex = std::numeric_limits<uint32_t>::max();
+
+uint64_t get_key(const std::map<std::string, MeshAttributeInput> &attributes, const std::vector<uint32_t> &indices, bool quantize)
+{
+	size_t key = std::hash<std::string_view>{}({reinterpret_cast<const char *>(indices.data()), indices.size() * sizeof(uint32_t)});
+	hash_combine(key, quantize);
+	for (auto &[name, attribute] : attributes)
+	{
+		hash_combine(key, name);
+		hash_combine(key, static_cast<uint32_t>(attribute.format));
+		hash_combine(key, attribute.stride);
+		hash_combine(key, std::string_view{reinterpret_cast<const char *>(attribute.data.data()), attribute.data.size()});
+	}
+	return key;
+}
+
+uint32_t get_format_size(VkFormat format)
+{
+	return static_cast<uint32_t>(get_bits_per_pixel(format)) / 8;
+}
+
+/**
+ * @brief Picks the 16 bit format of normals, tangents and texture coordinates, other attributes keep their format
+ */
+VkFormat get_quantized_format(const std::string &name, const MeshAttributeInput &attribute)
+{
+	if ((name == "normal" && attribute.format == VK_FORMAT_R32G32B32_SFLOAT) ||
+	    (name == "tangent" && attribute.format == VK_FORMAT_R32G32B32A32_SFLOAT))
+	{
+		return VK_FORMAT_R16G16B16A16_SNORM;
+	}
+
+	if (name.rfind("texcoord_", 0) == 0 && attribute.format == VK_FORMAT_R32G32_SFLOAT)
+	{
+		// Unorm keeps more precision, but can't represent wrapping texture coordinates
+		for (size_t offset = 0; offset + sizeof(glm::vec2) <= attribute.data.size(); offset += attribute.stride)
+		{
+			glm::vec2 texcoord;
+			std::memcpy(&texcoord, attribute.data.data() + offset, sizeof(glm::vec2));
+			if (glm::any(glm::lessThan(texcoord, glm::vec2(0.0f))) || glm::any(glm::greaterThan(texcoord, glm::vec2(1.0f))))
+			{
+				return VK_FORMAT_R16G16_SFLOAT;
+			}
+		}
+		return VK_FORMAT_R16G16_UNORM;
+	}
+
+	return attribute.format;
+}
+
+/**
+ * @brief Writes an element of an attribute in its interleaved format, from its float format if it was quantized
+ */
+void write_element(uint8_t *dst, VkFormat format, const uint8_t *src, VkFormat src_format)
+{
+	if (format == src_format)
+	{
+		std::memcpy(dst, src, get_format_size(format));
+		return;
+	}
+
+	uint32_t src_component_count = get_format_size(src_format) / sizeof(float);
+	uint32_t dst_component_count = get_format_size(format) / sizeof(uint16_t);
+
+	auto *components = reinterpret_cast<uint16_t *>(dst);
+	for (uint32_t i = 0; i < dst_component_count; i++)
+	{
+		float value = 0.0f;
+		if (i < src_component_count)
+		{
+			std::memcpy(&value, src + i * sizeof(float), sizeof(float));
+		}
+
+		switch (format)
+		{
+			case VK_FORMAT_R16G16B16A16_SNORM:
+				components[i] = glm::packSnorm1x16(value);
+				break;
+			case VK_FORMAT_R16G16_UNORM:
+				components[i] = glm::packUnorm1x16(value);
+				break;
+			case VK_FORMAT_R16G16_SFLOAT:
+				components[i] = glm::packHalf1x16(value);
+				break;
+			default:
+				assert(false && "Unexpected quantized format");
+				break;
+		}
+	}
+}
+}        // namespace
+
+float VertexCacheStats::get_acmr() const
+{
+	return triangles > 0 ? static_cast<float>(transformed_vertices) / triangles : 0.0f;
+}
+
+float VertexCacheStats::get_atvr() const
+{
+	return vertices > 0 ? static_cast<float>(transformed_vertices) / vertices : 0.0f;
+}
+
+MeshOptimizer::MeshOptimizer(bool quantize) :
+    quantize{quantize}
+{
+}
+
+std::vector<uint32_t> MeshOptimizer::optimize_vertex_cache(const std::vector<uint32_t> &indices, size_t vertex_count, std::vector<uint32_t> &cluster_offsets)
+{
+	size_t triangle_count = indices.size() / 3;
+
+	// Triangles using every vertex
+	std::vector<uint32_t> adjacency_offsets(vertex_count + 1, 0);
+	for (size_t i = 0; i < triangle_count * 3; i++)
+	{
+		adjacency_offsets[indices[i] + 1]++;
+	}
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		adjacency_offsets[i + 1] += adjacency_offsets[i];
+	}
+
+	std::vector<uint32_t> adjacency(triangle_count * 3);
+	std::vector<uint32_t> adjacency_fill(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+	for (size_t i = 0; i < triangle_count * 3; i++)
+	{
+		adjacency[adjacency_fill[indices[i]]++] = to_u32(i / 3);
+	}
+
+	// Triangles left to emit for every vertex
+	std::vector<uint32_t> live_triangles(vertex_count);
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		live_triangles[i] = adjacency_offsets[i + 1] - adjacency_offsets[i];
+	}
+
+	// A vertex is in the cache while fewer than vertex_cache_size vertices entered it since its timestamp
+	std::vector<uint32_t> cache_timestamps(vertex_count, 0);
+	uint32_t              timestamp = vertex_cache_size + 1;
+
+	std::vector<bool>     emitted(triangle_count, false);
+	std::vector<uint32_t> dead_end_stack;
+	std::vector<uint32_t> candidates;
+
+	std::vector<uint32_t> output;
+	output.reserve(triangle_count * 3);
+	cluster_offsets.clear();
+
+	size_t   cursor         = 0;
+	uint32_t fanning_vertex = invalid_vertex;
+	bool     cache_flushed  = true;
+
+	while (true)
+	{
+		if (fanning_vertex == invalid_vertex)
+		{
+			// Dead end: the most recently used vertex with triangles left, or else the next one in index order
+			while (!dead_end_stack.empty() && fanning_vertex == invalid_vertex)
+			{
+				uint32_t vertex = dead_end_stack.back();
+				dead_end_stack.pop_back();
+				if (live_triangles[vertex] > 0)
+				{
+					fanning_vertex = vertex;
+				}
+			}
+
+			while (cursor < vertex_count && fanning_vertex == invalid_vertex)
+			{
+				if (live_triangles[cursor] > 0)
+				{
+					fanning_vertex = to_u32(cursor);
+				}
+				cursor++;
+			}
+
+			if (fanning_vertex == invalid_vertex)
+			{
+				break;
+			}
+
+			// Starting over from a vertex out of the cache costs as much as starting over anywhere else in the mesh
+			cache_flushed = timestamp - cache_timestamps[fanning_vertex] > vertex_cache_size;
+		}
+
+		if (cache_flushed || output.size() - cluster_offsets.back() >= max_cluster_triangles * 3)
+		{
+			cluster_offsets.push_back(to_u32(output.size()));
+		}
+
+		candidates.clear();
+		for (uint32_t i = adjacency_offsets[fanning_vertex]; i < adjacency_offsets[fanning_vertex + 1]; i++)
+		{
+			uint32_t triangle = adjacency[i];
+			if (emitted[triangle])
+			{
+				continue;
+			}
+
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				uint32_t vertex = indices[triangle * 3 + corner];
+
+				output.push_back(vertex);
+				dead_end_stack.push_back(vertex);
+				candidates.push_back(vertex);
+				live_triangles[vertex]--;
+
+				if (timestamp - cache_timestamps[vertex] > vertex_cache_size)
+				{
+					cache_timestamps[vertex] = timestamp++;
+				}
+			}
+
+			emitted[triangle] = true;
+		}
+
+		// Next fan around the candidate which entered the cache the earliest, among the ones which stay in the cache
+		// while their triangles left are emitted
+		uint32_t next_vertex   = invalid_vertex;
+		int64_t  best_priority = -1;
+		for (uint32_t vertex : candidates)
+		{
+			if (live_triangles[vertex] == 0)
+			{
+				continue;
+			}
+
+			int64_t priority = 0;
+			if (timestamp - cache_timestamps[vertex] + 2 * live_triangles[vertex] <= vertex_cache_size)
+			{
+				priority = timestamp - cache_timestamps[vertex];
+			}
+
+			if (priority > best_priority)
+			{
+				best_priority = priority;
+				next_vertex   = vertex;
+			}
+		}
+
+		fanning_vertex = next_vertex;
+		cache_flushed  = false;
+	}
+
+	return output;
+}
+
+void MeshOptimizer::optimize_overdraw(std::vector<uint32_t> &indices, const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &cluster_offsets)
+{
+	if (cluster_offsets.size() < 2)
+	{
+		return;
+	}
+
+	struct Cluster
+	{
+		uint32_t begin;
+
+		uint32_t end;
+
+		glm::vec3 centroid{0.0f};
+
+		glm::vec3 normal{0.0f};
+
+		float area{0.0f};
+
+		float sort_key{0.0f};
+	};
+
+	std::vector<Cluster> clusters;
+	clusters.reserve(cluster_offsets.size());
+
+	glm::vec3 mesh_centroid{0.0f};
+	float     mesh_area{0.0f};
+
+	for (size_t i = 0; i < cluster_offsets.size(); i++)
+	{
+		Cluster cluster;
+		cluster.begin = cluster_offsets[i];
+		cluster.end   = i + 1 < cluster_offsets.size() ? cluster_offsets[i + 1] : to_u32(indices.size());
+
+		for (uint32_t j = cluster.begin; j < cluster.end; j += 3)
+		{
+			const auto &p0 = positions[indices[j]];
+			const auto &p1 = positions[indices[j + 1]];
+			const auto &p2 = positions[indices[j + 2]];
+
+			// Twice the area weighted normal of the triangle
+			glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+			float     area   = glm::length(normal);
+
+			cluster.centroid += (p0 + p1 + p2) / 3.0f * area;
+			cluster.normal += normal;
+			cluster.area += area;
+		}
+
+		mesh_centroid += cluster.centroid;
+		mesh_area += cluster.area;
+
+		if (cluster.area > 0.0f)
+		{
+			cluster.centroid /= cluster.area;
+		}
+
+		clusters.push_back(cluster);
+	}
+
+	if (mesh_area > 0.0f)
+	{
+		mesh_centroid /= mesh_area;
+	}
+
+	// Clusters facing away from the center of the mesh are the likely occluders of the clusters behind them
+	for (auto &cluster : clusters)
+	{
+		float normal_length = glm::length(cluster.normal);
+		if (normal_length > 0.0f)
+		{
+			cluster.sort_key = glm::dot(cluster.centroid - mesh_centroid, cluster.normal / normal_length);
+		}
+	}
+
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster &a, const Cluster &b) { return a.sort_key > b.sort_key; });
+
+	std::vector<uint32_t> sorted_indices;
+	sorted_indices.reserve(indices.size());
+	for (auto &cluster : clusters)
+	{
+		sorted_indices.insert(sorted_indices.end(), indices.begin() + cluster.begin, indices.begin() + cluster.end);
+	}
+
+	indices = std::move(sorted_indices);
+}
+
+std::vector<uint32_t> MeshOptimizer::optimize_vertex_fetch(std::vector<uint32_t> &indices, size_t vertex_count)
+{
+	std::vector<uint32_t> remap(vertex_count, invalid_vertex);
+
+	uint32_t next_vertex = 0;
+	for (auto &index : indices)
+	{
+		if (remap[index] == invalid_vertex)
+		{
+			remap[index] = next_vertex++;
+		}
+		index = remap[index];
+	}
+
+	return remap;
+}
+
+VertexCacheStats MeshOptimizer::analyze_vertex_cache(const std::vector<uint32_t> &indices, size_t vertex_count)
+{
+	VertexCacheStats stats;
+	stats.triangles = indices.size() / 3;
+
+	std::vector<uint32_t> cache_timestamps(vertex_count, 0);
+	std::vector<bool>     used(vertex_count, false);
+	uint32_t              timestamp = vertex_cache_size + 1;
+
+	for (uint32_t index : indices)
+	{
+		if (!used[index])
+		{
+			used[index] = true;
+			stats.vertices++;
+		}
+
+		// Hits don't move the vertex in a FIFO cache
+		if (timestamp - cache_timestamps[index] > vertex_cache_size)
+		{
+			cache_timestamps[index] = timestamp++;
+			stats.transformed_vertices++;
+		}
+	}
+
+	return stats;
+}
+
+OptimizedMesh MeshOptimizer::optimize(const std::map<std::string, MeshAttributeInput> &attributes, const std::vector<uint32_t> &indices) const
+{
+	const auto &position = attributes.at("position");
+	assert(position.format == VK_FORMAT_R32G32B32_SFLOAT);
+
+	size_t vertex_count = position.data.size() / position.stride;
+
+	std::vector<glm::vec3> positions(vertex_count);
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		std::memcpy(&positions[i], position.data.data() + i * position.stride, sizeof(glm::vec3));
+	}
+
+	OptimizedMesh mesh;
+	mesh.stats_before = analyze_vertex_cache(indices, vertex_count);
+
+	std::vector<uint32_t> cluster_offsets;
+	mesh.indices = optimize_vertex_cache(indices, vertex_count, cluster_offsets);
+	optimize_overdraw(mesh.indices, positions, cluster_offsets);
+
+	auto remap        = optimize_vertex_fetch(mesh.indices, vertex_count);
+	mesh.vertex_count = to_u32(mesh.stats_before.vertices);
+	mesh.stats_after  = analyze_vertex_cache(mesh.indices, mesh.vertex_count);
+
+	// Every attribute is 4 byte aligned in the interleaved vertex
+	uint32_t vertex_stride = 0;
+	for (auto &[name, attribute] : attributes)
+	{
+		sg::VertexAttribute interleaved;
+		interleaved.format = quantize ? get_quantized_format(name, attribute) : attribute.format;
+		interleaved.offset = vertex_stride;
+
+		vertex_stride += (get_format_size(interleaved.format) + 3) & ~3u;
+
+		mesh.attributes.emplace(name, interleaved);
+	}
+
+	for (auto &attribute : mesh.attributes)
+	{
+		attribute.second.stride = vertex_stride;
+	}
+
+	mesh.vertex_data.resize(static_cast<size_t>(mesh.vertex_count) * vertex_stride);
+	for (size_t vertex = 0; vertex < vertex_count; vertex++)
+	{
+		if (remap[vertex] == invalid_vertex)
+		{
+			continue;
+		}
+
+		uint8_t *dst = mesh.vertex_data.data() + static_cast<size_t>(remap[vertex]) * vertex_stride;
+		for (auto &[name, attribute] : attributes)
+		{
+			auto &interleaved = mesh.attributes.at(name);
+			write_element(dst + interleaved.offset, interleaved.format, attribute.data.data() + vertex * attribute.stride, attribute.format);
+		}
+	}
+
+	return mesh;
+}
+
+void MeshOptimizer::load_cache(const std::string &cache_file)
+{
+	cached.clear();
+	requested.clear();
+
+	auto fs = vkb::filesystem::get();
+	if (!fs->is_file(cache_file))
+	{
+		return;
+	}
+
+	auto               cache_data = fs->read_file_binary(cache_file);
+	std::istringstream is{std::string{cache_data.begin(), cache_data.end()}};
+
+	uint32_t magic{0};
+	uint32_t version{0};
+	size_t   entry_count{0};
+	read(is, magic, version, entry_count);
+
+	if (!is || magic != cache_magic || version != cache_version)
+	{
+		LOGW("Ignoring invalid optimized mesh cache {}", cache_file);
+		return;
+	}
+
+	for (size_t i = 0; i < entry_count; i++)
+	{
+		uint64_t      key{0};
+		OptimizedMesh mesh;
+		read(is, key, mesh.vertex_data, mesh.attributes, mesh.indices, mesh.vertex_count, mesh.stats_before, mesh.stats_after);
+
+		if (!is)
+		{
+			LOGW("Ignoring truncated optimized mesh cache {}", cache_file);
+			cached.clear();
+			return;
+		}
+
+		cached.emplace(key, std::move(mesh));
+	}
+}
+
+void MeshOptimizer::save_cache(const std::string &cache_file) const
+{
+	if (optimized_mesh_count == 0)
+	{
+		return;
+	}
+
+	std::ostringstream os;
+	write(os, cache_magic, cache_version, requested.size());
+	for (auto &[key, mesh] : requested)
+	{
+		write(os, key, mesh.vertex_data, mesh.attributes, mesh.indices, mesh.vertex_count, mesh.stats_before, mesh.stats_after);
+	}
+
+	try
+	{
+		vkb::filesystem::get()->write_file(cache_file, os.str());
+	}
+	catch (const std::exception &e)
+	{
+		// The asset directory may be read-only, the meshes are optimized again next time
+		LOGW("Cannot write optimized mesh cache {}: {}", cache_file, e.what());
+	}
+}
+
+const OptimizedMesh &MeshOptimizer::request(const std::map<std::string, MeshAttributeInput> &attributes, const std::vector<uint32_t> &indices)
+{
+	uint64_t key = get_key(attributes, indices, quantize);
+
+	auto requested_it = requested.find(key);
+	if (requested_it != requested.end())
+	{
+		return requested_it->second;
+	}
+
+	OptimizedMesh mesh;
+
+	auto cached_it = cached.find(key);
+	if (cached_it != cached.end())
+	{
+		mesh = std::move(cached_it->second);
+		cached_mesh_count++;
+	}
+	else
+	{
+		Timer timer;
+		timer.start();
+
+		mesh = optimize(attributes, indices);
+
+		optimization_time += timer.stop();
+		optimized_mesh_count++;
+	}
+
+	auto accumulate = [](VertexCacheStats &total, const VertexCacheStats &stats) {
+		total.transformed_vertices += stats.transformed_vertices;
+		total.triangles += stats.triangles;
+		total.vertices += stats.vertices;
+	};
+	accumulate(total_stats_before, mesh.stats_before);
+	accumulate(total_stats_after, mesh.stats_after);
+
+	return requested.emplace(key, std::move(mesh)).first->second;
+}
+
+void MeshOptimizer::log_stats() const
+{
+	if (cached_mesh_count > 0)
+	{
+		LOGI("Loaded {} optimized meshes from the cache", cached_mesh_count);
+	}
+
+	if (optimized_mesh_count > 0)
+	{
+		LOGI("Optimized {} meshes in {:.3f} ms", optimized_mesh_count, optimization_time * 1000.0);
+	}
+
+	if (total_stats_before.triangles > 0)
+	{
+		LOGI("Vertex cache of {} entries: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f} over {} triangles",
+		     vertex_cache_size,
+		     total_stats_before.get_acmr(),
+		     total_stats_after.get_acmr(),
+		     total_stats_before.get_atvr(),
+		     total_stats_after.get_atvr(),
+		     total_stats_before.triangles);
+	}
+}
+}        // namespace vkb
@@ -0,0 +1,202 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/glm_common.h"
+#include "common/vk_common.h"
+#include "scene_graph/components/sub_mesh.h"
+
+namespace vkb
+{
+/**
+ * @brief Vertex attribute of a mesh to optimize, one element per vertex
+ */
+struct MeshAttributeInput
+{
+	VkFormat format;
+
+	/// Bytes between the elements of consecutive vertices in data
+	uint32_t stride;
+
+	std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Transformed vertices of a triangle list in a simulated post-transform cache
+ */
+struct VertexCacheStats
+{
+	/// Vertices missing from the cache when their triangle is drawn
+	uint64_t transformed_vertices{0};
+
+	uint64_t triangles{0};
+
+	/// Vertices referenced by the triangles
+	uint64_t vertices{0};
+
+	/**
+	 * @return Average cache miss ratio, the vertices transformed per triangle
+	 */
+	float get_acmr() const;
+
+	/**
+	 * @return Average transform to vertex ratio, 1 if every vertex is transformed only once
+	 */
+	float get_atvr() const;
+};
+
+/**
+ * @brief Optimized mesh, with its attributes interleaved in a single vertex stream
+ */
+struct OptimizedMesh
+{
+	/// Interleaved attributes, vertex_stride bytes per vertex
+	std::vector<uint8_t> vertex_data;
+
+	/// Attributes of the vertex stream by lowercase glTF name, with their offset in a vertex and the stride of the stream
+	std::map<std::string, sg::VertexAttribute> attributes;
+
+	std::vector<uint32_t> indices;
+
+	uint32_t vertex_count{0};
+
+	VertexCacheStats stats_before;
+
+	VertexCacheStats stats_after;
+};
+
+/**
+ * @brief Reorders the triangles and vertices of meshes for the post-transform vertex cache, overdraw and vertex fetch
+ *
+ * Meshes are optimized in three steps:
+ * - The triangles are ordered for the post-transform cache with Tipsify (Sander et al. 2007), which fans around
+ *   vertices still in the cache and jumps to the most recently used vertex with triangles left at dead ends.
+ * - The sequence is split into clusters at those dead ends, and the clusters are sorted from the most outward facing
+ *   to the most inward facing, so that the triangles likely to occlude the others of the mesh are drawn first.
+ * - The vertices are renumbered in the order the triangles first use them, so that vertex fetches walk the vertex
+ *   stream forward.
+ *
+ * The attributes are then interleaved in a single vertex stream, bound once per draw. Optionally normals and tangents
+ * are quantized to 16 bit snorm, and texture coordinates to 16 bit unorm if they are within [0, 1], 16 bit floats
+ * otherwise. Vertex fetch converts them back to floats, the shaders are left unchanged.
+ *
+ * The meshes of a scene are cached in a file next to the asset, keyed by the attributes and indices they were
+ * optimized from, so that they are only optimized the first time the scene is loaded.
+ */
+class MeshOptimizer
+{
+  public:
+	/// Entries of the FIFO post-transform cache Tipsify optimizes for and the stats simulate
+	static constexpr uint32_t vertex_cache_size = 16;
+
+	/// Triangles of an overdraw cluster, longer runs between dead ends are split
+	static constexpr uint32_t max_cluster_triangles = 256;
+
+	/// Suffix of the cache file, appended to the name of the asset
+	static constexpr const char *cache_suffix = ".optimized";
+
+	/**
+	 * @param quantize Whether to quantize normals, tangents and texture coordinates to 16 bits
+	 */
+	explicit MeshOptimizer(bool quantize = false);
+
+	/**
+	 * @brief Orders triangles for the post-transform cache
+	 * @param indices Three indices per triangle
+	 * @param vertex_count Vertices referenced by the indices
+	 * @param cluster_offsets Set to the offsets in the returned indices of the clusters of the overdraw optimization
+	 * @return The reordered indices
+	 */
+	static std::vector<uint32_t> optimize_vertex_cache(const std::vector<uint32_t> &indices, size_t vertex_count, std::vector<uint32_t> &cluster_offsets);
+
+	/**
+	 * @brief Sorts the clusters of a triangle list from the most outward facing to the most inward facing
+	 * @param indices Three indices per triangle, reordered in place
+	 * @param positions Vertex positions
+	 * @param cluster_offsets Offsets of the clusters in the indices, from optimize_vertex_cache
+	 */
+	static void optimize_overdraw(std::vector<uint32_t> &indices, const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &cluster_offsets);
+
+	/**
+	 * @brief Renumbers the vertices in the order the triangles first use them
+	 * @param indices Three indices per triangle, renumbered in place
+	 * @param vertex_count Vertices referenced by the indices
+	 * @return The new index of every vertex, or ~0 for the vertices no triangle uses
+	 */
+	static std::vector<uint32_t> optimize_vertex_fetch(std::vector<uint32_t> &indices, size_t vertex_count);
+
+	/**
+	 * @brief Simulates a FIFO post-transform cache of vertex_cache_size entries
+	 */
+	static VertexCacheStats analyze_vertex_cache(const std::vector<uint32_t> &indices, size_t vertex_count);
+
+	/**
+	 * @brief Reorders a triangle list and interleaves its attributes
+	 * @param attributes Attributes by lowercase glTF name, with at least a float "position"
+	 * @param indices Three indices per triangle
+	 */
+	OptimizedMesh optimize(const std::map<std::string, MeshAttributeInput> &attributes, const std::vector<uint32_t> &indices) const;
+
+	/**
+	 * @brief Reads the meshes cached for an asset, if the cache file exists and is valid
+	 * @param cache_file Path of the cache file
+	 */
+	void load_cache(const std::string &cache_file);
+
+	/**
+	 * @brief Writes the meshes requested since the cache was loaded, if any had to be optimized
+	 *        Meshes which were not requested again are dropped from the cache.
+	 */
+	void save_cache(const std::string &cache_file) const;
+
+	/**
+	 * @brief Finds the optimized mesh in the cache, or optimizes it
+	 */
+	const OptimizedMesh &request(const std::map<std::string, MeshAttributeInput> &attributes, const std::vector<uint32_t> &indices);
+
+	/**
+	 * @brief Logs the ACMR and ATVR of the meshes requested before and after optimization, and the optimization time
+	 */
+	void log_stats() const;
+
+  private:
+	bool quantize{false};
+
+	/// Meshes loaded from the cache file
+	std::unordered_map<uint64_t, OptimizedMesh> cached;
+
+	/// Meshes requested, found in the cache or optimized
+	std::unordered_map<uint64_t, OptimizedMesh> requested;
+
+	VertexCacheStats total_stats_before;
+
+	VertexCacheStats total_stats_after;
+
+	size_t optimized_mesh_count{0};
+
+	size_t cached_mesh_count{0};
+
+	/// Time spent optimizing meshes, in seconds
+	double optimization_time{0.0};
+};
+}        // namespace vkb
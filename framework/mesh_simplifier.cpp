@@ -0,0 +1,337 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mesh_simplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <queue>
+#include <string>
+#include <unordered_map>
+
+namespace vkb
+{
+namespace
+{
+/**
+ * @brief Symmetric 4x4 matrix summing the squared distances to a set of planes
+ */
+struct Quadric
+{
+	// a2, ab, ac, ad, b2, bc, bd, c2, cd, d2
+	std::array<double, 10> q{};
+
+	/// Number of planes summed
+	double plane_count{0.0};
+
+	static Quadric from_plane(const glm::dvec3 &normal, double d)
+	{
+		Quadric quadric;
+		quadric.q = {normal.x * normal.x, normal.x * normal.y, normal.x * normal.z, normal.x * d,
+		             normal.y * normal.y, normal.y * normal.z, normal.y * d,
+		             normal.z * normal.z, normal.z * d,
+		             d * d};
+		quadric.plane_count = 1.0;
+		return quadric;
+	}
+
+	Quadric &operator+=(const Quadric &other)
+	{
+		for (size_t i = 0; i < q.size(); i++)
+		{
+			q[i] += other.q[i];
+		}
+		plane_count += other.plane_count;
+		return *this;
+	}
+
+	double evaluate(const glm::vec3 &position) const
+	{
+		double x = position.x;
+		double y = position.y;
+		double z = position.z;
+
+		return q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x +
+		       q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y +
+		       q[7] * z * z + 2.0 * q[8] * z +
+		       q[9];
+	}
+};
+
+struct Collapse
+{
+	double cost;
+
+	uint32_t from;
+
+	uint32_t to;
+
+	/// Versions of both vertices when the cost was computed, the collapse is stale once either changed
+	uint32_t from_version;
+
+	uint32_t to_version;
+
+	bool operator>(const Collapse &other) const
+	{
+		return cost > other.cost;
+	}
+};
+
+uint64_t get_edge_key(uint32_t a, uint32_t b)
+{
+	return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+}
+
+/**
+ * @brief Locks the vertices on the border of the mesh, and the vertices sharing their position with another one
+ */
+std::vector<bool> find_locked_vertices(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices)
+{
+	std::vector<bool> locked(positions.size(), false);
+
+	std::unordered_map<std::string, uint32_t> vertex_by_position;
+	for (uint32_t vertex = 0; vertex < positions.size(); vertex++)
+	{
+		std::string key{reinterpret_cast<const char *>(&positions[vertex]), sizeof(glm::vec3)};
+
+		auto it = vertex_by_position.emplace(key, vertex);
+		if (!it.second)
+		{
+			locked[vertex]            = true;
+			locked[it.first->second] = true;
+		}
+	}
+
+	std::unordered_map<uint64_t, uint32_t> edge_triangle_counts;
+	for (size_t i = 0; i + 2 < indices.size(); i += 3)
+	{
+		if (indices[i] == indices[i + 1] || indices[i + 1] == indices[i + 2] || indices[i + 2] == indices[i])
+		{
+			continue;
+		}
+
+		for (uint32_t corner = 0; corner < 3; corner++)
+		{
+			edge_triangle_counts[get_edge_key(indices[i + corner], indices[i + (corner + 1) % 3])]++;
+		}
+	}
+
+	for (auto &[edge, triangle_count] : edge_triangle_counts)
+	{
+		if (triangle_count == 1)
+		{
+			locked[edge >> 32]         = true;
+			locked[edge & 0xffffffff] = true;
+		}
+	}
+
+	return locked;
+}
+}        // namespace
+
+std::vector<uint32_t> MeshSimplifier::simplify(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices, size_t target_index_count, float &error)
+{
+	size_t vertex_count   = positions.size();
+	size_t triangle_count = indices.size() / 3;
+
+	error = 0.0f;
+
+	std::vector<uint32_t> triangles{indices.begin(), indices.begin() + triangle_count * 3};
+	std::vector<bool>     triangle_alive(triangle_count, true);
+
+	std::vector<std::vector<uint32_t>> vertex_triangles(vertex_count);
+	std::vector<Quadric>               quadrics(vertex_count);
+
+	size_t alive_count = 0;
+	for (uint32_t triangle = 0; triangle < triangle_count; triangle++)
+	{
+		uint32_t a = triangles[triangle * 3];
+		uint32_t b = triangles[triangle * 3 + 1];
+		uint32_t c = triangles[triangle * 3 + 2];
+
+		glm::dvec3 normal = glm::cross(glm::dvec3(positions[b] - positions[a]), glm::dvec3(positions[c] - positions[a]));
+		double     length = glm::length(normal);
+
+		if (a == b || b == c || c == a || length == 0.0)
+		{
+			triangle_alive[triangle] = false;
+			continue;
+		}
+
+		normal /= length;
+		Quadric plane = Quadric::from_plane(normal, -glm::dot(normal, glm::dvec3(positions[a])));
+
+		for (uint32_t vertex : {a, b, c})
+		{
+			quadrics[vertex] += plane;
+			vertex_triangles[vertex].push_back(triangle);
+		}
+
+		alive_count++;
+	}
+
+	auto locked = find_locked_vertices(positions, triangles);
+
+	std::vector<uint32_t> versions(vertex_count, 0);
+	std::vector<bool>     removed(vertex_count, false);
+
+	std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+
+	auto push_collapse = [&](uint32_t from, uint32_t to) {
+		if (locked[from])
+		{
+			return;
+		}
+
+		Quadric quadric = quadrics[from];
+		quadric += quadrics[to];
+		collapses.push({quadric.evaluate(positions[to]), from, to, versions[from], versions[to]});
+	};
+
+	for (uint32_t triangle = 0; triangle < triangle_count; triangle++)
+	{
+		if (!triangle_alive[triangle])
+		{
+			continue;
+		}
+
+		for (uint32_t corner = 0; corner < 3; corner++)
+		{
+			uint32_t a = triangles[triangle * 3 + corner];
+			uint32_t b = triangles[triangle * 3 + (corner + 1) % 3];
+			push_collapse(a, b);
+			push_collapse(b, a);
+		}
+	}
+
+	// Largest mean squared distance of a collapsed vertex to its planes
+	double max_error = 0.0;
+
+	while (alive_count * 3 > target_index_count && !collapses.empty())
+	{
+		Collapse collapse = collapses.top();
+		collapses.pop();
+
+		uint32_t from = collapse.from;
+		uint32_t to   = collapse.to;
+
+		if (removed[from] || removed[to] || versions[from] != collapse.from_version || versions[to] != collapse.to_version)
+		{
+			continue;
+		}
+
+		// The edge may be gone since, and no triangle of the collapsed vertex may flip
+		bool edge_found = false;
+		bool flipped    = false;
+		for (uint32_t triangle : vertex_triangles[from])
+		{
+			if (!triangle_alive[triangle])
+			{
+				continue;
+			}
+
+			uint32_t *corners = &triangles[triangle * 3];
+			if (corners[0] == to || corners[1] == to || corners[2] == to)
+			{
+				edge_found = true;
+				continue;
+			}
+
+			std::array<glm::vec3, 3> before;
+			std::array<glm::vec3, 3> after;
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				before[corner] = positions[corners[corner]];
+				after[corner]  = corners[corner] == from ? positions[to] : before[corner];
+			}
+
+			glm::vec3 normal_before = glm::cross(before[1] - before[0], before[2] - before[0]);
+			glm::vec3 normal_after  = glm::cross(after[1] - after[0], after[2] - after[0]);
+			if (glm::dot(normal_before, normal_after) <= 0.0f)
+			{
+				flipped = true;
+				break;
+			}
+		}
+
+		if (!edge_found || flipped)
+		{
+			continue;
+		}
+
+		// The triangles sharing the edge disappear, the others move to the remaining vertex
+		for (uint32_t triangle : vertex_triangles[from])
+		{
+			if (!triangle_alive[triangle])
+			{
+				continue;
+			}
+
+			uint32_t *corners = &triangles[triangle * 3];
+			if (corners[0] == to || corners[1] == to || corners[2] == to)
+			{
+				triangle_alive[triangle] = false;
+				alive_count--;
+				continue;
+			}
+
+			std::replace(corners, corners + 3, from, to);
+			vertex_triangles[to].push_back(triangle);
+		}
+
+		vertex_triangles[from].clear();
+		removed[from] = true;
+		quadrics[to] += quadrics[from];
+		versions[to]++;
+		max_error = std::max(max_error, collapse.cost / quadrics[to].plane_count);
+
+		// Collapses onto and from the remaining vertex cost more with its merged quadric
+		for (uint32_t triangle : vertex_triangles[to])
+		{
+			if (!triangle_alive[triangle])
+			{
+				continue;
+			}
+
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				uint32_t neighbor = triangles[triangle * 3 + corner];
+				if (neighbor != to)
+				{
+					push_collapse(neighbor, to);
+					push_collapse(to, neighbor);
+				}
+			}
+		}
+	}
+
+	error = static_cast<float>(std::sqrt(max_error));
+
+	std::vector<uint32_t> simplified;
+	simplified.reserve(alive_count * 3);
+	for (uint32_t triangle = 0; triangle < triangle_count; triangle++)
+	{
+		if (triangle_alive[triangle])
+		{
+			simplified.insert(simplified.end(), triangles.begin() + triangle * 3, triangles.begin() + triangle * 3 + 3);
+		}
+	}
+
+	return simplified;
+}
+}        // namespace vkb
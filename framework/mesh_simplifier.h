@@ -0,0 +1,51 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "common/glm_common.h"
+
+namespace vkb
+{
+/**
+ * @brief Simplifies triangle lists with the quadric error metric (Garland and Heckbert 1997)
+ *
+ * Edges are collapsed onto one of their vertices, cheapest first, so the simplified triangles index the vertices of
+ * the original mesh and can share its vertex buffers. The cost of collapsing a vertex onto another is the sum of the
+ * squared distances of the new position to the planes of the triangles merged into both vertices.
+ *
+ * Vertices on the border of the mesh, and vertices split along attribute seams (several vertices with the same
+ * position), are never moved, so the levels of detail keep their silhouette and texture mapping. Collapses which
+ * flip a triangle are rejected.
+ */
+class MeshSimplifier
+{
+  public:
+	/**
+	 * @brief Collapses edges until the triangle list is small enough, or no collapse is left
+	 * @param positions Vertex positions
+	 * @param indices Three indices into the positions per triangle
+	 * @param target_index_count Index count to reach
+	 * @param error Set to the largest root mean square distance of a collapsed vertex to the triangles merged into it,
+	 *        an estimate of the geometric error of the simplified mesh in the units of the positions
+	 * @return The indices of the triangles left, which may be more than the target
+	 */
+	static std::vector<uint32_t> simplify(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices, size_t target_index_count, float &error);
+};
+}        // namespace vkb
@@ -0,0 +1,310 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "meshlet_builder.h"
+
+#include <algorithm>
+#include <limits>
+#include <string_view>
+
+#include <filesystem/filesystem.hpp>
+
+#include "common/helpers.h"
+#include "core/util/logging.hpp"
+#include "timer.h"
+
+namespace vkb
+{
+namespace
+{
+constexpr uint32_t cache_magic = 0x48534D56;        // "VMSH"
+
+/// Bumped whenever the meshlets built from the same triangles change
+constexpr uint32_t cache_version = 1;
+
+constexpr uint8_t no_local_index = std::numeric_limits<uint8_t>::max();
+
+uint64_t get_key(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices)
+{
+	size_t key = std::hash<std::string_view>{}({reinterpret_cast<const char *>(positions.data()), positions.size() * sizeof(glm::vec3)});
+	hash_combine(key, std::string_view{reinterpret_cast<const char *>(indices.data()), indices.size() * sizeof(uint32_t)});
+	return key;
+}
+
+/**
+ * @brief Computes the bounding sphere and normal cone of the last meshlet, and clears the local indices of its vertices
+ */
+void finish_meshlet(MeshletData &data, const std::vector<glm::vec3> &positions, std::vector<uint8_t> &local_indices)
+{
+	auto &meshlet = data.meshlets.back();
+
+	auto vertices_begin = data.vertices.begin() + meshlet.vertex_offset;
+	auto vertices_end   = vertices_begin + meshlet.vertex_count;
+
+	glm::vec3 min_position{std::numeric_limits<float>::max()};
+	glm::vec3 max_position{std::numeric_limits<float>::lowest()};
+	for (auto it = vertices_begin; it != vertices_end; it++)
+	{
+		min_position       = glm::min(min_position, positions[*it]);
+		max_position       = glm::max(max_position, positions[*it]);
+		local_indices[*it] = no_local_index;
+	}
+
+	glm::vec3 center = (min_position + max_position) * 0.5f;
+	float     radius = 0.0f;
+	for (auto it = vertices_begin; it != vertices_end; it++)
+	{
+		radius = std::max(radius, glm::distance(center, positions[*it]));
+	}
+	meshlet.bounding_sphere = glm::vec4(center, radius);
+
+	std::vector<glm::vec3> normals;
+	normals.reserve(meshlet.triangle_count);
+
+	glm::vec3 normal_sum{0.0f};
+	for (uint32_t i = 0; i < meshlet.triangle_count; i++)
+	{
+		uint32_t triangle = data.triangles[meshlet.triangle_offset + i];
+
+		const auto &p0 = positions[*(vertices_begin + (triangle & 0xff))];
+		const auto &p1 = positions[*(vertices_begin + ((triangle >> 8) & 0xff))];
+		const auto &p2 = positions[*(vertices_begin + ((triangle >> 16) & 0xff))];
+
+		glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+		float     length = glm::length(normal);
+		if (length > 0.0f)
+		{
+			normals.push_back(normal / length);
+			normal_sum += normals.back();
+		}
+	}
+
+	// Without a cone narrower than a half space, the meshlet is never backface culled
+	meshlet.normal_cone = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+	float sum_length = glm::length(normal_sum);
+	if (sum_length == 0.0f)
+	{
+		return;
+	}
+
+	glm::vec3 axis    = normal_sum / sum_length;
+	float     min_dot = 1.0f;
+	for (auto &normal : normals)
+	{
+		min_dot = std::min(min_dot, glm::dot(axis, normal));
+	}
+
+	// Cones close to a half space cull nearly nothing, and are sensitive to the precision of the normals
+	if (min_dot > 0.1f)
+	{
+		// Sine of the half angle: every triangle faces away from the viewers within the cone of that cutoff around -axis
+		meshlet.normal_cone = glm::vec4(axis, std::sqrt(1.0f - min_dot * min_dot));
+	}
+}
+}        // namespace
+
+MeshletData MeshletBuilder::build(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices)
+{
+	MeshletData data;
+
+	// Upper bounds, with every meshlet full
+	data.meshlets.reserve(indices.size() / 3 / max_triangles + 1);
+	data.triangles.reserve(indices.size() / 3);
+
+	// Index of every vertex in the current meshlet
+	std::vector<uint8_t> local_indices(positions.size(), no_local_index);
+
+	bool meshlet_open = false;
+
+	for (size_t i = 0; i + 2 < indices.size(); i += 3)
+	{
+		uint32_t a = indices[i];
+		uint32_t b = indices[i + 1];
+		uint32_t c = indices[i + 2];
+
+		// Degenerate triangles are never rasterized
+		if (a == b || b == c || c == a)
+		{
+			continue;
+		}
+
+		if (meshlet_open)
+		{
+			auto    &current          = data.meshlets.back();
+			uint32_t new_vertex_count = (local_indices[a] == no_local_index) + (local_indices[b] == no_local_index) + (local_indices[c] == no_local_index);
+
+			if (current.vertex_count + new_vertex_count > max_vertices || current.triangle_count == max_triangles)
+			{
+				finish_meshlet(data, positions, local_indices);
+				meshlet_open = false;
+			}
+		}
+
+		if (!meshlet_open)
+		{
+			MeshletDescription meshlet{};
+			meshlet.vertex_offset   = to_u32(data.vertices.size());
+			meshlet.triangle_offset = to_u32(data.triangles.size());
+			data.meshlets.push_back(meshlet);
+			meshlet_open = true;
+		}
+
+		auto &current = data.meshlets.back();
+
+		uint32_t triangle = 0;
+		for (uint32_t corner = 0; corner < 3; corner++)
+		{
+			uint32_t vertex = indices[i + corner];
+			if (local_indices[vertex] == no_local_index)
+			{
+				local_indices[vertex] = static_cast<uint8_t>(current.vertex_count++);
+				data.vertices.push_back(vertex);
+			}
+			triangle |= static_cast<uint32_t>(local_indices[vertex]) << (corner * 8);
+		}
+
+		data.triangles.push_back(triangle);
+		current.triangle_count++;
+	}
+
+	if (meshlet_open)
+	{
+		finish_meshlet(data, positions, local_indices);
+	}
+
+	return data;
+}
+
+void MeshletBuilder::load_cache(const std::string &cache_file)
+{
+	cached.clear();
+	requested.clear();
+
+	auto fs = vkb::filesystem::get();
+	if (!fs->is_file(cache_file))
+	{
+		return;
+	}
+
+	auto               cache_data = fs->read_file_binary(cache_file);
+	std::istringstream is{std::string{cache_data.begin(), cache_data.end()}};
+
+	uint32_t magic{0};
+	uint32_t version{0};
+	size_t   entry_count{0};
+	read(is, magic, version, entry_count);
+
+	if (!is || magic != cache_magic || version != cache_version)
+	{
+		LOGW("Ignoring invalid meshlet cache {}", cache_file);
+		return;
+	}
+
+	for (size_t i = 0; i < entry_count; i++)
+	{
+		uint64_t    key{0};
+		MeshletData data;
+		read(is, key, data.meshlets, data.vertices, data.triangles);
+
+		if (!is)
+		{
+			LOGW("Ignoring truncated meshlet cache {}", cache_file);
+			cached.clear();
+			return;
+		}
+
+		cached.emplace(key, std::move(data));
+	}
+}
+
+void MeshletBuilder::save_cache(const std::string &cache_file) const
+{
+	if (stats.built_meshlet_count == 0)
+	{
+		return;
+	}
+
+	std::ostringstream os;
+	write(os, cache_magic, cache_version, requested.size());
+	for (auto &entry : requested)
+	{
+		write(os, entry.first, entry.second.meshlets, entry.second.vertices, entry.second.triangles);
+	}
+
+	try
+	{
+		vkb::filesystem::get()->write_file(cache_file, os.str());
+	}
+	catch (const std::exception &e)
+	{
+		// The asset directory may be read-only, the meshlets are built again next time
+		LOGW("Cannot write meshlet cache {}: {}", cache_file, e.what());
+	}
+}
+
+const MeshletData &MeshletBuilder::request(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices)
+{
+	uint64_t key = get_key(positions, indices);
+
+	auto requested_it = requested.find(key);
+	if (requested_it != requested.end())
+	{
+		return requested_it->second;
+	}
+
+	auto cached_it = cached.find(key);
+	if (cached_it != cached.end())
+	{
+		stats.cached_meshlet_count += cached_it->second.meshlets.size();
+		return requested.emplace(key, std::move(cached_it->second)).first->second;
+	}
+
+	Timer timer;
+	timer.start();
+
+	auto data = build(positions, indices);
+
+	stats.build_time += timer.stop();
+	stats.built_triangle_count += data.triangles.size();
+	stats.built_meshlet_count += data.meshlets.size();
+
+	return requested.emplace(key, std::move(data)).first->second;
+}
+
+void MeshletBuilder::log_stats() const
+{
+	if (stats.cached_meshlet_count > 0)
+	{
+		LOGI("Loaded {} meshlets from the cache", stats.cached_meshlet_count);
+	}
+
+	if (stats.built_meshlet_count > 0)
+	{
+		LOGI("Built {} meshlets from {} triangles in {:.3f} ms ({:.1f} M triangles/s)",
+		     stats.built_meshlet_count,
+		     stats.built_triangle_count,
+		     stats.build_time * 1000.0,
+		     stats.get_triangles_per_second() / 1000000.0);
+	}
+}
+
+const MeshletBuildStats &MeshletBuilder::get_stats() const
+{
+	return stats;
+}
+}        // namespace vkb
@@ -0,0 +1,149 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/glm_common.h"
+
+namespace vkb
+{
+/**
+ * @brief Meshlet of a sub mesh, laid out as in the storage buffer of meshlet/meshlet_shared.h
+ */
+struct MeshletDescription
+{
+	/// Center and radius of the sphere bounding the vertices
+	glm::vec4 bounding_sphere;
+
+	/// Axis and cutoff of the cone of the triangle normals, the cutoff is 1 if the meshlet can't be backface culled
+	glm::vec4 normal_cone;
+
+	/// Offset of the first vertex in MeshletData::vertices
+	uint32_t vertex_offset;
+
+	/// Offset of the first triangle in MeshletData::triangles
+	uint32_t triangle_offset;
+
+	uint32_t vertex_count;
+
+	uint32_t triangle_count;
+};
+
+/**
+ * @brief Meshlets of a sub mesh
+ */
+struct MeshletData
+{
+	std::vector<MeshletDescription> meshlets;
+
+	/// Vertex remapping: indices of the vertices of every meshlet in the vertex buffers of the sub mesh
+	std::vector<uint32_t> vertices;
+
+	/// Primitive remapping: the three vertices of every triangle, as 8 bit indices into the vertices of its meshlet
+	std::vector<uint32_t> triangles;
+};
+
+/**
+ * @brief Meshlets found in the cache or built by a MeshletBuilder, and the time spent building them
+ */
+struct MeshletBuildStats
+{
+	size_t cached_meshlet_count{0};
+
+	size_t built_meshlet_count{0};
+
+	size_t built_triangle_count{0};
+
+	/// Time spent building meshlets, in seconds
+	double build_time{0.0};
+
+	/**
+	 * @return Triangles built into meshlets per second
+	 */
+	double get_triangles_per_second() const
+	{
+		return build_time > 0.0 ? built_triangle_count / build_time : 0.0;
+	}
+};
+
+/**
+ * @brief Splits the triangles of sub meshes into meshlets, for task and mesh shaders to cull and draw them
+ *
+ * Triangles are added in index order to the current meshlet until it runs out of vertices or triangles, which keeps
+ * the locality of indices optimized for the post-transform cache. Every meshlet is given a bounding sphere and the
+ * cone of its triangle normals, so that it can be frustum and backface culled as a whole.
+ *
+ * The meshlets of a scene are cached in a file next to the asset, keyed by the positions and indices they were built
+ * from, so that they are only built the first time the scene is loaded.
+ */
+class MeshletBuilder
+{
+  public:
+	/// Vertices of a meshlet, the output limit of the mesh shader
+	static constexpr uint32_t max_vertices = 64;
+
+	/// Triangles of a meshlet, the output limit of the mesh shader
+	static constexpr uint32_t max_triangles = 124;
+
+	/// Suffix of the cache file, appended to the name of the asset
+	static constexpr const char *cache_suffix = ".meshlets";
+
+	/**
+	 * @brief Builds the meshlets of a triangle list
+	 * @param positions Vertex positions
+	 * @param indices Three indices into the positions per triangle
+	 */
+	static MeshletData build(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices);
+
+	/**
+	 * @brief Reads the meshlets cached for an asset, if the cache file exists and is valid
+	 * @param cache_file Path of the cache file
+	 */
+	void load_cache(const std::string &cache_file);
+
+	/**
+	 * @brief Writes the meshlets requested since the cache was loaded, if any had to be built
+	 *        Meshlets which were not requested again are dropped from the cache.
+	 */
+	void save_cache(const std::string &cache_file) const;
+
+	/**
+	 * @brief Finds the meshlets of a triangle list in the cache, or builds them
+	 */
+	const MeshletData &request(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices);
+
+	/**
+	 * @brief Logs the number of meshlets requested, and the throughput of the ones built
+	 */
+	void log_stats() const;
+
+	const MeshletBuildStats &get_stats() const;
+
+  private:
+	/// Meshlets loaded from the cache file
+	std::unordered_map<uint64_t, MeshletData> cached;
+
+	/// Meshlets requested, found in the cache or built
+	std::unordered_map<uint64_t, MeshletData> requested;
+
+	MeshletBuildStats stats;
+};
+}        // namespace vkb
@@ -0,0 +1,291 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pipeline_library_cache.h"
+
+#include <algorithm>
+
+#include "common/resource_caching.h"
+#include "core/device.h"
+#include "core/util/logging.hpp"
+#include "resource_record.h"
+
+namespace vkb
+{
+namespace
+{
+constexpr std::array<GraphicsPipelineLibraryPart, 4> library_parts{
+    GraphicsPipelineLibraryPart::VertexInput,
+    GraphicsPipelineLibraryPart::PreRasterization,
+    GraphicsPipelineLibraryPart::FragmentShader,
+    GraphicsPipelineLibraryPart::FragmentOutput,
+};
+
+/**
+ * @brief Hashes the shaders of a part, with the state shared by the parts created from a render pass and a layout
+ */
+void hash_shaders(size_t &result, const PipelineState &pipeline_state, bool fragment)
+{
+	vkb::hash_combine(result, pipeline_state.get_pipeline_layout().get_handle());
+	vkb::hash_combine(result, pipeline_state.get_render_pass()->get_handle());
+	vkb::hash_combine(result, pipeline_state.get_subpass_index());
+	vkb::hash_combine(result, pipeline_state.get_specialization_constant_state());
+
+	for (auto shader_module : pipeline_state.get_pipeline_layout().get_shader_modules())
+	{
+		if ((shader_module->get_stage() == VK_SHADER_STAGE_FRAGMENT_BIT) == fragment)
+		{
+			vkb::hash_combine(result, shader_module->get_id());
+		}
+	}
+}
+
+void hash_multisample_state(size_t &result, const PipelineState &pipeline_state)
+{
+	vkb::hash_combine(result, pipeline_state.get_multisample_state().alpha_to_coverage_enable);
+	vkb::hash_combine(result, pipeline_state.get_multisample_state().alpha_to_one_enable);
+	vkb::hash_combine(result, pipeline_state.get_multisample_state().min_sample_shading);
+	vkb::hash_combine(result, static_cast<std::underlying_type<VkSampleCountFlagBits>::type>(pipeline_state.get_multisample_state().rasterization_samples));
+	vkb::hash_combine(result, pipeline_state.get_multisample_state().sample_shading_enable);
+	vkb::hash_combine(result, pipeline_state.get_multisample_state().sample_mask);
+}
+}        // namespace
+
+PipelineLibraryCache::PipelineLibraryCache(Device &device) :
+    device{device}
+{
+}
+
+PipelineLibraryCache::~PipelineLibraryCache()
+{
+	clear();
+}
+
+GraphicsPipeline &PipelineLibraryCache::request_graphics_pipeline(VkPipelineCache pipeline_cache, PipelineState &pipeline_state, ResourceRecord *recorder)
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	size_t hash = std::hash<PipelineState>()(pipeline_state);
+
+	auto it = graphics_pipelines.find(hash);
+	if (it != graphics_pipelines.end())
+	{
+		return it->second;
+	}
+
+	std::vector<VkPipeline> library_handles;
+	for (auto part : library_parts)
+	{
+		library_handles.push_back(request_library(pipeline_cache, pipeline_state, part).get_handle());
+	}
+
+	LOGD("Linking #{} graphics pipeline from libraries", graphics_pipelines.size());
+
+	// The fast link is used until the optimized pipeline is ready
+	it = graphics_pipelines.emplace(hash, GraphicsPipeline{device, pipeline_cache, pipeline_state, library_handles}).first;
+
+	if (recorder)
+	{
+		size_t index = recorder->register_graphics_pipeline(pipeline_cache, pipeline_state);
+		recorder->set_graphics_pipeline(index, it->second);
+	}
+
+	optimize(it->second, pipeline_cache, library_handles);
+
+	return it->second;
+}
+
+void PipelineLibraryCache::update_pipelines(uint32_t frames_in_flight)
+{
+	// The pipelines retired in earlier frames are destroyed once the frames which may use them have completed
+	for (auto &retired : retired_pipelines)
+	{
+		if (retired.remaining_frames > 0)
+		{
+			retired.remaining_frames--;
+		}
+
+		if (retired.remaining_frames == 0)
+		{
+			vkDestroyPipeline(device.get_handle(), retired.handle, nullptr);
+			retired.handle = VK_NULL_HANDLE;
+		}
+	}
+
+	retired_pipelines.erase(std::remove_if(retired_pipelines.begin(), retired_pipelines.end(),
+	                                       [](const RetiredPipeline &retired) { return retired.handle == VK_NULL_HANDLE; }),
+	                        retired_pipelines.end());
+
+	std::vector<OptimizedPipeline> ready_pipelines;
+	{
+		std::lock_guard<std::mutex> guard(optimized_mutex);
+		std::swap(ready_pipelines, optimized_pipelines);
+	}
+
+	for (auto &optimized : ready_pipelines)
+	{
+		retired_pipelines.push_back({optimized.graphics_pipeline->replace_handle(optimized.handle), frames_in_flight});
+	}
+
+	std::lock_guard<std::mutex> guard(mutex);
+
+	optimize_jobs.erase(std::remove_if(optimize_jobs.begin(), optimize_jobs.end(),
+	                                   [](const JobHandle &job) { return job.is_done(); }),
+	                    optimize_jobs.end());
+}
+
+void PipelineLibraryCache::clear()
+{
+	// The waiting thread may run other jobs requesting pipelines meanwhile, so the jobs are waited for without the lock
+	std::vector<JobHandle> jobs;
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		std::swap(jobs, optimize_jobs);
+	}
+	if (!jobs.empty())
+	{
+		JobSystem::get().wait(jobs);
+	}
+
+	std::lock_guard<std::mutex> guard(mutex);
+
+	for (auto &optimized : optimized_pipelines)
+	{
+		vkDestroyPipeline(device.get_handle(), optimized.handle, nullptr);
+	}
+	optimized_pipelines.clear();
+
+	for (auto &retired : retired_pipelines)
+	{
+		vkDestroyPipeline(device.get_handle(), retired.handle, nullptr);
+	}
+	retired_pipelines.clear();
+
+	graphics_pipelines.clear();
+
+	for (auto &part_libraries : libraries)
+	{
+		part_libraries.clear();
+	}
+}
+
+size_t PipelineLibraryCache::hash_part(const PipelineState &pipeline_state, GraphicsPipelineLibraryPart part)
+{
+	std::size_t result = 0;
+
+	switch (part)
+	{
+		case GraphicsPipelineLibraryPart::VertexInput:
+			for (auto &attribute : pipeline_state.get_vertex_input_state().attributes)
+			{
+				vkb::hash_combine(result, attribute);
+			}
+
+			for (auto &binding : pipeline_state.get_vertex_input_state().bindings)
+			{
+				vkb::hash_combine(result, binding);
+			}
+
+			vkb::hash_combine(result, pipeline_state.get_input_assembly_state().primitive_restart_enable);
+			vkb::hash_combine(result, static_cast<std::underlying_type<VkPrimitiveTopology>::type>(pipeline_state.get_input_assembly_state().topology));
+			break;
+
+		case GraphicsPipelineLibraryPart::PreRasterization:
+			hash_shaders(result, pipeline_state, false);
+
+			vkb::hash_combine(result, pipeline_state.get_viewport_state().viewport_count);
+			vkb::hash_combine(result, pipeline_state.get_viewport_state().scissor_count);
+
+			vkb::hash_combine(result, pipeline_state.get_rasterization_state().cull_mode);
+			vkb::hash_combine(result, pipeline_state.get_rasterization_state().depth_bias_enable);
+			vkb::hash_combine(result, pipeline_state.get_rasterization_state().depth_clamp_enable);
+			vkb::hash_combine(result, static_cast<std::underlying_type<VkFrontFace>::type>(pipeline_state.get_rasterization_state().front_face));
+			vkb::hash_combine(result, static_cast<std::underlying_type<VkPolygonMode>::type>(pipeline_state.get_rasterization_state().polygon_mode));
+			vkb::hash_combine(result, pipeline_state.get_rasterization_state().rasterizer_discard_enable);
+			break;
+
+		case GraphicsPipelineLibraryPart::FragmentShader:
+			hash_shaders(result, pipeline_state, true);
+			hash_multisample_state(result, pipeline_state);
+
+			vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().back);
+			vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().depth_bounds_test_enable);
+			vkb::hash_combine(result, static_cast<std::underlying_type<VkCompareOp>::type>(pipeline_state.get_depth_stencil_state().depth_compare_op));
+			vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().depth_test_enable);
+			vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().depth_write_enable);
+			vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().front);
+			vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().stencil_test_enable);
+			break;
+
+		case GraphicsPipelineLibraryPart::FragmentOutput:
+			vkb::hash_combine(result, pipeline_state.get_render_pass()->get_handle());
+			vkb::hash_combine(result, pipeline_state.get_subpass_index());
+			hash_multisample_state(result, pipeline_state);
+
+			vkb::hash_combine(result, static_cast<std::underlying_type<VkLogicOp>::type>(pipeline_state.get_color_blend_state().logic_op));
+			vkb::hash_combine(result, pipeline_state.get_color_blend_state().logic_op_enable);
+
+			for (auto &attachment : pipeline_state.get_color_blend_state().attachments)
+			{
+				vkb::hash_combine(result, attachment);
+			}
+			break;
+	}
+
+	return result;
+}
+
+PipelineLibrary &PipelineLibraryCache::request_library(VkPipelineCache pipeline_cache, PipelineState &pipeline_state, GraphicsPipelineLibraryPart part)
+{
+	auto &part_libraries = libraries[static_cast<size_t>(part)];
+
+	size_t hash = hash_part(pipeline_state, part);
+
+	auto it = part_libraries.find(hash);
+	if (it != part_libraries.end())
+	{
+		return it->second;
+	}
+
+	LOGD("Building #{} graphics pipeline library of part {}", part_libraries.size(), static_cast<uint32_t>(part));
+
+	return part_libraries.emplace(hash, PipelineLibrary{device, pipeline_cache, pipeline_state, part}).first->second;
+}
+
+void PipelineLibraryCache::optimize(GraphicsPipeline &graphics_pipeline, VkPipelineCache pipeline_cache, const std::vector<VkPipeline> &library_handles)
+{
+	VkPipelineLayout pipeline_layout = graphics_pipeline.get_state().get_pipeline_layout().get_handle();
+
+	// The libraries and the pipeline outlive the job, as clear() waits for it
+	optimize_jobs.push_back(JobSystem::get().schedule(
+	    [this, &graphics_pipeline, pipeline_cache, pipeline_layout, library_handles]() {
+		    try
+		    {
+			    VkPipeline handle = GraphicsPipeline::link_libraries(device, pipeline_cache, pipeline_layout, library_handles, true);
+
+			    std::lock_guard<std::mutex> guard(optimized_mutex);
+			    optimized_pipelines.push_back({&graphics_pipeline, handle});
+		    }
+		    catch (const std::exception &e)
+		    {
+			    // The fast-linked pipeline is kept
+			    LOGW("Cannot link optimized graphics pipeline: {}", e.what());
+		    }
+	    },
+	    JobPriority::Background));
+}
+}        // namespace vkb
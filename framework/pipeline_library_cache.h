@@ -0,0 +1,128 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "core/pipeline.h"
+#include "job_system.h"
+
+namespace vkb
+{
+class Device;
+class ResourceRecord;
+
+/**
+ * @brief Caches graphics pipelines linked from graphics pipeline libraries, with VK_EXT_graphics_pipeline_library
+ *
+ * The four parts of a pipeline are created as libraries and cached independently, keyed on the state relevant to
+ * each part only, so that pipelines which differ in their vertex input, rasterization or blend state share the
+ * libraries of their other parts. On a miss the libraries are fast-linked into a pipeline usable within the frame,
+ * and a pipeline optimized across the libraries is linked in the background. The optimized pipeline replaces the
+ * handle of the fast-linked one in update_pipelines(), and the fast-linked one is destroyed once the frames in
+ * flight which may use it have completed.
+ */
+class PipelineLibraryCache
+{
+  public:
+	PipelineLibraryCache(Device &device);
+
+	PipelineLibraryCache(const PipelineLibraryCache &) = delete;
+
+	PipelineLibraryCache(PipelineLibraryCache &&) = delete;
+
+	~PipelineLibraryCache();
+
+	PipelineLibraryCache &operator=(const PipelineLibraryCache &) = delete;
+
+	PipelineLibraryCache &operator=(PipelineLibraryCache &&) = delete;
+
+	/**
+	 * @brief Requests a graphics pipeline, linking it from the cached libraries if needed
+	 * @param recorder Records the pipelines linked for the first time, can be nullptr
+	 */
+	GraphicsPipeline &request_graphics_pipeline(VkPipelineCache pipeline_cache, PipelineState &pipeline_state, ResourceRecord *recorder);
+
+	/**
+	 * @brief Swaps in the pipelines optimized in the background, and destroys the pipelines they replaced once unused
+	 *        Must be called once per frame, while no command buffer is being recorded
+	 * @param frames_in_flight Number of frames which may still use a pipeline replaced now
+	 */
+	void update_pipelines(uint32_t frames_in_flight);
+
+	/**
+	 * @brief Waits for the background links, and destroys the pipelines and the libraries
+	 */
+	void clear();
+
+	/**
+	 * @return The hash of the state a part of the pipeline is created from
+	 */
+	static size_t hash_part(const PipelineState &pipeline_state, GraphicsPipelineLibraryPart part);
+
+  private:
+	/**
+	 * @brief A pipeline linked with link time optimization, waiting to replace the fast-linked one
+	 */
+	struct OptimizedPipeline
+	{
+		GraphicsPipeline *graphics_pipeline{nullptr};
+
+		VkPipeline handle{VK_NULL_HANDLE};
+	};
+
+	/**
+	 * @brief A fast-linked pipeline which may still be used by the frames in flight
+	 */
+	struct RetiredPipeline
+	{
+		VkPipeline handle{VK_NULL_HANDLE};
+
+		uint32_t remaining_frames{0};
+	};
+
+	PipelineLibrary &request_library(VkPipelineCache pipeline_cache, PipelineState &pipeline_state, GraphicsPipelineLibraryPart part);
+
+	/**
+	 * @brief Links the libraries of a pipeline with link time optimization in a background job
+	 */
+	void optimize(GraphicsPipeline &graphics_pipeline, VkPipelineCache pipeline_cache, const std::vector<VkPipeline> &libraries);
+
+	Device &device;
+
+	/// Libraries of every part, keyed on the hash of their part of the state
+	std::array<std::unordered_map<size_t, PipelineLibrary>, 4> libraries;
+
+	std::unordered_map<size_t, GraphicsPipeline> graphics_pipelines;
+
+	/// Protects the libraries, the pipelines and the background jobs
+	std::mutex mutex;
+
+	std::vector<JobHandle> optimize_jobs;
+
+	/// Protects the pipelines optimized by the background jobs
+	std::mutex optimized_mutex;
+
+	std::vector<OptimizedPipeline> optimized_pipelines;
+
+	std::vector<RetiredPipeline> retired_pipelines;
+};
+}        // namespace vkb
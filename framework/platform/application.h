@@ -35,6 +35,29 @@ struct ApplicationOptions
 	Window *window{nullptr};
 };
 
+/**
+ * @brief Optional device features changing how the framework synchronizes frames, presents, binds shaders and uploads
+ *        textures
+ *        The samples only request them, when they are supported, once they are selected
+ */
+struct FrameworkFeatures
+{
+	/// VK_KHR_timeline_semaphore, to track the submissions of a frame with a timeline semaphore per queue
+	bool timeline_semaphore{false};
+
+	/// VK_KHR_present_id and VK_KHR_present_wait, to pace frames on their presentation and measure their latency
+	bool present_wait{false};
+
+	/// VK_EXT_graphics_pipeline_library, to link graphics pipelines from cached pipeline libraries
+	bool graphics_pipeline_library{false};
+
+	/// VK_EXT_shader_object, to bind shader objects instead of pipelines
+	bool shader_object{false};
+
+	/// VK_EXT_host_image_copy, to copy textures to their images from host memory instead of through staging buffers
+	bool host_image_copy{false};
+};
+
 class Application
 {
   public:
@@ -124,6 +147,13 @@ class Application
 	 */
 	static vkb::ShadingLanguage get_shading_language();
 
+	/**
+	 * @brief Selects the optional device features the framework uses, requested by the samples prepared next
+	 */
+	static void set_framework_features(const FrameworkFeatures &features);
+
+	static FrameworkFeatures get_framework_features();
+
   protected:
 	/**
 	 * @brief Stores a list of shaders for the active sample, used by plugins to dynamically change the shader
@@ -159,6 +189,9 @@ class Application
 
 	/** @brief Used to select between different shader languages, static so it can be changed from a plugin */
 	inline static vkb::ShadingLanguage shading_language{vkb::ShadingLanguage::GLSL};
+
+	/** @brief Static so that they can be selected from the plugins using them, before the samples are created */
+	inline static FrameworkFeatures framework_features{};
 };
 
 inline void Application::set_shading_language(const vkb::ShadingLanguage language)
@@ -171,4 +204,14 @@ inline vkb::ShadingLanguage Application::get_shading_language()
 	return shading_language;
 }
 
+inline void Application::set_framework_features(const FrameworkFeatures &features)
+{
+	framework_features = features;
+}
+
+inline FrameworkFeatures Application::get_framework_features()
+{
+	return framework_features;
+}
+
 }        // namespace vkb
@@ -25,6 +25,9 @@ namespace vkb
  * @brief Surface-less implementation of a Window using VK_EXT_headless_surface.
  * A surface and swapchain are still created but the the present operation resolves to a no op.
  * Useful for testing and benchmarking in CI environments.
+ *
+ * In Offscreen mode no surface is created at all, so that the RenderContext renders to a ring of
+ * offscreen images instead of a swapchain, which also works on drivers without VK_EXT_headless_surface.
  */
 class HeadlessWindow : public Window
 {
@@ -34,14 +37,14 @@ class HeadlessWindow : public Window
 	virtual ~HeadlessWindow() = default;
 
 	/**
-	 * @brief A direct window doesn't have a surface
-	 * @returns VK_NULL_HANDLE
+	 * @brief Creates a headless surface
+	 * @returns VK_NULL_HANDLE in Offscreen mode
 	 */
 	VkSurfaceKHR create_surface(Instance &instance) override;
 
 	/**
-	 * @brief A direct window doesn't have a surface
-	 * @returns nullptr
+	 * @brief Creates a headless surface
+	 * @returns VK_NULL_HANDLE in Offscreen mode
 	 */
 	VkSurfaceKHR create_surface(VkInstance instance, VkPhysicalDevice physical_device) override;
 
@@ -281,7 +281,7 @@ void Platform::update()
 		{
 			if (app->has_render_context())
 			{
-				on_post_draw(reinterpret_cast<vkb::RenderContext &>(app->get_render_context()));
+				on_post_draw(reinterpret_cast<vkb::rendering::RenderContextC &>(app->get_render_context()));
 			}
 		}
 		else if (auto *app = dynamic_cast<VulkanSampleC *>(active_app.get()))
@@ -352,6 +352,9 @@ void Platform::terminate(ExitCode code)
 	active_app.reset();
 	window.reset();
 
+	// Jobs left may still log, so they finish before the loggers are dropped
+	JobSystem::shutdown();
+
 	spdlog::drop_all();
 
 	on_platform_close();
@@ -430,6 +433,11 @@ Window &Platform::get_window()
 	return *window;
 }
 
+JobSystem &Platform::get_job_system()
+{
+	return JobSystem::get();
+}
+
 void Platform::set_last_error(const std::string &error)
 {
 	last_error = error;
@@ -535,7 +543,7 @@ void Platform::resize(uint32_t width, uint32_t height)
 		}                               \
 	}
 
-void Platform::on_post_draw(RenderContext &context)
+void Platform::on_post_draw(vkb::rendering::RenderContextC &context)
 {
 	HOOK(Hook::PostDraw, on_post_draw(context));
 }
@@ -29,6 +29,7 @@
 #include "common/optional.h"
 #include "common/utils.h"
 #include "common/vk_common.h"
+#include "job_system.h"
 #include "platform/application.h"
 #include "platform/plugins/plugin.h"
 #include "platform/window.h"
@@ -101,6 +102,11 @@ class Platform
 
 	Window &get_window();
 
+	/**
+	 * @brief The job system shared by the app, the framework and the plugins, instead of creating their own threads
+	 */
+	JobSystem &get_job_system();
+
 	Application &get_app() const;
 
 	Application &get_app();
@@ -130,7 +136,7 @@ class Platform
 
 	void set_window_properties(const Window::OptionalProperties &properties);
 
-	void on_post_draw(RenderContext &context);
+	void on_post_draw(vkb::rendering::RenderContextC &context);
 
 	static const uint32_t MIN_WINDOW_WIDTH;
 	static const uint32_t MIN_WINDOW_HEIGHT;
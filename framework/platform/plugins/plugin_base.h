@@ -46,7 +46,7 @@ class PluginBase : public Plugin, public Tag<TAGS...>
 	void on_app_start(const std::string &app_id) override{};
 	void on_app_close(const std::string &app_id) override{};
 	void on_platform_close() override{};
-	void on_post_draw(RenderContext &context) override{};
+	void on_post_draw(vkb::rendering::RenderContextC &context) override{};
 	void on_app_error(const std::string &app_id) override{};
 	void on_update_ui_overlay(vkb::Drawer &drawer) override{};
 
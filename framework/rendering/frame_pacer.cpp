@@ -0,0 +1,229 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frame_pacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace vkb
+{
+namespace
+{
+/// Weight of a new measurement in the averaged present interval and frame duration
+constexpr double averaging_weight = 0.1;
+
+/// Time a just-in-time frame is started ahead of its deadline, to absorb variations in its duration
+constexpr double just_in_time_margin = 0.001;
+
+/// Longest time waited for the presentation of the previous frame, which may not happen while the window is hidden
+constexpr uint64_t present_timeout = 100'000'000;
+
+double to_seconds(FramePacer::Clock::duration duration)
+{
+	return std::chrono::duration<double>(duration).count();
+}
+
+void average(double &value, double measurement)
+{
+	value = value > 0.0 ? value + averaging_weight * (measurement - value) : measurement;
+}
+}        // namespace
+
+FramePacer::FramePacer(VkDevice device, bool present_wait) :
+    device{device}, present_wait{present_wait}
+{
+}
+
+void FramePacer::set_max_frames_in_flight(uint32_t count)
+{
+	max_frames_in_flight = count;
+}
+
+uint32_t FramePacer::get_max_frames_in_flight() const
+{
+	return max_frames_in_flight;
+}
+
+void FramePacer::set_latency_mode(LatencyMode mode)
+{
+	latency_mode = mode;
+}
+
+LatencyMode FramePacer::get_latency_mode() const
+{
+	return latency_mode;
+}
+
+void FramePacer::begin_frame(VkSwapchainKHR swapchain, const WaitFrameFunc &wait_frame)
+{
+	while (!frames_in_flight.empty() && complete(frames_in_flight.front(), swapchain, wait_frame, 0))
+	{
+		frames_in_flight.pop_front();
+	}
+
+	if (latency_mode == LatencyMode::JustInTime)
+	{
+		// Only one frame is in flight, and it is presented before the next one starts
+		while (!frames_in_flight.empty())
+		{
+			wait_gpu(frames_in_flight.front(), wait_frame, std::numeric_limits<uint32_t>::max());
+			complete(frames_in_flight.front(), swapchain, wait_frame, present_timeout);
+			frames_in_flight.pop_front();
+		}
+
+		// Start as late as possible for the frame to be ready for the next presentation
+		if (has_last_present && present_interval > 0.0 && frame_duration > 0.0)
+		{
+			auto   now       = Clock::now();
+			double ahead     = frame_duration + just_in_time_margin;
+			double intervals = std::ceil((to_seconds(now - last_present) + ahead) / present_interval);
+			double start     = intervals * present_interval - ahead;
+			double sleep     = std::min(start - to_seconds(now - last_present), present_interval);
+
+			if (sleep > 0.0)
+			{
+				std::this_thread::sleep_for(std::chrono::duration<double>(sleep));
+			}
+		}
+	}
+	else if (max_frames_in_flight > 0)
+	{
+		// Frames whose GPU work is done are only kept until their presentation is observed, and are not in flight
+		auto in_flight = static_cast<uint32_t>(std::count_if(frames_in_flight.begin(), frames_in_flight.end(),
+		                                                     [](const FrameRecord &record) { return !record.gpu_complete; }));
+
+		for (auto &record : frames_in_flight)
+		{
+			if (in_flight < max_frames_in_flight)
+			{
+				break;
+			}
+
+			if (!record.gpu_complete)
+			{
+				wait_gpu(record, wait_frame, std::numeric_limits<uint32_t>::max());
+				in_flight--;
+			}
+		}
+	}
+
+	cpu_start = Clock::now();
+}
+
+uint64_t FramePacer::end_frame(uint32_t frame_index, VkSwapchainKHR swapchain)
+{
+	// Earlier frames rendered with the same render frame were waited for when it was reused, and their fences were reset
+	for (auto &record : frames_in_flight)
+	{
+		if (record.frame_index == frame_index && !record.gpu_complete)
+		{
+			record.gpu_complete = true;
+			record.gpu_done     = cpu_start;
+		}
+	}
+
+	FrameRecord record;
+	record.frame_index = frame_index;
+	record.swapchain   = swapchain;
+	record.cpu_start   = cpu_start;
+	record.submit      = Clock::now();
+
+	if (present_wait && swapchain != VK_NULL_HANDLE)
+	{
+		record.present_id = next_present_id++;
+	}
+
+	frames_in_flight.push_back(record);
+
+	return record.present_id;
+}
+
+const FrameLatency &FramePacer::get_latest_latency() const
+{
+	return latest_latency;
+}
+
+bool FramePacer::wait_gpu(FrameRecord &record, const WaitFrameFunc &wait_frame, uint32_t timeout)
+{
+	if (record.gpu_complete)
+	{
+		return true;
+	}
+
+	if (!wait_frame(record.frame_index, timeout))
+	{
+		return false;
+	}
+
+	record.gpu_complete = true;
+	record.gpu_done     = Clock::now();
+
+	average(frame_duration, to_seconds(record.gpu_done - record.cpu_start));
+
+	return true;
+}
+
+bool FramePacer::complete(FrameRecord &record, VkSwapchainKHR swapchain, const WaitFrameFunc &wait_frame, uint64_t timeout)
+{
+	if (!wait_gpu(record, wait_frame, static_cast<uint32_t>(std::min<uint64_t>(timeout, std::numeric_limits<uint32_t>::max()))))
+	{
+		return false;
+	}
+
+	bool presented = false;
+	auto end       = record.gpu_done;
+
+	// Presentations to a retired swapchain can't be waited for anymore
+	if (record.present_id != 0 && record.swapchain == swapchain)
+	{
+		VkResult result = vkWaitForPresentKHR(device, swapchain, record.present_id, timeout);
+
+		if (result == VK_TIMEOUT)
+		{
+			return false;
+		}
+
+		if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
+		{
+			presented = true;
+			end       = Clock::now();
+		}
+	}
+
+	latest_latency.cpu_time        = to_seconds(record.submit - record.cpu_start);
+	latest_latency.present_latency = to_seconds(end - record.submit);
+	latest_latency.total           = to_seconds(end - record.cpu_start);
+	latest_latency.presented       = presented;
+
+	if (presented)
+	{
+		// Polled presentations are observed with a delay, only the ones waited for measure the interval
+		if (has_last_present && timeout > 0 && end > last_present)
+		{
+			average(present_interval, to_seconds(end - last_present));
+		}
+
+		last_present     = end;
+		has_last_present = true;
+	}
+
+	return true;
+}
+}        // namespace vkb
@@ -0,0 +1,183 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+
+#include "common/vk_common.h"
+
+namespace vkb
+{
+/**
+ * @brief How the CPU work of a frame is scheduled
+ */
+enum class LatencyMode
+{
+	/// Frames are started as soon as a frame in flight is available, which keeps the GPU busy
+	Throughput,
+
+	/// A frame is only started once the previous one has been presented, and as late as possible
+	/// so that it is still ready for the next presentation, which minimizes input-to-photon latency
+	JustInTime
+};
+
+/**
+ * @brief Latency of a completed frame, in seconds
+ */
+struct FrameLatency
+{
+	/// From the start of the CPU work of the frame to its submission
+	double cpu_time{0.0};
+
+	/// From the submission of the frame to its presentation, or to the end of its GPU work when presentation can't be observed
+	double present_latency{0.0};
+
+	/// From the start of the CPU work of the frame to its presentation
+	double total{0.0};
+
+	/// Whether the presentation was observed with VK_KHR_present_wait
+	bool presented{false};
+};
+
+/**
+ * @brief Paces the frames of a render context and measures their latency
+ *
+ * The number of frames in flight can be limited below the number of render frames, so that the CPU does not run ahead
+ * of the GPU by as many frames as there are swapchain images. In LatencyMode::JustInTime a frame is only started once
+ * the previous one has completed, and when VK_KHR_present_wait is enabled the start is further delayed so that the
+ * frame ends just before the next presentation, based on the measured refresh interval and frame duration.
+ *
+ * Frames are identified with VK_KHR_present_id when it is enabled, so that their presentation can be waited for and
+ * their latency measured up to the presentation. Otherwise the latency ends when the GPU work of the frame is done.
+ * Completion is polled at the start of every frame, so it is observed with up to a frame of delay unless the frame
+ * pacer waits for it.
+ */
+class FramePacer
+{
+  public:
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 * @brief Waits for the GPU work of a render frame
+	 * @param frame_index Index of the render frame
+	 * @param timeout Timeout in nanoseconds, 0 to poll
+	 * @return Whether the work is done
+	 */
+	using WaitFrameFunc = std::function<bool(uint32_t frame_index, uint32_t timeout)>;
+
+	/**
+	 * @param device The device presenting
+	 * @param present_wait Whether VK_KHR_present_id and VK_KHR_present_wait are enabled
+	 */
+	FramePacer(VkDevice device, bool present_wait);
+
+	void set_max_frames_in_flight(uint32_t count);
+
+	/**
+	 * @return Maximum number of frames in flight, 0 if only limited by the number of render frames
+	 */
+	uint32_t get_max_frames_in_flight() const;
+
+	void set_latency_mode(LatencyMode mode);
+
+	LatencyMode get_latency_mode() const;
+
+	/**
+	 * @brief Waits until the next frame can be started, called before acquiring its image
+	 * @param swapchain The current swapchain, VK_NULL_HANDLE when rendering offscreen
+	 * @param wait_frame Waits for the GPU work of a render frame
+	 */
+	void begin_frame(VkSwapchainKHR swapchain, const WaitFrameFunc &wait_frame);
+
+	/**
+	 * @brief Records the submission of the frame, called before it is presented
+	 * @param frame_index Index of the render frame which was submitted
+	 * @param swapchain The swapchain the frame is presented to, VK_NULL_HANDLE when rendering offscreen
+	 * @return The present ID to chain to the present call with VkPresentIdKHR, 0 if none should be
+	 */
+	uint64_t end_frame(uint32_t frame_index, VkSwapchainKHR swapchain);
+
+	/**
+	 * @return Latency of the last completed frame
+	 */
+	const FrameLatency &get_latest_latency() const;
+
+  private:
+	struct FrameRecord
+	{
+		uint32_t frame_index{0};
+
+		VkSwapchainKHR swapchain{VK_NULL_HANDLE};
+
+		uint64_t present_id{0};
+
+		Clock::time_point cpu_start;
+
+		Clock::time_point submit;
+
+		Clock::time_point gpu_done;
+
+		bool gpu_complete{false};
+	};
+
+	/**
+	 * @brief Waits for the GPU work of a frame
+	 * @param timeout Timeout in nanoseconds, 0 to poll
+	 * @return Whether the GPU work is done
+	 */
+	bool wait_gpu(FrameRecord &record, const WaitFrameFunc &wait_frame, uint32_t timeout);
+
+	/**
+	 * @brief Waits for the GPU work and the presentation of a frame, and measures its latency once both are done
+	 * @param swapchain The current swapchain, presentations to previous swapchains are not waited for
+	 * @param timeout Timeout in nanoseconds, 0 to poll
+	 * @return Whether the frame is complete
+	 */
+	bool complete(FrameRecord &record, VkSwapchainKHR swapchain, const WaitFrameFunc &wait_frame, uint64_t timeout);
+
+	VkDevice device;
+
+	bool present_wait;
+
+	uint32_t max_frames_in_flight{0};
+
+	LatencyMode latency_mode{LatencyMode::Throughput};
+
+	/// Submitted frames which are not complete, oldest first
+	std::deque<FrameRecord> frames_in_flight;
+
+	Clock::time_point cpu_start;
+
+	uint64_t next_present_id{1};
+
+	FrameLatency latest_latency;
+
+	/// Time of the last observed presentation
+	Clock::time_point last_present;
+
+	bool has_last_present{false};
+
+	/// Averaged interval between two presentations, in seconds, 0 until measured
+	double present_interval{0.0};
+
+	/// Averaged time from the start of a frame to the end of its GPU work, in seconds
+	double frame_duration{0.0};
+};
+}        // namespace vkb
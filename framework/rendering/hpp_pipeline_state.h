@@ -125,11 +125,31 @@ class HPPPipelineState : private vkb::PipelineState
 		return reinterpret_cast<vkb::rendering::HPPColorBlendState const &>(vkb::PipelineState::get_color_blend_state());
 	}
 
+	const vkb::rendering::HPPDepthStencilState &get_depth_stencil_state() const
+	{
+		return reinterpret_cast<vkb::rendering::HPPDepthStencilState const &>(vkb::PipelineState::get_depth_stencil_state());
+	}
+
+	const vkb::rendering::HPPInputAssemblyState &get_input_assembly_state() const
+	{
+		return reinterpret_cast<vkb::rendering::HPPInputAssemblyState const &>(vkb::PipelineState::get_input_assembly_state());
+	}
+
+	const vkb::rendering::HPPMultisampleState &get_multisample_state() const
+	{
+		return reinterpret_cast<vkb::rendering::HPPMultisampleState const &>(vkb::PipelineState::get_multisample_state());
+	}
+
 	const vkb::core::HPPPipelineLayout &get_pipeline_layout() const
 	{
 		return reinterpret_cast<vkb::core::HPPPipelineLayout const &>(vkb::PipelineState::get_pipeline_layout());
 	}
 
+	const vkb::rendering::HPPRasterizationState &get_rasterization_state() const
+	{
+		return reinterpret_cast<vkb::rendering::HPPRasterizationState const &>(vkb::PipelineState::get_rasterization_state());
+	}
+
 	const vkb::core::HPPRenderPass *get_render_pass() const
 	{
 		return reinterpret_cast<vkb::core::HPPRenderPass const *>(vkb::PipelineState::get_render_pass());
@@ -140,6 +160,11 @@ class HPPPipelineState : private vkb::PipelineState
 		return reinterpret_cast<vkb::rendering::HPPSpecializationConstantState const &>(vkb::PipelineState::get_specialization_constant_state());
 	}
 
+	const vkb::rendering::HPPVertexInputState &get_vertex_input_state() const
+	{
+		return reinterpret_cast<vkb::rendering::HPPVertexInputState const &>(vkb::PipelineState::get_vertex_input_state());
+	}
+
 	void set_color_blend_state(const vkb::rendering::HPPColorBlendState &color_blend_state)
 	{
 		vkb::PipelineState::set_color_blend_state(reinterpret_cast<vkb::ColorBlendState const &>(color_blend_state));
@@ -38,6 +38,9 @@ class HPPRenderPipeline : private vkb::RenderPipeline
 		vkb::RenderPipeline::add_subpass(std::move(subpass));
 	}
 
+	using vkb::RenderPipeline::get_thread_count;
+	using vkb::RenderPipeline::set_thread_count;
+
 	void draw(vkb::core::CommandBufferCpp     &command_buffer,
 	          vkb::rendering::HPPRenderTarget &render_target,
 	          vk::SubpassContents              contents = vk::SubpassContents::eInline)
@@ -46,6 +49,11 @@ class HPPRenderPipeline : private vkb::RenderPipeline
 		                          reinterpret_cast<vkb::RenderTarget &>(render_target),
 		                          static_cast<VkSubpassContents>(contents));
 	}
+
+	vk::SubpassContents get_last_subpass_contents() const
+	{
+		return static_cast<vk::SubpassContents>(vkb::RenderPipeline::get_last_subpass_contents());
+	}
 };
 }        // namespace rendering
 }        // namespace vkb
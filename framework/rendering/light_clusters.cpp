@@ -0,0 +1,366 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rendering/light_clusters.h"
+
+#include "core/command_buffer.h"
+#include "rendering/render_context.h"
+#include "scene_graph/components/light.h"
+#include "scene_graph/components/perspective_camera.h"
+#include "scene_graph/components/transform.h"
+#include "scene_graph/node.h"
+#include "timer.h"
+
+#include <limits>
+
+namespace vkb
+{
+namespace
+{
+/**
+ * @brief Radius beyond which a point or spot light contributes nothing, must match get_light_radius in lighting.h
+ *        clustered_lighting.h windows the inverse square falloff of both light types to zero at this radius, so the
+ *        culled clusters never receive light. Lights without a range are cut off where their falloff,
+ *        intensity / dist^2, drops below 1/256.
+ */
+float light_radius(const vkb::rendering::Light &light)
+{
+	float range = light.direction.w;
+	if (range > 0.0f)
+	{
+		return range;
+	}
+
+	float intensity = light.color.w;
+	return std::sqrt(std::max(intensity, 0.0f) * 256.0f) / 0.005f;
+}
+
+template <typename T>
+BufferAllocationC upload_storage(rendering::RenderFrameC &render_frame, const std::vector<T> &data)
+{
+	// Empty allocations are not allowed, and shaders need a valid buffer bound even when there is nothing to read
+	auto allocation = render_frame.allocate_buffer(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, std::max<size_t>(data.size(), 1) * sizeof(T));
+	if (!data.empty())
+	{
+		allocation.get_buffer().update(data.data(), data.size() * sizeof(T), allocation.get_offset());
+	}
+	return allocation;
+}
+}        // namespace
+
+LightClusters::LightClusters(vkb::rendering::RenderContextC &render_context, const glm::uvec3 &grid_size, uint32_t max_lights_per_cluster) :
+    render_context{render_context},
+    grid_size{grid_size},
+    max_lights_per_cluster{max_lights_per_cluster},
+    culling_shader{"light_culling.comp"}
+{
+	if (grid_size.x == 0 || grid_size.y == 0 || grid_size.z == 0 || max_lights_per_cluster == 0)
+	{
+		throw std::runtime_error("LightClusters: grid size and maximum lights per cluster must be greater than zero");
+	}
+}
+
+void LightClusters::set_culling_mode(LightCullingMode mode)
+{
+	culling_mode = mode;
+}
+
+LightCullingMode LightClusters::get_culling_mode() const
+{
+	return culling_mode;
+}
+
+void LightClusters::set_lights(const std::vector<sg::Light *> &lights)
+{
+	selected_lights = lights;
+}
+
+void LightClusters::update(const std::vector<sg::Light *> &scene_lights, sg::Camera &camera, const VkExtent2D &extent)
+{
+	auto perspective_camera = dynamic_cast<sg::PerspectiveCamera *>(&camera);
+	if (!perspective_camera)
+	{
+		throw std::runtime_error("LightClusters: clustered lighting requires a perspective camera");
+	}
+
+	clustered_lights.clear();
+	light_radii.clear();
+
+	for (auto &scene_light : selected_lights.empty() ? scene_lights : selected_lights)
+	{
+		if (scene_light->get_light_type() == sg::LightType::Directional)
+		{
+			// Directional lights reach every cluster, they stay in the regular light uniform
+			continue;
+		}
+
+		const auto &properties = scene_light->get_properties();
+		auto       &transform  = scene_light->get_node()->get_transform();
+
+		vkb::rendering::Light light{{transform.get_translation(), static_cast<float>(scene_light->get_light_type())},
+		                            {properties.color, properties.intensity},
+		                            {transform.get_rotation() * properties.direction, properties.range},
+		                            {properties.inner_cone_angle, properties.outer_cone_angle}};
+
+		switch (scene_light->get_light_type())
+		{
+			case sg::LightType::Point:
+			case sg::LightType::Spot:
+				clustered_lights.push_back(light);
+				light_radii.push_back(light_radius(light));
+				break;
+			default:
+				LOGE("LightClusters::update: encountered unknown light type {}", static_cast<int>(scene_light->get_light_type()));
+				break;
+		}
+	}
+
+	glm::mat4 projection = camera.get_pre_rotation() * vkb::rendering::vulkan_style_projection(camera.get_projection());
+	float     near_plane = perspective_camera->get_near_plane();
+	float     far_plane  = perspective_camera->get_far_plane();
+	float     log_ratio  = std::log(far_plane / near_plane);
+
+	cluster_uniform.view           = camera.get_view();
+	cluster_uniform.inv_projection = glm::inverse(projection);
+	cluster_uniform.grid_size      = glm::uvec4(grid_size, max_lights_per_cluster);
+	cluster_uniform.cluster_scale  = glm::vec4(static_cast<float>(grid_size.x) / extent.width,
+	                                           static_cast<float>(grid_size.y) / extent.height,
+	                                           grid_size.z / log_ratio,
+	                                           grid_size.z * std::log(near_plane) / log_ratio);
+	cluster_uniform.depth_range    = glm::vec4(near_plane, far_plane, 0.0f, 0.0f);
+	cluster_uniform.light_count    = glm::uvec4(to_u32(clustered_lights.size()), 0, 0, 0);
+
+	auto &render_frame = render_context.get_active_frame();
+
+	uniform_allocation = render_frame.allocate_buffer(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, sizeof(LightClusterUniform));
+	uniform_allocation.update(cluster_uniform);
+
+	lights_allocation = upload_storage(render_frame, clustered_lights);
+
+	size_t cluster_count = static_cast<size_t>(grid_size.x) * grid_size.y * grid_size.z;
+
+	if (culling_mode == LightCullingMode::CPU)
+	{
+		Timer timer;
+		timer.start();
+
+		update_cluster_bounds(cluster_uniform.inv_projection, near_plane, far_plane);
+		cull_lights(cluster_uniform.view);
+
+		cpu_culling_time = timer.stop<Timer::Milliseconds>();
+
+		ranges_allocation  = upload_storage(render_frame, cluster_ranges);
+		indices_allocation = upload_storage(render_frame, light_indices);
+	}
+	else
+	{
+		// The compute shader writes the ranges and a fixed-stride index list, nothing to upload
+		cpu_culling_time   = 0.0;
+		ranges_allocation  = render_frame.allocate_buffer(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, cluster_count * sizeof(glm::uvec2));
+		indices_allocation = render_frame.allocate_buffer(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, cluster_count * max_lights_per_cluster * sizeof(uint32_t));
+	}
+}
+
+void LightClusters::record_culling(vkb::core::CommandBufferC &command_buffer)
+{
+	if (culling_mode != LightCullingMode::GPU)
+	{
+		return;
+	}
+
+	assert(!uniform_allocation.empty() && "LightClusters::update must be called before recording the culling");
+
+	auto &resource_cache  = command_buffer.get_device().get_resource_cache();
+	auto &shader_module   = resource_cache.request_shader_module(VK_SHADER_STAGE_COMPUTE_BIT, culling_shader);
+	auto &pipeline_layout = resource_cache.request_pipeline_layout({&shader_module});
+	command_buffer.bind_pipeline_layout(pipeline_layout);
+
+	bind(command_buffer, 0, 0);
+
+	uint32_t cluster_count = grid_size.x * grid_size.y * grid_size.z;
+	command_buffer.dispatch((cluster_count + CULLING_GROUP_SIZE - 1) / CULLING_GROUP_SIZE, 1, 1);
+
+	BufferMemoryBarrier barrier{};
+	barrier.src_stage_mask  = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+	barrier.dst_stage_mask  = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+	barrier.src_access_mask = VK_ACCESS_SHADER_WRITE_BIT;
+	barrier.dst_access_mask = VK_ACCESS_SHADER_READ_BIT;
+
+	command_buffer.buffer_memory_barrier(ranges_allocation.get_buffer(), ranges_allocation.get_offset(), ranges_allocation.get_size(), barrier);
+	command_buffer.buffer_memory_barrier(indices_allocation.get_buffer(), indices_allocation.get_offset(), indices_allocation.get_size(), barrier);
+}
+
+void LightClusters::bind(vkb::core::CommandBufferC &command_buffer, uint32_t set, uint32_t first_binding)
+{
+	command_buffer.bind_buffer(uniform_allocation.get_buffer(), uniform_allocation.get_offset(), uniform_allocation.get_size(), set, first_binding, 0);
+	command_buffer.bind_buffer(lights_allocation.get_buffer(), lights_allocation.get_offset(), lights_allocation.get_size(), set, first_binding + 1, 0);
+	command_buffer.bind_buffer(ranges_allocation.get_buffer(), ranges_allocation.get_offset(), ranges_allocation.get_size(), set, first_binding + 2, 0);
+	command_buffer.bind_buffer(indices_allocation.get_buffer(), indices_allocation.get_offset(), indices_allocation.get_size(), set, first_binding + 3, 0);
+}
+
+std::vector<std::string> LightClusters::get_shader_definitions() const
+{
+	return {"CLUSTERED_LIGHTING"};
+}
+
+size_t LightClusters::get_light_count() const
+{
+	return clustered_lights.size();
+}
+
+double LightClusters::get_cpu_culling_time() const
+{
+	return cpu_culling_time;
+}
+
+float LightClusters::get_average_lights_per_cluster() const
+{
+	return average_lights_per_cluster;
+}
+
+void LightClusters::update_cluster_bounds(const glm::mat4 &inv_projection, float near_plane, float far_plane)
+{
+	glm::vec4 key{near_plane, far_plane, 0.0f, 0.0f};
+	if (!cluster_bounds.empty() && key == cluster_bounds_key && inv_projection == cluster_bounds_inv_projection)
+	{
+		return;
+	}
+	cluster_bounds_key            = key;
+	cluster_bounds_inv_projection = inv_projection;
+
+	// View-space direction through a point of the screen, scaled so that its depth (-z) is 1
+	auto view_ray = [&inv_projection](float ndc_x, float ndc_y) {
+		glm::vec4 point = inv_projection * glm::vec4(ndc_x, ndc_y, 1.0f, 1.0f);
+		glm::vec3 ray   = glm::vec3(point) / point.w;
+		return ray / -ray.z;
+	};
+
+	cluster_bounds.resize(static_cast<size_t>(grid_size.x) * grid_size.y * grid_size.z);
+
+	for (uint32_t y = 0; y < grid_size.y; ++y)
+	{
+		for (uint32_t x = 0; x < grid_size.x; ++x)
+		{
+			float ndc_min_x = 2.0f * x / grid_size.x - 1.0f;
+			float ndc_max_x = 2.0f * (x + 1) / grid_size.x - 1.0f;
+			float ndc_min_y = 2.0f * y / grid_size.y - 1.0f;
+			float ndc_max_y = 2.0f * (y + 1) / grid_size.y - 1.0f;
+
+			std::array<glm::vec3, 4> rays{view_ray(ndc_min_x, ndc_min_y), view_ray(ndc_max_x, ndc_min_y), view_ray(ndc_min_x, ndc_max_y), view_ray(ndc_max_x, ndc_max_y)};
+
+			for (uint32_t z = 0; z < grid_size.z; ++z)
+			{
+				// Logarithmic slicing keeps clusters roughly cubic along the view direction
+				float slice_near = near_plane * std::pow(far_plane / near_plane, static_cast<float>(z) / grid_size.z);
+				float slice_far  = near_plane * std::pow(far_plane / near_plane, static_cast<float>(z + 1) / grid_size.z);
+
+				glm::vec3 bounds_min{std::numeric_limits<float>::max()};
+				glm::vec3 bounds_max{std::numeric_limits<float>::lowest()};
+				for (auto &ray : rays)
+				{
+					bounds_min = glm::min(bounds_min, glm::min(ray * slice_near, ray * slice_far));
+					bounds_max = glm::max(bounds_max, glm::max(ray * slice_near, ray * slice_far));
+				}
+
+				cluster_bounds[x + grid_size.x * (y + grid_size.y * z)] = {bounds_min, bounds_max};
+			}
+		}
+	}
+}
+
+void LightClusters::cull_lights(const glm::mat4 &view)
+{
+	float near_plane = cluster_uniform.depth_range.x;
+	float far_plane  = cluster_uniform.depth_range.y;
+
+	auto depth_to_slice = [this](float depth) {
+		float slice = std::floor(std::log(depth) * cluster_uniform.cluster_scale.z - cluster_uniform.cluster_scale.w);
+		return static_cast<uint32_t>(glm::clamp(slice, 0.0f, static_cast<float>(grid_size.z - 1)));
+	};
+
+	cluster_light_pairs.clear();
+
+	for (uint32_t light_index = 0; light_index < clustered_lights.size(); ++light_index)
+	{
+		glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(clustered_lights[light_index].position), 1.0f));
+		float     radius = light_radii[light_index];
+
+		// Reject against the depth range first, it also narrows down the slices to test
+		float depth_min = -center.z - radius;
+		float depth_max = -center.z + radius;
+		if (depth_max < near_plane || depth_min > far_plane)
+		{
+			continue;
+		}
+
+		uint32_t slice_begin = depth_to_slice(std::max(depth_min, near_plane));
+		uint32_t slice_end   = depth_to_slice(std::min(depth_max, far_plane));
+
+		for (uint32_t z = slice_begin; z <= slice_end; ++z)
+		{
+			for (uint32_t y = 0; y < grid_size.y; ++y)
+			{
+				for (uint32_t x = 0; x < grid_size.x; ++x)
+				{
+					uint32_t    cluster_index = x + grid_size.x * (y + grid_size.y * z);
+					const auto &bounds        = cluster_bounds[cluster_index];
+
+					glm::vec3 closest = glm::clamp(center, bounds.first, bounds.second);
+					glm::vec3 offset  = closest - center;
+					if (glm::dot(offset, offset) <= radius * radius)
+					{
+						cluster_light_pairs.emplace_back(cluster_index, light_index);
+					}
+				}
+			}
+		}
+	}
+
+	// Counting sort of the pairs into a compact per-cluster index list
+	cluster_ranges.assign(cluster_bounds.size(), glm::uvec2{0, 0});
+	for (auto &pair : cluster_light_pairs)
+	{
+		auto &range = cluster_ranges[pair.first];
+		if (range.y < max_lights_per_cluster)
+		{
+			++range.y;
+		}
+	}
+
+	uint32_t offset            = 0;
+	uint32_t occupied_clusters = 0;
+	for (auto &range : cluster_ranges)
+	{
+		range.x = offset;
+		offset += range.y;
+		occupied_clusters += range.y > 0 ? 1 : 0;
+		range.y = 0;
+	}
+
+	light_indices.resize(offset);
+	for (auto &pair : cluster_light_pairs)
+	{
+		auto &range = cluster_ranges[pair.first];
+		if (range.y < max_lights_per_cluster)
+		{
+			light_indices[range.x + range.y++] = pair.second;
+		}
+	}
+
+	average_lights_per_cluster = occupied_clusters > 0 ? static_cast<float>(offset) / occupied_clusters : 0.0f;
+}
+}        // namespace vkb
@@ -0,0 +1,199 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "buffer_pool.h"
+#include "common/glm_common.h"
+#include "core/shader_module.h"
+#include "rendering/subpass.h"
+
+namespace vkb
+{
+
+namespace core
+{
+template <vkb::BindingType bindingType>
+class CommandBuffer;
+using CommandBufferC = CommandBuffer<vkb::BindingType::C>;
+}        // namespace core
+
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC = RenderContext<vkb::BindingType::C>;
+}        // namespace rendering
+
+namespace sg
+{
+class Camera;
+class Light;
+}        // namespace sg
+
+/**
+ * @brief Uniform describing the cluster grid, shared by the light culling compute shader and the lighting shaders
+ */
+struct alignas(16) LightClusterUniform
+{
+	glm::mat4  view;
+	glm::mat4  inv_projection;
+	glm::uvec4 grid_size;            // xyz represents the number of clusters per axis, w represents the maximum number of lights per cluster
+	glm::vec4  cluster_scale;        // xy represents clusters per pixel, z and w represent the logarithmic depth slice scale and bias
+	glm::vec4  depth_range;          // x represents the near plane, y represents the far plane
+	glm::uvec4 light_count;          // x represents the number of clustered (point and spot) lights
+};
+
+enum class LightCullingMode
+{
+	CPU,
+	GPU
+};
+
+/**
+ * @brief Bins the point and spot lights of a scene into a view-space froxel grid
+ *
+ * The view frustum is split into grid_size.x * grid_size.y screen tiles and grid_size.z
+ * logarithmic depth slices. Every cluster stores an (offset, count) range into a light index
+ * list, so a fragment only evaluates the lights overlapping its cluster instead of every light
+ * of the scene. Directional lights affect every cluster and are left to the regular light uniform.
+ *
+ * Culling either runs on the CPU while updating (the reference implementation, producing a
+ * compact index list), or in the light_culling.comp compute shader, which writes up to
+ * max_lights_per_cluster indices at a fixed stride per cluster. Both produce the same layout.
+ *
+ * All buffers are allocated from the active RenderFrame, so update() is expected once per frame.
+ */
+class LightClusters
+{
+  public:
+	/**
+	 * @brief Number of clusters processed per workgroup of the culling compute shader
+	 */
+	static constexpr uint32_t CULLING_GROUP_SIZE = 64;
+
+	LightClusters(vkb::rendering::RenderContextC &render_context, const glm::uvec3 &grid_size = {16, 9, 24}, uint32_t max_lights_per_cluster = 256);
+
+	LightClusters(const LightClusters &) = delete;
+
+	LightClusters(LightClusters &&) = delete;
+
+	LightClusters &operator=(const LightClusters &) = delete;
+
+	LightClusters &operator=(LightClusters &&) = delete;
+
+	void set_culling_mode(LightCullingMode mode);
+
+	LightCullingMode get_culling_mode() const;
+
+	/**
+	 * @brief Restricts the clustered lights to a subset of the lights of the scene
+	 * @param lights Lights to cluster instead of the scene lights passed to update(), or empty to cluster the scene lights
+	 */
+	void set_lights(const std::vector<sg::Light *> &lights);
+
+	/**
+	 * @brief Gathers the point and spot lights of the scene, uploads them and, in LightCullingMode::CPU, bins them into clusters
+	 * @param scene_lights All of the light components from the scene graph, unless a subset was given to set_lights()
+	 * @param camera Camera the clusters are built for, it must be a sg::PerspectiveCamera
+	 * @param extent Extent of the render target, in pixels
+	 */
+	void update(const std::vector<sg::Light *> &scene_lights, sg::Camera &camera, const VkExtent2D &extent);
+
+	/**
+	 * @brief Records the culling dispatch, and the barrier making its results visible to fragment shaders
+	 *        Only does something in LightCullingMode::GPU. Must be recorded after update() and outside of a render pass.
+	 */
+	void record_culling(vkb::core::CommandBufferC &command_buffer);
+
+	/**
+	 * @brief Binds the cluster uniform, the light list, the cluster ranges and the light indices to four consecutive bindings
+	 */
+	void bind(vkb::core::CommandBufferC &command_buffer, uint32_t set, uint32_t first_binding);
+
+	/**
+	 * @return Shader definitions required by shaders including clustered_lighting.h
+	 */
+	std::vector<std::string> get_shader_definitions() const;
+
+	/**
+	 * @return The number of point and spot lights going through the clusters
+	 */
+	size_t get_light_count() const;
+
+	/**
+	 * @return Time spent binning lights on the CPU during the last update, in milliseconds
+	 */
+	double get_cpu_culling_time() const;
+
+	/**
+	 * @return Average number of lights per non-empty cluster after the last CPU culling
+	 */
+	float get_average_lights_per_cluster() const;
+
+  private:
+	void update_cluster_bounds(const glm::mat4 &inv_projection, float near_plane, float far_plane);
+
+	void cull_lights(const glm::mat4 &view);
+
+	vkb::rendering::RenderContextC &render_context;
+
+	glm::uvec3 grid_size;
+
+	uint32_t max_lights_per_cluster;
+
+	LightCullingMode culling_mode{LightCullingMode::CPU};
+
+	ShaderSource culling_shader;
+
+	LightClusterUniform cluster_uniform{};
+
+	/// Lights set with set_lights(), clustered instead of the scene lights if not empty
+	std::vector<sg::Light *> selected_lights;
+
+	std::vector<vkb::rendering::Light> clustered_lights;
+
+	/// Radius of influence of each clustered light
+	std::vector<float> light_radii;
+
+	/// View-space bounds of each cluster, min and max corners, valid for cluster_bounds_key
+	std::vector<std::pair<glm::vec3, glm::vec3>> cluster_bounds;
+
+	glm::vec4 cluster_bounds_key{0.0f};
+
+	glm::mat4 cluster_bounds_inv_projection{0.0f};
+
+	std::vector<glm::uvec2> cluster_ranges;
+
+	std::vector<uint32_t> light_indices;
+
+	/// (cluster, light) pairs found by the CPU culling, before being sorted per cluster
+	std::vector<std::pair<uint32_t, uint32_t>> cluster_light_pairs;
+
+	BufferAllocationC uniform_allocation;
+
+	BufferAllocationC lights_allocation;
+
+	BufferAllocationC ranges_allocation;
+
+	BufferAllocationC indices_allocation;
+
+	double cpu_culling_time{0.0};
+
+	float average_lights_per_cluster{0.0f};
+};
+}        // namespace vkb
@@ -122,6 +122,13 @@ void PostProcessingComputePass::transition_images(vkb::core::CommandBufferC &com
 				continue;
 			}
 
+			if (get_render_graph_image(sampled.second.get_render_target(), *attachment).is_valid())
+			{
+				// The render graph transitioned it already
+				sampled_rt->set_layout(*attachment, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+				continue;
+			}
+
 			vkb::ImageMemoryBarrier barrier;
 			barrier.old_layout      = sampled_rt->get_layout(*attachment);
 			barrier.new_layout      = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
@@ -148,6 +155,13 @@ void PostProcessingComputePass::transition_images(vkb::core::CommandBufferC &com
 				storage_rt = &default_render_target;
 			}
 
+			if (get_render_graph_image(storage.second.get_render_target(), *attachment).is_valid())
+			{
+				// The render graph transitioned it already, to the layout of a storage write
+				storage_rt->set_layout(*attachment, VK_IMAGE_LAYOUT_GENERAL);
+				continue;
+			}
+
 			// A storage image is either readonly or writeonly;
 			// use shader reflection to figure out which case, then transition
 			// NOTE: Could add a <name -> readonly?> cache to make this faster?
@@ -195,6 +209,34 @@ void PostProcessingComputePass::transition_images(vkb::core::CommandBufferC &com
 	}
 }
 
+void PostProcessingComputePass::declare_accesses(const RenderGraph &render_graph, RenderGraph::PassBuilder &builder)
+{
+	for (const auto &sampled : sampled_images)
+	{
+		if (const uint32_t *attachment = sampled.second.get_target_attachment())
+		{
+			auto image = get_render_graph_image(sampled.second.get_render_target(), *attachment);
+			if (image.is_valid())
+			{
+				builder.read(image, RenderGraphAccess::ComputeShaderSampled);
+			}
+		}
+	}
+
+	// Storage images may be read-only, but a render graph only knows them as storage writes
+	for (const auto &storage : storage_images)
+	{
+		if (const uint32_t *attachment = storage.second.get_target_attachment())
+		{
+			auto image = get_render_graph_image(storage.second.get_render_target(), *attachment);
+			if (image.is_valid())
+			{
+				builder.write(image, RenderGraphAccess::ComputeShaderStorageWrite);
+			}
+		}
+	}
+}
+
 void PostProcessingComputePass::draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target)
 {
 	transition_images(command_buffer, default_render_target);
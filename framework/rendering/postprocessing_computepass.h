@@ -47,6 +47,8 @@ class PostProcessingComputePass : public PostProcessingPass<PostProcessingComput
 	void prepare(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target) override;
 	void draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target) override;
 
+	void declare_accesses(const RenderGraph &render_graph, RenderGraph::PassBuilder &builder) override;
+
 	/**
 	 * @brief Sets the number of workgroups to be dispatched each draw().
 	 */
@@ -162,6 +164,7 @@ class PostProcessingComputePass : public PostProcessingPass<PostProcessingComput
 	/**
 	 * @brief Transitions sampled_images (to SHADER_READ_ONLY_OPTIMAL)
 	 *        and storage_images (to GENERAL) as appropriate.
+	 * @remarks Images synchronized by a render graph are not transitioned, only their layout is updated.
 	 */
 	void transition_images(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target);
 
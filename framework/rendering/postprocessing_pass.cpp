@@ -25,7 +25,7 @@ PostProcessingPassBase::PostProcessingPassBase(PostProcessingPipeline *parent) :
     parent{parent}
 {}
 
-RenderContext &PostProcessingPassBase::get_render_context() const
+vkb::rendering::RenderContextC &PostProcessingPassBase::get_render_context() const
 {
 	return *parent->render_context;
 }
@@ -35,6 +35,16 @@ ShaderSource &PostProcessingPassBase::get_triangle_vs() const
 	return parent->triangle_vs;
 }
 
+RenderGraphImage PostProcessingPassBase::get_render_graph_image(const RenderTarget *render_target, uint32_t attachment) const
+{
+	if (!parent->render_graph_images)
+	{
+		return {};
+	}
+
+	return parent->render_graph_images(render_target ? render_target : this->render_target, attachment);
+}
+
 PostProcessingPassBase::BarrierInfo PostProcessingPassBase::get_predecessor_src_barrier_info(BarrierInfo fallback) const
 {
 	const size_t cur_pass_i = parent->get_current_pass_index();
@@ -19,6 +19,7 @@
 
 #include "core/command_buffer.h"
 #include "render_context.h"
+#include "render_graph.h"
 #include "render_target.h"
 #include <functional>
 
@@ -63,6 +64,13 @@ class PostProcessingPassBase
 	virtual void draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target)
 	{}
 
+	/**
+	 * @brief Declares the render target attachments this pass reads and writes to a render graph,
+	 *        for the attachments PostProcessingPipeline::set_render_graph_images() maps to graph images.
+	 */
+	virtual void declare_accesses(const RenderGraph &render_graph, RenderGraph::PassBuilder &builder)
+	{}
+
 	/**
 	 * @brief A functor ran in the context of this renderpass.
 	 * @see set_pre_draw_func(), set_post_draw_func()
@@ -84,13 +92,19 @@ class PostProcessingPassBase
 	/**
 	 * @brief Returns the parent's render context.
 	 */
-	RenderContext &get_render_context() const;
+	vkb::rendering::RenderContextC &get_render_context() const;
 
 	/**
 	 * @brief Returns the parent's fullscreen triangle vertex shader source.
 	 */
 	ShaderSource &get_triangle_vs() const;
 
+	/**
+	 * @brief Returns the render graph image an attachment maps to, or an invalid handle if this pass synchronizes it itself.
+	 * @param render_target Render target of the attachment, nullptr for the one this pass renders to
+	 */
+	RenderGraphImage get_render_graph_image(const RenderTarget *render_target, uint32_t attachment) const;
+
 	struct BarrierInfo
 	{
 		VkPipelineStageFlags pipeline_stage;            // Pipeline stage of this pass' inputs/outputs
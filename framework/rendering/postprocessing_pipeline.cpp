@@ -21,49 +21,70 @@
 
 namespace vkb
 {
-PostProcessingPipeline::PostProcessingPipeline(RenderContext &render_context, ShaderSource triangle_vs) :
+PostProcessingPipeline::PostProcessingPipeline(vkb::rendering::RenderContextC &render_context, ShaderSource triangle_vs) :
     render_context{&render_context},
     triangle_vs{std::move(triangle_vs)}
 {}
 
 void PostProcessingPipeline::draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target)
 {
-	for (current_pass_index = 0; current_pass_index < passes.size(); current_pass_index++)
+	for (size_t pass_index = 0; pass_index < passes.size(); pass_index++)
 	{
-		auto &pass = *passes[current_pass_index];
+		draw_pass(command_buffer, default_render_target, pass_index);
+	}
+}
 
-		if (pass.debug_name.empty())
-		{
-			pass.debug_name = fmt::format("PPP pass #{}", current_pass_index);
-		}
-		ScopedDebugLabel marker{command_buffer, pass.debug_name.c_str()};
+void PostProcessingPipeline::draw_pass(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target, size_t pass_index)
+{
+	assert(pass_index < passes.size());
 
-		if (!pass.prepared)
-		{
-			ScopedDebugLabel marker{command_buffer, "Prepare"};
+	// Passes look at the current index to find their predecessor and whether they are the last one
+	current_pass_index = pass_index;
 
-			pass.prepare(command_buffer, default_render_target);
-			pass.prepared = true;
-		}
+	auto &pass = *passes[current_pass_index];
 
-		if (pass.pre_draw)
-		{
-			ScopedDebugLabel marker{command_buffer, "Pre-draw"};
+	if (pass.debug_name.empty())
+	{
+		pass.debug_name = fmt::format("PPP pass #{}", current_pass_index);
+	}
+	ScopedDebugLabel marker{command_buffer, pass.debug_name.c_str()};
 
-			pass.pre_draw();
-		}
+	if (!pass.prepared)
+	{
+		ScopedDebugLabel marker{command_buffer, "Prepare"};
 
-		pass.draw(command_buffer, default_render_target);
+		pass.prepare(command_buffer, default_render_target);
+		pass.prepared = true;
+	}
 
-		if (pass.post_draw)
-		{
-			ScopedDebugLabel marker{command_buffer, "Post-draw"};
+	if (pass.pre_draw)
+	{
+		ScopedDebugLabel marker{command_buffer, "Pre-draw"};
 
-			pass.post_draw();
-		}
+		pass.pre_draw();
+	}
+
+	pass.draw(command_buffer, default_render_target);
+
+	if (pass.post_draw)
+	{
+		ScopedDebugLabel marker{command_buffer, "Post-draw"};
+
+		pass.post_draw();
 	}
 
 	current_pass_index = 0;
 }
 
+void PostProcessingPipeline::set_render_graph_images(RenderGraphImageMap &&image_map)
+{
+	render_graph_images = std::move(image_map);
+}
+
+void PostProcessingPipeline::declare_pass(const RenderGraph &render_graph, RenderGraph::PassBuilder &builder, size_t pass_index)
+{
+	assert(pass_index < passes.size());
+	passes[pass_index]->declare_accesses(render_graph, builder);
+}
+
 }        // namespace vkb
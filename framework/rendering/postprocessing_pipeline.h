@@ -23,6 +23,13 @@ namespace vkb
 {
 class PostProcessingRenderPass;
 
+/**
+ * @brief Maps an attachment of a render target to the render graph image it is, or to an invalid handle
+ *        if the pipeline keeps synchronizing it itself (e.g. the swapchain image).
+ *        A null render target stands for the default render target passed to draw().
+ */
+using RenderGraphImageMap = std::function<RenderGraphImage(const RenderTarget *render_target, uint32_t attachment)>;
+
 /**
  * @brief A rendering pipeline specialized for fullscreen post-processing and compute passes.
  */
@@ -34,7 +41,7 @@ class PostProcessingPipeline
 	/**
 	 * @brief Creates a rendering pipeline entirely made of fullscreen post-processing subpasses.
 	 */
-	PostProcessingPipeline(RenderContext &render_context, ShaderSource triangle_vs);
+	PostProcessingPipeline(vkb::rendering::RenderContextC &render_context, ShaderSource triangle_vs);
 
 	PostProcessingPipeline(const PostProcessingPipeline &to_copy)            = delete;
 	PostProcessingPipeline &operator=(const PostProcessingPipeline &to_copy) = delete;
@@ -51,6 +58,24 @@ class PostProcessingPipeline
 	 */
 	void draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target);
 
+	/**
+	 * @brief Runs a single pass of this pipeline, e.g. as the execute function of a render graph pass.
+	 * @remarks Like draw(), the renderpass of the last pass is left open.
+	 */
+	void draw_pass(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target, size_t pass_index);
+
+	/**
+	 * @brief Hands the synchronization of the attachments the map resolves over to a render graph.
+	 *        The passes no longer record barriers for them, and expect them in the layout of the access they declare.
+	 * @remarks An empty map makes the passes synchronize every attachment again.
+	 */
+	void set_render_graph_images(RenderGraphImageMap &&image_map);
+
+	/**
+	 * @brief Declares the accesses of the pass at pass_index to a render graph, see set_render_graph_images().
+	 */
+	void declare_pass(const RenderGraph &render_graph, RenderGraph::PassBuilder &builder, size_t pass_index);
+
 	/**
 	 * @brief Gets all of the passes in the pipeline.
 	 */
@@ -82,7 +107,7 @@ class PostProcessingPipeline
 	/**
 	 * @brief Returns the current render context.
 	 */
-	inline RenderContext &get_render_context() const
+	inline vkb::rendering::RenderContextC &get_render_context() const
 	{
 		return *render_context;
 	}
@@ -96,10 +121,11 @@ class PostProcessingPipeline
 	}
 
   private:
-	RenderContext                                       *render_context{nullptr};
+	vkb::rendering::RenderContextC                      *render_context{nullptr};
 	ShaderSource                                         triangle_vs;
 	std::vector<std::unique_ptr<PostProcessingPassBase>> passes{};
 	size_t                                               current_pass_index{0};
+	RenderGraphImageMap                                  render_graph_images{};
 };
 
 }        // namespace vkb
\ No newline at end of file
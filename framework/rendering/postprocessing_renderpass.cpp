@@ -24,7 +24,7 @@ namespace vkb
 constexpr uint32_t DEPTH_RESOLVE_BITMASK = 0x80000000;
 constexpr uint32_t ATTACHMENT_BITMASK    = 0x7FFFFFFF;
 
-PostProcessingSubpass::PostProcessingSubpass(PostProcessingRenderPass *parent, RenderContext &render_context, ShaderSource &&triangle_vs,
+PostProcessingSubpass::PostProcessingSubpass(PostProcessingRenderPass *parent, vkb::rendering::RenderContextC &render_context, ShaderSource &&triangle_vs,
                                              ShaderSource &&fs, ShaderVariant &&fs_variant) :
     Subpass(render_context, std::move(triangle_vs), std::move(fs)),
     parent{parent},
@@ -354,6 +354,13 @@ void PostProcessingRenderPass::transition_attachments(const AttachmentSet
 			continue;
 		}
 
+		if (get_render_graph_image(nullptr, input).is_valid())
+		{
+			// The render graph transitioned it already
+			render_target.set_layout(input, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+			continue;
+		}
+
 		ensure_src_access(prev_pass_barrier_info.image_write_access, prev_pass_barrier_info.pipeline_stage,
 		                  prev_layout);
 
@@ -386,6 +393,13 @@ void PostProcessingRenderPass::transition_attachments(const AttachmentSet
 			continue;
 		}
 
+		if (get_render_graph_image(sampled.first, attachment).is_valid())
+		{
+			// The render graph transitioned it already
+			sampled_rt->set_layout(attachment, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+			continue;
+		}
+
 		if (prev_layout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
 		{
 			// Synchronize with previous pass writes as barrier below might do image transition
@@ -431,6 +445,13 @@ void PostProcessingRenderPass::transition_attachments(const AttachmentSet
 			continue;
 		}
 
+		if (get_render_graph_image(nullptr, output).is_valid())
+		{
+			// The render graph transitioned it already
+			render_target.set_layout(output, output_layout);
+			continue;
+		}
+
 		vkb::ImageMemoryBarrier barrier;
 		barrier.old_layout      = VK_IMAGE_LAYOUT_UNDEFINED;        // = don't care about previous contents
 		barrier.new_layout      = output_layout;
@@ -456,12 +477,10 @@ void PostProcessingRenderPass::transition_attachments(const AttachmentSet
 	//       so we don't want to transition them to UNDEFINED layout here
 }
 
-void PostProcessingRenderPass::prepare_draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &fallback_render_target)
+void PostProcessingRenderPass::collect_attachments(AttachmentSet        &input_attachments,
+                                                   SampledAttachmentSet &sampled_attachments,
+                                                   AttachmentSet        &output_attachments)
 {
-	// Collect all input, output, and sampled-from attachments from all subpasses (steps)
-	AttachmentSet        input_attachments, output_attachments;
-	SampledAttachmentSet sampled_attachments;
-
 	for (auto &step_ptr : pipeline.get_subpasses())
 	{
 		auto &step = *dynamic_cast<PostProcessingSubpass *>(step_ptr.get());
@@ -493,6 +512,13 @@ void PostProcessingRenderPass::prepare_draw(vkb::core::CommandBufferC &command_b
 			output_attachments.insert(it);
 		}
 	}
+}
+
+void PostProcessingRenderPass::prepare_draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &fallback_render_target)
+{
+	AttachmentSet        input_attachments, output_attachments;
+	SampledAttachmentSet sampled_attachments;
+	collect_attachments(input_attachments, sampled_attachments, output_attachments);
 
 	transition_attachments(input_attachments, sampled_attachments, output_attachments,
 	                       command_buffer, fallback_render_target);
@@ -500,6 +526,42 @@ void PostProcessingRenderPass::prepare_draw(vkb::core::CommandBufferC &command_b
 	                   fallback_render_target);
 }
 
+void PostProcessingRenderPass::declare_accesses(const RenderGraph &render_graph, RenderGraph::PassBuilder &builder)
+{
+	AttachmentSet        input_attachments, output_attachments;
+	SampledAttachmentSet sampled_attachments;
+	collect_attachments(input_attachments, sampled_attachments, output_attachments);
+
+	for (uint32_t input : input_attachments)
+	{
+		auto image = get_render_graph_image(nullptr, input);
+		if (image.is_valid())
+		{
+			builder.read(image, RenderGraphAccess::FragmentShaderInputAttachment);
+		}
+	}
+
+	for (const auto &sampled : sampled_attachments)
+	{
+		auto image = get_render_graph_image(sampled.first, sampled.second & ATTACHMENT_BITMASK);
+		if (image.is_valid())
+		{
+			builder.read(image, RenderGraphAccess::FragmentShaderSampled);
+		}
+	}
+
+	for (uint32_t output : output_attachments)
+	{
+		auto image = get_render_graph_image(nullptr, output);
+		if (image.is_valid())
+		{
+			builder.write(image, vkb::is_depth_format(render_graph.get_image_desc(image).format) ?
+			                         RenderGraphAccess::DepthStencilAttachmentWrite :
+			                         RenderGraphAccess::ColorAttachmentWrite);
+		}
+	}
+}
+
 void PostProcessingRenderPass::draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target)
 {
 	prepare_draw(command_buffer, default_render_target);
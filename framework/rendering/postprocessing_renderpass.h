@@ -71,7 +71,7 @@ class PostProcessingRenderPass;
 class PostProcessingSubpass : public vkb::rendering::SubpassC
 {
   public:
-	PostProcessingSubpass(PostProcessingRenderPass *parent, RenderContext &render_context, ShaderSource &&triangle_vs,
+	PostProcessingSubpass(PostProcessingRenderPass *parent, vkb::rendering::RenderContextC &render_context, ShaderSource &&triangle_vs,
 	                      ShaderSource &&fs, ShaderVariant &&fs_variant = {});
 
 	PostProcessingSubpass(const PostProcessingSubpass &to_copy)            = delete;
@@ -231,6 +231,8 @@ class PostProcessingRenderPass : public PostProcessingPass<PostProcessingRenderP
 
 	void draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &default_render_target) override;
 
+	void declare_accesses(const RenderGraph &render_graph, RenderGraph::PassBuilder &builder) override;
+
 	/**
 	 * @brief Gets the step at the given index.
 	 */
@@ -284,8 +286,16 @@ class PostProcessingRenderPass : public PostProcessingPass<PostProcessingRenderP
 	// An attachment sampled from a rendertarget
 	using SampledAttachmentSet = std::unordered_set<std::pair<RenderTarget *, uint32_t>, PairHasher>;
 
+	/**
+	 * @brief Collect all input, output, and sampled-from attachments from all subpasses (steps).
+	 */
+	void collect_attachments(AttachmentSet        &input_attachments,
+	                         SampledAttachmentSet &sampled_attachments,
+	                         AttachmentSet        &output_attachments);
+
 	/**
 	 * @brief Transition input, sampled and output attachments as appropriate.
+	 * @remarks Attachments synchronized by a render graph are not transitioned, only their layout is updated.
 	 * @remarks If a RenderTarget is not explicitly set for this pass, fallback_render_target is used.
 	 */
 	void transition_attachments(const AttachmentSet        &input_attachments,
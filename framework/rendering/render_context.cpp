@@ -17,20 +17,36 @@
 
 #include "render_context.h"
 
+#include "core/hpp_image.h"
+#include "core/hpp_queue.h"
+#include "memory_budget_tracker.h"
 #include "platform/window.h"
+#include "timer.h"
 
 namespace vkb
 {
-VkFormat RenderContext::DEFAULT_VK_FORMAT = VK_FORMAT_R8G8B8A8_SRGB;
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::FormatType RenderContext<bindingType>::DEFAULT_VK_FORMAT = static_cast<FormatType>(VK_FORMAT_R8G8B8A8_SRGB);
+
+template <vkb::BindingType bindingType>
+uint32_t RenderContext<bindingType>::OFFSCREEN_FRAME_COUNT = 3;
 
-RenderContext::RenderContext(Device                                &device,
-                             VkSurfaceKHR                           surface,
-                             const Window                          &window,
-                             VkPresentModeKHR                       present_mode,
-                             const std::vector<VkPresentModeKHR>   &present_mode_priority_list,
-                             const std::vector<VkSurfaceFormatKHR> &surface_format_priority_list) :
-    device{device}, window{window}, queue{device.get_suitable_graphics_queue()}, surface_extent{window.get_extent().width, window.get_extent().height}
+template <vkb::BindingType bindingType>
+RenderContext<bindingType>::RenderContext(DeviceType                           &device_,
+                                          SurfaceType                           surface_,
+                                          const Window                         &window,
+                                          PresentModeType                       present_mode_,
+                                          const std::vector<PresentModeType>   &present_mode_priority_list_,
+                                          const std::vector<SurfaceFormatType> &surface_format_priority_list_) :
+    device{reinterpret_cast<Device &>(device_)}, window{window}, queue{device.get_suitable_graphics_queue()}, surface_extent{window.get_extent().width, window.get_extent().height}
 {
+	auto  surface                      = static_cast<VkSurfaceKHR>(surface_);
+	auto  present_mode                 = static_cast<VkPresentModeKHR>(present_mode_);
+	auto &present_mode_priority_list   = reinterpret_cast<const std::vector<VkPresentModeKHR> &>(present_mode_priority_list_);
+	auto &surface_format_priority_list = reinterpret_cast<const std::vector<VkSurfaceFormatKHR> &>(surface_format_priority_list_);
+
 	if (surface != VK_NULL_HANDLE)
 	{
 		VkSurfaceCapabilitiesKHR surface_properties;
@@ -47,10 +63,30 @@ RenderContext::RenderContext(Device                                &device,
 			swapchain = std::make_unique<Swapchain>(device, surface, present_mode, present_mode_priority_list, surface_format_priority_list);
 		}
 	}
+
+	bool present_wait = device.is_enabled(VK_KHR_PRESENT_ID_EXTENSION_NAME) && device.is_enabled(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+	frame_pacer       = std::make_unique<FramePacer>(device.get_handle(), present_wait);
+
+	timeline_synchronization = device.is_enabled(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
 }
 
-void RenderContext::prepare(size_t thread_count, RenderTarget::CreateFunc create_render_target_func)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::prepare(size_t thread_count, typename RenderTargetType::CreateFunc create_render_target_func_)
 {
+	RenderTarget::CreateFunc create_render_target_func;
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		// The render targets of both bindings share their layout, so the frames are created from the vulkan.hpp delegate
+		create_render_target_func = [create_render_target_func_](core::Image &&image) {
+			return std::unique_ptr<RenderTarget>(
+			    reinterpret_cast<RenderTarget *>(create_render_target_func_(std::move(reinterpret_cast<vkb::core::HPPImage &>(image))).release()));
+		};
+	}
+	else
+	{
+		create_render_target_func = create_render_target_func_;
+	}
+
 	device.wait_idle();
 
 	if (swapchain)
@@ -67,22 +103,25 @@ void RenderContext::prepare(size_t thread_count, RenderTarget::CreateFunc create
 			    swapchain->get_format(),
 			    swapchain->get_usage()};
 			auto render_target = create_render_target_func(std::move(swapchain_image));
-			frames.emplace_back(std::make_unique<RenderFrame>(device, std::move(render_target), thread_count));
+			frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameC>(device, std::move(render_target), thread_count));
 		}
 	}
 	else
 	{
-		// Otherwise, create a single RenderFrame
+		// Otherwise, create a ring of RenderFrames rendering to offscreen images
 		swapchain = nullptr;
 
-		auto color_image = core::Image{device,
-		                               VkExtent3D{surface_extent.width, surface_extent.height, 1},
-		                               DEFAULT_VK_FORMAT,        // We can use any format here that we like
-		                               VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
-		                               VMA_MEMORY_USAGE_GPU_ONLY};
-
-		auto render_target = create_render_target_func(std::move(color_image));
-		frames.emplace_back(std::make_unique<RenderFrame>(device, std::move(render_target), thread_count));
+		for (uint32_t i = 0; i < std::max(OFFSCREEN_FRAME_COUNT, 1u); i++)
+		{
+			auto color_image = core::Image{device,
+			                               VkExtent3D{surface_extent.width, surface_extent.height, 1},
+			                               static_cast<VkFormat>(DEFAULT_VK_FORMAT),        // We can use any format here that we like
+			                               VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+			                               VMA_MEMORY_USAGE_GPU_ONLY};
+
+			auto render_target = create_render_target_func(std::move(color_image));
+			frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameC>(device, std::move(render_target), thread_count));
+		}
 	}
 
 	this->create_render_target_func = create_render_target_func;
@@ -90,20 +129,30 @@ void RenderContext::prepare(size_t thread_count, RenderTarget::CreateFunc create
 	this->prepared                  = true;
 }
 
-VkFormat RenderContext::get_format() const
+template <vkb::BindingType bindingType>
+size_t RenderContext<bindingType>::get_thread_count() const
 {
-	VkFormat format = DEFAULT_VK_FORMAT;
+	return thread_count;
+}
+
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::FormatType RenderContext<bindingType>::get_format() const
+{
+	VkFormat format = static_cast<VkFormat>(DEFAULT_VK_FORMAT);
 
 	if (swapchain)
 	{
 		format = swapchain->get_format();
 	}
 
-	return format;
+	return static_cast<FormatType>(format);
 }
 
-void RenderContext::update_swapchain(const VkExtent2D &extent)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::update_swapchain(const Extent2DType &extent_)
 {
+	auto &extent = reinterpret_cast<const VkExtent2D &>(extent_);
+
 	if (!swapchain)
 	{
 		LOGW("Can't update the swapchains extent. No swapchain, offscreen rendering detected, skipping.");
@@ -117,7 +166,8 @@ void RenderContext::update_swapchain(const VkExtent2D &extent)
 	recreate();
 }
 
-void RenderContext::update_swapchain(const uint32_t image_count)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::update_swapchain(const uint32_t image_count)
 {
 	if (!swapchain)
 	{
@@ -134,8 +184,15 @@ void RenderContext::update_swapchain(const uint32_t image_count)
 	recreate();
 }
 
-void RenderContext::update_swapchain(const std::set<VkImageUsageFlagBits> &image_usage_flags)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::update_swapchain(const std::set<ImageUsageFlagBitsType> &image_usage_flags_)
 {
+	std::set<VkImageUsageFlagBits> image_usage_flags;
+	for (auto flag : image_usage_flags_)
+	{
+		image_usage_flags.insert(static_cast<VkImageUsageFlagBits>(flag));
+	}
+
 	if (!swapchain)
 	{
 		LOGW("Can't update the swapchains image usage. No swapchain, offscreen rendering detected, skipping.");
@@ -149,8 +206,12 @@ void RenderContext::update_swapchain(const std::set<VkImageUsageFlagBits> &image
 	recreate();
 }
 
-void RenderContext::update_swapchain(const VkExtent2D &extent, const VkSurfaceTransformFlagBitsKHR transform)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::update_swapchain(const Extent2DType &extent_, const SurfaceTransformFlagBitsType transform_)
 {
+	auto &extent    = reinterpret_cast<const VkExtent2D &>(extent_);
+	auto  transform = static_cast<VkSurfaceTransformFlagBitsKHR>(transform_);
+
 	if (!swapchain)
 	{
 		LOGW("Can't update the swapchains extent and surface transform. No swapchain, offscreen rendering detected, skipping.");
@@ -175,8 +236,12 @@ void RenderContext::update_swapchain(const VkExtent2D &extent, const VkSurfaceTr
 	recreate();
 }
 
-void RenderContext::update_swapchain(const VkImageCompressionFlagsEXT compression, const VkImageCompressionFixedRateFlagsEXT compression_fixed_rate)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::update_swapchain(const ImageCompressionFlagsType compression_, const ImageCompressionFixedRateFlagsType compression_fixed_rate_)
 {
+	auto compression            = static_cast<VkImageCompressionFlagsEXT>(compression_);
+	auto compression_fixed_rate = static_cast<VkImageCompressionFixedRateFlagsEXT>(compression_fixed_rate_);
+
 	if (!swapchain)
 	{
 		LOGW("Can't update the swapchains compression. No swapchain, offscreen rendering detected, skipping.");
@@ -190,7 +255,8 @@ void RenderContext::update_swapchain(const VkImageCompressionFlagsEXT compressio
 	recreate();
 }
 
-void RenderContext::recreate()
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::recreate()
 {
 	LOGI("Recreated swapchain");
 
@@ -215,7 +281,7 @@ void RenderContext::recreate()
 		else
 		{
 			// Create a new frame if the new swapchain has more images than current frames
-			frames.emplace_back(std::make_unique<RenderFrame>(device, std::move(render_target), thread_count));
+			frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameC>(device, std::move(render_target), thread_count));
 		}
 
 		++frame_it;
@@ -224,7 +290,8 @@ void RenderContext::recreate()
 	device.get_resource_cache().clear_framebuffers();
 }
 
-bool RenderContext::handle_surface_changes(bool force_update)
+template <vkb::BindingType bindingType>
+bool RenderContext<bindingType>::handle_surface_changes(bool force_update)
 {
 	if (!swapchain)
 	{
@@ -262,7 +329,8 @@ bool RenderContext::handle_surface_changes(bool force_update)
 	return false;
 }
 
-vkb::core::CommandBufferC &RenderContext::begin(vkb::CommandBufferResetMode reset_mode)
+template <vkb::BindingType bindingType>
+vkb::core::CommandBuffer<bindingType> &RenderContext<bindingType>::begin(vkb::CommandBufferResetMode reset_mode)
 {
 	assert(prepared && "RenderContext not prepared for rendering, call prepare()");
 
@@ -277,15 +345,17 @@ vkb::core::CommandBufferC &RenderContext::begin(vkb::CommandBufferResetMode rese
 	}
 
 	const auto &queue = device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
-	return get_active_frame().request_command_buffer(queue, reset_mode);
+	return reinterpret_cast<vkb::core::CommandBuffer<bindingType> &>(frames[active_frame_index]->request_command_buffer(queue, reset_mode));
 }
 
-void RenderContext::submit(vkb::core::CommandBufferC &command_buffer)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::submit(vkb::core::CommandBuffer<bindingType> &command_buffer)
 {
 	submit({&command_buffer});
 }
 
-void RenderContext::submit(const std::vector<vkb::core::CommandBufferC *> &command_buffers)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::submit(const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers)
 {
 	assert(frame_active && "RenderContext is inactive, cannot submit command buffer. Please call begin()");
 
@@ -294,17 +364,19 @@ void RenderContext::submit(const std::vector<vkb::core::CommandBufferC *> &comma
 	if (swapchain)
 	{
 		assert(acquired_semaphore && "We do not have acquired_semaphore, it was probably consumed?\n");
-		render_semaphore = submit(queue, command_buffers, acquired_semaphore, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+		render_semaphore = static_cast<VkSemaphore>(submit(reinterpret_cast<const QueueType &>(queue), command_buffers, static_cast<SemaphoreType>(acquired_semaphore),
+		                                                   static_cast<PipelineStageFlagsType>(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT)));
 	}
 	else
 	{
-		submit(queue, command_buffers);
+		submit(reinterpret_cast<const QueueType &>(queue), command_buffers);
 	}
 
-	end_frame(render_semaphore);
+	end_frame(static_cast<SemaphoreType>(render_semaphore));
 }
 
-void RenderContext::begin_frame()
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::begin_frame()
 {
 	// Only handle surface changes if a swapchain exists
 	if (swapchain)
@@ -314,6 +386,9 @@ void RenderContext::begin_frame()
 
 	assert(!frame_active && "Frame is still active, please call end_frame");
 
+	frame_pacer->begin_frame(swapchain ? swapchain->get_handle() : VK_NULL_HANDLE,
+	                         [this](uint32_t frame_index, uint32_t timeout) { return frames[frame_index]->wait(timeout) == VK_SUCCESS; });
+
 	assert(active_frame_index < frames.size());
 	auto &prev_frame = *frames[active_frame_index];
 
@@ -350,28 +425,54 @@ void RenderContext::begin_frame()
 			return;
 		}
 	}
+	else
+	{
+		// Without a swapchain the offscreen frames are simply used in turn
+		active_frame_index = (active_frame_index + 1) % to_u32(frames.size());
+	}
 
 	// Now the frame is active again
 	frame_active = true;
 
+	// Refresh the heap budgets first, so that the resources of the frame respond to the memory pressure when recycled
+	MemoryBudgetTracker::get().update();
+
 	// Wait on all resource to be freed from the previous render to this frame
 	wait_frame();
+
+	// Pipelines optimized in the background are swapped in before recording, the frames in flight may still use the replaced ones
+	device.get_resource_cache().update_pipelines(to_u32(frames.size()));
 }
 
-VkSemaphore RenderContext::submit(const Queue                                    &queue,
-                                  const std::vector<vkb::core::CommandBufferC *> &command_buffers,
-                                  VkSemaphore                                     wait_semaphore,
-                                  VkPipelineStageFlags                            wait_pipeline_stage)
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::SemaphoreType RenderContext<bindingType>::submit(const QueueType                                             &queue_,
+                                                                                   const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers,
+                                                                                   SemaphoreType                                               wait_semaphore_,
+                                                                                   PipelineStageFlagsType                                      wait_pipeline_stage_)
 {
+	auto &queue               = reinterpret_cast<const Queue &>(queue_);
+	auto  wait_semaphore      = static_cast<VkSemaphore>(wait_semaphore_);
+	auto  wait_pipeline_stage = static_cast<VkPipelineStageFlags>(wait_pipeline_stage_);
+
 	std::vector<VkCommandBuffer> cmd_buf_handles(command_buffers.size(), VK_NULL_HANDLE);
 	std::transform(command_buffers.begin(),
 	               command_buffers.end(),
 	               cmd_buf_handles.begin(),
-	               [](const vkb::core::CommandBufferC *cmd_buf) { return cmd_buf->get_handle(); });
+	               [](const vkb::core::CommandBuffer<bindingType> *cmd_buf) { return static_cast<VkCommandBuffer>(cmd_buf->get_handle()); });
+
+	assert(frame_active && "Frame is not active, please call begin_frame");
+	vkb::rendering::RenderFrameC &frame = *frames[active_frame_index];
+
+	Timer sync_timer;
+	sync_timer.start();
 
-	RenderFrame &frame = get_active_frame();
+	// The binary semaphore is signaled alongside the timeline semaphore, for the presentation to wait on
+	std::array<VkSemaphore, 2> signal_semaphores{frame.request_semaphore(), VK_NULL_HANDLE};
+	std::array<uint64_t, 2>    signal_values{0, 0};
 
-	VkSemaphore signal_semaphore = frame.request_semaphore();
+	VkFence fence = request_frame_signal(queue, signal_semaphores[1], signal_values[1]);
+
+	sync_time += sync_timer.stop();
 
 	VkSubmitInfo submit_info{VK_STRUCTURE_TYPE_SUBMIT_INFO};
 
@@ -385,46 +486,192 @@ VkSemaphore RenderContext::submit(const Queue
 		submit_info.pWaitDstStageMask  = &wait_pipeline_stage;
 	}
 
-	submit_info.signalSemaphoreCount = 1;
-	submit_info.pSignalSemaphores    = &signal_semaphore;
+	submit_info.signalSemaphoreCount = timeline_synchronization ? 2 : 1;
+	submit_info.pSignalSemaphores    = signal_semaphores.data();
 
-	VkFence fence = frame.request_fence();
+	VkTimelineSemaphoreSubmitInfoKHR timeline_info{VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR};
+	if (timeline_synchronization)
+	{
+		timeline_info.signalSemaphoreValueCount = 2;
+		timeline_info.pSignalSemaphoreValues    = signal_values.data();
+		submit_info.pNext                       = &timeline_info;
+	}
 
 	VK_CHECK(queue.submit({submit_info}, fence));
 
-	return signal_semaphore;
+	return static_cast<SemaphoreType>(signal_semaphores[0]);
 }
 
-void RenderContext::submit(const Queue &queue, const std::vector<vkb::core::CommandBufferC *> &command_buffers)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::submit(const QueueType &queue_, const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers)
 {
+	auto &queue = reinterpret_cast<const Queue &>(queue_);
+
 	std::vector<VkCommandBuffer> cmd_buf_handles(command_buffers.size(), VK_NULL_HANDLE);
 	std::transform(command_buffers.begin(),
 	               command_buffers.end(),
 	               cmd_buf_handles.begin(),
-	               [](const vkb::core::CommandBufferC *cmd_buf) { return cmd_buf->get_handle(); });
+	               [](const vkb::core::CommandBuffer<bindingType> *cmd_buf) { return static_cast<VkCommandBuffer>(cmd_buf->get_handle()); });
+
+	Timer sync_timer;
+	sync_timer.start();
 
-	RenderFrame &frame = get_active_frame();
+	VkSemaphore timeline{VK_NULL_HANDLE};
+	uint64_t    value{0};
+	VkFence     fence = request_frame_signal(queue, timeline, value);
+
+	sync_time += sync_timer.stop();
 
 	VkSubmitInfo submit_info{VK_STRUCTURE_TYPE_SUBMIT_INFO};
 
 	submit_info.commandBufferCount = to_u32(cmd_buf_handles.size());
 	submit_info.pCommandBuffers    = cmd_buf_handles.data();
 
-	VkFence fence = frame.request_fence();
+	VkTimelineSemaphoreSubmitInfoKHR timeline_info{VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR};
+	if (timeline_synchronization)
+	{
+		timeline_info.signalSemaphoreValueCount = 1;
+		timeline_info.pSignalSemaphoreValues    = &value;
+		submit_info.signalSemaphoreCount        = 1;
+		submit_info.pSignalSemaphores           = &timeline;
+		submit_info.pNext                       = &timeline_info;
+	}
 
 	VK_CHECK(queue.submit({submit_info}, fence));
 }
 
-void RenderContext::wait_frame()
+template <vkb::BindingType bindingType>
+uint64_t RenderContext<bindingType>::submit_timeline(const QueueType                                             &queue_,
+                                                     const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers,
+                                                     const std::vector<TimelineWait>                            &waits,
+                                                     SemaphoreType                                              *present_semaphore)
 {
-	RenderFrame &frame = get_active_frame();
+	assert(timeline_synchronization && "Submitting with timeline values requires timeline synchronization");
+	assert(frame_active && "Frame is not active, please call begin_frame");
+
+	auto &queue = reinterpret_cast<const Queue &>(queue_);
+
+	std::vector<VkCommandBuffer> cmd_buf_handles(command_buffers.size(), VK_NULL_HANDLE);
+	std::transform(command_buffers.begin(),
+	               command_buffers.end(),
+	               cmd_buf_handles.begin(),
+	               [](const vkb::core::CommandBuffer<bindingType> *cmd_buf) { return static_cast<VkCommandBuffer>(cmd_buf->get_handle()); });
+
+	std::vector<VkSemaphore>          wait_semaphores;
+	std::vector<uint64_t>             wait_values;
+	std::vector<VkPipelineStageFlags> wait_stages;
+	for (auto &wait : waits)
+	{
+		// A timeline starts at 0, so there is nothing to wait for
+		if (wait.value == 0)
+		{
+			continue;
+		}
+
+		wait_semaphores.push_back(static_cast<VkSemaphore>(get_queue_timeline(*wait.queue).get_handle()));
+		wait_values.push_back(wait.value);
+		wait_stages.push_back(static_cast<VkPipelineStageFlags>(wait.stages));
+	}
+
+	Timer sync_timer;
+	sync_timer.start();
+
+	// The binary semaphores of the swapchain are signaled and waited for alongside the timeline semaphores
+	std::array<VkSemaphore, 2> signal_semaphores{VK_NULL_HANDLE, VK_NULL_HANDLE};
+	std::array<uint64_t, 2>    signal_values{0, 0};
+	request_frame_signal(queue, signal_semaphores[0], signal_values[0]);
+
+	VkSemaphore acquired = VK_NULL_HANDLE;
+	if (present_semaphore)
+	{
+		signal_semaphores[1] = frames[active_frame_index]->request_semaphore();
+		*present_semaphore   = static_cast<SemaphoreType>(signal_semaphores[1]);
+
+		acquired = std::exchange(acquired_semaphore, VK_NULL_HANDLE);
+		if (acquired != VK_NULL_HANDLE)
+		{
+			wait_semaphores.push_back(acquired);
+			wait_values.push_back(0);
+			wait_stages.push_back(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+		}
+	}
+
+	sync_time += sync_timer.stop();
+
+	VkTimelineSemaphoreSubmitInfoKHR timeline_info{VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR};
+	timeline_info.waitSemaphoreValueCount   = to_u32(wait_values.size());
+	timeline_info.pWaitSemaphoreValues      = wait_values.data();
+	timeline_info.signalSemaphoreValueCount = present_semaphore ? 2 : 1;
+	timeline_info.pSignalSemaphoreValues    = signal_values.data();
+
+	VkSubmitInfo submit_info{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+
+	submit_info.pNext                = &timeline_info;
+	submit_info.waitSemaphoreCount   = to_u32(wait_semaphores.size());
+	submit_info.pWaitSemaphores      = wait_semaphores.data();
+	submit_info.pWaitDstStageMask    = wait_stages.data();
+	submit_info.commandBufferCount   = to_u32(cmd_buf_handles.size());
+	submit_info.pCommandBuffers      = cmd_buf_handles.data();
+	submit_info.signalSemaphoreCount = timeline_info.signalSemaphoreValueCount;
+	submit_info.pSignalSemaphores    = signal_semaphores.data();
+
+	VK_CHECK(queue.submit({submit_info}, VK_NULL_HANDLE));
+
+	if (acquired != VK_NULL_HANDLE)
+	{
+		frames[active_frame_index]->release_owned_semaphore(acquired);
+	}
+
+	return signal_values[0];
+}
+
+template <vkb::BindingType bindingType>
+VkFence RenderContext<bindingType>::request_frame_signal(const Queue &queue, VkSemaphore &timeline, uint64_t &value)
+{
+	assert(frame_active && "Frame is not active, please call begin_frame");
+	vkb::rendering::RenderFrameC &frame = *frames[active_frame_index];
+
+	if (!timeline_synchronization)
+	{
+		return frame.request_fence();
+	}
+
+	auto &queue_timeline = reinterpret_cast<TimelineSemaphore &>(get_queue_timeline(reinterpret_cast<const QueueType &>(queue)));
+
+	timeline = queue_timeline.get_handle();
+	value    = queue_timeline.request_value();
+
+	frame.add_timeline_signal(timeline, value);
+
+	return VK_NULL_HANDLE;
+}
+
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::wait_frame()
+{
+	assert(frame_active && "Frame is not active, please call begin_frame");
+	vkb::rendering::RenderFrameC &frame = *frames[active_frame_index];
+
+	// Waiting for the GPU is not part of the synchronization overhead
+	VK_CHECK(frame.wait());
+
+	Timer sync_timer;
+	sync_timer.start();
+
 	frame.reset();
+
+	sync_time += sync_timer.stop();
 }
 
-void RenderContext::end_frame(VkSemaphore semaphore)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::end_frame(SemaphoreType semaphore_)
 {
+	auto semaphore = static_cast<VkSemaphore>(semaphore_);
+
 	assert(frame_active && "Frame is not active, please call begin_frame");
 
+	uint64_t present_id = frame_pacer->end_frame(active_frame_index, swapchain ? swapchain->get_handle() : VK_NULL_HANDLE);
+
 	if (swapchain)
 	{
 		VkSwapchainKHR vk_swapchain = swapchain->get_handle();
@@ -437,12 +684,22 @@ void RenderContext::end_frame(VkSemaphore semaphore)
 		present_info.pSwapchains        = &vk_swapchain;
 		present_info.pImageIndices      = &active_frame_index;
 
+		VkPresentIdKHR present_id_info{VK_STRUCTURE_TYPE_PRESENT_ID_KHR};
+		if (present_id != 0)
+		{
+			// Identify the presentation so that the frame pacer can wait for it
+			present_id_info.swapchainCount = 1;
+			present_id_info.pPresentIds    = &present_id;
+			present_info.pNext             = &present_id_info;
+		}
+
 		VkDisplayPresentInfoKHR disp_present_info{};
 		if (device.is_extension_supported(VK_KHR_DISPLAY_SWAPCHAIN_EXTENSION_NAME) &&
 		    window.get_display_present_info(&disp_present_info, surface_extent.width, surface_extent.height))
 		{
 			// Add display present info if supported and wanted
-			present_info.pNext = &disp_present_info;
+			disp_present_info.pNext = const_cast<void *>(present_info.pNext);
+			present_info.pNext      = &disp_present_info;
 		}
 
 		VkResult result = queue.present(present_info);
@@ -456,64 +713,138 @@ void RenderContext::end_frame(VkSemaphore semaphore)
 	// Frame is not active anymore
 	if (acquired_semaphore)
 	{
-		release_owned_semaphore(acquired_semaphore);
+		frames[active_frame_index]->release_owned_semaphore(acquired_semaphore);
 		acquired_semaphore = VK_NULL_HANDLE;
 	}
 	frame_active = false;
+
+	last_sync_time = sync_time;
+	sync_time      = 0.0;
 }
 
-VkSemaphore RenderContext::consume_acquired_semaphore()
+template <vkb::BindingType bindingType>
+FramePacer &RenderContext<bindingType>::get_frame_pacer()
+{
+	return *frame_pacer;
+}
+
+template <vkb::BindingType bindingType>
+const FramePacer &RenderContext<bindingType>::get_frame_pacer() const
+{
+	return *frame_pacer;
+}
+
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::set_timeline_synchronization(bool enable)
+{
+	assert(!frame_active && "Frame is still active, please call end_frame");
+
+	if (enable == timeline_synchronization)
+	{
+		return;
+	}
+
+	if (enable && !device.is_enabled(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+	{
+		LOGW("Timeline semaphores are not supported, frames stay synchronized with fences");
+		return;
+	}
+
+	// The submissions in flight were tracked by the previous mode
+	device.wait_idle();
+
+	timeline_synchronization = enable;
+}
+
+template <vkb::BindingType bindingType>
+bool RenderContext<bindingType>::uses_timeline_synchronization() const
+{
+	return timeline_synchronization;
+}
+
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::TimelineSemaphoreType &RenderContext<bindingType>::get_queue_timeline(const QueueType &queue_)
+{
+	auto &queue = reinterpret_cast<const Queue &>(queue_);
+
+	assert(timeline_synchronization && "Queue timelines are only available with timeline synchronization");
+
+	auto &queue_timeline = queue_timelines[queue.get_handle()];
+	if (!queue_timeline)
+	{
+		queue_timeline = std::make_unique<TimelineSemaphore>(device);
+	}
+
+	return reinterpret_cast<TimelineSemaphoreType &>(*queue_timeline);
+}
+
+template <vkb::BindingType bindingType>
+double RenderContext<bindingType>::get_sync_time() const
+{
+	return last_sync_time;
+}
+
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::SemaphoreType RenderContext<bindingType>::consume_acquired_semaphore()
 {
 	assert(frame_active && "Frame is not active, please call begin_frame");
 	auto sem           = acquired_semaphore;
 	acquired_semaphore = VK_NULL_HANDLE;
-	return sem;
+	return static_cast<SemaphoreType>(sem);
 }
 
-RenderFrame &RenderContext::get_active_frame()
+template <vkb::BindingType bindingType>
+RenderFrame<bindingType> &RenderContext<bindingType>::get_active_frame()
 {
 	assert(frame_active && "Frame is not active, please call begin_frame");
 	assert(active_frame_index < frames.size());
-	return *frames[active_frame_index];
+	return reinterpret_cast<RenderFrame<bindingType> &>(*frames[active_frame_index]);
 }
 
-uint32_t RenderContext::get_active_frame_index()
+template <vkb::BindingType bindingType>
+uint32_t RenderContext<bindingType>::get_active_frame_index()
 {
 	assert(frame_active && "Frame is not active, please call begin_frame");
 	return active_frame_index;
 }
 
-RenderFrame &RenderContext::get_last_rendered_frame()
+template <vkb::BindingType bindingType>
+RenderFrame<bindingType> &RenderContext<bindingType>::get_last_rendered_frame()
 {
 	assert(!frame_active && "Frame is still active, please call end_frame");
 	assert(active_frame_index < frames.size());
-	return *frames[active_frame_index];
+	return reinterpret_cast<RenderFrame<bindingType> &>(*frames[active_frame_index]);
 }
 
-VkSemaphore RenderContext::request_semaphore()
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::SemaphoreType RenderContext<bindingType>::request_semaphore()
 {
-	RenderFrame &frame = get_active_frame();
+	RenderFrame<bindingType> &frame = get_active_frame();
 	return frame.request_semaphore();
 }
 
-VkSemaphore RenderContext::request_semaphore_with_ownership()
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::SemaphoreType RenderContext<bindingType>::request_semaphore_with_ownership()
 {
-	RenderFrame &frame = get_active_frame();
+	RenderFrame<bindingType> &frame = get_active_frame();
 	return frame.request_semaphore_with_ownership();
 }
 
-void RenderContext::release_owned_semaphore(VkSemaphore semaphore)
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::release_owned_semaphore(SemaphoreType semaphore)
 {
-	RenderFrame &frame = get_active_frame();
+	RenderFrame<bindingType> &frame = get_active_frame();
 	frame.release_owned_semaphore(semaphore);
 }
 
-Device &RenderContext::get_device()
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::DeviceType &RenderContext<bindingType>::get_device()
 {
-	return device;
+	return reinterpret_cast<DeviceType &>(device);
 }
 
-void RenderContext::recreate_swapchain()
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::recreate_swapchain()
 {
 	device.wait_idle();
 	device.get_resource_cache().clear_framebuffers();
@@ -537,30 +868,52 @@ void RenderContext::recreate_swapchain()
 	}
 }
 
-bool RenderContext::has_swapchain()
+template <vkb::BindingType bindingType>
+bool RenderContext<bindingType>::has_swapchain()
 {
 	return swapchain != nullptr;
 }
 
-Swapchain const &RenderContext::get_swapchain() const
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::SwapchainType const &RenderContext<bindingType>::get_swapchain() const
 {
 	assert(swapchain && "Swapchain is not valid");
-	return *swapchain;
+	return reinterpret_cast<SwapchainType const &>(*swapchain);
 }
 
-VkExtent2D const &RenderContext::get_surface_extent() const
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::Extent2DType const &RenderContext<bindingType>::get_surface_extent() const
 {
-	return surface_extent;
+	return reinterpret_cast<Extent2DType const &>(surface_extent);
 }
 
-uint32_t RenderContext::get_active_frame_index() const
+template <vkb::BindingType bindingType>
+uint32_t RenderContext<bindingType>::get_active_frame_index() const
 {
 	return active_frame_index;
 }
 
-std::vector<std::unique_ptr<RenderFrame>> &RenderContext::get_render_frames()
+template <vkb::BindingType bindingType>
+void RenderContext<bindingType>::set_active_frame_index(uint32_t index)
+{
+	assert(!frame_active && "Frame is still active, please call end_frame");
+	assert(index < frames.size());
+	active_frame_index = index;
+}
+
+template <vkb::BindingType bindingType>
+typename RenderContext<bindingType>::ImageLayoutType RenderContext<bindingType>::get_final_layout() const
+{
+	return static_cast<ImageLayoutType>(swapchain ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+}
+
+template <vkb::BindingType bindingType>
+std::vector<std::unique_ptr<RenderFrame<bindingType>>> &RenderContext<bindingType>::get_render_frames()
 {
-	return frames;
+	return reinterpret_cast<std::vector<std::unique_ptr<RenderFrame<bindingType>>> &>(frames);
 }
 
+template class RenderContext<vkb::BindingType::C>;
+template class RenderContext<vkb::BindingType::Cpp>;
+}        // namespace rendering
 }        // namespace vkb
@@ -19,26 +19,27 @@
 
 #include "common/helpers.h"
 #include "common/vk_common.h"
-#include "core/command_buffer.h"
-#include "core/command_pool.h"
-#include "core/descriptor_set.h"
-#include "core/descriptor_set_layout.h"
-#include "core/framebuffer.h"
-#include "core/pipeline.h"
-#include "core/pipeline_layout.h"
-#include "core/queue.h"
-#include "core/render_pass.h"
-#include "core/shader_module.h"
+#include "core/hpp_swapchain.h"
 #include "core/swapchain.h"
-#include "rendering/pipeline_state.h"
+#include "hpp_timeline_semaphore.h"
+#include "rendering/frame_pacer.h"
 #include "rendering/render_frame.h"
 #include "rendering/render_target.h"
-#include "resource_cache.h"
+#include "timeline_semaphore.h"
 
 namespace vkb
 {
+class Device;
+class Queue;
 class Window;
 
+namespace core
+{
+class HPPQueue;
+}
+
+namespace rendering
+{
 /**
  * @brief RenderContext acts as a frame manager for the sample, with a lifetime that is the
  * same as that of the Application itself. It acts as a container for RenderFrame objects,
@@ -52,31 +53,61 @@ class Window;
  * swapchain. A RenderFrame will then be created for each Swapchain image.
  *
  * For offscreen rendering (no swapchain), the RenderContext can be given a valid Device, and
- * a width and height. A single RenderFrame will then be created.
+ * a width and height. OFFSCREEN_FRAME_COUNT RenderFrames will then be created, each rendering to
+ * its own offscreen image, and used in turn so that the CPU can record a frame while the GPU is
+ * still rendering the previous ones.
+ *
+ * Both bindings share a single implementation, working on the C types. The members are defined
+ * in render_context.cpp and explicitly instantiated for vkb::BindingType::C and vkb::BindingType::Cpp.
  */
+template <vkb::BindingType bindingType>
 class RenderContext
 {
   public:
+	using ColorSpaceType                     = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::ColorSpaceKHR, VkColorSpaceKHR>::type;
+	using Extent2DType                       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::Extent2D, VkExtent2D>::type;
+	using FormatType                         = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::Format, VkFormat>::type;
+	using ImageCompressionFixedRateFlagsType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::ImageCompressionFixedRateFlagsEXT, VkImageCompressionFixedRateFlagsEXT>::type;
+	using ImageCompressionFlagsType          = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::ImageCompressionFlagsEXT, VkImageCompressionFlagsEXT>::type;
+	using ImageLayoutType                    = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::ImageLayout, VkImageLayout>::type;
+	using ImageUsageFlagBitsType             = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::ImageUsageFlagBits, VkImageUsageFlagBits>::type;
+	using PipelineStageFlagsType             = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::PipelineStageFlags, VkPipelineStageFlags>::type;
+	using PresentModeType                    = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::PresentModeKHR, VkPresentModeKHR>::type;
+	using SemaphoreType                      = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::Semaphore, VkSemaphore>::type;
+	using SurfaceFormatType                  = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::SurfaceFormatKHR, VkSurfaceFormatKHR>::type;
+	using SurfaceTransformFlagBitsType       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::SurfaceTransformFlagBitsKHR, VkSurfaceTransformFlagBitsKHR>::type;
+	using SurfaceType                        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::SurfaceKHR, VkSurfaceKHR>::type;
+
+	using DeviceType            = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDevice, vkb::Device>::type;
+	using QueueType             = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPQueue, vkb::Queue>::type;
+	using RenderTargetType      = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPRenderTarget, vkb::RenderTarget>::type;
+	using SwapchainType         = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPSwapchain, vkb::Swapchain>::type;
+	using TimelineSemaphoreType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::HPPTimelineSemaphore, vkb::TimelineSemaphore>::type;
+
 	// The format to use for the RenderTargets if a swapchain isn't created
-	static VkFormat DEFAULT_VK_FORMAT;
+	static FormatType DEFAULT_VK_FORMAT;
+
+	// The number of RenderFrames to create if a swapchain isn't created
+	static uint32_t OFFSCREEN_FRAME_COUNT;
 
 	/**
 	 * @brief Constructor
 	 * @param device A valid device
-	 * @param surface A surface, VK_NULL_HANDLE if in offscreen mode
+	 * @param surface A surface, a null handle if in offscreen mode
 	 * @param window The window where the surface was created
 	 * @param present_mode Requests to set the present mode of the swapchain
 	 * @param present_mode_priority_list The order in which the swapchain prioritizes selecting its present mode
 	 * @param surface_format_priority_list The order in which the swapchain prioritizes selecting its surface format
 	 */
-	RenderContext(Device                                &device,
-	              VkSurfaceKHR                           surface,
-	              const Window                          &window,
-	              VkPresentModeKHR                       present_mode                 = VK_PRESENT_MODE_FIFO_KHR,
-	              const std::vector<VkPresentModeKHR>   &present_mode_priority_list   = {VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_MAILBOX_KHR},
-	              const std::vector<VkSurfaceFormatKHR> &surface_format_priority_list = {
-	                  {VK_FORMAT_R8G8B8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR},
-	                  {VK_FORMAT_B8G8R8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR}});
+	RenderContext(DeviceType                           &device,
+	              SurfaceType                           surface,
+	              const Window                         &window,
+	              PresentModeType                       present_mode                 = static_cast<PresentModeType>(VK_PRESENT_MODE_FIFO_KHR),
+	              const std::vector<PresentModeType>   &present_mode_priority_list   = {static_cast<PresentModeType>(VK_PRESENT_MODE_FIFO_KHR),
+	                                                                                    static_cast<PresentModeType>(VK_PRESENT_MODE_MAILBOX_KHR)},
+	              const std::vector<SurfaceFormatType> &surface_format_priority_list = {
+	                  {static_cast<FormatType>(VK_FORMAT_R8G8B8A8_SRGB), static_cast<ColorSpaceType>(VK_COLOR_SPACE_SRGB_NONLINEAR_KHR)},
+	                  {static_cast<FormatType>(VK_FORMAT_B8G8R8A8_SRGB), static_cast<ColorSpaceType>(VK_COLOR_SPACE_SRGB_NONLINEAR_KHR)}});
 
 	RenderContext(const RenderContext &) = delete;
 
@@ -93,13 +124,18 @@ class RenderContext
 	 * @param thread_count The number of threads in the application, necessary to allocate this many resource pools for each RenderFrame
 	 * @param create_render_target_func A function delegate, used to create a RenderTarget
 	 */
-	void prepare(size_t thread_count = 1, RenderTarget::CreateFunc create_render_target_func = RenderTarget::DEFAULT_CREATE_FUNC);
+	void prepare(size_t thread_count = 1, typename RenderTargetType::CreateFunc create_render_target_func = RenderTargetType::DEFAULT_CREATE_FUNC);
+
+	/**
+	 * @return The number of threads the RenderFrames have resource pools for
+	 */
+	size_t get_thread_count() const;
 
 	/**
 	 * @brief Updates the swapchains extent, if a swapchain exists
 	 * @param extent The width and height of the new swapchain images
 	 */
-	void update_swapchain(const VkExtent2D &extent);
+	void update_swapchain(const Extent2DType &extent);
 
 	/**
 	 * @brief Updates the swapchains image count, if a swapchain exists
@@ -111,21 +147,21 @@ class RenderContext
 	 * @brief Updates the swapchains image usage, if a swapchain exists
 	 * @param image_usage_flags The usage flags the new swapchain images will have
 	 */
-	void update_swapchain(const std::set<VkImageUsageFlagBits> &image_usage_flags);
+	void update_swapchain(const std::set<ImageUsageFlagBitsType> &image_usage_flags);
 
 	/**
 	 * @brief Updates the swapchains extent and surface transform, if a swapchain exists
 	 * @param extent The width and height of the new swapchain images
 	 * @param transform The surface transform flags
 	 */
-	void update_swapchain(const VkExtent2D &extent, const VkSurfaceTransformFlagBitsKHR transform);
+	void update_swapchain(const Extent2DType &extent, const SurfaceTransformFlagBitsType transform);
 
 	/**
 	 * @brief Updates the swapchain's compression settings, if a swapchain exists
 	 * @param compression The compression to use for swapchain images (default, fixed-rate, none)
 	 * @param compression_fixed_rate The rate to use, if compression is fixed-rate
 	 */
-	void update_swapchain(const VkImageCompressionFlagsEXT compression, const VkImageCompressionFixedRateFlagsEXT compression_fixed_rate);
+	void update_swapchain(const ImageCompressionFlagsType compression, const ImageCompressionFixedRateFlagsType compression_fixed_rate);
 
 	/**
 	 * @returns True if a valid swapchain exists in the RenderContext
@@ -148,48 +184,77 @@ class RenderContext
 	 * @returns A valid command buffer to record commands to be submitted
 	 * Also ensures that there is an active frame if there is no existing active frame already
 	 */
-	vkb::core::CommandBufferC &begin(vkb::CommandBufferResetMode reset_mode = vkb::CommandBufferResetMode::ResetPool);
+	vkb::core::CommandBuffer<bindingType> &begin(vkb::CommandBufferResetMode reset_mode = vkb::CommandBufferResetMode::ResetPool);
 
 	/**
 	 * @brief Submits the command buffer to the right queue
 	 * @param command_buffer A command buffer containing recorded commands
 	 */
-	void submit(vkb::core::CommandBufferC &command_buffer);
+	void submit(vkb::core::CommandBuffer<bindingType> &command_buffer);
 
 	/**
 	 * @brief Submits multiple command buffers to the right queue
 	 * @param command_buffers Command buffers containing recorded commands
 	 */
-	void submit(const std::vector<vkb::core::CommandBufferC *> &command_buffers);
+	void submit(const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers);
 
 	/**
 	 * @brief begin_frame
 	 */
 	void begin_frame();
 
-	VkSemaphore submit(const Queue                                    &queue,
-	                   const std::vector<vkb::core::CommandBufferC *> &command_buffers,
-	                   VkSemaphore                                     wait_semaphore,
-	                   VkPipelineStageFlags                            wait_pipeline_stage);
+	SemaphoreType submit(const QueueType                                             &queue,
+	                     const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers,
+	                     SemaphoreType                                               wait_semaphore,
+	                     PipelineStageFlagsType                                      wait_pipeline_stage);
 
 	/**
 	 * @brief Submits a command buffer related to a frame to a queue
 	 */
-	void submit(const Queue &queue, const std::vector<vkb::core::CommandBufferC *> &command_buffers);
+	void submit(const QueueType &queue, const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers);
+
+	/**
+	 * @brief A wait of a submission for a value of the timeline semaphore of a queue
+	 */
+	struct TimelineWait
+	{
+		const QueueType *queue;
+
+		/// Value returned by a previous call to @ref submit_timeline, 0 to skip the wait
+		uint64_t value;
+
+		/// The pipeline stages at which the value is waited for
+		PipelineStageFlagsType stages;
+	};
+
+	/**
+	 * @brief Submits command buffers related to a frame to a queue, once the submissions to other queues reached timeline values
+	 *        Only available with timeline synchronization
+	 * @param queue The queue to submit to
+	 * @param command_buffers Command buffers containing recorded commands
+	 * @param waits Values of the timeline semaphores of queues to wait for
+	 * @param present_semaphore If not null, the submission also waits for the swapchain image, if any, and signals a semaphore
+	 *        returned here, which @ref end_frame waits for
+	 * @return The value of the timeline semaphore of the queue signaled once the command buffers completed
+	 */
+	uint64_t submit_timeline(const QueueType                                             &queue,
+	                         const std::vector<vkb::core::CommandBuffer<bindingType> *> &command_buffers,
+	                         const std::vector<TimelineWait>                            &waits             = {},
+	                         SemaphoreType                                              *present_semaphore = nullptr);
 
 	/**
 	 * @brief Waits a frame to finish its rendering
 	 */
 	virtual void wait_frame();
 
-	void end_frame(VkSemaphore semaphore);
+	void end_frame(SemaphoreType semaphore);
 
 	/**
 	 * @brief An error should be raised if the frame is not active.
 	 *        A frame is active after @ref begin_frame has been called.
 	 * @return The current active frame
 	 */
-	RenderFrame &get_active_frame();
+	RenderFrame<bindingType> &get_active_frame();
 
 	/**
 	 * @brief An error should be raised if the frame is not active.
@@ -203,26 +268,41 @@ class RenderContext
 	 *        A frame is active after @ref begin_frame has been called.
 	 * @return The previous frame
 	 */
-	RenderFrame &get_last_rendered_frame();
+	RenderFrame<bindingType> &get_last_rendered_frame();
 
-	VkSemaphore request_semaphore();
-	VkSemaphore request_semaphore_with_ownership();
-	void        release_owned_semaphore(VkSemaphore semaphore);
+	SemaphoreType request_semaphore();
+	SemaphoreType request_semaphore_with_ownership();
+	void          release_owned_semaphore(SemaphoreType semaphore);
 
-	Device &get_device();
+	DeviceType &get_device();
 
 	/**
 	 * @brief Returns the format that the RenderTargets are created with within the RenderContext
 	 */
-	VkFormat get_format() const;
+	FormatType get_format() const;
 
-	Swapchain const &get_swapchain() const;
+	SwapchainType const &get_swapchain() const;
 
-	VkExtent2D const &get_surface_extent() const;
+	Extent2DType const &get_surface_extent() const;
 
 	uint32_t get_active_frame_index() const;
 
-	std::vector<std::unique_ptr<RenderFrame>> &get_render_frames();
+	/**
+	 * @brief Makes a frame the last rendered one, for samples which acquire and submit the frame images themselves
+	 *        instead of calling @ref begin_frame and @ref end_frame, so that readers of the last rendered frame,
+	 *        like screenshots, see the image the sample rendered to
+	 *        An error should be raised if a frame is active.
+	 * @param index The index of the swapchain image acquired, or of the offscreen image used
+	 */
+	void set_active_frame_index(uint32_t index);
+
+	/**
+	 * @return The layout the color image of a frame is left in once rendered: the present layout with a swapchain,
+	 *         and the transfer source layout of a copy otherwise, as offscreen images are never presented
+	 */
+	ImageLayoutType get_final_layout() const;
+
+	std::vector<std::unique_ptr<RenderFrame<bindingType>>> &get_render_frames();
 
 	/**
 	 * @brief Handles surface changes, only applicable if the render_context makes use of a swapchain
@@ -233,12 +313,49 @@ class RenderContext
 	 * @brief Returns the WSI acquire semaphore. Only to be used in very special circumstances.
 	 * @return The WSI acquire semaphore.
 	 */
-	VkSemaphore consume_acquired_semaphore();
+	SemaphoreType consume_acquired_semaphore();
+
+	/**
+	 * @brief Returns the frame pacer, which limits the frames in flight and measures their latency
+	 */
+	FramePacer &get_frame_pacer();
+
+	const FramePacer &get_frame_pacer() const;
+
+	/**
+	 * @brief Selects how the submissions of the frames are tracked: with a fence per submission, or with a timeline
+	 *        semaphore per queue whose values are signaled by the submissions, which needs VK_KHR_timeline_semaphore.
+	 *        Timeline synchronization is used by default when available. Waits for the device to be idle.
+	 */
+	void set_timeline_synchronization(bool enable);
+
+	bool uses_timeline_synchronization() const;
+
+	/**
+	 * @brief Returns the timeline semaphore signaled by the frame submissions to a queue
+	 *        Only available with timeline synchronization
+	 */
+	TimelineSemaphoreType &get_queue_timeline(const QueueType &queue);
+
+	/**
+	 * @return CPU time spent on the synchronization of the last frame in seconds, to request the synchronization
+	 *         objects of its submissions and to reset the frame once its previous submissions completed
+	 */
+	double get_sync_time() const;
 
   protected:
 	VkExtent2D surface_extent;
 
   private:
+	/**
+	 * @brief Requests the synchronization of a submission of the active frame to a queue
+	 * @param queue The queue submitted to
+	 * @param timeline Set to the timeline semaphore of the queue to signal with timeline synchronization
+	 * @param value Set to the value to signal with timeline synchronization
+	 * @return The fence to submit with, VK_NULL_HANDLE with timeline synchronization
+	 */
+	VkFence request_frame_signal(const Queue &queue, VkSemaphore &timeline, uint64_t &value);
+
 	Device &device;
 
 	const Window &window;
@@ -250,7 +367,7 @@ class RenderContext
 
 	SwapchainProperties swapchain_properties;
 
-	std::vector<std::unique_ptr<RenderFrame>> frames;
+	std::vector<std::unique_ptr<vkb::rendering::RenderFrameC>> frames;
 
 	VkSemaphore acquired_semaphore;
 
@@ -267,6 +384,41 @@ class RenderContext
 	VkSurfaceTransformFlagBitsKHR pre_transform{VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR};
 
 	size_t thread_count{1};
+
+	std::unique_ptr<FramePacer> frame_pacer;
+
+	/// Whether the submissions of the frames signal a timeline semaphore per queue instead of fences
+	bool timeline_synchronization{false};
+
+	std::unordered_map<VkQueue, std::unique_ptr<TimelineSemaphore>> queue_timelines;
+
+	/// CPU time spent on synchronization in the active frame
+	double sync_time{0.0};
+
+	/// CPU time spent on synchronization in the last frame
+	double last_sync_time{0.0};
 };
 
+using RenderContextC   = RenderContext<vkb::BindingType::C>;
+using RenderContextCpp = RenderContext<vkb::BindingType::Cpp>;
+}        // namespace rendering
 }        // namespace vkb
+
+#include "common/resource_caching.h"
+#include "core/command_buffer.h"
+#include "core/command_pool.h"
+#include "core/descriptor_set.h"
+#include "core/descriptor_set_layout.h"
+#include "core/device.h"
+#include "core/framebuffer.h"
+#include "core/image.h"
+#include "core/pipeline.h"
+#include "core/pipeline_layout.h"
+#include "core/query_pool.h"
+#include "core/queue.h"
+#include "core/render_pass.h"
+#include "core/shader_module.h"
+#include "fence_pool.h"
+#include "rendering/pipeline_state.h"
+#include "resource_cache.h"
+#include "semaphore_pool.h"
@@ -1,4 +1,5 @@
 /* Copyright (c) 2019-2025, Arm Limited and Contributors
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -15,86 +16,123 @@
  * limitations under the License.
  */
 
-#include "render_frame.h"
+#include "rendering/render_frame.h"
 
-#include "common/utils.h"
+#include "common/helpers.h"
+#include "common/hpp_resource_caching.h"
+#include "core/command_pool.h"
+#include "core/hpp_device.h"
+#include "core/hpp_queue.h"
 #include "core/util/logging.hpp"
+#include "rendering/render_target.h"
 
 namespace vkb
 {
-RenderFrame::RenderFrame(Device &device, std::unique_ptr<RenderTarget> &&render_target, size_t thread_count) :
-    device{device},
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+RenderFrame<bindingType>::RenderFrame(DeviceType &device_, std::unique_ptr<RenderTargetType> &&render_target, size_t thread_count) :
+    device{reinterpret_cast<vkb::core::HPPDevice &>(device_)},
     fence_pool{device},
     semaphore_pool{device},
-    swapchain_render_target{std::move(render_target)},
-    thread_count{thread_count}
+    thread_count{thread_count},
+    swapchain_render_target{std::move(render_target)}
 {
 	for (auto &usage_it : supported_usage_map)
 	{
-		std::vector<std::pair<BufferPoolC, BufferBlockC *>> usage_buffer_pools;
-		for (size_t i = 0; i < thread_count; ++i)
+		auto [buffer_pools_it, inserted] = buffer_pools.emplace(usage_it.first, std::vector<std::pair<vkb::BufferPoolCpp, vkb::BufferBlockCpp *>>{});
+		if (!inserted)
 		{
-			usage_buffer_pools.push_back(std::make_pair(BufferPoolC{device, BUFFER_POOL_BLOCK_SIZE * 1024 * usage_it.second, usage_it.first}, nullptr));
+			throw std::runtime_error("Failed to insert buffer pool");
 		}
 
-		auto res_ins_it = buffer_pools.emplace(usage_it.first, std::move(usage_buffer_pools));
-
-		if (!res_ins_it.second)
+		for (size_t i = 0; i < thread_count; ++i)
 		{
-			throw std::runtime_error("Failed to insert buffer pool");
+			buffer_pools_it->second.push_back(std::make_pair(vkb::BufferPoolCpp{device, BUFFER_POOL_BLOCK_SIZE * 1024 * usage_it.second, usage_it.first}, nullptr));
 		}
 	}
 
 	for (size_t i = 0; i < thread_count; ++i)
 	{
-		descriptor_pools.push_back(std::make_unique<std::unordered_map<std::size_t, DescriptorPool>>());
-		descriptor_sets.push_back(std::make_unique<std::unordered_map<std::size_t, DescriptorSet>>());
+		descriptor_pools.push_back(std::make_unique<std::unordered_map<std::size_t, vkb::core::HPPDescriptorPool>>());
+		descriptor_sets.push_back(std::make_unique<std::unordered_map<std::size_t, vkb::core::HPPDescriptorSet>>());
 	}
 }
 
-Device &RenderFrame::get_device()
-{
-	return device;
-}
+template <vkb::BindingType bindingType>
+RenderFrame<bindingType>::~RenderFrame() = default;
 
-void RenderFrame::update_render_target(std::unique_ptr<RenderTarget> &&render_target)
+template <vkb::BindingType bindingType>
+BufferAllocation<bindingType> RenderFrame<bindingType>::allocate_buffer(BufferUsageFlagsType usage, DeviceSizeType size, size_t thread_index)
 {
-	swapchain_render_target = std::move(render_target);
-}
+	assert(thread_index < thread_count && "Thread index is out of bounds");
 
-void RenderFrame::reset()
-{
-	VK_CHECK(fence_pool.wait());
+	// Find a pool for this usage
+	auto buffer_pool_it = buffer_pools.find(static_cast<vk::BufferUsageFlags>(usage));
+	if (buffer_pool_it == buffer_pools.end())
+	{
+		LOGE("No buffer pool for buffer usage {}", vk::to_string(static_cast<vk::BufferUsageFlags>(usage)));
+		return BufferAllocation<bindingType>{};
+	}
 
-	fence_pool.reset();
+	assert(thread_index < buffer_pool_it->second.size());
+	auto &buffer_pool  = buffer_pool_it->second[thread_index].first;
+	auto &buffer_block = buffer_pool_it->second[thread_index].second;
 
-	for (auto &command_pools_per_queue : command_pools)
+	bool want_minimal_block = buffer_allocation_strategy == vkb::rendering::BufferAllocationStrategy::OneAllocationPerBuffer;
+
+	if (want_minimal_block || !buffer_block || !buffer_block->can_allocate(size))
 	{
-		for (auto &command_pool : command_pools_per_queue.second)
-		{
-			command_pool->reset_pool();
-		}
+		// If we are creating a buffer for each allocation of there is no block associated with the pool or the current block is too small
+		// for this allocation, request a new buffer block
+		buffer_block = &buffer_pool.request_buffer_block(size, want_minimal_block);
 	}
 
-	for (auto &buffer_pools_per_usage : buffer_pools)
+	return reinterpret_cast<BufferBlock<bindingType> *>(buffer_block)->allocate(to_u32(size));
+}
+
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::clear_descriptors()
+{
+	for (auto &desc_sets_per_thread : descriptor_sets)
 	{
-		for (auto &buffer_pool : buffer_pools_per_usage.second)
+		desc_sets_per_thread->clear();
+	}
+
+	for (auto &desc_pools_per_thread : descriptor_pools)
+	{
+		for (auto &desc_pool : *desc_pools_per_thread)
 		{
-			buffer_pool.first.reset();
-			buffer_pool.second = nullptr;
+			desc_pool.second.reset();
 		}
 	}
+}
 
-	semaphore_pool.reset();
+template <vkb::BindingType bindingType>
+std::vector<uint32_t> RenderFrame<bindingType>::collect_bindings_to_update(const vkb::core::HPPDescriptorSetLayout    &descriptor_set_layout,
+                                                                           const BindingMap<vk::DescriptorBufferInfo> &buffer_infos,
+                                                                           const BindingMap<vk::DescriptorImageInfo>  &image_infos)
+{
+	std::set<uint32_t> bindings_to_update;
 
-	if (descriptor_management_strategy == vkb::DescriptorManagementStrategy::CreateDirectly)
-	{
-		clear_descriptors();
-	}
+	auto aggregate_binding_to_update = [&bindings_to_update, &descriptor_set_layout](const auto &infos_map) {
+		for (const auto &[binding_index, ignored] : infos_map)
+		{
+			if (!(descriptor_set_layout.get_layout_binding_flag(binding_index) & vk::DescriptorBindingFlagBits::eUpdateAfterBind))
+			{
+				bindings_to_update.insert(binding_index);
+			}
+		}
+	};
+	aggregate_binding_to_update(buffer_infos);
+	aggregate_binding_to_update(image_infos);
+
+	return {bindings_to_update.begin(), bindings_to_update.end()};
 }
 
-std::vector<std::unique_ptr<vkb::core::CommandPoolC>> &RenderFrame::get_command_pools(const Queue                &queue,
-                                                                                      vkb::CommandBufferResetMode reset_mode)
+template <vkb::BindingType bindingType>
+std::vector<std::unique_ptr<vkb::core::CommandPoolCpp>> &RenderFrame<bindingType>::get_command_pools(const vkb::core::HPPQueue  &queue,
+                                                                                                     vkb::CommandBufferResetMode reset_mode)
 {
 	auto command_pool_it = command_pools.find(queue.get_family_index());
 
@@ -103,7 +141,7 @@ std::vector<std::unique_ptr<vkb::core::CommandPoolC>> &RenderFrame::get_command_
 		assert(!command_pool_it->second.empty());
 		if (command_pool_it->second[0]->get_reset_mode() != reset_mode)
 		{
-			device.wait_idle();
+			device.get_handle().waitIdle();
 
 			// Delete pools
 			command_pools.erase(command_pool_it);
@@ -114,110 +152,136 @@ std::vector<std::unique_ptr<vkb::core::CommandPoolC>> &RenderFrame::get_command_
 		}
 	}
 
-	std::vector<std::unique_ptr<vkb::core::CommandPoolC>> queue_command_pools;
-	for (size_t i = 0; i < thread_count; i++)
-	{
-		queue_command_pools.push_back(std::make_unique<vkb::core::CommandPoolC>(device, queue.get_family_index(), this, i, reset_mode));
-	}
-
-	auto res_ins_it = command_pools.emplace(queue.get_family_index(), std::move(queue_command_pools));
-
-	if (!res_ins_it.second)
+	bool inserted                       = false;
+	std::tie(command_pool_it, inserted) = command_pools.emplace(queue.get_family_index(), std::vector<std::unique_ptr<vkb::core::CommandPoolCpp>>{});
+	if (!inserted)
 	{
 		throw std::runtime_error("Failed to insert command pool");
 	}
 
-	command_pool_it = res_ins_it.first;
+	// The pools of the other threads are created once these threads request a command buffer
+	command_pool_it->second.resize(thread_count);
+	command_pool_it->second[0] =
+	    std::make_unique<vkb::core::CommandPoolCpp>(device, queue.get_family_index(), reinterpret_cast<vkb::rendering::RenderFrameCpp *>(this), 0, reset_mode);
 
 	return command_pool_it->second;
 }
 
-std::vector<uint32_t> RenderFrame::collect_bindings_to_update(const DescriptorSetLayout &descriptor_set_layout, const BindingMap<VkDescriptorBufferInfo> &buffer_infos, const BindingMap<VkDescriptorImageInfo> &image_infos)
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::DeviceType &RenderFrame<bindingType>::get_device()
 {
-	std::vector<uint32_t> bindings_to_update;
-
-	bindings_to_update.reserve(buffer_infos.size() + image_infos.size());
-	auto aggregate_binding_to_update = [&bindings_to_update, &descriptor_set_layout](const auto &infos_map) {
-		for (const auto &pair : infos_map)
-		{
-			uint32_t binding_index = pair.first;
-			if (!(descriptor_set_layout.get_layout_binding_flag(binding_index) & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT) &&
-			    std::find(bindings_to_update.begin(), bindings_to_update.end(), binding_index) == bindings_to_update.end())
-			{
-				bindings_to_update.push_back(binding_index);
-			}
-		}
-	};
-	aggregate_binding_to_update(buffer_infos);
-	aggregate_binding_to_update(image_infos);
-
-	return bindings_to_update;
-}
-
-const FencePool &RenderFrame::get_fence_pool() const
-{
-	return fence_pool;
+	return reinterpret_cast<DeviceType &>(device);
 }
 
-VkFence RenderFrame::request_fence()
+template <vkb::BindingType bindingType>
+const typename RenderFrame<bindingType>::FencePoolType &RenderFrame<bindingType>::get_fence_pool() const
 {
-	return fence_pool.request_fence();
+	return reinterpret_cast<FencePoolType const &>(fence_pool);
 }
 
-const SemaphorePool &RenderFrame::get_semaphore_pool() const
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::RenderTargetType &RenderFrame<bindingType>::get_render_target()
 {
-	return semaphore_pool;
+	return *swapchain_render_target;
 }
 
-VkSemaphore RenderFrame::request_semaphore()
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::RenderTargetType const &RenderFrame<bindingType>::get_render_target() const
 {
-	return semaphore_pool.request_semaphore();
+	return *swapchain_render_target;
 }
 
-VkSemaphore RenderFrame::request_semaphore_with_ownership()
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::RenderTargetType const &RenderFrame<bindingType>::get_render_target_const() const
 {
-	return semaphore_pool.request_semaphore_with_ownership();
+	return get_render_target();
 }
 
-void RenderFrame::release_owned_semaphore(VkSemaphore semaphore)
+template <vkb::BindingType bindingType>
+const typename RenderFrame<bindingType>::SemaphorePoolType &RenderFrame<bindingType>::get_semaphore_pool() const
 {
-	semaphore_pool.release_owned_semaphore(semaphore);
+	return reinterpret_cast<SemaphorePoolType const &>(semaphore_pool);
 }
 
-RenderTarget &RenderFrame::get_render_target()
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::release_owned_semaphore(SemaphoreType semaphore)
 {
-	return *swapchain_render_target;
+	semaphore_pool.release_owned_semaphore(static_cast<vk::Semaphore>(semaphore));
 }
 
-const RenderTarget &RenderFrame::get_render_target_const() const
+template <vkb::BindingType bindingType>
+vkb::core::CommandBuffer<bindingType> &RenderFrame<bindingType>::request_command_buffer(const QueueType            &queue,
+                                                                                       vkb::CommandBufferResetMode reset_mode,
+                                                                                       CommandBufferLevelType      level,
+                                                                                       size_t                      thread_index)
 {
-	return *swapchain_render_target;
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		return request_command_buffer_impl(queue, reset_mode, level, thread_index);
+	}
+	else
+	{
+		return reinterpret_cast<vkb::core::CommandBufferC &>(
+		    request_command_buffer_impl(reinterpret_cast<vkb::core::HPPQueue const &>(queue), reset_mode, static_cast<vk::CommandBufferLevel>(level), thread_index));
+	}
 }
 
-vkb::core::CommandBufferC &RenderFrame::request_command_buffer(const Queue                &queue,
-                                                               vkb::CommandBufferResetMode reset_mode,
-                                                               VkCommandBufferLevel        level,
-                                                               size_t                      thread_index)
+template <vkb::BindingType bindingType>
+vkb::core::CommandBufferCpp &RenderFrame<bindingType>::request_command_buffer_impl(const vkb::core::HPPQueue  &queue,
+                                                                                    vkb::CommandBufferResetMode reset_mode,
+                                                                                    vk::CommandBufferLevel      level,
+                                                                                    size_t                      thread_index)
 {
 	assert(thread_index < thread_count && "Thread index is out of bounds");
 
 	auto &command_pools = get_command_pools(queue, reset_mode);
 
-	auto command_pool_it =
-	    std::find_if(command_pools.begin(),
-	                 command_pools.end(),
-	                 [&thread_index](std::unique_ptr<vkb::core::CommandPoolC> &cmd_pool) { return cmd_pool->get_thread_index() == thread_index; });
+	// Only the pool of the first thread exists up front, every other thread creates its own slot, such as the threads
+	// recording subpasses in parallel, so the frames of samples recording on a single thread hold a single pool
+	assert(thread_index < command_pools.size());
+	auto &command_pool = command_pools[thread_index];
+	if (!command_pool)
+	{
+		command_pool =
+		    std::make_unique<vkb::core::CommandPoolCpp>(device, queue.get_family_index(), reinterpret_cast<vkb::rendering::RenderFrameCpp *>(this), thread_index, reset_mode);
+	}
+
+	return command_pool->request_command_buffer(level);
+}
 
-	return (*command_pool_it)->request_command_buffer(level);
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::DescriptorSetType RenderFrame<bindingType>::request_descriptor_set(const DescriptorSetLayoutType              &descriptor_set_layout,
+                                                                                                     const BindingMap<DescriptorBufferInfoType> &buffer_infos,
+                                                                                                     const BindingMap<DescriptorImageInfoType>  &image_infos,
+                                                                                                     bool                                        update_after_bind,
+                                                                                                     size_t                                      thread_index)
+{
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		return request_descriptor_set_impl(descriptor_set_layout, buffer_infos, image_infos, update_after_bind, thread_index);
+	}
+	else
+	{
+		return static_cast<VkDescriptorSet>(request_descriptor_set_impl(reinterpret_cast<vkb::core::HPPDescriptorSetLayout const &>(descriptor_set_layout),
+		                                                                reinterpret_cast<BindingMap<vk::DescriptorBufferInfo> const &>(buffer_infos),
+		                                                                reinterpret_cast<BindingMap<vk::DescriptorImageInfo> const &>(image_infos),
+		                                                                update_after_bind,
+		                                                                thread_index));
+	}
 }
 
-VkDescriptorSet RenderFrame::request_descriptor_set(const DescriptorSetLayout &descriptor_set_layout, const BindingMap<VkDescriptorBufferInfo> &buffer_infos, const BindingMap<VkDescriptorImageInfo> &image_infos, bool update_after_bind, size_t thread_index)
+template <vkb::BindingType bindingType>
+vk::DescriptorSet RenderFrame<bindingType>::request_descriptor_set_impl(const vkb::core::HPPDescriptorSetLayout    &descriptor_set_layout,
+                                                                        const BindingMap<vk::DescriptorBufferInfo> &buffer_infos,
+                                                                        const BindingMap<vk::DescriptorImageInfo>  &image_infos,
+                                                                        bool                                        update_after_bind,
+                                                                        size_t                                      thread_index)
 {
 	assert(thread_index < thread_count && "Thread index is out of bounds");
 
 	assert(thread_index < descriptor_pools.size());
-	auto &descriptor_pool = request_resource(device, nullptr, *descriptor_pools[thread_index], descriptor_set_layout);
-	if (descriptor_management_strategy == DescriptorManagementStrategy::StoreInCache)
+	auto &descriptor_pool = vkb::request_resource(device, nullptr, *descriptor_pools[thread_index], descriptor_set_layout);
+	if (descriptor_management_strategy == vkb::rendering::DescriptorManagementStrategy::StoreInCache)
 	{
 		// The bindings we want to update before binding, if empty we update all bindings
 		std::vector<uint32_t> bindings_to_update;
@@ -229,80 +293,147 @@ VkDescriptorSet RenderFrame::request_descriptor_set(const DescriptorSetLayout &d
 
 		// Request a descriptor set from the render frame, and write the buffer infos and image infos of all the specified bindings
 		assert(thread_index < descriptor_sets.size());
-		auto &descriptor_set = request_resource(device, nullptr, *descriptor_sets[thread_index], descriptor_set_layout, descriptor_pool, buffer_infos, image_infos);
+		auto &descriptor_set =
+		    vkb::request_resource(device, nullptr, *descriptor_sets[thread_index], descriptor_set_layout, descriptor_pool, buffer_infos, image_infos);
 		descriptor_set.update(bindings_to_update);
 		return descriptor_set.get_handle();
 	}
 	else
 	{
 		// Request a descriptor pool, allocate a descriptor set, write buffer and image data to it
-		DescriptorSet descriptor_set{device, descriptor_set_layout, descriptor_pool, buffer_infos, image_infos};
+		vkb::core::HPPDescriptorSet descriptor_set{device, descriptor_set_layout, descriptor_pool, buffer_infos, image_infos};
 		descriptor_set.apply_writes();
 		return descriptor_set.get_handle();
 	}
 }
 
-void RenderFrame::update_descriptor_sets(size_t thread_index)
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::FenceType RenderFrame<bindingType>::request_fence()
 {
-	assert(thread_index < descriptor_sets.size());
-	auto &thread_descriptor_sets = *descriptor_sets[thread_index];
-	for (auto &descriptor_set_it : thread_descriptor_sets)
-	{
-		descriptor_set_it.second.update();
-	}
+	return static_cast<FenceType>(fence_pool.request_fence());
 }
 
-void RenderFrame::clear_descriptors()
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::SemaphoreType RenderFrame<bindingType>::request_semaphore()
 {
-	for (auto &desc_sets_per_thread : descriptor_sets)
+	return static_cast<SemaphoreType>(semaphore_pool.request_semaphore());
+}
+
+template <vkb::BindingType bindingType>
+typename RenderFrame<bindingType>::SemaphoreType RenderFrame<bindingType>::request_semaphore_with_ownership()
+{
+	return static_cast<SemaphoreType>(semaphore_pool.request_semaphore_with_ownership());
+}
+
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::reset()
+{
+	VK_CHECK(wait());
+
+	fence_pool.reset();
+
+	timeline_signals.clear();
+
+	for (auto &command_pools_per_queue : command_pools)
 	{
-		desc_sets_per_thread->clear();
+		for (auto &command_pool : command_pools_per_queue.second)
+		{
+			if (command_pool)
+			{
+				command_pool->reset_pool();
+			}
+		}
 	}
 
-	for (auto &desc_pools_per_thread : descriptor_pools)
+	// Pools may release blocks that stayed idle for a while, so descriptor sets cached on their buffers have to go as well
+	bool released_buffer_blocks = false;
+	for (auto &buffer_pools_per_usage : buffer_pools)
 	{
-		for (auto &desc_pool : *desc_pools_per_thread)
+		for (auto &buffer_pool : buffer_pools_per_usage.second)
 		{
-			desc_pool.second.reset();
+			released_buffer_blocks |= buffer_pool.first.reset();
+			buffer_pool.second = nullptr;
 		}
 	}
-}
 
-void RenderFrame::set_buffer_allocation_strategy(BufferAllocationStrategy new_strategy)
-{
-	buffer_allocation_strategy = new_strategy;
+	semaphore_pool.reset();
+
+	if (descriptor_management_strategy == vkb::rendering::DescriptorManagementStrategy::CreateDirectly || released_buffer_blocks)
+	{
+		clear_descriptors();
+	}
 }
 
-void RenderFrame::set_descriptor_management_strategy(DescriptorManagementStrategy new_strategy)
+template <vkb::BindingType bindingType>
+VkResult RenderFrame<bindingType>::wait(uint32_t timeout) const
 {
-	descriptor_management_strategy = new_strategy;
+	VkResult result = fence_pool.wait(timeout);
+
+	if (result != VK_SUCCESS || timeline_signals.empty())
+	{
+		return result;
+	}
+
+	std::vector<vk::Semaphore> semaphores;
+	std::vector<uint64_t>      values;
+	for (auto &timeline_signal : timeline_signals)
+	{
+		semaphores.push_back(timeline_signal.first);
+		values.push_back(timeline_signal.second);
+	}
+
+	vk::SemaphoreWaitInfoKHR wait_info({}, semaphores, values);
+
+	return static_cast<VkResult>(device.get_handle().waitSemaphoresKHR(wait_info, timeout));
 }
 
-BufferAllocationC RenderFrame::allocate_buffer(const VkBufferUsageFlags usage, const VkDeviceSize size, size_t thread_index)
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::add_timeline_signal(SemaphoreType timeline, uint64_t value)
 {
-	assert(thread_index < thread_count && "Thread index is out of bounds");
+	auto it = std::find_if(timeline_signals.begin(), timeline_signals.end(),
+	                       [timeline](const auto &timeline_signal) { return timeline_signal.first == static_cast<vk::Semaphore>(timeline); });
 
-	// Find a pool for this usage
-	auto buffer_pool_it = buffer_pools.find(usage);
-	if (buffer_pool_it == buffer_pools.end())
+	if (it != timeline_signals.end())
 	{
-		LOGE("No buffer pool for buffer usage {}", usage);
-		return BufferAllocationC{};
+		it->second = std::max(it->second, value);
 	}
+	else
+	{
+		timeline_signals.emplace_back(static_cast<vk::Semaphore>(timeline), value);
+	}
+}
 
-	assert(thread_index < buffer_pool_it->second.size());
-	auto &buffer_pool  = buffer_pool_it->second[thread_index].first;
-	auto &buffer_block = buffer_pool_it->second[thread_index].second;
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::set_buffer_allocation_strategy(BufferAllocationStrategyType new_strategy)
+{
+	buffer_allocation_strategy = static_cast<vkb::rendering::BufferAllocationStrategy>(new_strategy);
+}
 
-	bool want_minimal_block = buffer_allocation_strategy == BufferAllocationStrategy::OneAllocationPerBuffer;
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::set_descriptor_management_strategy(DescriptorManagementStrategyType new_strategy)
+{
+	descriptor_management_strategy = static_cast<vkb::rendering::DescriptorManagementStrategy>(new_strategy);
+}
 
-	if (want_minimal_block || !buffer_block || !buffer_block->can_allocate(size))
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::update_descriptor_sets(size_t thread_index)
+{
+	assert(thread_index < descriptor_sets.size());
+	auto &thread_descriptor_sets = *descriptor_sets[thread_index];
+	for (auto &descriptor_set_it : thread_descriptor_sets)
 	{
-		// If we are creating a buffer for each allocation of there is no block associated with the pool or the current block is too small
-		// for this allocation, request a new buffer block
-		buffer_block = &buffer_pool.request_buffer_block(size, want_minimal_block);
+		descriptor_set_it.second.update();
 	}
+}
 
-	return buffer_block->allocate(to_u32(size));
+template <vkb::BindingType bindingType>
+void RenderFrame<bindingType>::update_render_target(std::unique_ptr<RenderTargetType> &&render_target)
+{
+	swapchain_render_target = std::move(render_target);
 }
+
+// Both bindings share this translation unit, the C one only adds casts around the vulkan.hpp implementation
+template class RenderFrame<vkb::BindingType::C>;
+template class RenderFrame<vkb::BindingType::Cpp>;
+}        // namespace rendering
 }        // namespace vkb
@@ -1,4 +1,5 @@
 /* Copyright (c) 2019-2025, Arm Limited and Contributors
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -18,22 +19,20 @@
 #pragma once
 
 #include "buffer_pool.h"
-#include "common/helpers.h"
-#include "common/resource_caching.h"
 #include "common/vk_common.h"
-#include "core/buffer.h"
-#include "core/command_buffer.h"
-#include "core/command_pool.h"
-#include "core/device.h"
-#include "core/image.h"
-#include "core/query_pool.h"
-#include "core/queue.h"
-#include "fence_pool.h"
-#include "rendering/render_target.h"
-#include "semaphore_pool.h"
+#include "core/hpp_device.h"
+#include "hpp_fence_pool.h"
+#include "hpp_semaphore_pool.h"
+#include "rendering/hpp_render_target.h"
+#include <vulkan/vulkan_hash.hpp>
 
 namespace vkb
 {
+class DescriptorSetLayout;
+class Device;
+class Queue;
+class RenderTarget;
+
 enum BufferAllocationStrategy
 {
 	OneAllocationPerBuffer,
@@ -46,10 +45,41 @@ enum DescriptorManagementStrategy
 	CreateDirectly
 };
 
+namespace core
+{
+class HPPDescriptorSetLayout;
+class HPPQueue;
+
+template <vkb::BindingType bindingType>
+class CommandBuffer;
+using CommandBufferCpp = CommandBuffer<vkb::BindingType::Cpp>;
+
+template <vkb::BindingType bindingType>
+class CommandPool;
+using CommandPoolCpp = CommandPool<vkb::BindingType::Cpp>;
+}        // namespace core
+
+namespace rendering
+{
+enum class BufferAllocationStrategy
+{
+	OneAllocationPerBuffer,
+	MultipleAllocationsPerBuffer
+};
+
+enum class DescriptorManagementStrategy
+{
+	StoreInCache,
+	CreateDirectly
+};
+
 /**
  * @brief RenderFrame is a container for per-frame data, including BufferPool objects,
  * synchronization primitives (semaphores, fences) and the swapchain RenderTarget.
  *
+ * The submissions of a frame are tracked either by fences or, with timeline synchronization,
+ * by the timeline semaphore values they signal, which are waited for before the frame is reset.
+ *
  * When creating a RenderTarget, we need to provide images that will be used as attachments
  * within a RenderPass. The RenderFrame is responsible for creating a RenderTarget using
  * RenderTarget::CreateFunc. A custom RenderTarget::CreateFunc can be provided if a different
@@ -58,55 +88,90 @@ enum DescriptorManagementStrategy
  * A RenderFrame cannot be destroyed individually since frames are managed by the RenderContext,
  * the whole context must be destroyed. This is because each RenderFrame holds Vulkan objects
  * such as the swapchain image.
+ *
+ * Both bindings share a single implementation, working on the vulkan.hpp types. The members are
+ * defined in render_frame.cpp and explicitly instantiated for vkb::BindingType::C and vkb::BindingType::Cpp.
  */
+template <vkb::BindingType bindingType>
 class RenderFrame
 {
   public:
+	using BufferUsageFlagsType     = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::BufferUsageFlags, VkBufferUsageFlags>::type;
+	using CommandBufferLevelType   = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::CommandBufferLevel, VkCommandBufferLevel>::type;
+	using DescriptorBufferInfoType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DescriptorBufferInfo, VkDescriptorBufferInfo>::type;
+	using DescriptorImageInfoType  = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DescriptorImageInfo, VkDescriptorImageInfo>::type;
+	using DescriptorSetType        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DescriptorSet, VkDescriptorSet>::type;
+	using DeviceSizeType           = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DeviceSize, VkDeviceSize>::type;
+	using FenceType                = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::Fence, VkFence>::type;
+	using SemaphoreType            = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::Semaphore, VkSemaphore>::type;
+
+	using BufferAllocationStrategyType     = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::BufferAllocationStrategy, vkb::BufferAllocationStrategy>::type;
+	using DescriptorManagementStrategyType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::DescriptorManagementStrategy, vkb::DescriptorManagementStrategy>::type;
+
+	using DescriptorSetLayoutType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDescriptorSetLayout, vkb::DescriptorSetLayout>::type;
+	using DeviceType              = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDevice, vkb::Device>::type;
+	using FencePoolType           = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::HPPFencePool, vkb::FencePool>::type;
+	using QueueType               = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPQueue, vkb::Queue>::type;
+	using RenderTargetType        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPRenderTarget, vkb::RenderTarget>::type;
+	using SemaphorePoolType       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::HPPSemaphorePool, vkb::SemaphorePool>::type;
+
 	/**
 	 * @brief Block size of a buffer pool in kilobytes
 	 */
 	static constexpr uint32_t BUFFER_POOL_BLOCK_SIZE = 256;
 
-	// A map of the supported usages to a multiplier for the BUFFER_POOL_BLOCK_SIZE
-	const std::unordered_map<VkBufferUsageFlags, uint32_t> supported_usage_map = {
-	    {VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, 1},
-	    {VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, 2},        // x2 the size of BUFFER_POOL_BLOCK_SIZE since SSBOs are normally much larger than other types of buffers
-	    {VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, 1},
-	    {VK_BUFFER_USAGE_INDEX_BUFFER_BIT, 1}};
-
-	RenderFrame(Device &device, std::unique_ptr<RenderTarget> &&render_target, size_t thread_count = 1);
+  public:
+	RenderFrame(DeviceType &device, std::unique_ptr<RenderTargetType> &&render_target, size_t thread_count = 1);
 
 	RenderFrame(const RenderFrame &) = delete;
 
 	RenderFrame(RenderFrame &&) = delete;
 
+	~RenderFrame();
+
 	RenderFrame &operator=(const RenderFrame &) = delete;
 
 	RenderFrame &operator=(RenderFrame &&) = delete;
 
 	void reset();
 
-	Device &get_device();
+	/**
+	 * @brief Waits for the submissions of the frame, tracked either by fences or by timeline semaphore values
+	 * @param timeout Timeout in nanoseconds
+	 * @return VK_SUCCESS once they completed, VK_TIMEOUT otherwise
+	 */
+	VkResult wait(uint32_t timeout = std::numeric_limits<uint32_t>::max()) const;
+
+	/**
+	 * @brief Records a timeline semaphore value signaled by a submission of the frame, to wait for it before the frame is reset
+	 * @param timeline A timeline semaphore
+	 * @param value The value the submission signals
+	 */
+	void add_timeline_signal(SemaphoreType timeline, uint64_t value);
+
+	DeviceType &get_device();
 
-	const FencePool &get_fence_pool() const;
+	const FencePoolType &get_fence_pool() const;
 
-	VkFence request_fence();
+	FenceType request_fence();
 
-	const SemaphorePool &get_semaphore_pool() const;
+	const SemaphorePoolType &get_semaphore_pool() const;
 
-	VkSemaphore request_semaphore();
-	VkSemaphore request_semaphore_with_ownership();
-	void        release_owned_semaphore(VkSemaphore semaphore);
+	SemaphoreType request_semaphore();
+	SemaphoreType request_semaphore_with_ownership();
+	void          release_owned_semaphore(SemaphoreType semaphore);
 
 	/**
 	 * @brief Called when the swapchain changes
 	 * @param render_target A new render target with updated images
 	 */
-	void update_render_target(std::unique_ptr<RenderTarget> &&render_target);
+	void update_render_target(std::unique_ptr<RenderTargetType> &&render_target);
+
+	RenderTargetType &get_render_target();
 
-	RenderTarget &get_render_target();
+	const RenderTargetType &get_render_target() const;
 
-	const RenderTarget &get_render_target_const() const;
+	const RenderTargetType &get_render_target_const() const;
 
 	/**
 	 * @brief Requests a command buffer to the command pool of the active frame
@@ -118,16 +183,16 @@ class RenderFrame
 	 * @param thread_index Selects the thread's command pool used to manage the buffer
 	 * @return A command buffer related to the current active frame
 	 */
-	vkb::core::CommandBufferC &request_command_buffer(const Queue                &queue,
-	                                                  vkb::CommandBufferResetMode reset_mode   = vkb::CommandBufferResetMode::ResetPool,
-	                                                  VkCommandBufferLevel        level        = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-	                                                  size_t                      thread_index = 0);
+	vkb::core::CommandBuffer<bindingType> &request_command_buffer(const QueueType            &queue,
+	                                                              vkb::CommandBufferResetMode reset_mode   = vkb::CommandBufferResetMode::ResetPool,
+	                                                              CommandBufferLevelType      level        = static_cast<CommandBufferLevelType>(VK_COMMAND_BUFFER_LEVEL_PRIMARY),
+	                                                              size_t                      thread_index = 0);
 
-	VkDescriptorSet request_descriptor_set(const DescriptorSetLayout                &descriptor_set_layout,
-	                                       const BindingMap<VkDescriptorBufferInfo> &buffer_infos,
-	                                       const BindingMap<VkDescriptorImageInfo>  &image_infos,
-	                                       bool                                      update_after_bind,
-	                                       size_t                                    thread_index = 0);
+	DescriptorSetType request_descriptor_set(const DescriptorSetLayoutType              &descriptor_set_layout,
+	                                         const BindingMap<DescriptorBufferInfoType> &buffer_infos,
+	                                         const BindingMap<DescriptorImageInfoType>  &image_infos,
+	                                         bool                                        update_after_bind,
+	                                         size_t                                      thread_index = 0);
 
 	void clear_descriptors();
 
@@ -135,13 +200,13 @@ class RenderFrame
 	 * @brief Sets a new buffer allocation strategy
 	 * @param new_strategy The new buffer allocation strategy
 	 */
-	void set_buffer_allocation_strategy(BufferAllocationStrategy new_strategy);
+	void set_buffer_allocation_strategy(BufferAllocationStrategyType new_strategy);
 
 	/**
 	 * @brief Sets a new descriptor set management strategy
 	 * @param new_strategy The new descriptor set management strategy
 	 */
-	void set_descriptor_management_strategy(DescriptorManagementStrategy new_strategy);
+	void set_descriptor_management_strategy(DescriptorManagementStrategyType new_strategy);
 
 	/**
 	 * @param usage Usage of the buffer
@@ -149,7 +214,7 @@ class RenderFrame
 	 * @param thread_index Index of the buffer pool to be used by the current thread
 	 * @return The requested allocation, it may be empty
 	 */
-	BufferAllocationC allocate_buffer(VkBufferUsageFlags usage, VkDeviceSize size, size_t thread_index = 0);
+	BufferAllocation<bindingType> allocate_buffer(BufferUsageFlagsType usage, DeviceSizeType size, size_t thread_index = 0);
 
 	/**
 	 * @brief Updates all the descriptor sets in the current frame at a specific thread index
@@ -157,39 +222,65 @@ class RenderFrame
 	void update_descriptor_sets(size_t thread_index = 0);
 
   private:
-	Device &device;
+	vkb::core::CommandBufferCpp &request_command_buffer_impl(const vkb::core::HPPQueue &queue, vkb::CommandBufferResetMode reset_mode, vk::CommandBufferLevel level, size_t thread_index);
+	vk::DescriptorSet            request_descriptor_set_impl(const vkb::core::HPPDescriptorSetLayout    &descriptor_set_layout,
+	                                                         const BindingMap<vk::DescriptorBufferInfo> &buffer_infos,
+	                                                         const BindingMap<vk::DescriptorImageInfo>  &image_infos,
+	                                                         bool                                        update_after_bind,
+	                                                         size_t                                      thread_index);
 
 	/**
 	 * @brief Retrieve the frame's command pool(s)
 	 * @param queue The queue command buffers will be submitted on
 	 * @param reset_mode Indicate how the command buffers will be reset after execution,
 	 *        may trigger a pool re-creation to set necessary flags
-	 * @return The frame's command pool(s)
+	 * @return The frame's command pool(s), indexed by thread, where the pools of threads which have not requested a command buffer yet are null
 	 */
-	std::vector<std::unique_ptr<vkb::core::CommandPoolC>> &get_command_pools(const Queue &queue, vkb::CommandBufferResetMode reset_mode);
+	std::vector<std::unique_ptr<vkb::core::CommandPoolCpp>> &get_command_pools(const vkb::core::HPPQueue &queue, vkb::CommandBufferResetMode reset_mode);
+
+	static std::vector<uint32_t> collect_bindings_to_update(const vkb::core::HPPDescriptorSetLayout    &descriptor_set_layout,
+	                                                        const BindingMap<vk::DescriptorBufferInfo> &buffer_infos,
+	                                                        const BindingMap<vk::DescriptorImageInfo>  &image_infos);
+
+  private:
+	// A map of the supported usages to a multiplier for the BUFFER_POOL_BLOCK_SIZE
+	const std::unordered_map<vk::BufferUsageFlags, uint32_t> supported_usage_map = {
+	    {vk::BufferUsageFlagBits::eUniformBuffer, 1},
+	    {vk::BufferUsageFlagBits::eStorageBuffer, 2},        // x2 the size of BUFFER_POOL_BLOCK_SIZE since SSBOs are normally much larger than other types of buffers
+	    {vk::BufferUsageFlagBits::eVertexBuffer, 1},
+	    {vk::BufferUsageFlagBits::eIndexBuffer, 1}};
+
+	vkb::core::HPPDevice &device;
 
 	/// Commands pools associated to the frame
-	std::map<uint32_t, std::vector<std::unique_ptr<vkb::core::CommandPoolC>>> command_pools;
+	std::map<uint32_t, std::vector<std::unique_ptr<vkb::core::CommandPoolCpp>>> command_pools;
 
 	/// Descriptor pools for the frame
-	std::vector<std::unique_ptr<std::unordered_map<std::size_t, DescriptorPool>>> descriptor_pools;
+	std::vector<std::unique_ptr<std::unordered_map<std::size_t, vkb::core::HPPDescriptorPool>>> descriptor_pools;
 
 	/// Descriptor sets for the frame
-	std::vector<std::unique_ptr<std::unordered_map<std::size_t, DescriptorSet>>> descriptor_sets;
+	std::vector<std::unique_ptr<std::unordered_map<std::size_t, vkb::core::HPPDescriptorSet>>> descriptor_sets;
 
-	FencePool fence_pool;
+	vkb::HPPFencePool fence_pool;
 
-	SemaphorePool semaphore_pool;
+	vkb::HPPSemaphorePool semaphore_pool;
+
+	/// Last value signaled by the submissions of the frame, per timeline semaphore
+	std::vector<std::pair<vk::Semaphore, uint64_t>> timeline_signals;
 
 	size_t thread_count;
 
-	std::unique_ptr<RenderTarget> swapchain_render_target;
+	/// Kept in the type of the binding, as render targets are created and owned by the binding specific render contexts
+	std::unique_ptr<RenderTargetType> swapchain_render_target;
 
-	BufferAllocationStrategy     buffer_allocation_strategy{BufferAllocationStrategy::MultipleAllocationsPerBuffer};
-	DescriptorManagementStrategy descriptor_management_strategy{DescriptorManagementStrategy::StoreInCache};
+	vkb::rendering::BufferAllocationStrategy buffer_allocation_strategy{vkb::rendering::BufferAllocationStrategy::MultipleAllocationsPerBuffer};
 
-	std::map<VkBufferUsageFlags, std::vector<std::pair<BufferPoolC, BufferBlockC *>>> buffer_pools;
+	vkb::rendering::DescriptorManagementStrategy descriptor_management_strategy{vkb::rendering::DescriptorManagementStrategy::StoreInCache};
 
-	static std::vector<uint32_t> collect_bindings_to_update(const DescriptorSetLayout &descriptor_set_layout, const BindingMap<VkDescriptorBufferInfo> &buffer_infos, const BindingMap<VkDescriptorImageInfo> &image_infos);
+	std::map<vk::BufferUsageFlags, std::vector<std::pair<vkb::BufferPoolCpp, vkb::BufferBlockCpp *>>> buffer_pools;
 };
+
+using RenderFrameC   = RenderFrame<vkb::BindingType::C>;
+using RenderFrameCpp = RenderFrame<vkb::BindingType::Cpp>;
+}        // namespace rendering
 }        // namespace vkb
@@ -0,0 +1,1122 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rendering/render_graph.h"
+
+#include "core/allocated.h"
+#include "core/command_buffer.h"
+#include "core/debug.h"
+#include "core/device.h"
+#include "rendering/render_context.h"
+
+namespace vkb
+{
+namespace
+{
+struct AccessInfo
+{
+	VkPipelineStageFlags2KHR stages;
+
+	VkAccessFlags2KHR access;
+
+	/// Part of the access which writes the image
+	VkAccessFlags2KHR write_access;
+
+	VkImageLayout layout;
+
+	VkImageUsageFlags usage;
+};
+
+AccessInfo get_access_info(RenderGraphAccess access)
+{
+	switch (access)
+	{
+		case RenderGraphAccess::ColorAttachmentWrite:
+			return {VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR,
+			        VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT_KHR | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR,
+			        VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR,
+			        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+			        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT};
+		case RenderGraphAccess::DepthStencilAttachmentWrite:
+			return {VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR,
+			        VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT_KHR | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT_KHR,
+			        VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT_KHR,
+			        VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+			        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT};
+		case RenderGraphAccess::FragmentShaderSampled:
+			return {VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR,
+			        VK_ACCESS_2_SHADER_READ_BIT_KHR,
+			        0,
+			        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			        VK_IMAGE_USAGE_SAMPLED_BIT};
+		case RenderGraphAccess::FragmentShaderInputAttachment:
+			return {VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR,
+			        VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT_KHR,
+			        0,
+			        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			        VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT};
+		case RenderGraphAccess::ComputeShaderSampled:
+			return {VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR,
+			        VK_ACCESS_2_SHADER_READ_BIT_KHR,
+			        0,
+			        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			        VK_IMAGE_USAGE_SAMPLED_BIT};
+		case RenderGraphAccess::ComputeShaderStorageWrite:
+			return {VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR,
+			        VK_ACCESS_2_SHADER_WRITE_BIT_KHR,
+			        VK_ACCESS_2_SHADER_WRITE_BIT_KHR,
+			        VK_IMAGE_LAYOUT_GENERAL,
+			        VK_IMAGE_USAGE_STORAGE_BIT};
+		case RenderGraphAccess::TransferRead:
+			return {VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR,
+			        VK_ACCESS_2_TRANSFER_READ_BIT_KHR,
+			        0,
+			        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			        VK_IMAGE_USAGE_TRANSFER_SRC_BIT};
+		case RenderGraphAccess::TransferWrite:
+			return {VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR,
+			        VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR,
+			        VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR,
+			        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			        VK_IMAGE_USAGE_TRANSFER_DST_BIT};
+		default:
+			throw std::runtime_error("Unknown render graph access");
+	}
+}
+
+VkDeviceSize align_up(VkDeviceSize value, VkDeviceSize alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+VkImageMemoryBarrier2KHR make_image_barrier(VkPipelineStageFlags2KHR src_stages, VkAccessFlags2KHR src_access,
+                                            VkPipelineStageFlags2KHR dst_stages, VkAccessFlags2KHR dst_access,
+                                            VkImageLayout old_layout, VkImageLayout new_layout)
+{
+	VkImageMemoryBarrier2KHR barrier{VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR};
+	barrier.srcStageMask        = src_stages;
+	barrier.srcAccessMask       = src_access;
+	barrier.dstStageMask        = dst_stages;
+	barrier.dstAccessMask       = dst_access;
+	barrier.oldLayout           = old_layout;
+	barrier.newLayout           = new_layout;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	return barrier;
+}
+}        // namespace
+
+RenderGraph::PassBuilder::PassBuilder(RenderGraph &graph, uint32_t pass_index) :
+    graph{graph},
+    pass_index{pass_index}
+{
+}
+
+void RenderGraph::PassBuilder::read(RenderGraphImage image, RenderGraphAccess access)
+{
+	graph.add_access(pass_index, image, access, false);
+}
+
+void RenderGraph::PassBuilder::write(RenderGraphImage image, RenderGraphAccess access)
+{
+	graph.add_access(pass_index, image, access, true);
+}
+
+void RenderGraph::PassBuilder::write_backbuffer()
+{
+	graph.passes[pass_index].writes_backbuffer = true;
+}
+
+void RenderGraph::PassBuilder::set_side_effect()
+{
+	graph.passes[pass_index].side_effect = true;
+}
+
+RenderGraph::RenderGraph(vkb::rendering::RenderContextC &render_context, bool synchronization2) :
+    render_context{render_context},
+    device{render_context.get_device()},
+    synchronization2{synchronization2}
+{
+	graphics_queue = &device.get_suitable_graphics_queue();
+
+	// Prefer a queue of a dedicated compute family, then a second queue of the graphics family
+	uint32_t graphics_family_index = graphics_queue->get_family_index();
+	uint32_t compute_family_index  = device.get_queue_family_index(VK_QUEUE_COMPUTE_BIT);
+	if (compute_family_index != graphics_family_index)
+	{
+		compute_queue = &device.get_queue(compute_family_index, 0);
+	}
+	else if (device.get_num_queues_for_queue_family(graphics_family_index) >= 2)
+	{
+		compute_queue = &device.get_queue(graphics_family_index, graphics_queue->get_index() == 0 ? 1 : 0);
+	}
+}
+
+RenderGraph::~RenderGraph()
+{
+	reset();
+}
+
+RenderGraphImage RenderGraph::create_image(const std::string &name, const RenderGraphImageDesc &desc)
+{
+	assert(!compiled && "Images must be declared before the render graph is compiled");
+
+	ImageResource resource{};
+	resource.name = name;
+	resource.desc = desc;
+	images.push_back(std::move(resource));
+
+	return {to_u32(images.size() - 1)};
+}
+
+RenderGraphImage RenderGraph::import_image(const std::string &name, const core::ImageView &view, VkImageLayout initial_layout, VkImageLayout final_layout)
+{
+	assert(!compiled && "Images must be declared before the render graph is compiled");
+
+	ImageResource resource{};
+	resource.name           = name;
+	resource.desc.extent    = view.get_image().get_extent();
+	resource.desc.format    = view.get_format();
+	resource.imported       = true;
+	resource.imported_view  = &view;
+	resource.initial_layout = initial_layout;
+	resource.final_layout   = final_layout;
+	images.push_back(std::move(resource));
+
+	return {to_u32(images.size() - 1)};
+}
+
+void RenderGraph::set_imported_image(RenderGraphImage image, const core::ImageView &view)
+{
+	assert(image.index < images.size() && images[image.index].imported);
+	images[image.index].imported_view = &view;
+}
+
+void RenderGraph::add_pass(const std::string                                &name,
+                           RenderGraphQueue                                  queue,
+                           const std::function<void(PassBuilder &)>          &setup,
+                           std::function<void(vkb::core::CommandBufferC &)> &&execute)
+{
+	assert(!compiled && "Passes must be declared before the render graph is compiled");
+
+	Pass pass{};
+	pass.name            = name;
+	pass.requested_queue = queue;
+	pass.execute         = std::move(execute);
+	passes.push_back(std::move(pass));
+
+	PassBuilder builder{*this, to_u32(passes.size() - 1)};
+	setup(builder);
+}
+
+void RenderGraph::add_access(uint32_t pass_index, RenderGraphImage image, RenderGraphAccess access, bool write)
+{
+	assert(image.index < images.size() && "Invalid render graph image");
+	assert((get_access_info(access).write_access != 0) == write && "Access does not match the declaration");
+
+	auto &pass = passes[pass_index];
+	for (auto &existing : pass.accesses)
+	{
+		if (existing.image == image.index)
+		{
+			throw std::runtime_error("Render graph pass " + pass.name + " accesses image " + images[image.index].name + " more than once");
+		}
+	}
+
+	pass.accesses.push_back({image.index, access});
+}
+
+void RenderGraph::compile()
+{
+	if (compiled)
+	{
+		// Previous frames may still use the transient images and signal the carried semaphores
+		device.wait_idle();
+		destroy_carried_semaphores();
+		destroy_transient_images();
+	}
+
+	statistics = {};
+	batches.clear();
+	for (auto &pass : passes)
+	{
+		pass.culled = false;
+		pass.batch  = ~0u;
+		pass.barriers.clear();
+	}
+	for (auto &image : images)
+	{
+		image.usage      = image.desc.usage;
+		image.first_pass = ~0u;
+		image.last_pass  = ~0u;
+	}
+
+	cull_passes();
+	schedule_batches();
+	allocate_transient_images();
+
+	// A first simulated frame finds the state every image ends a frame in,
+	// which is where the accesses of the next frame have to be synchronized from
+	std::vector<ImageState> states(images.size());
+	for (size_t i = 0; i < images.size(); i++)
+	{
+		states[i].layout = images[i].imported ? images[i].initial_layout : VK_IMAGE_LAYOUT_UNDEFINED;
+	}
+	synchronize(states, false);
+
+	for (size_t i = 0; i < images.size(); i++)
+	{
+		auto &state = states[i];
+
+		state.owner_batch.previous_frame = true;
+		state.write_batch.previous_frame = true;
+		for (uint32_t queue = 0; queue < QueueCount; queue++)
+		{
+			state.read_batches[queue].previous_frame = true;
+			state.visible_stages[queue]              = 0;
+		}
+
+		if (images[i].imported)
+		{
+			// The final layout transition ends the previous frame
+			if (images[i].final_layout != VK_IMAGE_LAYOUT_UNDEFINED && state.layout != images[i].final_layout && state.owner_batch.is_valid())
+			{
+				state.write_batch  = state.owner_batch;
+				state.write_stages = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+				state.write_access = 0;
+				for (uint32_t queue = 0; queue < QueueCount; queue++)
+				{
+					state.read_batches[queue] = {};
+					state.read_stages[queue]  = 0;
+				}
+			}
+			state.layout = images[i].initial_layout;
+		}
+	}
+	synchronize(states, true);
+	prune_waits();
+
+	for (auto &pass : passes)
+	{
+		statistics.barrier_count += to_u32(pass.barriers.size());
+	}
+	for (auto &batch : batches)
+	{
+		statistics.barrier_count += to_u32(batch.end_barriers.size());
+		statistics.semaphore_count += to_u32(batch.waits.size());
+	}
+	statistics.submission_count = to_u32(batches.size());
+
+	compiled = true;
+
+	LOGI("Render graph: {} passes ({} culled, {} async), {} submissions, {} semaphores, {} barriers, {} ownership transfers",
+	     statistics.pass_count, statistics.culled_pass_count, statistics.async_pass_count, statistics.submission_count,
+	     statistics.semaphore_count, statistics.barrier_count, statistics.ownership_transfer_count);
+	LOGI("Render graph: {} MiB of transient images, {} MiB without aliasing",
+	     statistics.transient_memory / (1024 * 1024), statistics.unaliased_transient_memory / (1024 * 1024));
+}
+
+void RenderGraph::cull_passes()
+{
+	// Walk the passes backwards, keeping those producing an image a kept pass reads, or an imported image
+	std::vector<bool> needed(images.size());
+	for (size_t i = 0; i < images.size(); i++)
+	{
+		needed[i] = images[i].imported;
+	}
+
+	for (auto pass = passes.rbegin(); pass != passes.rend(); ++pass)
+	{
+		bool keep = pass->side_effect || pass->writes_backbuffer;
+		for (auto &access : pass->accesses)
+		{
+			keep |= get_access_info(access.access).write_access != 0 && needed[access.image];
+		}
+
+		pass->culled = !keep;
+		if (keep)
+		{
+			for (auto &access : pass->accesses)
+			{
+				if (get_access_info(access.access).write_access == 0)
+				{
+					needed[access.image] = true;
+				}
+			}
+		}
+		else
+		{
+			statistics.culled_pass_count++;
+		}
+	}
+
+	statistics.pass_count = to_u32(passes.size());
+}
+
+void RenderGraph::schedule_batches()
+{
+	bool use_compute_queue = async_compute_enabled && compute_queue != nullptr;
+
+	for (uint32_t pass_index = 0; pass_index < passes.size(); pass_index++)
+	{
+		auto &pass = passes[pass_index];
+		if (pass.culled)
+		{
+			continue;
+		}
+
+		QueueIndex queue = GraphicsQueue;
+		if (pass.requested_queue == RenderGraphQueue::AsyncCompute && use_compute_queue)
+		{
+			queue = ComputeQueue;
+			statistics.async_pass_count++;
+		}
+
+		if (pass.writes_backbuffer && queue != GraphicsQueue)
+		{
+			throw std::runtime_error("Render graph pass " + pass.name + " writes the backbuffer outside of the graphics queue");
+		}
+
+		// Consecutive passes of a queue share a submission
+		if (batches.empty() || batches.back().queue != queue)
+		{
+			Batch batch{};
+			batch.queue = queue;
+			batches.push_back(std::move(batch));
+		}
+
+		pass.batch = to_u32(batches.size() - 1);
+		batches.back().passes.push_back(pass_index);
+		batches.back().presents |= pass.writes_backbuffer;
+
+		for (auto &access : pass.accesses)
+		{
+			auto &image = images[access.image];
+			image.usage |= get_access_info(access.access).usage;
+			if (image.first_pass == ~0u)
+			{
+				image.first_pass = pass_index;
+			}
+			image.last_pass = pass_index;
+
+			if (image.imported && queue != GraphicsQueue && compute_queue->get_family_index() != graphics_queue->get_family_index())
+			{
+				throw std::runtime_error("Imported image " + image.name + " is accessed by more than one queue family");
+			}
+		}
+	}
+
+	// Without a backbuffer pass, the last graphics submission takes care of the swapchain semaphores
+	if (std::none_of(batches.begin(), batches.end(), [](const Batch &batch) { return batch.presents; }))
+	{
+		for (auto batch = batches.rbegin(); batch != batches.rend(); ++batch)
+		{
+			if (batch->queue == GraphicsQueue)
+			{
+				batch->presents = true;
+				break;
+			}
+		}
+	}
+}
+
+void RenderGraph::allocate_transient_images()
+{
+	std::vector<uint32_t> transient_images;
+
+	for (uint32_t i = 0; i < images.size(); i++)
+	{
+		auto &resource = images[i];
+		if (resource.imported || resource.first_pass == ~0u)
+		{
+			continue;
+		}
+
+		VkImageCreateInfo image_info{VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+		image_info.imageType     = resource.desc.extent.depth > 1 ? VK_IMAGE_TYPE_3D : VK_IMAGE_TYPE_2D;
+		image_info.format        = resource.desc.format;
+		image_info.extent        = resource.desc.extent;
+		image_info.mipLevels     = 1;
+		image_info.arrayLayers   = 1;
+		image_info.samples       = VK_SAMPLE_COUNT_1_BIT;
+		image_info.tiling        = VK_IMAGE_TILING_OPTIMAL;
+		image_info.usage         = resource.usage;
+		image_info.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+		image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		VK_CHECK(vkCreateImage(device.get_handle(), &image_info, nullptr, &resource.handle));
+		vkGetImageMemoryRequirements(device.get_handle(), resource.handle, &resource.memory_requirements);
+
+		statistics.unaliased_transient_memory += align_up(resource.memory_requirements.size, resource.memory_requirements.alignment);
+		transient_images.push_back(i);
+	}
+
+	if (transient_images.empty())
+	{
+		return;
+	}
+
+	// Which queues access each image. Images are only aliased with images of the same queues,
+	// as memory shared across queues would add semaphores between them and serialize their work.
+	std::vector<uint32_t> queue_masks(images.size(), 0);
+	for (auto &pass : passes)
+	{
+		if (!pass.culled)
+		{
+			for (auto &access : pass.accesses)
+			{
+				queue_masks[access.image] |= 1u << batches[pass.batch].queue;
+			}
+		}
+	}
+
+	// Place the largest images first, each at the lowest offset not used by an image alive at the same time
+	std::sort(transient_images.begin(), transient_images.end(), [this](uint32_t a, uint32_t b) {
+		return images[a].memory_requirements.size > images[b].memory_requirements.size;
+	});
+
+	VkMemoryRequirements memory_requirements{0, 1, ~0u};
+	std::vector<uint32_t> placed;
+	for (uint32_t i : transient_images)
+	{
+		auto &resource = images[i];
+
+		std::vector<std::pair<VkDeviceSize, VkDeviceSize>> occupied;
+		for (uint32_t j : placed)
+		{
+			auto &other    = images[j];
+			bool  disjoint = resource.last_pass < other.first_pass || other.last_pass < resource.first_pass;
+			if (!disjoint || queue_masks[i] != queue_masks[j])
+			{
+				occupied.emplace_back(other.memory_offset, other.memory_offset + other.memory_requirements.size);
+			}
+		}
+		std::sort(occupied.begin(), occupied.end());
+
+		VkDeviceSize offset = 0;
+		for (auto &range : occupied)
+		{
+			if (offset + resource.memory_requirements.size <= range.first)
+			{
+				break;
+			}
+			offset = std::max(offset, align_up(range.second, resource.memory_requirements.alignment));
+		}
+
+		resource.memory_offset = offset;
+		placed.push_back(i);
+
+		memory_requirements.size      = std::max(memory_requirements.size, offset + resource.memory_requirements.size);
+		memory_requirements.alignment = std::max(memory_requirements.alignment, resource.memory_requirements.alignment);
+		memory_requirements.memoryTypeBits &= resource.memory_requirements.memoryTypeBits;
+	}
+
+	if (memory_requirements.memoryTypeBits == 0)
+	{
+		throw std::runtime_error("Render graph transient images have no memory type in common");
+	}
+
+	VmaAllocationCreateInfo allocation_info{};
+	allocation_info.usage         = VMA_MEMORY_USAGE_GPU_ONLY;
+	allocation_info.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+	VK_CHECK(vmaAllocateMemory(vkb::allocated::get_memory_allocator(), &memory_requirements, &allocation_info, &transient_allocation, nullptr));
+	statistics.transient_memory = memory_requirements.size;
+
+	for (uint32_t i : transient_images)
+	{
+		auto &resource = images[i];
+
+		VK_CHECK(vmaBindImageMemory2(vkb::allocated::get_memory_allocator(), transient_allocation, resource.memory_offset, resource.handle, nullptr));
+
+		resource.image = std::make_unique<core::Image>(device, resource.handle, resource.desc.extent, resource.desc.format, resource.usage);
+		resource.image->set_debug_name(resource.name);
+		resource.view = std::make_unique<core::ImageView>(*resource.image, resource.desc.extent.depth > 1 ? VK_IMAGE_VIEW_TYPE_3D : VK_IMAGE_VIEW_TYPE_2D);
+	}
+}
+
+void RenderGraph::synchronize(std::vector<ImageState> &states, bool record)
+{
+	for (uint32_t pass_index = 0; pass_index < passes.size(); pass_index++)
+	{
+		auto &pass = passes[pass_index];
+		if (pass.culled)
+		{
+			continue;
+		}
+
+		QueueIndex queue  = batches[pass.batch].queue;
+		uint32_t   family = get_queue(queue).get_family_index();
+
+		for (auto &access : pass.accesses)
+		{
+			auto  info     = get_access_info(access.access);
+			auto &resource = images[access.image];
+			auto &state    = states[access.image];
+
+			// Transient images start every frame with undefined contents, so nothing needs to be transferred
+			bool          discard            = !resource.imported && pass_index == resource.first_pass;
+			VkImageLayout old_layout         = discard ? VK_IMAGE_LAYOUT_UNDEFINED : state.layout;
+			bool          layout_change      = old_layout != info.layout;
+			bool          write              = info.write_access != 0 || layout_change;
+			bool          ownership_transfer = !discard && state.owner_family != VK_QUEUE_FAMILY_IGNORED && state.owner_family != family;
+
+			// After a transfer, the accesses of the other queue are covered by the semaphore wait
+			write |= ownership_transfer;
+
+			if (ownership_transfer)
+			{
+				// Every earlier access ran on the queue of the other family, whose last submission
+				// touching the image releases it, and is waited for by this one
+				add_wait(pass.batch, state.owner_batch, info.stages, record);
+
+				if (record)
+				{
+					QueueIndex owner_queue = batches[state.owner_batch.batch].queue;
+
+					auto release                = make_image_barrier(state.write_stages | state.read_stages[owner_queue], state.write_access, 0, 0, old_layout, info.layout);
+					release.srcQueueFamilyIndex = state.owner_family;
+					release.dstQueueFamilyIndex = family;
+					batches[state.owner_batch.batch].end_barriers.push_back({access.image, release});
+
+					// The source stages match the semaphore wait
+					auto acquire                = make_image_barrier(info.stages, 0, info.stages, info.access, old_layout, info.layout);
+					acquire.srcQueueFamilyIndex = state.owner_family;
+					acquire.dstQueueFamilyIndex = family;
+					pass.barriers.push_back({access.image, acquire});
+
+					statistics.ownership_transfer_count++;
+				}
+			}
+			else
+			{
+				VkPipelineStageFlags2KHR src_stages = 0;
+				VkAccessFlags2KHR        src_access = 0;
+				bool                     waited     = false;
+
+				const auto depend_on = [&](const ImageState &source) {
+					// Read after write and write after write
+					if (source.write_batch.is_valid())
+					{
+						if (batches[source.write_batch.batch].queue != queue)
+						{
+							add_wait(pass.batch, source.write_batch, info.stages, record);
+							waited = true;
+						}
+						else if (write || (source.visible_stages[queue] & info.stages) != info.stages)
+						{
+							src_stages |= source.write_stages;
+							src_access |= source.write_access;
+						}
+					}
+
+					// Write after read only needs an execution dependency
+					if (write)
+					{
+						for (uint32_t read_queue = 0; read_queue < QueueCount; read_queue++)
+						{
+							if (!source.read_batches[read_queue].is_valid())
+							{
+								continue;
+							}
+
+							if (read_queue != queue)
+							{
+								add_wait(pass.batch, source.read_batches[read_queue], info.stages, record);
+								waited = true;
+							}
+							else
+							{
+								src_stages |= source.read_stages[read_queue];
+							}
+						}
+					}
+				};
+
+				depend_on(state);
+
+				if (discard)
+				{
+					// Memory aliasing hazards with the images sharing memory with this one
+					for (uint32_t other = 0; other < images.size(); other++)
+					{
+						auto &other_resource = images[other];
+						if (other != access.image && other_resource.handle != VK_NULL_HANDLE &&
+						    other_resource.memory_offset < resource.memory_offset + resource.memory_requirements.size &&
+						    resource.memory_offset < other_resource.memory_offset + other_resource.memory_requirements.size)
+						{
+							depend_on(states[other]);
+						}
+					}
+				}
+
+				// A layout transition after a semaphore wait must chain with the stages it waits at
+				if (waited && layout_change)
+				{
+					src_stages |= info.stages;
+				}
+
+				if (record && (layout_change || src_stages != 0))
+				{
+					pass.barriers.push_back({access.image, make_image_barrier(src_stages, src_access, info.stages, info.access, old_layout, info.layout)});
+				}
+			}
+
+			state.layout       = info.layout;
+			state.owner_family = family;
+			state.owner_batch  = {pass.batch, false};
+
+			if (write)
+			{
+				// A layout transition counts as a write, visible to the stages of its barrier
+				state.write_batch  = {pass.batch, false};
+				state.write_stages = info.stages;
+				state.write_access = info.write_access;
+				for (uint32_t read_queue = 0; read_queue < QueueCount; read_queue++)
+				{
+					state.read_batches[read_queue]   = {};
+					state.read_stages[read_queue]    = 0;
+					state.visible_stages[read_queue] = 0;
+				}
+			}
+
+			if (info.write_access == 0)
+			{
+				state.read_batches[queue] = {pass.batch, false};
+				state.read_stages[queue] |= info.stages;
+				state.visible_stages[queue] |= info.stages;
+			}
+		}
+	}
+
+	if (!record)
+	{
+		return;
+	}
+
+	// Leave imported images in their final layout
+	for (uint32_t i = 0; i < images.size(); i++)
+	{
+		auto &resource = images[i];
+		auto &state    = states[i];
+		if (resource.imported && resource.final_layout != VK_IMAGE_LAYOUT_UNDEFINED && state.layout != resource.final_layout && state.owner_batch.is_valid())
+		{
+			QueueIndex queue = batches[state.owner_batch.batch].queue;
+			batches[state.owner_batch.batch].end_barriers.push_back(
+			    {i, make_image_barrier(state.write_stages | state.read_stages[queue], state.write_access,
+			                           VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR, 0, state.layout, resource.final_layout)});
+			state.layout = resource.final_layout;
+		}
+	}
+}
+
+void RenderGraph::add_wait(uint32_t batch, BatchRef signal_batch, VkPipelineStageFlags2KHR stages, bool record)
+{
+	if (!record)
+	{
+		return;
+	}
+
+	assert(batches[batch].queue != batches[signal_batch.batch].queue);
+
+	for (auto &wait : batches[batch].waits)
+	{
+		if (wait.batch == signal_batch.batch && wait.previous_frame == signal_batch.previous_frame)
+		{
+			wait.stages |= stages;
+			return;
+		}
+	}
+
+	batches[batch].waits.push_back({signal_batch.batch, stages, signal_batch.previous_frame});
+}
+
+void RenderGraph::prune_waits()
+{
+	// A semaphore signal covers everything submitted to its queue before it, so a batch only needs
+	// to wait for the latest of the submissions of another queue it depends on
+	for (auto &batch : batches)
+	{
+		std::vector<BatchWait> waits;
+		for (auto &wait : batch.waits)
+		{
+			auto latest = std::find_if(waits.begin(), waits.end(), [&](const BatchWait &other) {
+				return batches[other.batch].queue == batches[wait.batch].queue;
+			});
+
+			if (latest == waits.end())
+			{
+				waits.push_back(wait);
+				continue;
+			}
+
+			VkPipelineStageFlags2KHR stages = latest->stages | wait.stages;
+			if ((latest->previous_frame && !wait.previous_frame) ||
+			    (latest->previous_frame == wait.previous_frame && wait.batch > latest->batch))
+			{
+				*latest = wait;
+			}
+			latest->stages = stages;
+		}
+		batch.waits = std::move(waits);
+	}
+}
+
+VkSemaphore RenderGraph::execute()
+{
+	assert(compiled && "The render graph must be compiled before it is executed");
+
+	if (render_context.uses_timeline_synchronization())
+	{
+		return submit_timeline();
+	}
+
+	auto &render_frame = render_context.get_active_frame();
+
+	// Semaphores signaled in this frame, per batch and per wait
+	std::vector<std::vector<VkSemaphore>> wait_semaphores(batches.size());
+	for (size_t i = 0; i < batches.size(); i++)
+	{
+		wait_semaphores[i].resize(batches[i].waits.size(), VK_NULL_HANDLE);
+	}
+
+	VkSemaphore present_semaphore = VK_NULL_HANDLE;
+
+	for (uint32_t batch_index = 0; batch_index < batches.size(); batch_index++)
+	{
+		auto &batch = batches[batch_index];
+		auto &queue = get_queue(batch.queue);
+
+		auto &command_buffer = render_frame.request_command_buffer(queue);
+		command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+		record_batch(command_buffer, batch);
+		command_buffer.end();
+
+		std::vector<VkSemaphore>          semaphores_to_wait;
+		std::vector<VkPipelineStageFlags> wait_stages;
+		std::vector<VkSemaphore>          owned_semaphores;
+		for (size_t i = 0; i < batch.waits.size(); i++)
+		{
+			auto &wait = batch.waits[i];
+
+			// The first frame after compile() has no previous frame to wait for
+			VkSemaphore semaphore = wait.previous_frame ? std::exchange(wait.carried_semaphore, VK_NULL_HANDLE) : wait_semaphores[batch_index][i];
+			if (semaphore == VK_NULL_HANDLE)
+			{
+				continue;
+			}
+
+			semaphores_to_wait.push_back(semaphore);
+			wait_stages.push_back(static_cast<VkPipelineStageFlags>(wait.stages));
+			if (wait.previous_frame)
+			{
+				owned_semaphores.push_back(semaphore);
+			}
+		}
+
+		if (batch.presents && render_context.has_swapchain())
+		{
+			VkSemaphore acquired_semaphore = render_context.consume_acquired_semaphore();
+			semaphores_to_wait.push_back(acquired_semaphore);
+			wait_stages.push_back(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+			owned_semaphores.push_back(acquired_semaphore);
+		}
+
+		std::vector<VkSemaphore> semaphores_to_signal;
+		for (uint32_t other_index = 0; other_index < batches.size(); other_index++)
+		{
+			auto &waits = batches[other_index].waits;
+			for (size_t i = 0; i < waits.size(); i++)
+			{
+				if (waits[i].batch != batch_index)
+				{
+					continue;
+				}
+
+				if (waits[i].previous_frame)
+				{
+					// Waited for in the next frame, so the semaphore must outlive this one
+					assert(waits[i].carried_semaphore == VK_NULL_HANDLE);
+					waits[i].carried_semaphore = render_context.request_semaphore_with_ownership();
+					semaphores_to_signal.push_back(waits[i].carried_semaphore);
+				}
+				else
+				{
+					wait_semaphores[other_index][i] = render_context.request_semaphore();
+					semaphores_to_signal.push_back(wait_semaphores[other_index][i]);
+				}
+			}
+		}
+
+		if (batch.presents)
+		{
+			present_semaphore = render_context.request_semaphore();
+			semaphores_to_signal.push_back(present_semaphore);
+		}
+
+		VkSubmitInfo submit_info{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+		submit_info.waitSemaphoreCount   = to_u32(semaphores_to_wait.size());
+		submit_info.pWaitSemaphores      = semaphores_to_wait.data();
+		submit_info.pWaitDstStageMask    = wait_stages.data();
+		submit_info.commandBufferCount   = 1;
+		submit_info.pCommandBuffers      = &command_buffer.get_handle();
+		submit_info.signalSemaphoreCount = to_u32(semaphores_to_signal.size());
+		submit_info.pSignalSemaphores    = semaphores_to_signal.data();
+
+		VK_CHECK(queue.submit({submit_info}, render_frame.request_fence()));
+
+		for (auto semaphore : owned_semaphores)
+		{
+			render_context.release_owned_semaphore(semaphore);
+		}
+	}
+
+	return present_semaphore;
+}
+
+VkSemaphore RenderGraph::submit_timeline()
+{
+	auto &render_frame = render_context.get_active_frame();
+
+	// The values the batches signaled in the previous frame, which the previous_frame waits are for
+	std::vector<uint64_t> previous_values(batches.size());
+	std::transform(batches.begin(), batches.end(), previous_values.begin(), [](const Batch &batch) { return batch.timeline_value; });
+
+	VkSemaphore present_semaphore = VK_NULL_HANDLE;
+
+	for (auto &batch : batches)
+	{
+		auto &queue = get_queue(batch.queue);
+
+		auto &command_buffer = render_frame.request_command_buffer(queue);
+		command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+		record_batch(command_buffer, batch);
+		command_buffer.end();
+
+		// The first frame after compile() has no previous frame to wait for, which the value 0 skips
+		std::vector<vkb::rendering::RenderContextC::TimelineWait> waits;
+		for (auto &wait : batch.waits)
+		{
+			waits.push_back({&get_queue(batches[wait.batch].queue),
+			                 wait.previous_frame ? previous_values[wait.batch] : batches[wait.batch].timeline_value,
+			                 static_cast<VkPipelineStageFlags>(wait.stages)});
+		}
+
+		batch.timeline_value = render_context.submit_timeline(queue, {&command_buffer}, waits, batch.presents ? &present_semaphore : nullptr);
+	}
+
+	return present_semaphore;
+}
+
+void RenderGraph::record(vkb::core::CommandBufferC &command_buffer)
+{
+	assert(compiled && "The render graph must be compiled before it is recorded");
+
+	// Several submissions would need semaphores between them, which only execute() provides
+	if (batches.size() > 1 || (!batches.empty() && batches[0].queue != GraphicsQueue))
+	{
+		throw std::runtime_error("Render graph passes span several submissions, use execute() instead of record()");
+	}
+
+	for (auto &batch : batches)
+	{
+		record_batch(command_buffer, batch);
+	}
+}
+
+void RenderGraph::reset()
+{
+	if (compiled)
+	{
+		device.wait_idle();
+		destroy_carried_semaphores();
+		destroy_transient_images();
+	}
+
+	images.clear();
+	passes.clear();
+	batches.clear();
+	statistics = {};
+	compiled   = false;
+}
+
+void RenderGraph::set_async_compute_enabled(bool enabled)
+{
+	async_compute_enabled = enabled;
+}
+
+bool RenderGraph::is_async_compute_active() const
+{
+	return std::any_of(batches.begin(), batches.end(), [](const Batch &batch) { return batch.queue == ComputeQueue; });
+}
+
+core::Image &RenderGraph::get_image(RenderGraphImage image)
+{
+	assert(image.index < images.size() && images[image.index].image && "Only transient images of passes which are not culled are created");
+	return *images[image.index].image;
+}
+
+const core::ImageView &RenderGraph::get_image_view(RenderGraphImage image) const
+{
+	assert(image.index < images.size());
+	auto &resource = images[image.index];
+
+	if (resource.imported)
+	{
+		return *resource.imported_view;
+	}
+
+	assert(resource.view && "Transient images are only created by compile(), for passes which are not culled");
+	return *resource.view;
+}
+
+const RenderGraphImageDesc &RenderGraph::get_image_desc(RenderGraphImage image) const
+{
+	assert(image.index < images.size());
+	return images[image.index].desc;
+}
+
+const RenderGraph::Statistics &RenderGraph::get_statistics() const
+{
+	return statistics;
+}
+
+void RenderGraph::record_batch(vkb::core::CommandBufferC &command_buffer, const Batch &batch)
+{
+	for (uint32_t pass_index : batch.passes)
+	{
+		auto &pass = passes[pass_index];
+
+		ScopedDebugLabel label{command_buffer, pass.name.c_str()};
+		record_barriers(command_buffer, pass.barriers);
+		pass.execute(command_buffer);
+	}
+
+	record_barriers(command_buffer, batch.end_barriers);
+}
+
+void RenderGraph::record_barriers(vkb::core::CommandBufferC &command_buffer, const std::vector<ImageBarrier> &barriers)
+{
+	if (barriers.empty())
+	{
+		return;
+	}
+
+	const auto get_subresource_range = [this](uint32_t image) {
+		VkImageSubresourceRange range = get_image_view({image}).get_subresource_range();
+		if (is_depth_stencil_format(images[image].desc.format))
+		{
+			range.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+		}
+		return range;
+	};
+
+	if (synchronization2)
+	{
+		std::vector<VkImageMemoryBarrier2KHR> image_barriers;
+		for (auto &barrier : barriers)
+		{
+			image_barriers.push_back(barrier.barrier);
+			image_barriers.back().image            = get_image_handle(barrier.image);
+			image_barriers.back().subresourceRange = get_subresource_range(barrier.image);
+		}
+
+		VkDependencyInfoKHR dependency_info{VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR};
+		dependency_info.imageMemoryBarrierCount = to_u32(image_barriers.size());
+		dependency_info.pImageMemoryBarriers    = image_barriers.data();
+
+		vkCmdPipelineBarrier2KHR(command_buffer.get_handle(), &dependency_info);
+	}
+	else
+	{
+		// Only stages and accesses which exist in the original flags are used, so they convert as is,
+		// but a single vkCmdPipelineBarrier call needs the union of the stages of every barrier
+		VkPipelineStageFlags              src_stages = 0;
+		VkPipelineStageFlags              dst_stages = 0;
+		std::vector<VkImageMemoryBarrier> image_barriers;
+		for (auto &barrier : barriers)
+		{
+			VkImageMemoryBarrier image_barrier{VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+			image_barrier.srcAccessMask       = static_cast<VkAccessFlags>(barrier.barrier.srcAccessMask);
+			image_barrier.dstAccessMask       = static_cast<VkAccessFlags>(barrier.barrier.dstAccessMask);
+			image_barrier.oldLayout           = barrier.barrier.oldLayout;
+			image_barrier.newLayout           = barrier.barrier.newLayout;
+			image_barrier.srcQueueFamilyIndex = barrier.barrier.srcQueueFamilyIndex;
+			image_barrier.dstQueueFamilyIndex = barrier.barrier.dstQueueFamilyIndex;
+			image_barrier.image               = get_image_handle(barrier.image);
+			image_barrier.subresourceRange    = get_subresource_range(barrier.image);
+			image_barriers.push_back(image_barrier);
+
+			src_stages |= static_cast<VkPipelineStageFlags>(barrier.barrier.srcStageMask);
+			dst_stages |= static_cast<VkPipelineStageFlags>(barrier.barrier.dstStageMask);
+		}
+
+		vkCmdPipelineBarrier(command_buffer.get_handle(),
+		                     src_stages != 0 ? src_stages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		                     dst_stages != 0 ? dst_stages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+		                     0, 0, nullptr, 0, nullptr,
+		                     to_u32(image_barriers.size()), image_barriers.data());
+	}
+}
+
+void RenderGraph::destroy_transient_images()
+{
+	for (auto &resource : images)
+	{
+		resource.view.reset();
+		resource.image.reset();
+		if (resource.handle != VK_NULL_HANDLE)
+		{
+			vkDestroyImage(device.get_handle(), resource.handle, nullptr);
+			resource.handle = VK_NULL_HANDLE;
+		}
+	}
+
+	if (transient_allocation != VK_NULL_HANDLE)
+	{
+		vmaFreeMemory(vkb::allocated::get_memory_allocator(), transient_allocation);
+		transient_allocation = VK_NULL_HANDLE;
+	}
+}
+
+void RenderGraph::destroy_carried_semaphores()
+{
+	// Signaled, but never waited for by a next frame
+	for (auto &batch : batches)
+	{
+		for (auto &wait : batch.waits)
+		{
+			if (wait.carried_semaphore != VK_NULL_HANDLE)
+			{
+				vkDestroySemaphore(device.get_handle(), wait.carried_semaphore, nullptr);
+				wait.carried_semaphore = VK_NULL_HANDLE;
+			}
+		}
+	}
+}
+
+VkImage RenderGraph::get_image_handle(uint32_t image) const
+{
+	auto &resource = images[image];
+	return resource.imported ? resource.imported_view->get_image().get_handle() : resource.handle;
+}
+
+const Queue &RenderGraph::get_queue(QueueIndex queue) const
+{
+	return queue == ComputeQueue ? *compute_queue : *graphics_queue;
+}
+}        // namespace vkb
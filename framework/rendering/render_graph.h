@@ -0,0 +1,480 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <functional>
+
+#include "common/helpers.h"
+#include "common/vk_common.h"
+#include "core/image.h"
+#include "core/image_view.h"
+
+namespace vkb
+{
+class Device;
+class Queue;
+
+namespace core
+{
+template <vkb::BindingType bindingType>
+class CommandBuffer;
+using CommandBufferC = CommandBuffer<vkb::BindingType::C>;
+}        // namespace core
+
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC = RenderContext<vkb::BindingType::C>;
+}        // namespace rendering
+
+/**
+ * @brief Queue a render graph pass is meant to run on
+ */
+enum class RenderGraphQueue
+{
+	Graphics,
+
+	/// Runs on a separate compute queue when one is available and async compute is enabled, on the graphics queue otherwise
+	AsyncCompute
+};
+
+/**
+ * @brief How a pass uses an image, which determines the pipeline stages, access mask and layout it needs
+ */
+enum class RenderGraphAccess
+{
+	ColorAttachmentWrite,
+	DepthStencilAttachmentWrite,
+	FragmentShaderSampled,
+	FragmentShaderInputAttachment,
+	ComputeShaderSampled,
+	ComputeShaderStorageWrite,
+	TransferRead,
+	TransferWrite
+};
+
+/**
+ * @brief Handle of an image declared in a render graph
+ */
+struct RenderGraphImage
+{
+	uint32_t index{~0u};
+
+	bool is_valid() const
+	{
+		return index != ~0u;
+	}
+};
+
+/**
+ * @brief Description of an image owned by the render graph
+ */
+struct RenderGraphImageDesc
+{
+	VkExtent3D extent{};
+
+	VkFormat format{VK_FORMAT_UNDEFINED};
+
+	/// Usage in addition to the one deduced from the passes accessing the image
+	VkImageUsageFlags usage{0};
+};
+
+/**
+ * @brief A frame described as passes declaring the images they read and write
+ *
+ * Passes are declared once, in submission order, then compile() derives everything that is usually written
+ * by hand from those declarations:
+ * - Passes whose results do not reach an imported image or the backbuffer are culled
+ * - Consecutive passes running on the same queue are grouped in one submission, and submissions of different
+ *   queues are connected with the fewest semaphores covering every cross-queue hazard, including the
+ *   write-after-read hazards between one frame and the next
+ * - Every pass gets the image barriers it needs, and only those: reads of an image already visible to a stage
+ *   need no barrier, and queue family ownership transfers are emitted when a queue of another family takes over
+ * - Transient images whose lifetimes do not overlap share memory, out of a single allocation
+ *
+ * Barriers are recorded with vkCmdPipelineBarrier2KHR when synchronization2 is enabled, with vkCmdPipelineBarrier otherwise.
+ *
+ * Transient images have undefined contents when a frame starts. Imported images are expected in their initial layout
+ * when a frame starts, are transitioned to their final layout at its end, and must only be accessed by one queue family.
+ */
+class RenderGraph
+{
+  public:
+	/**
+	 * @brief Gives passes a way to declare their accesses while the graph is built
+	 */
+	class PassBuilder
+	{
+	  public:
+		/**
+		 * @brief Declares that the pass reads an image, with a read access
+		 */
+		void read(RenderGraphImage image, RenderGraphAccess access);
+
+		/**
+		 * @brief Declares that the pass writes an image, with a write access
+		 */
+		void write(RenderGraphImage image, RenderGraphAccess access);
+
+		/**
+		 * @brief Declares that the pass renders to the swapchain image
+		 *        Its submission waits for the image to be acquired, and the pass is never culled.
+		 *        The pass transitions the swapchain image itself, as vkb::VulkanSample::draw() does.
+		 */
+		void write_backbuffer();
+
+		/**
+		 * @brief Keeps the pass even if none of its results are used
+		 */
+		void set_side_effect();
+
+	  private:
+		friend class RenderGraph;
+
+		PassBuilder(RenderGraph &graph, uint32_t pass_index);
+
+		RenderGraph &graph;
+
+		uint32_t pass_index;
+	};
+
+	struct Statistics
+	{
+		uint32_t pass_count{0};
+
+		uint32_t culled_pass_count{0};
+
+		uint32_t async_pass_count{0};
+
+		uint32_t submission_count{0};
+
+		uint32_t semaphore_count{0};
+
+		uint32_t barrier_count{0};
+
+		uint32_t ownership_transfer_count{0};
+
+		/// Memory used by transient images
+		VkDeviceSize transient_memory{0};
+
+		/// Memory transient images would use without aliasing
+		VkDeviceSize unaliased_transient_memory{0};
+	};
+
+	/**
+	 * @param render_context Render context providing frames, command buffers and semaphores
+	 * @param synchronization2 Record barriers with VK_KHR_synchronization2, the feature must be enabled on the device
+	 */
+	RenderGraph(vkb::rendering::RenderContextC &render_context, bool synchronization2 = false);
+
+	RenderGraph(const RenderGraph &) = delete;
+
+	RenderGraph(RenderGraph &&) = delete;
+
+	~RenderGraph();
+
+	RenderGraph &operator=(const RenderGraph &) = delete;
+
+	RenderGraph &operator=(RenderGraph &&) = delete;
+
+	/**
+	 * @brief Declares an image owned by the graph, created by compile()
+	 */
+	RenderGraphImage create_image(const std::string &name, const RenderGraphImageDesc &desc);
+
+	/**
+	 * @brief Declares an image owned by the application
+	 * @param view View of the image, which can be changed between frames with set_imported_image()
+	 * @param initial_layout Layout of the image when a frame starts
+	 * @param final_layout Layout to leave the image in when a frame ends, VK_IMAGE_LAYOUT_UNDEFINED to keep the last one
+	 */
+	RenderGraphImage import_image(const std::string &name, const core::ImageView &view, VkImageLayout initial_layout, VkImageLayout final_layout);
+
+	void set_imported_image(RenderGraphImage image, const core::ImageView &view);
+
+	/**
+	 * @brief Declares a pass
+	 * @param setup Called immediately, declares the accesses of the pass
+	 * @param execute Called by execute() for every frame the pass is not culled, records the pass
+	 */
+	void add_pass(const std::string                                &name,
+	              RenderGraphQueue                                  queue,
+	              const std::function<void(PassBuilder &)>          &setup,
+	              std::function<void(vkb::core::CommandBufferC &)> &&execute);
+
+	/**
+	 * @brief Culls, schedules and synchronizes the declared passes, and allocates the transient images
+	 *        Must be called after the last pass is declared and before execute().
+	 */
+	void compile();
+
+	/**
+	 * @brief Records and submits the passes for the active frame
+	 *        Cross-queue dependencies use the queue timelines of the render context when it uses timeline synchronization
+	 * @return Semaphore signaled once the backbuffer is rendered, to be passed to RenderContext::end_frame()
+	 */
+	VkSemaphore execute();
+
+	/**
+	 * @brief Records the passes for the active frame into a command buffer the caller submits, e.g. the one of vkb::VulkanSample::draw()
+	 *        Only valid when compile() scheduled every pass in a single submission on the graphics queue,
+	 *        which is the case when no pass runs on the async compute queue.
+	 */
+	void record(vkb::core::CommandBufferC &command_buffer);
+
+	/**
+	 * @brief Waits for the device, then forgets every declaration and frees the transient images
+	 */
+	void reset();
+
+	/**
+	 * @brief Runs AsyncCompute passes on a separate compute queue, if the device has one. Takes effect on compile().
+	 */
+	void set_async_compute_enabled(bool enabled);
+
+	/**
+	 * @return Whether AsyncCompute passes run on a separate queue, valid after compile()
+	 */
+	bool is_async_compute_active() const;
+
+	/**
+	 * @return Image created by compile() for a transient image, e.g. to build a RenderTarget from
+	 */
+	core::Image &get_image(RenderGraphImage image);
+
+	const core::ImageView &get_image_view(RenderGraphImage image) const;
+
+	const RenderGraphImageDesc &get_image_desc(RenderGraphImage image) const;
+
+	/**
+	 * @return Statistics of the last compile() call
+	 */
+	const Statistics &get_statistics() const;
+
+  private:
+	/// Index of a queue the graph submits to
+	enum QueueIndex : uint32_t
+	{
+		GraphicsQueue = 0,
+		ComputeQueue  = 1,
+		QueueCount    = 2
+	};
+
+	struct ImageResource
+	{
+		std::string name;
+
+		RenderGraphImageDesc desc;
+
+		bool imported{false};
+
+		const core::ImageView *imported_view{nullptr};
+
+		VkImageLayout initial_layout{VK_IMAGE_LAYOUT_UNDEFINED};
+
+		VkImageLayout final_layout{VK_IMAGE_LAYOUT_UNDEFINED};
+
+		/// Usage accumulated from the accesses of the passes that are not culled
+		VkImageUsageFlags usage{0};
+
+		/// First and last scheduled pass accessing the image, or ~0 if none does
+		uint32_t first_pass{~0u};
+
+		uint32_t last_pass{~0u};
+
+		VkMemoryRequirements memory_requirements{};
+
+		VkDeviceSize memory_offset{0};
+
+		VkImage handle{VK_NULL_HANDLE};
+
+		std::unique_ptr<core::Image> image;
+
+		std::unique_ptr<core::ImageView> view;
+	};
+
+	struct ImageAccess
+	{
+		uint32_t image;
+
+		RenderGraphAccess access;
+	};
+
+	/// Barrier on an image, whose handle is only known when the barrier is recorded
+	struct ImageBarrier
+	{
+		uint32_t image;
+
+		VkImageMemoryBarrier2KHR barrier;
+	};
+
+	struct Pass
+	{
+		std::string name;
+
+		RenderGraphQueue requested_queue;
+
+		std::vector<ImageAccess> accesses;
+
+		std::function<void(vkb::core::CommandBufferC &)> execute;
+
+		bool side_effect{false};
+
+		bool writes_backbuffer{false};
+
+		bool culled{false};
+
+		uint32_t batch{~0u};
+
+		/// Barriers recorded before the pass
+		std::vector<ImageBarrier> barriers;
+	};
+
+	/// A semaphore wait of a batch on a batch of the other queue
+	struct BatchWait
+	{
+		uint32_t batch;
+
+		VkPipelineStageFlags2KHR stages;
+
+		/// Whether the batch signaling the semaphore belongs to the previous frame
+		bool previous_frame;
+
+		/// Semaphore carried from the previous frame, valid for previous_frame waits only, and without timeline synchronization
+		VkSemaphore carried_semaphore{VK_NULL_HANDLE};
+	};
+
+	/// Passes recorded in one command buffer and submitted together
+	struct Batch
+	{
+		QueueIndex queue;
+
+		std::vector<uint32_t> passes;
+
+		std::vector<BatchWait> waits;
+
+		/// Ownership releases and final layout transitions recorded after the last pass
+		std::vector<ImageBarrier> end_barriers;
+
+		/// Whether the batch waits for the swapchain image and signals the semaphore returned by execute()
+		bool presents{false};
+
+		/// Value of the timeline semaphore of its queue signaled by the last submission of the batch, with timeline synchronization
+		uint64_t timeline_value{0};
+	};
+
+	/// Reference to the batch which last accessed an image, in this frame or the previous one
+	struct BatchRef
+	{
+		uint32_t batch{~0u};
+
+		bool previous_frame{false};
+
+		bool is_valid() const
+		{
+			return batch != ~0u;
+		}
+	};
+
+	/// Synchronization state of an image while barriers are derived
+	struct ImageState
+	{
+		VkImageLayout layout{VK_IMAGE_LAYOUT_UNDEFINED};
+
+		uint32_t owner_family{VK_QUEUE_FAMILY_IGNORED};
+
+		BatchRef owner_batch;
+
+		BatchRef write_batch;
+
+		VkPipelineStageFlags2KHR write_stages{0};
+
+		VkAccessFlags2KHR write_access{0};
+
+		/// Per queue, the reads since the last write
+		BatchRef read_batches[QueueCount];
+
+		VkPipelineStageFlags2KHR read_stages[QueueCount]{};
+
+		/// Per queue, the stages the last write is visible to
+		VkPipelineStageFlags2KHR visible_stages[QueueCount]{};
+	};
+
+	void add_access(uint32_t pass_index, RenderGraphImage image, RenderGraphAccess access, bool write);
+
+	void cull_passes();
+
+	void schedule_batches();
+
+	void allocate_transient_images();
+
+	/**
+	 * @brief Simulates one frame from the given image states, adding barriers and semaphore waits
+	 */
+	void synchronize(std::vector<ImageState> &states, bool record);
+
+	void add_wait(uint32_t batch, BatchRef signal_batch, VkPipelineStageFlags2KHR stages, bool record);
+
+	void prune_waits();
+
+	void record_batch(vkb::core::CommandBufferC &command_buffer, const Batch &batch);
+
+	/**
+	 * @brief Submits the batches of execute() with timeline synchronization, waiting for the values of the queue timelines
+	 *        the batches they depend on signaled, in this frame or the previous one, instead of binary semaphores
+	 */
+	VkSemaphore submit_timeline();
+
+	void record_barriers(vkb::core::CommandBufferC &command_buffer, const std::vector<ImageBarrier> &barriers);
+
+	void destroy_transient_images();
+
+	void destroy_carried_semaphores();
+
+	VkImage get_image_handle(uint32_t image) const;
+
+	const Queue &get_queue(QueueIndex queue) const;
+
+	vkb::rendering::RenderContextC &render_context;
+
+	Device &device;
+
+	bool synchronization2;
+
+	bool async_compute_enabled{true};
+
+	const Queue *graphics_queue{nullptr};
+
+	/// Separate queue AsyncCompute passes run on, or nullptr if the device has none
+	const Queue *compute_queue{nullptr};
+
+	bool compiled{false};
+
+	std::vector<ImageResource> images;
+
+	std::vector<Pass> passes;
+
+	std::vector<Batch> batches;
+
+	/// Shared memory transient images are bound to
+	VmaAllocation transient_allocation{VK_NULL_HANDLE};
+
+	Statistics statistics;
+};
+}        // namespace vkb
@@ -17,6 +17,7 @@
 
 #include "render_pipeline.h"
 
+#include "rendering/subpasses/geometry_subpass.h"
 #include "scene_graph/components/camera.h"
 #include "scene_graph/components/image.h"
 #include "scene_graph/components/material.h"
@@ -86,6 +87,16 @@ void RenderPipeline::set_clear_value(const std::vector<VkClearValue> &cv)
 	clear_value = cv;
 }
 
+void RenderPipeline::set_thread_count(uint32_t count)
+{
+	thread_count = std::max(count, 1u);
+}
+
+uint32_t RenderPipeline::get_thread_count() const
+{
+	return thread_count;
+}
+
 void RenderPipeline::draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &render_target, VkSubpassContents contents)
 {
 	assert(!subpasses.empty() && "Render pipeline should contain at least one sub-pass");
@@ -104,27 +115,46 @@ void RenderPipeline::draw(vkb::core::CommandBufferC &command_buffer, RenderTarge
 
 		subpass->update_render_target_attachments(render_target);
 
+		// Geometry subpasses are recorded in secondary command buffers when recorded in parallel
+		auto *parallel_subpass = thread_count > 1 ? dynamic_cast<GeometrySubpass *>(subpass.get()) : nullptr;
+
+		last_subpass_contents = parallel_subpass ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : contents;
+
 		if (i == 0)
 		{
-			command_buffer.begin_render_pass(render_target, load_store, clear_value, subpasses, contents);
+			command_buffer.begin_render_pass(render_target, load_store, clear_value, subpasses, last_subpass_contents);
 		}
 		else
 		{
-			command_buffer.next_subpass();
+			command_buffer.next_subpass(last_subpass_contents);
 		}
 
 		if (subpass->get_debug_name().empty())
 		{
 			subpass->set_debug_name(fmt::format("RP subpass #{}", i));
 		}
-		ScopedDebugLabel subpass_debug_label{command_buffer, subpass->get_debug_name().c_str()};
 
-		subpass->draw(command_buffer);
+		if (parallel_subpass)
+		{
+			// Only secondary command buffers may be executed in this subpass, so they carry its label instead, untimed by the GPU profiler
+			parallel_subpass->draw_parallel(command_buffer, render_target.get_extent(), thread_count);
+		}
+		else
+		{
+			ScopedDebugLabel subpass_debug_label{command_buffer, subpass->get_debug_name().c_str()};
+
+			subpass->draw(command_buffer);
+		}
 	}
 
 	active_subpass_index = 0;
 }
 
+VkSubpassContents RenderPipeline::get_last_subpass_contents() const
+{
+	return last_subpass_contents;
+}
+
 std::unique_ptr<vkb::rendering::SubpassC> &RenderPipeline::get_active_subpass()
 {
 	return subpasses[active_subpass_index];
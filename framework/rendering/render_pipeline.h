@@ -84,11 +84,27 @@ class RenderPipeline
 
 	std::vector<std::unique_ptr<vkb::rendering::SubpassC>> &get_subpasses();
 
+	/**
+	 * @brief Sets the number of threads recording the draws of the geometry subpasses in parallel
+	 *        When above 1, every GeometrySubpass is begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+	 *        and records its draws with GeometrySubpass::draw_parallel, the other subpasses are recorded inline
+	 * @param thread_count Number of threads, limited to the thread count of the render context
+	 */
+	void set_thread_count(uint32_t thread_count);
+
+	uint32_t get_thread_count() const;
+
 	/**
 	 * @brief Record draw commands for each Subpass
 	 */
 	void draw(vkb::core::CommandBufferC &command_buffer, RenderTarget &render_target, VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
 
+	/**
+	 * @return How the contents of the last subpass were recorded by the last draw, which the commands recorded
+	 *         after draw in the same subpass must follow
+	 */
+	VkSubpassContents get_last_subpass_contents() const;
+
 	/**
 	 * @return Subpass currently being recorded, or the first one
 	 *         if drawing has not started
@@ -105,5 +121,9 @@ class RenderPipeline
 	std::vector<VkClearValue> clear_value = std::vector<VkClearValue>(2);
 
 	size_t active_subpass_index{0};
+
+	uint32_t thread_count{1};
+
+	VkSubpassContents last_subpass_contents{VK_SUBPASS_CONTENTS_INLINE};
 };
 }        // namespace vkb
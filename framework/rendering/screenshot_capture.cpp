@@ -0,0 +1,295 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rendering/screenshot_capture.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "core/command_buffer.h"
+#include "filesystem/legacy.h"
+#include "rendering/render_context.h"
+
+namespace vkb
+{
+namespace
+{
+/**
+ * @brief Copies 8-bit four component pixels, replacing alpha with 255 and optionally swapping R and B
+ *        Working on whole 32-bit pixels with the branch hoisted out of the loops lets the compiler vectorize both loops.
+ */
+void convert_to_opaque_rgba(const uint32_t *src, uint32_t *dst, size_t pixel_count, bool swizzle)
+{
+	if (swizzle)
+	{
+		for (size_t i = 0; i < pixel_count; ++i)
+		{
+			uint32_t pixel = src[i];
+			dst[i]         = ((pixel & 0x000000ffu) << 16) | (pixel & 0x0000ff00u) | ((pixel & 0x00ff0000u) >> 16) | 0xff000000u;
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < pixel_count; ++i)
+		{
+			dst[i] = src[i] | 0xff000000u;
+		}
+	}
+}
+}        // namespace
+
+ScreenshotCapture::ScreenshotCapture(vkb::rendering::RenderContextC &render_context, uint32_t ring_size) :
+    render_context{render_context},
+    command_pool{render_context.get_device(),
+                 render_context.get_device().get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0).get_family_index(),
+                 nullptr,
+                 0,
+                 vkb::CommandBufferResetMode::ResetIndividually},
+    slots(std::max(ring_size, 1u))
+{
+	VkFenceCreateInfo fence_info{VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+
+	for (auto &slot : slots)
+	{
+		slot.command_buffer = &command_pool.request_command_buffer();
+		VK_CHECK(vkCreateFence(render_context.get_device().get_handle(), &fence_info, nullptr, &slot.fence));
+	}
+
+	worker_thread = std::thread([this] { worker_loop(); });
+}
+
+ScreenshotCapture::~ScreenshotCapture()
+{
+	flush();
+
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		stop_worker = true;
+	}
+	condition.notify_all();
+	worker_thread.join();
+
+	for (auto &slot : slots)
+	{
+		vkDestroyFence(render_context.get_device().get_handle(), slot.fence, nullptr);
+	}
+}
+
+void ScreenshotCapture::capture(const std::string &filename)
+{
+	assert(render_context.get_format() == VK_FORMAT_R8G8B8A8_UNORM ||
+	       render_context.get_format() == VK_FORMAT_B8G8R8A8_UNORM ||
+	       render_context.get_format() == VK_FORMAT_R8G8B8A8_SRGB ||
+	       render_context.get_format() == VK_FORMAT_B8G8R8A8_SRGB);
+
+	std::unique_lock<std::mutex> lock{mutex};
+
+	size_t slot_index = next_slot;
+	next_slot         = (next_slot + 1) % slots.size();
+
+	auto &slot = slots[slot_index];
+
+	// The ring wrapped around before the oldest capture was done with its slot
+	if (slot.state == SlotState::Copying)
+	{
+		retire(slot_index, lock);
+	}
+	condition.wait(lock, [&slot] { return slot.state == SlotState::Free; });
+
+	slot.filename = filename;
+	slot.state    = SlotState::Copying;
+	++pending_count;
+
+	lock.unlock();
+
+	record_copy(slot);
+}
+
+void ScreenshotCapture::poll()
+{
+	std::unique_lock<std::mutex> lock{mutex};
+
+	for (size_t i = 0; i < slots.size(); ++i)
+	{
+		if (slots[i].state == SlotState::Copying && vkGetFenceStatus(render_context.get_device().get_handle(), slots[i].fence) == VK_SUCCESS)
+		{
+			retire(i, lock);
+		}
+	}
+}
+
+void ScreenshotCapture::flush()
+{
+	std::unique_lock<std::mutex> lock{mutex};
+
+	for (size_t i = 0; i < slots.size(); ++i)
+	{
+		if (slots[i].state == SlotState::Copying)
+		{
+			retire(i, lock);
+		}
+	}
+
+	condition.wait(lock, [this] { return pending_count == 0; });
+}
+
+size_t ScreenshotCapture::get_pending_count()
+{
+	std::lock_guard<std::mutex> lock{mutex};
+	return pending_count;
+}
+
+void ScreenshotCapture::retire(size_t slot_index, std::unique_lock<std::mutex> &lock)
+{
+	auto &slot = slots[slot_index];
+	assert(lock.owns_lock() && slot.state == SlotState::Copying);
+
+	VK_CHECK(vkWaitForFences(render_context.get_device().get_handle(), 1, &slot.fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+
+	slot.state = SlotState::Converting;
+	conversion_queue.push_back(slot_index);
+	condition.notify_all();
+}
+
+void ScreenshotCapture::record_copy(ReadbackSlot &slot)
+{
+	// We want the last completed frame since we don't want to be reading from an incomplete framebuffer
+	auto &frame = render_context.get_last_rendered_frame();
+	assert(!frame.get_render_target().get_views().empty());
+	auto &src_image_view = frame.get_render_target().get_views()[0];
+
+	slot.extent   = render_context.get_surface_extent();
+	auto dst_size = static_cast<VkDeviceSize>(slot.extent.width) * slot.extent.height * 4;
+
+	// Readback buffers are kept across captures, and only recreated when the surface is resized
+	if (!slot.buffer || slot.buffer->get_size() != dst_size)
+	{
+		slot.buffer = std::make_unique<vkb::core::BufferC>(render_context.get_device(),
+		                                                   dst_size,
+		                                                   VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		                                                   VMA_MEMORY_USAGE_GPU_TO_CPU,
+		                                                   VMA_ALLOCATION_CREATE_MAPPED_BIT);
+	}
+
+	// Check if framebuffer images are in a BGR format
+	auto bgr_formats = {VK_FORMAT_B8G8R8A8_SRGB, VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SNORM};
+	slot.swizzle     = std::find(bgr_formats.begin(), bgr_formats.end(), src_image_view.get_format()) != bgr_formats.end();
+
+	auto &cmd_buf = *slot.command_buffer;
+
+	cmd_buf.reset(vkb::CommandBufferResetMode::ResetIndividually);
+	cmd_buf.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
+	// Enable framebuffer image view to be read from
+	{
+		ImageMemoryBarrier memory_barrier{};
+		memory_barrier.old_layout     = render_context.get_final_layout();
+		memory_barrier.new_layout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		memory_barrier.src_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		memory_barrier.dst_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+		cmd_buf.image_memory_barrier(src_image_view, memory_barrier);
+	}
+
+	// Copy framebuffer image memory
+	VkBufferImageCopy image_copy_region{};
+	image_copy_region.bufferRowLength             = slot.extent.width;
+	image_copy_region.bufferImageHeight           = slot.extent.height;
+	image_copy_region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	image_copy_region.imageSubresource.layerCount = 1;
+	image_copy_region.imageExtent.width           = slot.extent.width;
+	image_copy_region.imageExtent.height          = slot.extent.height;
+	image_copy_region.imageExtent.depth           = 1;
+
+	cmd_buf.copy_image_to_buffer(src_image_view.get_image(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, *slot.buffer, {image_copy_region});
+
+	// Make the copy visible to the host once the fence is signaled
+	{
+		BufferMemoryBarrier memory_barrier{};
+		memory_barrier.src_access_mask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		memory_barrier.dst_access_mask = VK_ACCESS_HOST_READ_BIT;
+		memory_barrier.src_stage_mask  = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		memory_barrier.dst_stage_mask  = VK_PIPELINE_STAGE_HOST_BIT;
+
+		cmd_buf.buffer_memory_barrier(*slot.buffer, 0, dst_size, memory_barrier);
+	}
+
+	// Revert back the framebuffer image view from transfer to its final layout
+	// Nothing waits for the copy, so chain it with the color output of the next frame rendering to this image
+	{
+		ImageMemoryBarrier memory_barrier{};
+		memory_barrier.old_layout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		memory_barrier.new_layout     = render_context.get_final_layout();
+		memory_barrier.src_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		memory_barrier.dst_stage_mask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+		cmd_buf.image_memory_barrier(src_image_view, memory_barrier);
+	}
+
+	cmd_buf.end();
+
+	VK_CHECK(vkResetFences(render_context.get_device().get_handle(), 1, &slot.fence));
+
+	const auto &queue = render_context.get_device().get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
+	VK_CHECK(queue.submit(cmd_buf, slot.fence));
+}
+
+void ScreenshotCapture::worker_loop()
+{
+	std::vector<uint32_t> pixels;
+
+	while (true)
+	{
+		std::unique_lock<std::mutex> lock{mutex};
+		condition.wait(lock, [this] { return stop_worker || !conversion_queue.empty(); });
+
+		if (conversion_queue.empty())
+		{
+			return;
+		}
+
+		size_t slot_index = conversion_queue.front();
+		conversion_queue.pop_front();
+
+		auto       &slot     = slots[slot_index];
+		VkExtent2D  extent   = slot.extent;
+		std::string filename = std::move(slot.filename);
+		lock.unlock();
+
+		// Only the worker touches a slot while it is converting, so the readback buffer can be read without the lock
+		size_t pixel_count = static_cast<size_t>(extent.width) * extent.height;
+		pixels.resize(pixel_count);
+		convert_to_opaque_rgba(reinterpret_cast<const uint32_t *>(slot.buffer->get_data()), pixels.data(), pixel_count, slot.swizzle);
+
+		lock.lock();
+		slot.state = SlotState::Free;
+		condition.notify_all();
+		lock.unlock();
+
+		vkb::fs::write_image(reinterpret_cast<const uint8_t *>(pixels.data()),
+		                     filename,
+		                     extent.width,
+		                     extent.height,
+		                     4,
+		                     extent.width * 4);
+
+		lock.lock();
+		--pending_count;
+		condition.notify_all();
+	}
+}
+}        // namespace vkb
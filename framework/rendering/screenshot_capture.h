@@ -0,0 +1,147 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/vk_common.h"
+#include "core/buffer.h"
+#include "core/command_pool.h"
+
+namespace vkb
+{
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC = RenderContext<vkb::BindingType::C>;
+}        // namespace rendering
+
+/**
+ * @brief Captures the last rendered swapchain image to a PNG file without stalling the frame loop
+ *
+ * Each capture records a copy into one slot of a ring of host-visible readback buffers and submits
+ * it with the fence of that slot. The fence is only waited on when the slot is needed again, or on
+ * flush(); poll() hands finished readbacks over without blocking. Converting the pixels to opaque
+ * RGBA and encoding the PNG both happen on a worker thread, and a slot is released as soon as its
+ * pixels have been converted, so a slow encode does not hold on to a readback buffer.
+ */
+class ScreenshotCapture
+{
+  public:
+	static constexpr uint32_t DEFAULT_RING_SIZE = 3;
+
+	ScreenshotCapture(vkb::rendering::RenderContextC &render_context, uint32_t ring_size = DEFAULT_RING_SIZE);
+
+	ScreenshotCapture(const ScreenshotCapture &) = delete;
+
+	ScreenshotCapture(ScreenshotCapture &&) = delete;
+
+	/**
+	 * @brief Waits for every capture to be written to disk
+	 */
+	~ScreenshotCapture();
+
+	ScreenshotCapture &operator=(const ScreenshotCapture &) = delete;
+
+	ScreenshotCapture &operator=(ScreenshotCapture &&) = delete;
+
+	/**
+	 * @brief Records and submits the copy of the last rendered frame
+	 *        Only blocks if every slot of the ring is still in use.
+	 * @param filename The name of the file to save the output to
+	 */
+	void capture(const std::string &filename);
+
+	/**
+	 * @brief Hands the readbacks which completed on the GPU over to the worker thread, without blocking
+	 */
+	void poll();
+
+	/**
+	 * @brief Waits until every capture requested so far has been written to disk
+	 */
+	void flush();
+
+	/**
+	 * @return The number of captures which have not been written to disk yet
+	 */
+	size_t get_pending_count();
+
+  private:
+	enum class SlotState
+	{
+		Free,
+		Copying,
+		Converting
+	};
+
+	struct ReadbackSlot
+	{
+		std::unique_ptr<vkb::core::BufferC> buffer;
+
+		vkb::core::CommandBufferC *command_buffer{nullptr};
+
+		VkFence fence{VK_NULL_HANDLE};
+
+		SlotState state{SlotState::Free};
+
+		std::string filename;
+
+		VkExtent2D extent{};
+
+		bool swizzle{false};
+	};
+
+	/// Must be called with the mutex locked, waits for the copy of the slot and queues it for conversion
+	void retire(size_t slot_index, std::unique_lock<std::mutex> &lock);
+
+	void record_copy(ReadbackSlot &slot);
+
+	void worker_loop();
+
+	vkb::rendering::RenderContextC &render_context;
+
+	vkb::core::CommandPoolC command_pool;
+
+	std::vector<ReadbackSlot> slots;
+
+	size_t next_slot{0};
+
+	/// Protects the slot states, the conversion queue and the counters below
+	std::mutex mutex;
+
+	/// Notified whenever a slot is queued for conversion, released or a file has been written
+	std::condition_variable condition;
+
+	std::deque<size_t> conversion_queue;
+
+	/// Number of captures submitted and not yet written to disk
+	size_t pending_count{0};
+
+	bool stop_worker{false};
+
+	std::thread worker_thread;
+};
+}        // namespace vkb
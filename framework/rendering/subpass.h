@@ -20,15 +20,14 @@
 
 #include "buffer_pool.h"
 #include "rendering/hpp_pipeline_state.h"
-#include "rendering/hpp_render_frame.h"
 #include "rendering/hpp_render_target.h"
 #include "rendering/pipeline_state.h"
+#include "rendering/render_frame.h"
 #include "scene_graph/components/light.h"
 #include "scene_graph/node.h"
 
 namespace vkb
 {
-class RenderContext;
 class RenderTarget;
 class ShaderSource;
 
@@ -40,7 +39,9 @@ class CommandBuffer;
 
 namespace rendering
 {
-class HPPRenderContext;
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextCpp = RenderContext<vkb::BindingType::Cpp>;
 
 struct alignas(16) Light
 {
@@ -87,7 +88,7 @@ class Subpass
 
 	using DepthStencilStateType =
 	    typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPDepthStencilState, vkb::DepthStencilState>::type;
-	using RenderContextType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPRenderContext, vkb::RenderContext>::type;
+	using RenderContextType = vkb::rendering::RenderContext<bindingType>;
 	using RenderTargetType  = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPRenderTarget, vkb::RenderTarget>::type;
 
   public:
@@ -186,7 +187,7 @@ class Subpass
 	/// Default to swapchain output attachment
 	std::vector<uint32_t> output_attachments = {0};
 
-	vkb::rendering::HPPRenderContext &render_context;
+	vkb::rendering::RenderContextCpp &render_context;
 
 	// A map of shader resource names and the mode of constant data
 	std::unordered_map<std::string, ShaderResourceMode> resource_mode_map;
@@ -200,7 +201,7 @@ using SubpassCpp = Subpass<vkb::BindingType::Cpp>;
 }        // namespace rendering
 }        // namespace vkb
 
-#include "rendering/hpp_render_context.h"
+#include "rendering/render_context.h"
 
 namespace vkb
 {
@@ -217,7 +218,7 @@ inline glm::mat4 vulkan_style_projection(const glm::mat4 &proj)
 
 template <vkb::BindingType bindingType>
 inline Subpass<bindingType>::Subpass(RenderContextType &render_context, ShaderSource &&vertex_source, ShaderSource &&fragment_source) :
-    render_context{reinterpret_cast<vkb::rendering::HPPRenderContext &>(render_context)},
+    render_context{reinterpret_cast<vkb::rendering::RenderContextCpp &>(render_context)},
     vertex_shader{std::move(vertex_source)},
     fragment_shader{std::move(fragment_source)}
 {
@@ -257,7 +258,7 @@ inline typename vkb::rendering::Subpass<bindingType>::RenderContextType &Subpass
 	}
 	else
 	{
-		return reinterpret_cast<vkb::RenderContext &>(render_context);
+		return reinterpret_cast<vkb::rendering::RenderContext<bindingType> &>(render_context);
 	}
 }
 
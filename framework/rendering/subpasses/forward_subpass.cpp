@@ -32,7 +32,7 @@
 
 namespace vkb
 {
-ForwardSubpass::ForwardSubpass(RenderContext &render_context, ShaderSource &&vertex_source, ShaderSource &&fragment_source, sg::Scene &scene_, sg::Camera &camera) :
+ForwardSubpass::ForwardSubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_source, ShaderSource &&fragment_source, sg::Scene &scene_, sg::Camera &camera) :
     GeometrySubpass{render_context, std::move(vertex_source), std::move(fragment_source), scene_, camera}
 {
 }
@@ -51,6 +51,11 @@ void ForwardSubpass::prepare()
 
 			variant.add_definitions(vkb::rendering::light_type_definitions);
 
+			if (light_clusters)
+			{
+				variant.add_definitions(light_clusters->get_shader_definitions());
+			}
+
 			auto &vert_module = device.get_resource_cache().request_shader_module(VK_SHADER_STAGE_VERTEX_BIT, get_vertex_shader(), variant);
 			auto &frag_module = device.get_resource_cache().request_shader_module(VK_SHADER_STAGE_FRAGMENT_BIT, get_fragment_shader(), variant);
 		}
@@ -59,9 +64,61 @@ void ForwardSubpass::prepare()
 
 void ForwardSubpass::draw(vkb::core::CommandBufferC &command_buffer)
 {
-	allocate_lights<ForwardLights>(scene.get_components<sg::Light>(), MAX_FORWARD_LIGHT_COUNT);
-	command_buffer.bind_lighting(get_lighting_state(), 0, 4);
+	update_lights();
 
 	GeometrySubpass::draw(command_buffer);
 }
+
+void ForwardSubpass::draw_parallel(vkb::core::CommandBufferC &primary_command_buffer, const VkExtent2D &extent, uint32_t thread_count)
+{
+	update_lights();
+
+	GeometrySubpass::draw_parallel(primary_command_buffer, extent, thread_count);
+}
+
+void ForwardSubpass::update_lights()
+{
+	if (light_clusters)
+	{
+		auto scene_lights = scene.get_components<sg::Light>();
+
+		// With GPU culling, the clusters have been updated and culled before the render pass began
+		if (light_clusters->get_culling_mode() == LightCullingMode::CPU)
+		{
+			light_clusters->update(scene_lights, camera, get_render_context().get_active_frame().get_render_target().get_extent());
+		}
+
+		// Only directional lights go through the fixed size uniform, the others are read from the clusters
+		scene_lights.erase(std::remove_if(scene_lights.begin(), scene_lights.end(), [](sg::Light *light) { return light->get_light_type() != sg::LightType::Directional; }),
+		                   scene_lights.end());
+		allocate_lights<ForwardLights>(scene_lights, MAX_FORWARD_LIGHT_COUNT);
+	}
+	else
+	{
+		allocate_lights<ForwardLights>(scene.get_components<sg::Light>(), MAX_FORWARD_LIGHT_COUNT);
+	}
+}
+
+void ForwardSubpass::bind_draw_state(vkb::core::CommandBufferC &command_buffer)
+{
+	GeometrySubpass::bind_draw_state(command_buffer);
+
+	command_buffer.bind_lighting(get_lighting_state(), 0, 4);
+
+	if (light_clusters)
+	{
+		light_clusters->bind(command_buffer, 0, 5);
+	}
+}
+
+LightClusters &ForwardSubpass::enable_clustered_lighting(const glm::uvec3 &grid_size, uint32_t max_lights_per_cluster)
+{
+	light_clusters = std::make_unique<LightClusters>(get_render_context(), grid_size, max_lights_per_cluster);
+	return *light_clusters;
+}
+
+LightClusters *ForwardSubpass::get_light_clusters()
+{
+	return light_clusters.get();
+}
 }        // namespace vkb
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "buffer_pool.h"
+#include "rendering/light_clusters.h"
 #include "rendering/subpasses/geometry_subpass.h"
 
 // This value is per type of light that we feed into the shader
@@ -55,7 +56,7 @@ class ForwardSubpass : public GeometrySubpass
 	 * @param scene Scene to render on this subpass
 	 * @param camera Camera used to look at the scene
 	 */
-	ForwardSubpass(RenderContext &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Scene &scene, sg::Camera &camera);
+	ForwardSubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Scene &scene, sg::Camera &camera);
 
 	virtual ~ForwardSubpass() = default;
 
@@ -65,6 +66,37 @@ class ForwardSubpass : public GeometrySubpass
 	 * @brief Record draw commands
 	 */
 	virtual void draw(vkb::core::CommandBufferC &command_buffer) override;
+
+	virtual void draw_parallel(vkb::core::CommandBufferC &primary_command_buffer, const VkExtent2D &extent, uint32_t thread_count) override;
+
+	/**
+	 * @brief Shades point and spot lights through a cluster grid instead of the fixed size light uniform,
+	 *        lifting the MAX_FORWARD_LIGHT_COUNT limit for those types. Must be called before prepare().
+	 *        The fragment shader needs to include clustered_lighting.h, as base.frag does.
+	 * @param grid_size Number of clusters along the screen width, height and depth
+	 * @param max_lights_per_cluster Lights above this count in a single cluster are dropped
+	 * @return The light clusters, e.g. to switch them to GPU culling
+	 */
+	LightClusters &enable_clustered_lighting(const glm::uvec3 &grid_size = {16, 9, 24}, uint32_t max_lights_per_cluster = 256);
+
+	/**
+	 * @return The light clusters, or nullptr if clustered lighting is not enabled
+	 */
+	LightClusters *get_light_clusters();
+
+  protected:
+	/**
+	 * @brief Binds the lights, and the light clusters if enabled
+	 */
+	virtual void bind_draw_state(vkb::core::CommandBufferC &command_buffer) override;
+
+  private:
+	/**
+	 * @brief Updates the lights of the scene for the frame, before their draws are recorded
+	 */
+	void update_lights();
+
+	std::unique_ptr<LightClusters> light_clusters;
 };
 
 }        // namespace vkb
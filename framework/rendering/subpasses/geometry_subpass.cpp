@@ -16,9 +16,15 @@
  */
 
 #include "rendering/subpasses/geometry_subpass.h"
+
+#include <algorithm>
+#include <atomic>
+
 #include "common/utils.h"
 #include "common/vk_common.h"
+#include "job_system.h"
 #include "rendering/render_context.h"
+#include "rendering/texture_streamer.h"
 #include "scene_graph/components/camera.h"
 #include "scene_graph/components/image.h"
 #include "scene_graph/components/material.h"
@@ -30,7 +36,49 @@
 
 namespace vkb
 {
-GeometrySubpass::GeometrySubpass(RenderContext &render_context, ShaderSource &&vertex_source, ShaderSource &&fragment_source, sg::Scene &scene_, sg::Camera &camera) :
+namespace
+{
+/// Fewest draws worth a secondary command buffer of their own
+constexpr uint32_t min_draws_per_chunk = 32;
+
+/// Chunks per recording thread, so that threads done early take over the chunks left
+constexpr uint32_t chunks_per_thread = 4;
+
+struct DrawChunk
+{
+	uint32_t begin;
+
+	uint32_t end;
+
+	bool transparent;
+};
+
+void split_in_chunks(std::vector<DrawChunk> &chunks, uint32_t draw_count, uint32_t thread_count, bool transparent)
+{
+	if (draw_count == 0)
+	{
+		return;
+	}
+
+	uint32_t chunk_count = std::clamp((draw_count + min_draws_per_chunk - 1) / min_draws_per_chunk, 1u, thread_count * chunks_per_thread);
+	uint32_t chunk_size  = (draw_count + chunk_count - 1) / chunk_count;
+
+	for (uint32_t begin = 0; begin < draw_count; begin += chunk_size)
+	{
+		chunks.push_back({begin, std::min(draw_count, begin + chunk_size), transparent});
+	}
+}
+
+VkFrontFace get_front_face(const sg::Node &node)
+{
+	// Invert the front face if the mesh was flipped
+	const auto &scale   = node.get_transform().get_scale();
+	bool        flipped = scale.x * scale.y * scale.z < 0;
+	return flipped ? VK_FRONT_FACE_CLOCKWISE : VK_FRONT_FACE_COUNTER_CLOCKWISE;
+}
+}        // namespace
+
+GeometrySubpass::GeometrySubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_source, ShaderSource &&fragment_source, sg::Scene &scene_, sg::Camera &camera) :
     Subpass{render_context, std::move(vertex_source), std::move(fragment_source)},
     meshes{scene_.get_components<sg::Mesh>()},
     camera{camera},
@@ -85,6 +133,42 @@ void GeometrySubpass::get_sorted_nodes(std::multimap<float, std::pair<sg::Node *
 	}
 }
 
+uint32_t GeometrySubpass::select_lod(sg::Node &node, const sg::SubMesh &sub_mesh)
+{
+	if (sub_mesh.lods.empty() || lod_threshold <= 0.0f || !node.has_component<sg::Mesh>())
+	{
+		return 0;
+	}
+
+	auto node_transform = node.get_transform().get_world_matrix();
+
+	const sg::AABB &mesh_bounds = node.get_component<sg::Mesh>().get_bounds();
+
+	sg::AABB world_bounds{mesh_bounds.get_min(), mesh_bounds.get_max()};
+	world_bounds.transform(node_transform);
+
+	// Distance to the closest point of the bounds, the camera may be inside them
+	glm::vec3 camera_position = glm::vec3(camera.get_node()->get_transform().get_world_matrix()[3]);
+	float     distance        = glm::distance(camera_position, glm::clamp(camera_position, world_bounds.get_min(), world_bounds.get_max()));
+	if (distance == 0.0f)
+	{
+		return 0;
+	}
+
+	// Pixels covered by a unit of the vertex positions at that distance, through a perspective projection
+	float scale           = std::max({glm::length(glm::vec3(node_transform[0])), glm::length(glm::vec3(node_transform[1])), glm::length(glm::vec3(node_transform[2]))});
+	float viewport_height = static_cast<float>(get_render_context().get_surface_extent().height);
+	float pixels_per_unit = scale * std::abs(camera.get_projection()[1][1]) * 0.5f * viewport_height / distance;
+
+	uint32_t lod = 0;
+	while (lod < sub_mesh.lods.size() && sub_mesh.lods[lod].error * pixels_per_unit <= lod_threshold)
+	{
+		lod++;
+	}
+
+	return lod;
+}
+
 void GeometrySubpass::draw(vkb::core::CommandBufferC &command_buffer)
 {
 	std::multimap<float, std::pair<sg::Node *, sg::SubMesh *>> opaque_nodes;
@@ -92,6 +176,10 @@ void GeometrySubpass::draw(vkb::core::CommandBufferC &command_buffer)
 
 	get_sorted_nodes(opaque_nodes, transparent_nodes);
 
+	last_submitted_triangle_count = submitted_triangle_count.exchange(0);
+
+	bind_draw_state(command_buffer);
+
 	// Draw opaque objects in front-to-back order
 	{
 		ScopedDebugLabel opaque_debug_label{command_buffer, "Opaque objects"};
@@ -100,15 +188,150 @@ void GeometrySubpass::draw(vkb::core::CommandBufferC &command_buffer)
 		{
 			update_uniform(command_buffer, *node_it->second.first, thread_index);
 
-			// Invert the front face if the mesh was flipped
-			const auto &scale      = node_it->second.first->get_transform().get_scale();
-			bool        flipped    = scale.x * scale.y * scale.z < 0;
-			VkFrontFace front_face = flipped ? VK_FRONT_FACE_CLOCKWISE : VK_FRONT_FACE_COUNTER_CLOCKWISE;
+			draw_submesh(command_buffer, *node_it->second.second, get_front_face(*node_it->second.first), select_lod(*node_it->second.first, *node_it->second.second));
+		}
+	}
+
+	set_transparent_state(command_buffer);
+
+	// Draw transparent objects in back-to-front order
+	{
+		ScopedDebugLabel transparent_debug_label{command_buffer, "Transparent objects"};
+
+		for (auto node_it = transparent_nodes.rbegin(); node_it != transparent_nodes.rend(); node_it++)
+		{
+			update_uniform(command_buffer, *node_it->second.first, thread_index);
+
+			draw_submesh(command_buffer, *node_it->second.second, VK_FRONT_FACE_COUNTER_CLOCKWISE, select_lod(*node_it->second.first, *node_it->second.second));
+		}
+	}
+}
+
+void GeometrySubpass::draw_parallel(vkb::core::CommandBufferC &primary_command_buffer, const VkExtent2D &extent, uint32_t thread_count)
+{
+	std::multimap<float, std::pair<sg::Node *, sg::SubMesh *>> opaque_nodes;
+	std::multimap<float, std::pair<sg::Node *, sg::SubMesh *>> transparent_nodes;
+
+	get_sorted_nodes(opaque_nodes, transparent_nodes);
+
+	last_submitted_triangle_count = submitted_triangle_count.exchange(0);
+
+	// Opaque objects in front-to-back order, transparent objects in back-to-front order
+	std::vector<std::pair<sg::Node *, sg::SubMesh *>> opaque_draws;
+	opaque_draws.reserve(opaque_nodes.size());
+	for (auto node_it = opaque_nodes.begin(); node_it != opaque_nodes.end(); node_it++)
+	{
+		opaque_draws.push_back(node_it->second);
+	}
+
+	std::vector<std::pair<sg::Node *, sg::SubMesh *>> transparent_draws;
+	transparent_draws.reserve(transparent_nodes.size());
+	for (auto node_it = transparent_nodes.rbegin(); node_it != transparent_nodes.rend(); node_it++)
+	{
+		transparent_draws.push_back(node_it->second);
+	}
+
+	auto &job_system = JobSystem::get();
+
+	// Every thread records with the resource pools of its own thread index, which must exist in the render frame
+	thread_count = std::min({thread_count, to_u32(get_render_context().get_thread_count()), job_system.get_worker_count() + 1});
+	thread_count = std::max(thread_count, 1u);
+
+	// Chunks never mix opaque and transparent draws, which are recorded with a different state
+	std::vector<DrawChunk> chunks;
+	split_in_chunks(chunks, to_u32(opaque_draws.size()), thread_count, false);
+	split_in_chunks(chunks, to_u32(transparent_draws.size()), thread_count, true);
+
+	if (chunks.empty())
+	{
+		return;
+	}
+
+	thread_count = std::min(thread_count, to_u32(chunks.size()));
+
+	auto &render_frame = get_render_context().get_active_frame();
+	auto &queue        = get_render_context().get_device().get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
+
+	VkViewport viewport{0.0f, 0.0f, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.0f, 1.0f};
+	VkRect2D   scissor{{0, 0}, extent};
+
+	std::vector<vkb::core::CommandBufferC *> secondary_command_buffers(chunks.size());
+	std::atomic<uint32_t>                    next_chunk{0};
+
+	auto record_chunks = [&](uint32_t recording_thread_index) {
+		for (uint32_t chunk_index = next_chunk++; chunk_index < chunks.size(); chunk_index = next_chunk++)
+		{
+			const auto &chunk = chunks[chunk_index];
+
+			// The pools of the render frame are created along with the primary command buffer, with the same reset mode
+			auto &command_buffer =
+			    render_frame.request_command_buffer(queue, CommandBufferResetMode::ResetPool, VK_COMMAND_BUFFER_LEVEL_SECONDARY, recording_thread_index);
+
+			command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, &primary_command_buffer);
+			command_buffer.set_viewport(0, {viewport});
+			command_buffer.set_scissor(0, {scissor});
+
+			{
+				ScopedDebugLabel subpass_debug_label{command_buffer, get_debug_name().c_str()};
+
+				bind_draw_state(command_buffer);
+
+				if (chunk.transparent)
+				{
+					ScopedDebugLabel transparent_debug_label{command_buffer, "Transparent objects"};
+
+					set_transparent_state(command_buffer);
+
+					for (uint32_t i = chunk.begin; i < chunk.end; i++)
+					{
+						update_uniform(command_buffer, *transparent_draws[i].first, recording_thread_index);
+
+						draw_submesh(command_buffer, *transparent_draws[i].second, VK_FRONT_FACE_COUNTER_CLOCKWISE, select_lod(*transparent_draws[i].first, *transparent_draws[i].second));
+					}
+				}
+				else
+				{
+					ScopedDebugLabel opaque_debug_label{command_buffer, "Opaque objects"};
+
+					for (uint32_t i = chunk.begin; i < chunk.end; i++)
+					{
+						update_uniform(command_buffer, *opaque_draws[i].first, recording_thread_index);
+
+						draw_submesh(command_buffer, *opaque_draws[i].second, get_front_face(*opaque_draws[i].first), select_lod(*opaque_draws[i].first, *opaque_draws[i].second));
+					}
+				}
+			}
+
+			command_buffer.end();
 
-			draw_submesh(command_buffer, *node_it->second.second, front_face);
+			secondary_command_buffers[chunk_index] = &command_buffer;
 		}
+	};
+
+	// The calling thread records with the first thread index, the jobs with the others
+	std::vector<JobHandle> recording_jobs;
+	for (uint32_t recording_thread_index = 1; recording_thread_index < thread_count; recording_thread_index++)
+	{
+		recording_jobs.push_back(job_system.schedule([&record_chunks, recording_thread_index]() { record_chunks(recording_thread_index); }, JobPriority::FrameCritical));
 	}
 
+	record_chunks(0);
+
+	job_system.wait(recording_jobs);
+
+	primary_command_buffer.execute_commands(secondary_command_buffers);
+}
+
+void GeometrySubpass::bind_draw_state(vkb::core::CommandBufferC &command_buffer)
+{
+	if (texture_streamer)
+	{
+		texture_streamer->bind_feedback(command_buffer, 0, 9);
+	}
+}
+
+void GeometrySubpass::set_transparent_state(vkb::core::CommandBufferC &command_buffer)
+{
 	// Enable alpha blending
 	ColorBlendAttachmentState color_blend_attachment{};
 	color_blend_attachment.blend_enable           = VK_TRUE;
@@ -125,18 +348,6 @@ void GeometrySubpass::draw(vkb::core::CommandBufferC &command_buffer)
 	command_buffer.set_color_blend_state(color_blend_state);
 
 	command_buffer.set_depth_stencil_state(get_depth_stencil_state());
-
-	// Draw transparent objects in back-to-front order
-	{
-		ScopedDebugLabel transparent_debug_label{command_buffer, "Transparent objects"};
-
-		for (auto node_it = transparent_nodes.rbegin(); node_it != transparent_nodes.rend(); node_it++)
-		{
-			update_uniform(command_buffer, *node_it->second.first, thread_index);
-
-			draw_submesh(command_buffer, *node_it->second.second);
-		}
-	}
 }
 
 void GeometrySubpass::update_uniform(vkb::core::CommandBufferC &command_buffer, sg::Node &node, size_t thread_index)
@@ -160,7 +371,7 @@ void GeometrySubpass::update_uniform(vkb::core::CommandBufferC &command_buffer,
 	command_buffer.bind_buffer(allocation.get_buffer(), allocation.get_offset(), allocation.get_size(), 0, 1, 0);
 }
 
-void GeometrySubpass::draw_submesh(vkb::core::CommandBufferC &command_buffer, sg::SubMesh &sub_mesh, VkFrontFace front_face)
+void GeometrySubpass::draw_submesh(vkb::core::CommandBufferC &command_buffer, sg::SubMesh &sub_mesh, VkFrontFace front_face, uint32_t lod)
 {
 	auto &device = command_buffer.get_device();
 
@@ -177,29 +388,20 @@ void GeometrySubpass::draw_submesh(vkb::core::CommandBufferC &command_buffer, sg
 
 	std::vector<ShaderModule *> shader_modules{&vert_shader_module, &frag_shader_module};
 
-	auto &pipeline_layout = prepare_pipeline_layout(command_buffer, shader_modules);
+	std::unique_lock<std::mutex> pipeline_layout_lock(pipeline_layout_mutex);
+	auto                        &pipeline_layout = prepare_pipeline_layout(command_buffer, shader_modules);
+	pipeline_layout_lock.unlock();
 
 	command_buffer.bind_pipeline_layout(pipeline_layout);
 
-	if (pipeline_layout.get_push_constant_range_stage(sizeof(PBRMaterialUniform)) != 0)
-	{
-		prepare_push_constants(command_buffer, sub_mesh);
-	}
-
-	DescriptorSetLayout &descriptor_set_layout = pipeline_layout.get_descriptor_set_layout(0);
-
-	for (auto &texture : sub_mesh.get_material()->textures)
-	{
-		if (auto layout_binding = descriptor_set_layout.get_layout_binding(texture.first))
-		{
-			command_buffer.bind_image(texture.second->get_image()->get_vk_image_view(),
-			                          texture.second->get_sampler()->vk_sampler,
-			                          0, layout_binding->binding, 0);
-		}
-	}
+	bind_material(command_buffer, pipeline_layout, sub_mesh);
 
 	auto vertex_input_resources = pipeline_layout.get_resources(ShaderResourceType::Input, VK_SHADER_STAGE_VERTEX_BIT);
 
+	// Optimized sub meshes interleave their attributes in a single vertex buffer, bound once
+	const auto &interleaved_buffer_iter = sub_mesh.vertex_buffers.find("vertex_buffer");
+	bool        interleaved             = interleaved_buffer_iter != sub_mesh.vertex_buffers.end();
+
 	VertexInputState vertex_input_state;
 
 	for (auto &input_resource : vertex_input_resources)
@@ -212,15 +414,20 @@ void GeometrySubpass::draw_submesh(vkb::core::CommandBufferC &command_buffer, sg
 		}
 
 		VkVertexInputAttributeDescription vertex_attribute{};
-		vertex_attribute.binding  = input_resource.location;
+		vertex_attribute.binding  = interleaved ? 0 : input_resource.location;
 		vertex_attribute.format   = attribute.format;
 		vertex_attribute.location = input_resource.location;
 		vertex_attribute.offset   = attribute.offset;
 
 		vertex_input_state.attributes.push_back(vertex_attribute);
 
+		if (interleaved && !vertex_input_state.bindings.empty())
+		{
+			continue;
+		}
+
 		VkVertexInputBindingDescription vertex_binding{};
-		vertex_binding.binding = input_resource.location;
+		vertex_binding.binding = vertex_attribute.binding;
 		vertex_binding.stride  = attribute.stride;
 
 		vertex_input_state.bindings.push_back(vertex_binding);
@@ -228,6 +435,14 @@ void GeometrySubpass::draw_submesh(vkb::core::CommandBufferC &command_buffer, sg
 
 	command_buffer.set_vertex_input_state(vertex_input_state);
 
+	if (interleaved)
+	{
+		std::vector<std::reference_wrapper<const vkb::core::BufferC>> buffers;
+		buffers.emplace_back(std::ref(interleaved_buffer_iter->second));
+
+		command_buffer.bind_vertex_buffers(0, std::move(buffers), {0});
+	}
+
 	// Find submesh vertex buffers matching the shader input attribute names
 	for (auto &input_resource : vertex_input_resources)
 	{
@@ -243,7 +458,47 @@ void GeometrySubpass::draw_submesh(vkb::core::CommandBufferC &command_buffer, sg
 		}
 	}
 
-	draw_submesh_command(command_buffer, sub_mesh);
+	if (lod > 0)
+	{
+		// Levels of detail share the vertex buffers of the sub mesh
+		auto &sub_mesh_lod = sub_mesh.lods[lod - 1];
+		command_buffer.bind_index_buffer(*sub_mesh_lod.index_buffer, 0, sub_mesh_lod.index_type);
+		command_buffer.draw_indexed(sub_mesh_lod.index_count, 1, 0, 0, 0);
+
+		submitted_triangle_count += sub_mesh_lod.index_count / 3;
+	}
+	else
+	{
+		draw_submesh_command(command_buffer, sub_mesh);
+
+		submitted_triangle_count += (sub_mesh.vertex_indices != 0 ? sub_mesh.vertex_indices : sub_mesh.vertices_count) / 3;
+	}
+}
+
+void GeometrySubpass::bind_material(vkb::core::CommandBufferC &command_buffer, PipelineLayout &pipeline_layout, sg::SubMesh &sub_mesh)
+{
+	if (pipeline_layout.get_push_constant_range_stage(sizeof(PBRMaterialUniform)) != 0)
+	{
+		prepare_push_constants(command_buffer, sub_mesh);
+
+		// The feedback index follows the material uniform in the variants writing texture feedback
+		if (texture_streamer && pipeline_layout.get_push_constant_range_stage(sizeof(PBRMaterialUniform) + sizeof(uint32_t)) != 0)
+		{
+			command_buffer.push_constants(texture_streamer->get_feedback_index(*sub_mesh.get_material()));
+		}
+	}
+
+	DescriptorSetLayout &descriptor_set_layout = pipeline_layout.get_descriptor_set_layout(0);
+
+	for (auto &texture : sub_mesh.get_material()->textures)
+	{
+		if (auto layout_binding = descriptor_set_layout.get_layout_binding(texture.first))
+		{
+			command_buffer.bind_image(texture.second->get_image()->get_vk_image_view(),
+			                          texture.second->get_sampler()->vk_sampler,
+			                          0, layout_binding->binding, 0);
+		}
+	}
 }
 
 void GeometrySubpass::prepare_pipeline_state(vkb::core::CommandBufferC &command_buffer,
@@ -319,4 +574,19 @@ void GeometrySubpass::set_thread_index(uint32_t index)
 {
 	thread_index = index;
 }
+
+void GeometrySubpass::set_texture_streamer(TextureStreamer *streamer)
+{
+	texture_streamer = streamer;
+}
+
+void GeometrySubpass::set_lod_threshold(float pixels)
+{
+	lod_threshold = pixels;
+}
+
+uint64_t GeometrySubpass::get_submitted_triangle_count() const
+{
+	return last_submitted_triangle_count;
+}
 }        // namespace vkb
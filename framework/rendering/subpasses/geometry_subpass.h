@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include "common/error.h"
 
 #include "common/glm_common.h"
@@ -25,6 +28,8 @@
 
 namespace vkb
 {
+class TextureStreamer;
+
 namespace core
 {
 template <vkb::BindingType bindingType>
@@ -79,7 +84,7 @@ class GeometrySubpass : public vkb::rendering::SubpassC
 	 * @param scene Scene to render on this subpass
 	 * @param camera Camera used to look at the scene
 	 */
-	GeometrySubpass(RenderContext &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Scene &scene, sg::Camera &camera);
+	GeometrySubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Scene &scene, sg::Camera &camera);
 
 	virtual ~GeometrySubpass() = default;
 
@@ -90,15 +95,71 @@ class GeometrySubpass : public vkb::rendering::SubpassC
 	 */
 	virtual void draw(vkb::core::CommandBufferC &command_buffer) override;
 
+	/**
+	 * @brief Record draw commands in secondary command buffers, which are recorded in parallel on the job system
+	 *        and executed in order from the primary command buffer
+	 *
+	 * The draws are split in chunks sized after the draw count, and every thread records whole chunks with the
+	 * resource pools of its own thread index in the render frame, until no chunk is left. Subclasses overriding
+	 * draw() must override this function as well to be recorded in parallel.
+	 *
+	 * @param primary_command_buffer Command buffer recording a subpass begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+	 * @param extent Extent of the render target, covered by the viewport and scissor of the secondary command buffers
+	 * @param thread_count Maximum number of threads recording, limited to the thread count of the render context
+	 */
+	virtual void draw_parallel(vkb::core::CommandBufferC &primary_command_buffer, const VkExtent2D &extent, uint32_t thread_count);
+
 	/**
 	 * @brief Thread index to use for allocating resources
 	 */
 	void set_thread_index(uint32_t index);
 
+	/**
+	 * @brief Binds the feedback buffer of a texture streamer, and pushes the feedback index of every material
+	 *        after the PBR material uniform, for the shader variants with the TEXTURE_STREAMING definition
+	 */
+	void set_texture_streamer(TextureStreamer *texture_streamer);
+
+	/**
+	 * @brief Sets the projected geometric error, in pixels, up to which sub meshes are drawn with a coarser level of
+	 *        detail, see GLTFLoader::set_lods. 0 always draws the sub meshes in full.
+	 */
+	void set_lod_threshold(float pixels);
+
+	/**
+	 * @return Triangles submitted by the draws of the last frame recorded, before any culling
+	 */
+	uint64_t get_submitted_triangle_count() const;
+
   protected:
+	/**
+	 * @brief Binds the resources shared by all the draws, called on every command buffer draws are recorded in
+	 */
+	virtual void bind_draw_state(vkb::core::CommandBufferC &command_buffer);
+
+	/**
+	 * @brief Sets the state of the transparent draws, which are blended over the opaque ones
+	 */
+	void set_transparent_state(vkb::core::CommandBufferC &command_buffer);
+
 	virtual void update_uniform(vkb::core::CommandBufferC &command_buffer, sg::Node &node, size_t thread_index);
 
-	void draw_submesh(vkb::core::CommandBufferC &command_buffer, sg::SubMesh &sub_mesh, VkFrontFace front_face = VK_FRONT_FACE_COUNTER_CLOCKWISE);
+	/**
+	 * @param lod Level of detail to draw, 0 for the sub mesh itself or the index in sg::SubMesh::lods plus one
+	 */
+	virtual void draw_submesh(vkb::core::CommandBufferC &command_buffer, sg::SubMesh &sub_mesh, VkFrontFace front_face = VK_FRONT_FACE_COUNTER_CLOCKWISE, uint32_t lod = 0);
+
+	/**
+	 * @brief Selects the coarsest level of detail of a sub mesh whose geometric error, scaled by the node, projects to
+	 *        no more pixels than the threshold at the distance of the bounds of the node from the camera
+	 * @return 0 for the sub mesh itself, or the index in sg::SubMesh::lods plus one
+	 */
+	uint32_t select_lod(sg::Node &node, const sg::SubMesh &sub_mesh);
+
+	/**
+	 * @brief Pushes the material uniform of a sub mesh, and binds its textures sampled by the pipeline layout
+	 */
+	void bind_material(vkb::core::CommandBufferC &command_buffer, PipelineLayout &pipeline_layout, sg::SubMesh &sub_mesh);
 
 	virtual void prepare_pipeline_state(vkb::core::CommandBufferC &command_buffer, VkFrontFace front_face, bool double_sided_material);
 
@@ -125,6 +186,18 @@ class GeometrySubpass : public vkb::rendering::SubpassC
 	uint32_t thread_index{0};
 
 	vkb::RasterizationState base_rasterization_state{};
+
+	/// Serializes the pipeline layout preparation, which sets the resource modes of shared shader modules
+	std::mutex pipeline_layout_mutex;
+
+	TextureStreamer *texture_streamer{nullptr};
+
+	float lod_threshold{1.0f};
+
+	/// Triangles submitted since the frame began recording, counted by every recording thread
+	std::atomic<uint64_t> submitted_triangle_count{0};
+
+	uint64_t last_submitted_triangle_count{0};
 };
 
 }        // namespace vkb
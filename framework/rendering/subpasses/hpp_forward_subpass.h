@@ -19,7 +19,7 @@
 
 #include "rendering/subpasses/forward_subpass.h"
 
-#include <rendering/hpp_render_context.h>
+#include <rendering/render_context.h>
 
 namespace vkb
 {
@@ -35,12 +35,12 @@ namespace subpasses
 class HPPForwardSubpass : public vkb::ForwardSubpass
 {
   public:
-	HPPForwardSubpass(vkb::rendering::HPPRenderContext &render_context,
+	HPPForwardSubpass(vkb::rendering::RenderContextCpp &render_context,
 	                  vkb::ShaderSource               &&vertex_shader,
 	                  vkb::ShaderSource               &&fragment_shader,
 	                  vkb::scene_graph::HPPScene       &scene,
 	                  vkb::sg::Camera                  &camera) :
-	    vkb::ForwardSubpass(reinterpret_cast<vkb::RenderContext &>(render_context),
+	    vkb::ForwardSubpass(reinterpret_cast<vkb::rendering::RenderContextC &>(render_context),
 	                        std::forward<ShaderSource>(vertex_shader),
 	                        std::forward<ShaderSource>(fragment_shader),
 	                        reinterpret_cast<vkb::sg::Scene &>(scene),
@@ -24,7 +24,7 @@
 
 namespace vkb
 {
-LightingSubpass::LightingSubpass(RenderContext &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Camera &cam, sg::Scene &scene_) :
+LightingSubpass::LightingSubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Camera &cam, sg::Scene &scene_) :
     Subpass{render_context, std::move(vertex_shader), std::move(fragment_shader)},
     camera{cam},
     scene{scene_}
@@ -36,6 +36,12 @@ void LightingSubpass::prepare()
 	lighting_variant.add_definitions({"MAX_LIGHT_COUNT " + std::to_string(MAX_DEFERRED_LIGHT_COUNT)});
 
 	lighting_variant.add_definitions(vkb::rendering::light_type_definitions);
+
+	if (light_clusters)
+	{
+		lighting_variant.add_definitions(light_clusters->get_shader_definitions());
+	}
+
 	// Build all shaders upfront
 	auto &resource_cache = get_render_context().get_device().get_resource_cache();
 	resource_cache.request_shader_module(VK_SHADER_STAGE_VERTEX_BIT, get_vertex_shader(), lighting_variant);
@@ -44,8 +50,28 @@ void LightingSubpass::prepare()
 
 void LightingSubpass::draw(vkb::core::CommandBufferC &command_buffer)
 {
-	allocate_lights<DeferredLights>(scene.get_components<sg::Light>(), MAX_DEFERRED_LIGHT_COUNT);
-	command_buffer.bind_lighting(get_lighting_state(), 0, 4);
+	if (light_clusters)
+	{
+		auto scene_lights = scene.get_components<sg::Light>();
+
+		// With GPU culling, the clusters have been updated and culled before the render pass began
+		if (light_clusters->get_culling_mode() == LightCullingMode::CPU)
+		{
+			light_clusters->update(scene_lights, camera, get_render_context().get_active_frame().get_render_target().get_extent());
+		}
+
+		// Only directional lights go through the fixed size uniform, the others are read from the clusters
+		scene_lights.erase(std::remove_if(scene_lights.begin(), scene_lights.end(), [](sg::Light *light) { return light->get_light_type() != sg::LightType::Directional; }),
+		                   scene_lights.end());
+		allocate_lights<DeferredLights>(scene_lights, MAX_DEFERRED_LIGHT_COUNT);
+		command_buffer.bind_lighting(get_lighting_state(), 0, 4);
+		light_clusters->bind(command_buffer, 0, 5);
+	}
+	else
+	{
+		allocate_lights<DeferredLights>(scene.get_components<sg::Light>(), MAX_DEFERRED_LIGHT_COUNT);
+		command_buffer.bind_lighting(get_lighting_state(), 0, 4);
+	}
 
 	// Get shaders from cache
 	auto &resource_cache     = command_buffer.get_device().get_resource_cache();
@@ -101,4 +127,15 @@ void LightingSubpass::draw(vkb::core::CommandBufferC &command_buffer)
 	// Draw full screen triangle triangle
 	command_buffer.draw(3, 1, 0, 0);
 }
+
+LightClusters &LightingSubpass::enable_clustered_lighting(const glm::uvec3 &grid_size, uint32_t max_lights_per_cluster)
+{
+	light_clusters = std::make_unique<LightClusters>(get_render_context(), grid_size, max_lights_per_cluster);
+	return *light_clusters;
+}
+
+LightClusters *LightingSubpass::get_light_clusters()
+{
+	return light_clusters.get();
+}
 }        // namespace vkb
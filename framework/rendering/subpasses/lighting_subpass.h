@@ -18,6 +18,7 @@
 #pragma once
 
 #include "buffer_pool.h"
+#include "rendering/light_clusters.h"
 #include "rendering/subpass.h"
 
 #include "common/glm_common.h"
@@ -65,18 +66,34 @@ struct alignas(16) DeferredLights
 class LightingSubpass : public vkb::rendering::SubpassC
 {
   public:
-	LightingSubpass(RenderContext &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Camera &camera, sg::Scene &scene);
+	LightingSubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Camera &camera, sg::Scene &scene);
 
 	virtual void prepare() override;
 
 	void draw(vkb::core::CommandBufferC &command_buffer) override;
 
+	/**
+	 * @brief Shades point and spot lights through a cluster grid instead of the fixed size light uniform,
+	 *        lifting the MAX_DEFERRED_LIGHT_COUNT limit for those types. Must be called before prepare().
+	 * @param grid_size Number of clusters along the screen width, height and depth
+	 * @param max_lights_per_cluster Lights above this count in a single cluster are dropped
+	 * @return The light clusters, e.g. to switch them to GPU culling
+	 */
+	LightClusters &enable_clustered_lighting(const glm::uvec3 &grid_size = {16, 9, 24}, uint32_t max_lights_per_cluster = 256);
+
+	/**
+	 * @return The light clusters, or nullptr if clustered lighting is not enabled
+	 */
+	LightClusters *get_light_clusters();
+
   private:
 	sg::Camera &camera;
 
 	sg::Scene &scene;
 
 	ShaderVariant lighting_variant;
+
+	std::unique_ptr<LightClusters> light_clusters;
 };
 
 }        // namespace vkb
@@ -0,0 +1,245 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rendering/subpasses/meshlet_subpass.h"
+
+#include "common/utils.h"
+#include "common/vk_common.h"
+#include "core/util/logging.hpp"
+#include "rendering/render_context.h"
+#include "scene_graph/components/material.h"
+#include "scene_graph/components/mesh.h"
+#include "scene_graph/components/sub_mesh.h"
+
+namespace vkb
+{
+namespace
+{
+/// Meshlets tested by a task shader workgroup, MESHLETS_PER_TASK in meshlet/meshlet_shared.h
+constexpr uint32_t meshlets_per_task = 32;
+
+/// Specialization constants of meshlet/meshlet.task and meshlet/meshlet.mesh
+constexpr uint32_t cone_sign_constant_id         = 3;
+constexpr uint32_t position_stride_constant_id   = 4;
+constexpr uint32_t normal_stride_constant_id     = 5;
+constexpr uint32_t texcoord_0_stride_constant_id = 6;
+constexpr uint32_t position_offset_constant_id   = 7;
+constexpr uint32_t normal_offset_constant_id     = 8;
+constexpr uint32_t texcoord_0_offset_constant_id = 9;
+
+/// Counters of meshlet/meshlet.task
+struct CullingCounters
+{
+	uint32_t meshlets;
+
+	uint32_t visible_meshlets;
+
+	uint32_t triangles;
+
+	uint32_t visible_triangles;
+};
+}        // namespace
+
+MeshletSubpass::MeshletSubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_source, ShaderSource &&fragment_source, sg::Scene &scene_, sg::Camera &camera) :
+    ForwardSubpass{render_context, std::move(vertex_source), std::move(fragment_source), scene_, camera},
+    task_shader{"meshlet/meshlet.task"},
+    mesh_shader{"meshlet/meshlet.mesh"},
+    mesh_shading{render_context.get_device().is_enabled(VK_EXT_MESH_SHADER_EXTENSION_NAME)}
+{
+	if (!mesh_shading)
+	{
+		LOGW("VK_EXT_mesh_shader is not enabled, meshlets are drawn through the vertex shader");
+	}
+}
+
+MeshletSubpass::~MeshletSubpass()
+{
+	if (culling_stats.meshlets > 0)
+	{
+		LOGI("Meshlet culling: {} of {} meshlets and {} of {} triangles culled ({:.1f}% of the triangles)",
+		     culling_stats.meshlets - culling_stats.visible_meshlets,
+		     culling_stats.meshlets,
+		     culling_stats.triangles - culling_stats.visible_triangles,
+		     culling_stats.triangles,
+		     100.0 * (culling_stats.triangles - culling_stats.visible_triangles) / culling_stats.triangles);
+	}
+}
+
+void MeshletSubpass::prepare()
+{
+	ForwardSubpass::prepare();
+
+	if (!mesh_shading)
+	{
+		return;
+	}
+
+	// Build the task and mesh shader variants of the sub meshes with meshlets upfront
+	auto &device = get_render_context().get_device();
+	for (auto &mesh : meshes)
+	{
+		for (auto &sub_mesh : mesh->get_submeshes())
+		{
+			if (sub_mesh->meshlet_count > 0)
+			{
+				device.get_resource_cache().request_shader_module(VK_SHADER_STAGE_TASK_BIT_EXT, task_shader, sub_mesh->get_shader_variant());
+				device.get_resource_cache().request_shader_module(VK_SHADER_STAGE_MESH_BIT_EXT, mesh_shader, sub_mesh->get_shader_variant());
+			}
+		}
+	}
+}
+
+void MeshletSubpass::draw(vkb::core::CommandBufferC &command_buffer)
+{
+	collect_culling_stats();
+
+	ForwardSubpass::draw(command_buffer);
+}
+
+void MeshletSubpass::draw_parallel(vkb::core::CommandBufferC &primary_command_buffer, const VkExtent2D &extent, uint32_t thread_count)
+{
+	collect_culling_stats();
+
+	ForwardSubpass::draw_parallel(primary_command_buffer, extent, thread_count);
+}
+
+const MeshletCullingStats &MeshletSubpass::get_culling_stats() const
+{
+	return culling_stats;
+}
+
+void MeshletSubpass::collect_culling_stats()
+{
+	if (!mesh_shading)
+	{
+		return;
+	}
+
+	auto &render_context = get_render_context();
+	auto  frame_index    = render_context.get_active_frame_index();
+
+	if (culling_stats_buffers.size() < render_context.get_render_frames().size())
+	{
+		culling_stats_buffers.resize(render_context.get_render_frames().size());
+	}
+
+	auto &buffer = culling_stats_buffers[frame_index];
+	if (!buffer)
+	{
+		buffer = std::make_unique<vkb::core::BufferC>(render_context.get_device(),
+		                                              sizeof(CullingCounters),
+		                                              VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+		                                              VMA_MEMORY_USAGE_GPU_TO_CPU,
+		                                              VMA_ALLOCATION_CREATE_MAPPED_BIT);
+	}
+	else
+	{
+		// The frame which last rendered with the active render frame has completed
+		auto *counters = reinterpret_cast<const CullingCounters *>(buffer->map());
+
+		culling_stats.meshlets += counters->meshlets;
+		culling_stats.visible_meshlets += counters->visible_meshlets;
+		culling_stats.triangles += counters->triangles;
+		culling_stats.visible_triangles += counters->visible_triangles;
+	}
+
+	buffer->convert_and_update(CullingCounters{});
+}
+
+void MeshletSubpass::bind_draw_state(vkb::core::CommandBufferC &command_buffer)
+{
+	ForwardSubpass::bind_draw_state(command_buffer);
+
+	if (mesh_shading)
+	{
+		auto &buffer = *culling_stats_buffers[get_render_context().get_active_frame_index()];
+		command_buffer.bind_buffer(buffer, 0, buffer.get_size(), 0, 16, 0);
+	}
+}
+
+void MeshletSubpass::draw_submesh(vkb::core::CommandBufferC &command_buffer, sg::SubMesh &sub_mesh, VkFrontFace front_face, uint32_t lod)
+{
+	if (!mesh_shading || sub_mesh.meshlet_count == 0)
+	{
+		GeometrySubpass::draw_submesh(command_buffer, sub_mesh, front_face, lod);
+		return;
+	}
+
+	auto &device = command_buffer.get_device();
+
+	ScopedDebugLabel submesh_debug_label{command_buffer, sub_mesh.get_name().c_str()};
+
+	bool double_sided = sub_mesh.get_material()->double_sided;
+
+	prepare_pipeline_state(command_buffer, front_face, double_sided);
+
+	auto &task_shader_module = device.get_resource_cache().request_shader_module(VK_SHADER_STAGE_TASK_BIT_EXT, task_shader, sub_mesh.get_shader_variant());
+	auto &mesh_shader_module = device.get_resource_cache().request_shader_module(VK_SHADER_STAGE_MESH_BIT_EXT, mesh_shader, sub_mesh.get_shader_variant());
+	auto &frag_shader_module = device.get_resource_cache().request_shader_module(VK_SHADER_STAGE_FRAGMENT_BIT, get_fragment_shader(), sub_mesh.get_shader_variant());
+
+	std::vector<ShaderModule *> shader_modules{&task_shader_module, &mesh_shader_module, &frag_shader_module};
+
+	std::unique_lock<std::mutex> pipeline_layout_lock(pipeline_layout_mutex);
+	auto                        &pipeline_layout = prepare_pipeline_layout(command_buffer, shader_modules);
+	pipeline_layout_lock.unlock();
+
+	command_buffer.bind_pipeline_layout(pipeline_layout);
+
+	bind_material(command_buffer, pipeline_layout, sub_mesh);
+
+	// The mesh shader reads the vertices itself
+	command_buffer.set_vertex_input_state({});
+
+	// Double sided materials are not backface culled, and the cones of mirrored sub meshes are mirrored as well
+	float cone_sign = double_sided ? 0.0f : (front_face == VK_FRONT_FACE_CLOCKWISE ? -1.0f : 1.0f);
+	command_buffer.set_specialization_constant(cone_sign_constant_id, cone_sign);
+
+	command_buffer.bind_buffer(*sub_mesh.meshlet_buffer, 0, sub_mesh.meshlet_buffer->get_size(), 0, 10, 0);
+	command_buffer.bind_buffer(*sub_mesh.meshlet_vertex_buffer, 0, sub_mesh.meshlet_vertex_buffer->get_size(), 0, 11, 0);
+	command_buffer.bind_buffer(*sub_mesh.meshlet_triangle_buffer, 0, sub_mesh.meshlet_triangle_buffer->get_size(), 0, 12, 0);
+
+	const std::vector<std::tuple<std::string, uint32_t, uint32_t, uint32_t>> vertex_storage_buffers{{"position", 13, position_stride_constant_id, position_offset_constant_id},
+	                                                                                                {"normal", 14, normal_stride_constant_id, normal_offset_constant_id},
+	                                                                                                {"texcoord_0", 15, texcoord_0_stride_constant_id, texcoord_0_offset_constant_id}};
+	for (auto &[name, binding, stride_constant_id, offset_constant_id] : vertex_storage_buffers)
+	{
+		sg::VertexAttribute attribute;
+		if (!sub_mesh.get_attribute(name, attribute))
+		{
+			continue;
+		}
+
+		// Attributes of optimized sub meshes are interleaved in a single vertex buffer
+		auto buffer_it = sub_mesh.vertex_buffers.find(name);
+		if (buffer_it == sub_mesh.vertex_buffers.end())
+		{
+			buffer_it = sub_mesh.vertex_buffers.find("vertex_buffer");
+		}
+
+		if (buffer_it != sub_mesh.vertex_buffers.end())
+		{
+			command_buffer.bind_buffer(buffer_it->second, 0, buffer_it->second.get_size(), 0, binding, 0);
+			command_buffer.set_specialization_constant(stride_constant_id, attribute.stride / to_u32(sizeof(float)));
+			command_buffer.set_specialization_constant(offset_constant_id, attribute.offset / to_u32(sizeof(float)));
+		}
+	}
+
+	command_buffer.draw_mesh_tasks((sub_mesh.meshlet_count + meshlets_per_task - 1) / meshlets_per_task, 1, 1);
+
+	submitted_triangle_count += (sub_mesh.vertex_indices != 0 ? sub_mesh.vertex_indices : sub_mesh.vertices_count) / 3;
+}
+}        // namespace vkb
@@ -0,0 +1,108 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rendering/subpasses/forward_subpass.h"
+
+namespace vkb
+{
+/**
+ * @brief Meshlets and triangles tested by the task shader, and the ones left visible
+ */
+struct MeshletCullingStats
+{
+	uint64_t meshlets{0};
+
+	uint64_t visible_meshlets{0};
+
+	uint64_t triangles{0};
+
+	uint64_t visible_triangles{0};
+};
+
+/**
+ * @brief Forward subpass drawing the sub meshes with meshlets through task and mesh shaders
+ *
+ * A task shader workgroup tests 32 meshlets of a sub mesh against the view frustum with their bounding spheres,
+ * and against the view direction with their normal cones, and launches a mesh shader workgroup per meshlet left.
+ * The mesh shader reads the vertices of its meshlet from the vertex buffers of the sub mesh, and outputs them to the
+ * fragment shader of the subpass, like the vertex shader does.
+ *
+ * The meshlets are built by the loader, see GLTFLoader::set_meshlets. Sub meshes without meshlets, or all of them if
+ * VK_EXT_mesh_shader is not enabled, are drawn through the vertex shader of the subpass. As task and mesh shaders
+ * are compiled for SPIR-V 1.4, the device needs VK_KHR_spirv_1_4 or Vulkan 1.2, see VulkanSample::set_meshlets.
+ *
+ * The task shader counts the meshlets and triangles it tests and culls. The counts of a frame are read once the
+ * render frame is reused, and accumulated over the lifetime of the subpass.
+ */
+class MeshletSubpass : public ForwardSubpass
+{
+  public:
+	/**
+	 * @brief Constructs a subpass drawing meshlets in a forward renderer
+	 * @param render_context Render context
+	 * @param vertex_shader Vertex shader source, for the sub meshes without meshlets
+	 * @param fragment_shader Fragment shader source, with the inputs of base.vert
+	 * @param scene Scene to render on this subpass
+	 * @param camera Camera used to look at the scene
+	 */
+	MeshletSubpass(vkb::rendering::RenderContextC &render_context, ShaderSource &&vertex_shader, ShaderSource &&fragment_shader, sg::Scene &scene, sg::Camera &camera);
+
+	virtual ~MeshletSubpass();
+
+	virtual void prepare() override;
+
+	virtual void draw(vkb::core::CommandBufferC &command_buffer) override;
+
+	virtual void draw_parallel(vkb::core::CommandBufferC &primary_command_buffer, const VkExtent2D &extent, uint32_t thread_count) override;
+
+	/**
+	 * @return The counts of the frames completed so far
+	 */
+	const MeshletCullingStats &get_culling_stats() const;
+
+  protected:
+	/**
+	 * @brief Binds the culling counters of the active frame along with the lights
+	 */
+	virtual void bind_draw_state(vkb::core::CommandBufferC &command_buffer) override;
+
+	/**
+	 * @brief Draws the meshlets of a sub mesh, which are built from the sub mesh itself whatever the level of detail
+	 */
+	virtual void draw_submesh(vkb::core::CommandBufferC &command_buffer, sg::SubMesh &sub_mesh, VkFrontFace front_face = VK_FRONT_FACE_COUNTER_CLOCKWISE, uint32_t lod = 0) override;
+
+  private:
+	/**
+	 * @brief Accumulates the counts of the frame which last rendered with the active render frame, and resets them
+	 */
+	void collect_culling_stats();
+
+	ShaderSource task_shader;
+
+	ShaderSource mesh_shader;
+
+	/// Whether VK_EXT_mesh_shader is enabled, otherwise every sub mesh is drawn through the vertex shader
+	bool mesh_shading{false};
+
+	/// Culling counters per render frame
+	std::vector<std::unique_ptr<vkb::core::BufferC>> culling_stats_buffers;
+
+	MeshletCullingStats culling_stats;
+};
+}        // namespace vkb
@@ -0,0 +1,863 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rendering/texture_streamer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+#include "common/error.h"
+#include "common/utils.h"
+#include "core/allocated.h"
+#include "core/command_buffer.h"
+#include "core/device.h"
+#include "core/image.h"
+#include "core/image_view.h"
+#include "rendering/render_context.h"
+#include "scene_graph/components/image.h"
+#include "scene_graph/components/material.h"
+#include "scene_graph/components/sub_mesh.h"
+#include "scene_graph/components/texture.h"
+#include "scene_graph/scene.h"
+
+namespace vkb
+{
+namespace
+{
+/// Levels up to this size are always resident, so that every texture can be sampled
+constexpr uint32_t mip_tail_size = 128;
+
+/// Frames after which a texture which is not sampled anymore only needs its mip tail
+constexpr uint64_t unseen_frame_count = 120;
+
+/// Feedback of a material which was not sampled, see write_texture_feedback() in texture_streaming.h
+constexpr uint32_t no_feedback = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief Decodes the level of detail written by write_texture_feedback(), relative to a 1x1 texture
+ */
+float decode_feedback(uint32_t value)
+{
+	return static_cast<float>(value) / 16.0f - 32.0f;
+}
+
+/**
+ * @brief Allocates the memory of sparse levels or of a mip tail
+ *        VMA suballocates it from larger blocks, so that streaming many textures does not reach maxMemoryAllocationCount.
+ * @param image_requirements Memory requirements of the sparse image, whose alignment is the size of a sparse block
+ */
+VmaAllocation allocate_memory(const VkMemoryRequirements &image_requirements, VkDeviceSize size)
+{
+	VkMemoryRequirements memory_requirements = image_requirements;
+	memory_requirements.size                 = size;
+
+	VmaAllocationCreateInfo allocation_info{};
+	allocation_info.usage         = VMA_MEMORY_USAGE_GPU_ONLY;
+	allocation_info.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+	VmaAllocation allocation{nullptr};
+	VK_CHECK(vmaAllocateMemory(allocated::get_memory_allocator(), &memory_requirements, &allocation_info, &allocation, nullptr));
+	return allocation;
+}
+
+/**
+ * @brief Sets the memory and offset a sparse bind refers to, or no memory to unbind
+ */
+template <typename T>
+void set_bind_memory(T &bind, VmaAllocation allocation)
+{
+	if (allocation == nullptr)
+	{
+		bind.memory       = VK_NULL_HANDLE;
+		bind.memoryOffset = 0;
+		return;
+	}
+
+	VmaAllocationInfo allocation_info;
+	vmaGetAllocationInfo(allocated::get_memory_allocator(), allocation, &allocation_info);
+	bind.memory       = allocation_info.deviceMemory;
+	bind.memoryOffset = allocation_info.offset;
+}
+}        // namespace
+
+TextureStreamer::TextureStreamer(vkb::rendering::RenderContextC &render_context, VkDeviceSize memory_budget) :
+    render_context{render_context},
+    memory_budget{memory_budget}
+{
+	auto &device   = render_context.get_device();
+	auto  features = device.get_gpu().get_requested_features();
+
+	// The feedback is written with atomics from the fragment shaders
+	feedback_enabled = features.fragmentStoresAndAtomics;
+
+	if (features.sparseBinding && features.sparseResidencyImage2D)
+	{
+		// Levels are bound on a queue which renders as well, so that no ownership transfer is needed
+		try
+		{
+			sparse_queue = &device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_SPARSE_BINDING_BIT, 0);
+		}
+		catch (const std::runtime_error &)
+		{
+			LOGW("No graphics queue supports sparse binding, textures are streamed without sparse residency");
+		}
+	}
+
+	if (sparse_queue)
+	{
+		sparse_enabled = true;
+
+		VkFenceCreateInfo fence_info{VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+		VK_CHECK(vkCreateFence(device.get_handle(), &fence_info, nullptr, &bind_fence));
+	}
+
+	retired_resources.resize(render_context.get_render_frames().size());
+
+	memory_pressure      = MemoryBudgetTracker::get().get_pressure();
+	pressure_callback_id = MemoryBudgetTracker::get().add_pressure_callback([this](MemoryPressure pressure) { memory_pressure = pressure; });
+}
+
+TextureStreamer::~TextureStreamer()
+{
+	MemoryBudgetTracker::get().remove_pressure_callback(pressure_callback_id);
+
+	auto &device = render_context.get_device();
+	device.wait_idle();
+
+	std::vector<VmaAllocation> memory;
+	for (auto &retired : retired_resources)
+	{
+		memory.insert(memory.end(), retired.memory.begin(), retired.memory.end());
+	}
+	retired_resources.clear();
+
+	for (auto &texture : textures)
+	{
+		// The view and the image of the sg::Image go first, as they may refer to the sparse image
+		texture->image->release_vk_image_view().reset();
+		texture->image->release_vk_image().reset();
+
+		if (texture->sparse_image != VK_NULL_HANDLE)
+		{
+			vkDestroyImage(device.get_handle(), texture->sparse_image, nullptr);
+		}
+
+		std::copy_if(texture->level_memory.begin(), texture->level_memory.end(), std::back_inserter(memory), [](VmaAllocation level_memory) { return level_memory != nullptr; });
+		memory.insert(memory.end(), texture->tail_memory.begin(), texture->tail_memory.end());
+	}
+
+	for (auto level_memory : memory)
+	{
+		vmaFreeMemory(allocated::get_memory_allocator(), level_memory);
+	}
+
+	if (bind_fence != VK_NULL_HANDLE)
+	{
+		vkDestroyFence(device.get_handle(), bind_fence, nullptr);
+	}
+}
+
+void TextureStreamer::add_scene(sg::Scene &scene)
+{
+	auto &device = render_context.get_device();
+
+	// The feedback buffers are recreated for the new materials
+	device.wait_idle();
+	feedback_buffers.clear();
+
+	std::vector<StreamedTexture *> new_textures;
+	for (auto *image : scene.get_components<sg::Image>())
+	{
+		if (auto *texture = add_image(*image))
+		{
+			new_textures.push_back(texture);
+		}
+	}
+
+	// Every material reports the detail its fragments need, for all the images it samples
+	for (auto *sub_mesh : scene.get_components<sg::SubMesh>())
+	{
+		auto *material = sub_mesh->get_material();
+		if (!material)
+		{
+			continue;
+		}
+
+		auto feedback_it = feedback_indices.find(material);
+		if (feedback_it == feedback_indices.end())
+		{
+			feedback_it = feedback_indices.emplace(material, to_u32(feedback_indices.size())).first;
+
+			for (auto &texture : material->textures)
+			{
+				auto texture_it = texture_by_image.find(texture.second->get_image());
+				if (texture_it != texture_by_image.end())
+				{
+					texture_it->second->feedback_indices.push_back(feedback_it->second);
+				}
+			}
+		}
+
+		if (feedback_enabled)
+		{
+			sub_mesh->get_mut_shader_variant().add_definitions({"TEXTURE_STREAMING"});
+		}
+	}
+
+	// Upload the mip tails, the first frames are rendered with them
+	RetiredResources uploads;
+
+	auto &command_buffer = device.request_command_buffer();
+	command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, 0);
+
+	for (auto *texture : new_textures)
+	{
+		if (texture->mode == TextureResidencyMode::Sparse)
+		{
+			upload_levels(command_buffer, *texture, texture->resident_level, texture->level_count, 0, uploads);
+		}
+		else
+		{
+			recreate_image(command_buffer, *texture, uploads);
+		}
+	}
+
+	command_buffer.end();
+
+	auto &queue = device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
+
+	queue.submit(command_buffer, device.request_fence());
+
+	device.get_fence_pool().wait();
+	device.get_fence_pool().reset();
+	device.get_command_pool().reset_pool();
+
+	auto sparse_count = std::count_if(new_textures.begin(), new_textures.end(), [](const StreamedTexture *texture) { return texture->mode == TextureResidencyMode::Sparse; });
+
+	LOGI("Streaming {} textures, {} with sparse residency, {:.1f} MB resident with a budget of {:.1f} MB",
+	     new_textures.size(), sparse_count, resident_size / (1024.0f * 1024.0f), memory_budget / (1024.0f * 1024.0f));
+
+	if (!feedback_enabled)
+	{
+		LOGW("fragmentStoresAndAtomics is not enabled, textures are streamed without feedback");
+	}
+}
+
+TextureStreamer::StreamedTexture *TextureStreamer::add_image(sg::Image &image)
+{
+	// Images without data have already been uploaded, and are fully resident
+	if (image.get_data().empty() || texture_by_image.count(&image) > 0)
+	{
+		return nullptr;
+	}
+
+	assert(image.get_layers() == 1 && image.get_extent().depth == 1 && "Only 2D images can be streamed");
+
+	auto  texture        = std::make_unique<StreamedTexture>();
+	auto &mipmaps        = image.get_mipmaps();
+	texture->image       = &image;
+	texture->level_count = to_u32(mipmaps.size());
+	texture->size_log2   = std::log2(static_cast<float>(std::max(image.get_extent().width, image.get_extent().height)));
+
+	while (texture->tail_level + 1 < texture->level_count &&
+	       std::max(mipmaps[texture->tail_level].extent.width, mipmaps[texture->tail_level].extent.height) > mip_tail_size)
+	{
+		texture->tail_level++;
+	}
+
+	if (!sparse_enabled || !create_sparse_image(*texture))
+	{
+		texture->mode = TextureResidencyMode::MipTail;
+
+		for (uint32_t level = 0; level < texture->level_count; level++)
+		{
+			texture->level_sizes.push_back(get_level_data_size(*texture, level));
+
+			if (level >= texture->tail_level)
+			{
+				texture->tail_size += texture->level_sizes.back();
+			}
+		}
+	}
+
+	texture->resident_level = texture->tail_level;
+	texture->wanted_level   = texture->tail_level;
+
+	resident_size += texture->tail_size;
+
+	auto *result                     = texture.get();
+	texture_by_image[texture->image] = result;
+	textures.push_back(std::move(texture));
+
+	return result;
+}
+
+bool TextureStreamer::create_sparse_image(StreamedTexture &texture)
+{
+	auto &device = render_context.get_device();
+	auto &image  = *texture.image;
+
+	VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+	uint32_t property_count = 0;
+	vkGetPhysicalDeviceSparseImageFormatProperties(device.get_gpu().get_handle(), image.get_format(), VK_IMAGE_TYPE_2D, VK_SAMPLE_COUNT_1_BIT,
+	                                               usage, VK_IMAGE_TILING_OPTIMAL, &property_count, nullptr);
+	if (property_count == 0)
+	{
+		return false;
+	}
+
+	VkImageCreateInfo create_info{VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+	create_info.flags         = VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+	create_info.imageType     = VK_IMAGE_TYPE_2D;
+	create_info.format        = image.get_format();
+	create_info.extent        = image.get_extent();
+	create_info.mipLevels     = texture.level_count;
+	create_info.arrayLayers   = 1;
+	create_info.samples       = VK_SAMPLE_COUNT_1_BIT;
+	create_info.tiling        = VK_IMAGE_TILING_OPTIMAL;
+	create_info.usage         = usage;
+	create_info.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+	create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	VK_CHECK(vkCreateImage(device.get_handle(), &create_info, nullptr, &texture.sparse_image));
+
+	VkMemoryRequirements memory_requirements;
+	vkGetImageMemoryRequirements(device.get_handle(), texture.sparse_image, &memory_requirements);
+
+	uint32_t requirement_count = 0;
+	vkGetImageSparseMemoryRequirements(device.get_handle(), texture.sparse_image, &requirement_count, nullptr);
+	std::vector<VkSparseImageMemoryRequirements> sparse_requirements(requirement_count);
+	vkGetImageSparseMemoryRequirements(device.get_handle(), texture.sparse_image, &requirement_count, sparse_requirements.data());
+
+	auto color_requirements = std::find_if(sparse_requirements.begin(), sparse_requirements.end(), [](const VkSparseImageMemoryRequirements &requirements) {
+		return (requirements.formatProperties.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0;
+	});
+
+	if (color_requirements == sparse_requirements.end())
+	{
+		vkDestroyImage(device.get_handle(), texture.sparse_image, nullptr);
+		texture.sparse_image = VK_NULL_HANDLE;
+		return false;
+	}
+
+	texture.mode               = TextureResidencyMode::Sparse;
+	texture.sparse_tail_level  = std::min(color_requirements->imageMipTailFirstLod, texture.level_count);
+	texture.sparse_tail_offset = color_requirements->imageMipTailOffset;
+	texture.sparse_tail_size   = color_requirements->imageMipTailSize;
+	texture.tail_level         = std::min(texture.tail_level, texture.sparse_tail_level);
+
+	// Levels above the mip tail take whole sparse blocks, of the size of the alignment
+	const auto &granularity = color_requirements->formatProperties.imageGranularity;
+	const auto &mipmaps     = image.get_mipmaps();
+
+	texture.level_sizes.assign(texture.level_count, 0);
+	texture.level_memory.assign(texture.level_count, nullptr);
+
+	for (uint32_t level = 0; level < texture.sparse_tail_level; level++)
+	{
+		VkDeviceSize block_count = static_cast<VkDeviceSize>((mipmaps[level].extent.width + granularity.width - 1) / granularity.width) *
+		                           ((mipmaps[level].extent.height + granularity.height - 1) / granularity.height);
+
+		texture.level_sizes[level] = block_count * memory_requirements.alignment;
+	}
+
+	// The levels of the mip tail are always resident, and bound along with the mip tail of the image
+	std::vector<std::pair<StreamedTexture *, uint32_t>> tail_levels;
+	for (uint32_t level = texture.tail_level; level < texture.sparse_tail_level; level++)
+	{
+		texture.level_memory[level] = allocate_memory(memory_requirements, texture.level_sizes[level]);
+		texture.tail_size += texture.level_sizes[level];
+		tail_levels.emplace_back(&texture, level);
+	}
+
+	std::vector<StreamedTexture *> tails;
+	if (texture.sparse_tail_level < texture.level_count)
+	{
+		texture.tail_memory.push_back(allocate_memory(memory_requirements, texture.sparse_tail_size));
+		texture.tail_size += texture.sparse_tail_size;
+		tails.push_back(&texture);
+	}
+
+	bind_sparse(tail_levels, tails);
+
+	// The core::Image only wraps the sparse image, which the streamer destroys
+	auto vk_image = std::make_unique<core::Image>(device, texture.sparse_image, image.get_extent(), image.get_format(), usage);
+	vk_image->set_debug_name(image.get_name());
+
+	texture.vk_image       = vk_image.get();
+	texture.resident_level = texture.tail_level;
+
+	auto vk_image_view = std::make_unique<core::ImageView>(*vk_image, VK_IMAGE_VIEW_TYPE_2D, VK_FORMAT_UNDEFINED,
+	                                                       texture.resident_level, 0, texture.level_count - texture.resident_level, 1);
+	vk_image_view->set_debug_name("View on " + image.get_name());
+
+	image.set_vk_image(std::move(vk_image), std::move(vk_image_view));
+
+	return true;
+}
+
+void TextureStreamer::update(vkb::core::CommandBufferC &command_buffer)
+{
+	frame_number++;
+
+	auto &device      = render_context.get_device();
+	auto  frame_index = render_context.get_active_frame_index();
+	auto  frame_count = render_context.get_render_frames().size();
+
+	if (retired_resources.size() < frame_count)
+	{
+		retired_resources.resize(frame_count);
+	}
+
+	if (feedback_buffers.size() < frame_count)
+	{
+		feedback_buffers.resize(frame_count);
+	}
+
+	if (!feedback_buffers[frame_index])
+	{
+		std::vector<uint32_t> values(std::max<size_t>(feedback_indices.size(), 1), no_feedback);
+
+		feedback_buffers[frame_index] = std::make_unique<vkb::core::BufferC>(device,
+		                                                                     values.size() * sizeof(uint32_t),
+		                                                                     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+		                                                                     VMA_MEMORY_USAGE_GPU_TO_CPU,
+		                                                                     VMA_ALLOCATION_CREATE_MAPPED_BIT);
+		feedback_buffers[frame_index]->update(values);
+	}
+
+	// The frame which last rendered with the active render frame has completed
+	auto &retired = get_retired_resources();
+	release_retired_resources(retired);
+
+	read_feedback();
+
+	// Under memory pressure the levels are not refined, and the levels not needed anymore are released if it is critical
+	if (memory_pressure == MemoryPressure::Critical)
+	{
+		evict_unneeded_levels(command_buffer);
+	}
+
+	if (memory_pressure != MemoryPressure::None)
+	{
+		return;
+	}
+
+	// Refine the textures missing the most levels first, and the most recently seen ones among them
+	std::vector<StreamedTexture *> pending;
+	for (auto &texture : textures)
+	{
+		if (texture->wanted_level < texture->resident_level && frame_number >= texture->busy_until_frame)
+		{
+			pending.push_back(texture.get());
+		}
+	}
+
+	std::sort(pending.begin(), pending.end(), [](const StreamedTexture *a, const StreamedTexture *b) {
+		uint32_t a_missing = a->resident_level - a->wanted_level;
+		uint32_t b_missing = b->resident_level - b->wanted_level;
+		return a_missing != b_missing ? a_missing > b_missing : a->last_seen_frame > b->last_seen_frame;
+	});
+
+	VkDeviceSize uploaded = 0;
+
+	std::vector<std::pair<StreamedTexture *, uint32_t>> sparse_levels;
+
+	for (auto *texture : pending)
+	{
+		// A single level is refined per frame, starting with the coarsest one missing
+		uint32_t level = texture->resident_level - 1;
+
+		// Without sparse residency the resident levels are uploaded again along with the new one
+		VkDeviceSize upload_size = 0;
+		for (uint32_t uploaded_level = level; uploaded_level < (texture->mode == TextureResidencyMode::Sparse ? level + 1 : texture->level_count); uploaded_level++)
+		{
+			upload_size += get_level_data_size(*texture, uploaded_level);
+		}
+
+		if (uploaded > 0 && uploaded + upload_size > upload_budget)
+		{
+			break;
+		}
+
+		if (!make_room(command_buffer, texture->level_sizes[level]))
+		{
+			break;
+		}
+
+		resident_size += texture->level_sizes[level];
+		uploaded += upload_size;
+
+		if (texture->mode == TextureResidencyMode::Sparse)
+		{
+			VkMemoryRequirements memory_requirements;
+			vkGetImageMemoryRequirements(device.get_handle(), texture->sparse_image, &memory_requirements);
+
+			texture->level_memory[level] = allocate_memory(memory_requirements, texture->level_sizes[level]);
+			sparse_levels.emplace_back(texture, level);
+		}
+		else
+		{
+			texture->resident_level = level;
+			recreate_image(command_buffer, *texture, retired);
+		}
+	}
+
+	if (!sparse_levels.empty())
+	{
+		bind_sparse(sparse_levels);
+
+		for (auto &sparse_level : sparse_levels)
+		{
+			auto &texture = *sparse_level.first;
+
+			upload_levels(command_buffer, texture, sparse_level.second, sparse_level.second + 1, 0, retired);
+
+			texture.resident_level = sparse_level.second;
+			update_sparse_view(texture, retired);
+		}
+	}
+}
+
+void TextureStreamer::bind_feedback(vkb::core::CommandBufferC &command_buffer, uint32_t set, uint32_t binding)
+{
+	auto frame_index = render_context.get_active_frame_index();
+
+	assert(frame_index < feedback_buffers.size() && feedback_buffers[frame_index] && "The texture streamer was not updated for the active frame");
+
+	auto &feedback_buffer = *feedback_buffers[frame_index];
+	command_buffer.bind_buffer(feedback_buffer, 0, feedback_buffer.get_size(), set, binding, 0);
+}
+
+uint32_t TextureStreamer::get_feedback_index(const sg::Material &material) const
+{
+	auto it = feedback_indices.find(&material);
+	return it != feedback_indices.end() ? it->second : 0;
+}
+
+void TextureStreamer::set_memory_budget(VkDeviceSize budget)
+{
+	memory_budget = budget;
+}
+
+VkDeviceSize TextureStreamer::get_memory_budget() const
+{
+	return memory_budget;
+}
+
+void TextureStreamer::set_upload_budget(VkDeviceSize budget)
+{
+	upload_budget = budget;
+}
+
+VkDeviceSize TextureStreamer::get_resident_size() const
+{
+	return resident_size;
+}
+
+size_t TextureStreamer::get_pending_count() const
+{
+	return std::count_if(textures.begin(), textures.end(), [](const std::unique_ptr<StreamedTexture> &texture) { return texture->wanted_level < texture->resident_level; });
+}
+
+bool TextureStreamer::has_feedback() const
+{
+	return feedback_enabled;
+}
+
+void TextureStreamer::read_feedback()
+{
+	if (!feedback_enabled)
+	{
+		for (auto &texture : textures)
+		{
+			texture->wanted_level    = 0;
+			texture->last_seen_frame = frame_number;
+		}
+		return;
+	}
+
+	auto &feedback_buffer = *feedback_buffers[render_context.get_active_frame_index()];
+	auto *values          = reinterpret_cast<uint32_t *>(feedback_buffer.map());
+
+	for (auto &texture : textures)
+	{
+		uint32_t lowest_value = no_feedback;
+		for (auto feedback_index : texture->feedback_indices)
+		{
+			lowest_value = std::min(lowest_value, values[feedback_index]);
+		}
+
+		if (lowest_value != no_feedback)
+		{
+			// A texture of the size of the first level needs the level where a texel covers a pixel
+			float level = std::floor(texture->size_log2 + decode_feedback(lowest_value));
+
+			texture->wanted_level    = static_cast<uint32_t>(std::clamp(level, 0.0f, static_cast<float>(texture->tail_level)));
+			texture->last_seen_frame = frame_number;
+		}
+		else if (frame_number - texture->last_seen_frame > unseen_frame_count)
+		{
+			texture->wanted_level = texture->tail_level;
+		}
+	}
+
+	// Reset the feedback for the next frame rendered with the active render frame
+	std::fill(values, values + std::max<size_t>(feedback_indices.size(), 1), no_feedback);
+	feedback_buffer.flush();
+}
+
+bool TextureStreamer::make_room(vkb::core::CommandBufferC &command_buffer, VkDeviceSize size)
+{
+	if (resident_size + size <= memory_budget)
+	{
+		return true;
+	}
+
+	// Only levels which are not needed anymore are evicted, least recently seen first
+	std::vector<StreamedTexture *> candidates;
+	for (auto &texture : textures)
+	{
+		if (texture->resident_level < texture->wanted_level)
+		{
+			candidates.push_back(texture.get());
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end(), [](const StreamedTexture *a, const StreamedTexture *b) { return a->last_seen_frame < b->last_seen_frame; });
+
+	for (auto *texture : candidates)
+	{
+		uint32_t level = texture->resident_level;
+		while (level < texture->wanted_level && resident_size + size > memory_budget)
+		{
+			resident_size -= texture->level_sizes[level];
+			level++;
+		}
+
+		evict_levels(command_buffer, *texture, level);
+
+		if (resident_size + size <= memory_budget)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TextureStreamer::evict_unneeded_levels(vkb::core::CommandBufferC &command_buffer)
+{
+	for (auto &texture : textures)
+	{
+		if (texture->resident_level >= texture->wanted_level)
+		{
+			continue;
+		}
+
+		for (uint32_t level = texture->resident_level; level < texture->wanted_level; level++)
+		{
+			resident_size -= texture->level_sizes[level];
+		}
+
+		evict_levels(command_buffer, *texture, texture->wanted_level);
+	}
+}
+
+void TextureStreamer::evict_levels(vkb::core::CommandBufferC &command_buffer, StreamedTexture &texture, uint32_t level)
+{
+	auto &retired = get_retired_resources();
+
+	// The evicted levels may still be sampled by the frames in flight
+	texture.busy_until_frame = frame_number + render_context.get_render_frames().size();
+
+	if (texture.mode == TextureResidencyMode::Sparse)
+	{
+		for (uint32_t evicted_level = texture.resident_level; evicted_level < level; evicted_level++)
+		{
+			retired.memory.push_back(texture.level_memory[evicted_level]);
+			retired.sparse_levels.emplace_back(&texture, evicted_level);
+			texture.level_memory[evicted_level] = nullptr;
+		}
+
+		texture.resident_level = level;
+		update_sparse_view(texture, retired);
+	}
+	else
+	{
+		texture.resident_level = level;
+		recreate_image(command_buffer, texture, retired);
+	}
+}
+
+void TextureStreamer::recreate_image(vkb::core::CommandBufferC &command_buffer, StreamedTexture &texture, RetiredResources &retired)
+{
+	auto &device = render_context.get_device();
+	auto &image  = *texture.image;
+
+	auto vk_image = std::make_unique<core::Image>(device,
+	                                              image.get_mipmaps()[texture.resident_level].extent,
+	                                              image.get_format(),
+	                                              VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+	                                              VMA_MEMORY_USAGE_GPU_ONLY,
+	                                              VK_SAMPLE_COUNT_1_BIT,
+	                                              texture.level_count - texture.resident_level);
+	vk_image->set_debug_name(image.get_name());
+
+	auto vk_image_view = std::make_unique<core::ImageView>(*vk_image, VK_IMAGE_VIEW_TYPE_2D);
+	vk_image_view->set_debug_name("View on " + image.get_name());
+
+	texture.vk_image = vk_image.get();
+
+	upload_levels(command_buffer, texture, texture.resident_level, texture.level_count, texture.resident_level, retired);
+
+	retired.image_views.push_back(image.release_vk_image_view());
+	retired.images.push_back(image.release_vk_image());
+
+	image.set_vk_image(std::move(vk_image), std::move(vk_image_view));
+}
+
+void TextureStreamer::upload_levels(vkb::core::CommandBufferC &command_buffer, StreamedTexture &texture, uint32_t first_level, uint32_t last_level, uint32_t image_first_level, RetiredResources &retired)
+{
+	auto       &image   = *texture.image;
+	const auto &mipmaps = image.get_mipmaps();
+
+	// The levels are stored one after the other in the data of the image
+	VkDeviceSize begin = mipmaps[first_level].offset;
+	VkDeviceSize end   = last_level < texture.level_count ? mipmaps[last_level].offset : image.get_data().size();
+
+	auto staging_buffer = vkb::core::BufferC::create_staging_buffer(render_context.get_device(), end - begin, image.get_data().data() + begin);
+
+	std::vector<VkBufferImageCopy> copy_regions;
+	for (uint32_t level = first_level; level < last_level; level++)
+	{
+		VkBufferImageCopy copy_region{};
+		copy_region.bufferOffset                = mipmaps[level].offset - begin;
+		copy_region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		copy_region.imageSubresource.mipLevel   = level - image_first_level;
+		copy_region.imageSubresource.layerCount = 1;
+		copy_region.imageExtent                 = mipmaps[level].extent;
+
+		copy_regions.push_back(copy_region);
+	}
+
+	VkImageSubresourceRange subresource_range{VK_IMAGE_ASPECT_COLOR_BIT, first_level - image_first_level, last_level - first_level, 0, 1};
+
+	image_layout_transition(command_buffer.get_handle(), texture.vk_image->get_handle(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource_range);
+
+	command_buffer.copy_buffer_to_image(staging_buffer, *texture.vk_image, copy_regions);
+
+	image_layout_transition(command_buffer.get_handle(), texture.vk_image->get_handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresource_range);
+
+	retired.staging_buffers.push_back(std::move(staging_buffer));
+}
+
+void TextureStreamer::update_sparse_view(StreamedTexture &texture, RetiredResources &retired)
+{
+	auto &image = *texture.image;
+
+	auto vk_image_view = std::make_unique<core::ImageView>(*texture.vk_image, VK_IMAGE_VIEW_TYPE_2D, VK_FORMAT_UNDEFINED,
+	                                                       texture.resident_level, 0, texture.level_count - texture.resident_level, 1);
+	vk_image_view->set_debug_name("View on " + image.get_name());
+
+	retired.image_views.push_back(image.release_vk_image_view());
+
+	image.set_vk_image_view(std::move(vk_image_view));
+}
+
+void TextureStreamer::bind_sparse(const std::vector<std::pair<StreamedTexture *, uint32_t>> &levels, const std::vector<StreamedTexture *> &tails)
+{
+	if (levels.empty() && tails.empty())
+	{
+		return;
+	}
+
+	// Every bind is referred to by its own bind info, so that levels of different images can be bound at once
+	std::vector<VkSparseImageMemoryBind>     image_binds(levels.size());
+	std::vector<VkSparseImageMemoryBindInfo> image_bind_infos(levels.size());
+
+	for (size_t i = 0; i < levels.size(); i++)
+	{
+		auto &texture = *levels[i].first;
+		auto  level   = levels[i].second;
+
+		image_binds[i].subresource  = {VK_IMAGE_ASPECT_COLOR_BIT, level, 0};
+		image_binds[i].offset       = {0, 0, 0};
+		image_binds[i].extent       = texture.image->get_mipmaps()[level].extent;
+		set_bind_memory(image_binds[i], texture.level_memory[level]);
+
+		image_bind_infos[i].image     = texture.sparse_image;
+		image_bind_infos[i].bindCount = 1;
+		image_bind_infos[i].pBinds    = &image_binds[i];
+	}
+
+	std::vector<VkSparseMemoryBind>                opaque_binds(tails.size());
+	std::vector<VkSparseImageOpaqueMemoryBindInfo> opaque_bind_infos(tails.size());
+
+	for (size_t i = 0; i < tails.size(); i++)
+	{
+		opaque_binds[i].resourceOffset = tails[i]->sparse_tail_offset;
+		opaque_binds[i].size           = tails[i]->sparse_tail_size;
+		set_bind_memory(opaque_binds[i], tails[i]->tail_memory.front());
+
+		opaque_bind_infos[i].image     = tails[i]->sparse_image;
+		opaque_bind_infos[i].bindCount = 1;
+		opaque_bind_infos[i].pBinds    = &opaque_binds[i];
+	}
+
+	VkBindSparseInfo bind_info{VK_STRUCTURE_TYPE_BIND_SPARSE_INFO};
+	bind_info.imageBindCount       = to_u32(image_bind_infos.size());
+	bind_info.pImageBinds          = image_bind_infos.data();
+	bind_info.imageOpaqueBindCount = to_u32(opaque_bind_infos.size());
+	bind_info.pImageOpaqueBinds    = opaque_bind_infos.data();
+
+	// Binding is not ordered with the submissions using the levels, so it is waited for before recording them
+	auto device = render_context.get_device().get_handle();
+	VK_CHECK(vkQueueBindSparse(sparse_queue->get_handle(), 1, &bind_info, bind_fence));
+	VK_CHECK(vkWaitForFences(device, 1, &bind_fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+	VK_CHECK(vkResetFences(device, 1, &bind_fence));
+}
+
+void TextureStreamer::release_retired_resources(RetiredResources &retired)
+{
+	// Evicted sparse levels are unbound before their memory is freed
+	bind_sparse(retired.sparse_levels);
+
+	for (auto memory : retired.memory)
+	{
+		vmaFreeMemory(allocated::get_memory_allocator(), memory);
+	}
+
+	retired = {};
+}
+
+TextureStreamer::RetiredResources &TextureStreamer::get_retired_resources()
+{
+	return retired_resources[render_context.get_active_frame_index()];
+}
+
+VkDeviceSize TextureStreamer::get_level_data_size(const StreamedTexture &texture, uint32_t level) const
+{
+	const auto &mipmaps = texture.image->get_mipmaps();
+
+	VkDeviceSize end = level + 1 < texture.level_count ? mipmaps[level + 1].offset : texture.image->get_data().size();
+	return end - mipmaps[level].offset;
+}
+}        // namespace vkb
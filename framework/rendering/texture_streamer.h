@@ -0,0 +1,335 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/vk_common.h"
+#include "core/buffer.h"
+#include "memory_budget_tracker.h"
+
+namespace vkb
+{
+class Queue;
+
+namespace core
+{
+template <vkb::BindingType bindingType>
+class CommandBuffer;
+using CommandBufferC = CommandBuffer<vkb::BindingType::C>;
+
+class Image;
+class ImageView;
+}        // namespace core
+
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC = RenderContext<vkb::BindingType::C>;
+}        // namespace rendering
+
+namespace sg
+{
+class Image;
+class Material;
+class Scene;
+}        // namespace sg
+
+/**
+ * @brief How the mip levels of a streamed texture are made resident
+ */
+enum class TextureResidencyMode
+{
+	/// The image has its whole mip chain, and the streamed levels are bound to memory with sparse residency
+	Sparse,
+
+	/// The image only has the resident levels, and is recreated with more or fewer levels when they change
+	MipTail
+};
+
+/**
+ * @brief Streams the mip levels of the images of a scene, based on the detail the fragment shaders need
+ *
+ * Every image starts with its smallest levels resident, the mip tail, and is refined up to the level the
+ * fragments sampling it need. Fragment shaders including texture_streaming.h write the level of detail of
+ * their texture coordinates to a feedback buffer, per material, which is read back once the frame has completed.
+ * The missing levels are then uploaded, the textures missing the most levels first, within an upload budget per
+ * frame and a memory budget. When the memory budget is reached, the finest levels of the textures which are not
+ * needed anymore are evicted, least recently seen first.
+ *
+ * The streamer also follows the pressure on the memory heaps reported by the MemoryBudgetTracker: the uploads are
+ * deferred while the pressure is high, and under critical pressure every level which is not needed anymore is evicted.
+ *
+ * With sparse residency, the streamed levels are bound to memory one level at a time, in the same image.
+ * Otherwise, or for formats without sparse support, the image is recreated with the resident levels only.
+ * In both cases the resident levels are exposed through the image view of the sg::Image, so that the
+ * subpasses bind them as any other texture.
+ *
+ * The images must hold their whole mip chain on the CPU, which is kept as the source of the uploads, and must
+ * not have a Vulkan image yet, see GLTFLoader::set_texture_streaming().
+ */
+class TextureStreamer
+{
+  public:
+	/**
+	 * @param render_context The render context the textures are rendered with
+	 * @param memory_budget Device memory the textures can take, in bytes
+	 */
+	TextureStreamer(vkb::rendering::RenderContextC &render_context, VkDeviceSize memory_budget);
+
+	TextureStreamer(const TextureStreamer &) = delete;
+
+	TextureStreamer(TextureStreamer &&) = delete;
+
+	/**
+	 * @brief Destroys the Vulkan images of the streamed textures, the sg::Image components must still exist
+	 */
+	~TextureStreamer();
+
+	TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+	TextureStreamer &operator=(TextureStreamer &&) = delete;
+
+	/**
+	 * @brief Streams the images of a scene, creating their Vulkan images with their mip tail resident
+	 *        Adds the TEXTURE_STREAMING definition to the shader variants of the sub meshes, so it must be called
+	 *        before the subpasses rendering the scene are prepared.
+	 */
+	void add_scene(sg::Scene &scene);
+
+	/**
+	 * @brief Reads back the feedback of the frame which last used the active render frame, and records the uploads
+	 *        of the levels needed next. Must be recorded before the render pass sampling the textures.
+	 */
+	void update(vkb::core::CommandBufferC &command_buffer);
+
+	/**
+	 * @brief Binds the feedback buffer of the active frame, read by texture_streaming.h
+	 */
+	void bind_feedback(vkb::core::CommandBufferC &command_buffer, uint32_t set, uint32_t binding);
+
+	/**
+	 * @return Index of the feedback of a material, pushed after the PBR material uniform
+	 */
+	uint32_t get_feedback_index(const sg::Material &material) const;
+
+	void set_memory_budget(VkDeviceSize budget);
+
+	VkDeviceSize get_memory_budget() const;
+
+	/**
+	 * @param budget Bytes uploaded per frame at most, apart from a single level larger than that
+	 */
+	void set_upload_budget(VkDeviceSize budget);
+
+	/**
+	 * @return Device memory taken by the resident levels, in bytes
+	 */
+	VkDeviceSize get_resident_size() const;
+
+	/**
+	 * @return Number of textures whose resident levels are coarser than the ones their fragments need
+	 */
+	size_t get_pending_count() const;
+
+	/**
+	 * @return Whether the fragment shaders report the level of detail they need, otherwise every texture is refined up to its first level
+	 */
+	bool has_feedback() const;
+
+  private:
+	struct StreamedTexture
+	{
+		sg::Image *image{nullptr};
+
+		TextureResidencyMode mode{TextureResidencyMode::MipTail};
+
+		uint32_t level_count{1};
+
+		/// First level of the mip tail, which is always resident
+		uint32_t tail_level{0};
+
+		/// Finest resident level
+		uint32_t resident_level{0};
+
+		/// Finest level needed by the fragments
+		uint32_t wanted_level{0};
+
+		/// Base 2 logarithm of the largest dimension of the first level
+		float size_log2{0.0f};
+
+		/// Device memory taken by every level, for the streamed levels
+		std::vector<VkDeviceSize> level_sizes;
+
+		/// Device memory taken by the mip tail
+		VkDeviceSize tail_size{0};
+
+		/// Feedback indices of the materials sampling the image
+		std::vector<uint32_t> feedback_indices;
+
+		/// Frame the fragments last sampled the image in
+		uint64_t last_seen_frame{0};
+
+		/// Frame until which the levels are not refined, while an evicted level may still be in use
+		uint64_t busy_until_frame{0};
+
+		/// Vulkan image of the sg::Image, which views are created on
+		core::Image *vk_image{nullptr};
+
+		/// Sparse image, owned by the streamer as the core::Image of the sg::Image only wraps it
+		VkImage sparse_image{VK_NULL_HANDLE};
+
+		/// First level of the sparse mip tail, which is bound as a whole
+		uint32_t sparse_tail_level{0};
+
+		/// Range of the sparse mip tail in the image
+		VkDeviceSize sparse_tail_offset{0};
+
+		VkDeviceSize sparse_tail_size{0};
+
+		/// Memory bound to every streamed level with sparse residency, suballocated by VMA
+		std::vector<VmaAllocation> level_memory;
+
+		/// Memory bound to the mip tail with sparse residency
+		std::vector<VmaAllocation> tail_memory;
+	};
+
+	/**
+	 * @brief Resources which may still be in use by the frames in flight when they are replaced
+	 */
+	struct RetiredResources
+	{
+		std::vector<std::unique_ptr<core::Image>> images;
+
+		std::vector<std::unique_ptr<core::ImageView>> image_views;
+
+		/// Sparse levels to unbind before freeing their memory
+		std::vector<std::pair<StreamedTexture *, uint32_t>> sparse_levels;
+
+		std::vector<VmaAllocation> memory;
+
+		std::vector<vkb::core::BufferC> staging_buffers;
+	};
+
+	/**
+	 * @return The new texture, or nullptr if the image is not streamed
+	 */
+	StreamedTexture *add_image(sg::Image &image);
+
+	/**
+	 * @brief Creates an image with sparse residency, and binds its mip tail
+	 * @return Whether sparse residency is supported for the image
+	 */
+	bool create_sparse_image(StreamedTexture &texture);
+
+	/**
+	 * @brief Reads the feedback of the active frame and updates the wanted levels
+	 */
+	void read_feedback();
+
+	/**
+	 * @brief Evicts the finest level of textures which do not need it, until a size is available
+	 * @return Whether the size is available within the memory budget
+	 */
+	bool make_room(vkb::core::CommandBufferC &command_buffer, VkDeviceSize size);
+
+	/**
+	 * @brief Evicts the levels finer than the wanted level of every texture, to release memory under critical pressure
+	 */
+	void evict_unneeded_levels(vkb::core::CommandBufferC &command_buffer);
+
+	/**
+	 * @brief Evicts the finest levels of a texture
+	 * @param level The new finest resident level
+	 */
+	void evict_levels(vkb::core::CommandBufferC &command_buffer, StreamedTexture &texture, uint32_t level);
+
+	/**
+	 * @brief Recreates an image without sparse residency with its resident levels, and records their upload
+	 */
+	void recreate_image(vkb::core::CommandBufferC &command_buffer, StreamedTexture &texture, RetiredResources &retired);
+
+	/**
+	 * @brief Records the upload of levels from the CPU data of the image
+	 * @param first_level First level uploaded
+	 * @param last_level Level after the last level uploaded
+	 * @param image_first_level Level of the data at the first level of the Vulkan image
+	 */
+	void upload_levels(vkb::core::CommandBufferC &command_buffer, StreamedTexture &texture, uint32_t first_level, uint32_t last_level, uint32_t image_first_level, RetiredResources &retired);
+
+	/**
+	 * @brief Replaces the image view of a sparse image with one starting at its resident level
+	 */
+	void update_sparse_view(StreamedTexture &texture, RetiredResources &retired);
+
+	/**
+	 * @brief Binds the memory of sparse levels, or unbinds them if they have none, and waits for the binding
+	 * @param levels Levels to bind
+	 * @param tails Textures whose mip tail is bound
+	 */
+	void bind_sparse(const std::vector<std::pair<StreamedTexture *, uint32_t>> &levels, const std::vector<StreamedTexture *> &tails = {});
+
+	/**
+	 * @brief Destroys the resources retired when the active frame was last rendered
+	 */
+	void release_retired_resources(RetiredResources &retired);
+
+	RetiredResources &get_retired_resources();
+
+	VkDeviceSize get_level_data_size(const StreamedTexture &texture, uint32_t level) const;
+
+	vkb::rendering::RenderContextC &render_context;
+
+	VkDeviceSize memory_budget;
+
+	VkDeviceSize upload_budget{32 * 1024 * 1024};
+
+	VkDeviceSize resident_size{0};
+
+	/// Pressure on the memory heaps, updated by the MemoryBudgetTracker callback
+	MemoryPressure memory_pressure{MemoryPressure::None};
+
+	uint32_t pressure_callback_id{0};
+
+	bool feedback_enabled{false};
+
+	bool sparse_enabled{false};
+
+	/// Queue binding the sparse levels, which renders as well
+	const Queue *sparse_queue{nullptr};
+
+	VkFence bind_fence{VK_NULL_HANDLE};
+
+	std::vector<std::unique_ptr<StreamedTexture>> textures;
+
+	std::unordered_map<const sg::Image *, StreamedTexture *> texture_by_image;
+
+	std::unordered_map<const sg::Material *, uint32_t> feedback_indices;
+
+	/// Feedback written by the fragment shaders, per render frame
+	std::vector<std::unique_ptr<vkb::core::BufferC>> feedback_buffers;
+
+	/// Resources retired while rendering with every render frame
+	std::vector<RetiredResources> retired_resources;
+
+	uint64_t frame_number{0};
+};
+}        // namespace vkb
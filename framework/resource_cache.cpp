@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2020, Arm Limited and Contributors
+/* Copyright (c) 2019-2025, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -19,6 +19,17 @@
 
 #include "common/resource_caching.h"
 #include "core/device.h"
+#include "core/hpp_descriptor_set.h"
+#include "core/hpp_device.h"
+#include "core/hpp_framebuffer.h"
+#include "core/hpp_image_view.h"
+#include "core/hpp_pipeline.h"
+#include "core/hpp_pipeline_layout.h"
+#include "core/hpp_render_pass.h"
+#include "pipeline_library_cache.h"
+#include "rendering/hpp_pipeline_state.h"
+#include "rendering/hpp_render_target.h"
+#include "shader_object_cache.h"
 
 namespace vkb
 {
@@ -35,79 +46,191 @@ T &request_resource(Device &device, ResourceRecord &recorder, std::mutex &resour
 }
 }        // namespace
 
-ResourceCache::ResourceCache(Device &device) :
-    device{device}
+template <vkb::BindingType bindingType>
+ResourceCache<bindingType>::ResourceCache(DeviceType &device) :
+    device{reinterpret_cast<vkb::Device &>(device)}
 {
 }
 
-void ResourceCache::warmup(const std::vector<uint8_t> &data)
+template <vkb::BindingType bindingType>
+ResourceCache<bindingType>::~ResourceCache() = default;
+
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::warmup(const std::vector<uint8_t> &data)
 {
 	recorder.set_data(data);
 
-	replayer.play(*this, recorder);
+	replayer.play(reinterpret_cast<ResourceCacheC &>(*this), recorder);
 }
 
-std::vector<uint8_t> ResourceCache::serialize()
+template <vkb::BindingType bindingType>
+std::vector<uint8_t> ResourceCache<bindingType>::serialize()
 {
 	return recorder.get_data();
 }
 
-void ResourceCache::set_pipeline_cache(VkPipelineCache new_pipeline_cache)
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::set_pipeline_cache(PipelineCacheType new_pipeline_cache)
+{
+	pipeline_cache = static_cast<VkPipelineCache>(new_pipeline_cache);
+}
+
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::enable_pipeline_libraries()
+{
+	pipeline_library_cache = std::make_unique<PipelineLibraryCache>(device);
+}
+
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::update_pipelines(uint32_t frames_in_flight)
+{
+	if (pipeline_library_cache)
+	{
+		pipeline_library_cache->update_pipelines(frames_in_flight);
+	}
+}
+
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::set_shader_objects(bool enabled)
+{
+	if (enabled && !shader_object_cache)
+	{
+		if (!device.is_enabled(VK_EXT_SHADER_OBJECT_EXTENSION_NAME) || !device.is_enabled(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+		{
+			throw std::runtime_error{"Shader objects require VK_EXT_shader_object and VK_KHR_dynamic_rendering"};
+		}
+		shader_object_cache = std::make_unique<ShaderObjectCache>(device);
+	}
+	else if (!enabled)
+	{
+		shader_object_cache.reset();
+	}
+}
+
+template <vkb::BindingType bindingType>
+bool ResourceCache<bindingType>::uses_shader_objects() const
+{
+	return shader_object_cache != nullptr;
+}
+
+template <vkb::BindingType bindingType>
+size_t ResourceCache<bindingType>::get_shader_object_count() const
+{
+	return shader_object_cache ? shader_object_cache->get_shader_object_count() : 0;
+}
+
+template <vkb::BindingType bindingType>
+const ShaderObjectBinding &ResourceCache<bindingType>::request_shader_objects(PipelineStateType &pipeline_state)
 {
-	pipeline_cache = new_pipeline_cache;
+	assert(shader_object_cache && "Shader objects are not used");
+	return shader_object_cache->request_shader_objects(reinterpret_cast<PipelineState &>(pipeline_state));
 }
 
-ShaderModule &ResourceCache::request_shader_module(VkShaderStageFlagBits stage, const ShaderSource &glsl_source, const ShaderVariant &shader_variant)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::ShaderModuleType &
+    ResourceCache<bindingType>::request_shader_module(ShaderStageFlagBitsType stage, const ShaderSourceType &glsl_source, const ShaderVariantType &shader_variant)
 {
 	std::string entry_point{"main"};
-	return request_resource(device, recorder, shader_module_mutex, state.shader_modules, stage, glsl_source, entry_point, shader_variant);
+	auto        vk_stage = static_cast<VkShaderStageFlagBits>(stage);
+
+	return reinterpret_cast<ShaderModuleType &>(request_resource(device, recorder, shader_module_mutex, state.shader_modules, vk_stage,
+	                                                             reinterpret_cast<const ShaderSource &>(glsl_source), entry_point,
+	                                                             reinterpret_cast<const ShaderVariant &>(shader_variant)));
 }
 
-PipelineLayout &ResourceCache::request_pipeline_layout(const std::vector<ShaderModule *> &shader_modules)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::PipelineLayoutType &ResourceCache<bindingType>::request_pipeline_layout(const std::vector<ShaderModuleType *> &shader_modules)
 {
-	return request_resource(device, recorder, pipeline_layout_mutex, state.pipeline_layouts, shader_modules);
+	return reinterpret_cast<PipelineLayoutType &>(request_resource(device, recorder, pipeline_layout_mutex, state.pipeline_layouts,
+	                                                               reinterpret_cast<const std::vector<ShaderModule *> &>(shader_modules)));
 }
 
-DescriptorSetLayout &ResourceCache::request_descriptor_set_layout(const uint32_t                     set_index,
-                                                                  const std::vector<ShaderModule *> &shader_modules,
-                                                                  const std::vector<ShaderResource> &set_resources)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::DescriptorSetLayoutType &
+    ResourceCache<bindingType>::request_descriptor_set_layout(const uint32_t                           set_index,
+                                                              const std::vector<ShaderModuleType *>   &shader_modules,
+                                                              const std::vector<ShaderResourceType>   &set_resources)
 {
-	return request_resource(device, recorder, descriptor_set_layout_mutex, state.descriptor_set_layouts, set_index, shader_modules, set_resources);
+	return reinterpret_cast<DescriptorSetLayoutType &>(request_resource(device, recorder, descriptor_set_layout_mutex, state.descriptor_set_layouts, set_index,
+	                                                                    reinterpret_cast<const std::vector<ShaderModule *> &>(shader_modules),
+	                                                                    reinterpret_cast<const std::vector<ShaderResource> &>(set_resources)));
 }
 
-GraphicsPipeline &ResourceCache::request_graphics_pipeline(PipelineState &pipeline_state)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::GraphicsPipelineType &ResourceCache<bindingType>::request_graphics_pipeline(PipelineStateType &pipeline_state)
 {
-	return request_resource(device, recorder, graphics_pipeline_mutex, state.graphics_pipelines, pipeline_cache, pipeline_state);
+	auto &vk_pipeline_state = reinterpret_cast<PipelineState &>(pipeline_state);
+
+	if (pipeline_library_cache)
+	{
+		return reinterpret_cast<GraphicsPipelineType &>(pipeline_library_cache->request_graphics_pipeline(pipeline_cache, vk_pipeline_state, &recorder));
+	}
+
+	return reinterpret_cast<GraphicsPipelineType &>(
+	    request_resource(device, recorder, graphics_pipeline_mutex, state.graphics_pipelines, pipeline_cache, vk_pipeline_state));
 }
 
-ComputePipeline &ResourceCache::request_compute_pipeline(PipelineState &pipeline_state)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::ComputePipelineType &ResourceCache<bindingType>::request_compute_pipeline(PipelineStateType &pipeline_state)
 {
-	return request_resource(device, recorder, compute_pipeline_mutex, state.compute_pipelines, pipeline_cache, pipeline_state);
+	return reinterpret_cast<ComputePipelineType &>(request_resource(device, recorder, compute_pipeline_mutex, state.compute_pipelines, pipeline_cache,
+	                                                                reinterpret_cast<PipelineState &>(pipeline_state)));
 }
 
-DescriptorSet &ResourceCache::request_descriptor_set(DescriptorSetLayout &descriptor_set_layout, const BindingMap<VkDescriptorBufferInfo> &buffer_infos, const BindingMap<VkDescriptorImageInfo> &image_infos)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::DescriptorSetType &
+    ResourceCache<bindingType>::request_descriptor_set(DescriptorSetLayoutType                    &descriptor_set_layout,
+                                                       const BindingMap<DescriptorBufferInfoType> &buffer_infos,
+                                                       const BindingMap<DescriptorImageInfoType>  &image_infos)
 {
-	auto &descriptor_pool = request_resource(device, recorder, descriptor_set_mutex, state.descriptor_pools, descriptor_set_layout);
-	return request_resource(device, recorder, descriptor_set_mutex, state.descriptor_sets, descriptor_set_layout, descriptor_pool, buffer_infos, image_infos);
+	auto &vk_descriptor_set_layout = reinterpret_cast<DescriptorSetLayout &>(descriptor_set_layout);
+	auto &vk_buffer_infos          = reinterpret_cast<const BindingMap<VkDescriptorBufferInfo> &>(buffer_infos);
+	auto &vk_image_infos           = reinterpret_cast<const BindingMap<VkDescriptorImageInfo> &>(image_infos);
+
+	auto &descriptor_pool = request_resource(device, recorder, descriptor_set_mutex, state.descriptor_pools, vk_descriptor_set_layout);
+	return reinterpret_cast<DescriptorSetType &>(request_resource(device, recorder, descriptor_set_mutex, state.descriptor_sets, vk_descriptor_set_layout,
+	                                                              descriptor_pool, vk_buffer_infos, vk_image_infos));
 }
 
-RenderPass &ResourceCache::request_render_pass(const std::vector<Attachment> &attachments, const std::vector<LoadStoreInfo> &load_store_infos, const std::vector<SubpassInfo> &subpasses)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::RenderPassType &ResourceCache<bindingType>::request_render_pass(const std::vector<AttachmentType>    &attachments,
+                                                                                                     const std::vector<LoadStoreInfoType> &load_store_infos,
+                                                                                                     const std::vector<SubpassInfoType>   &subpasses)
 {
-	return request_resource(device, recorder, render_pass_mutex, state.render_passes, attachments, load_store_infos, subpasses);
+	return reinterpret_cast<RenderPassType &>(request_resource(device, recorder, render_pass_mutex, state.render_passes,
+	                                                           reinterpret_cast<const std::vector<Attachment> &>(attachments),
+	                                                           reinterpret_cast<const std::vector<LoadStoreInfo> &>(load_store_infos),
+	                                                           reinterpret_cast<const std::vector<SubpassInfo> &>(subpasses)));
 }
 
-Framebuffer &ResourceCache::request_framebuffer(const RenderTarget &render_target, const RenderPass &render_pass)
+template <vkb::BindingType bindingType>
+typename ResourceCache<bindingType>::FramebufferType &ResourceCache<bindingType>::request_framebuffer(const RenderTargetType &render_target,
+                                                                                                       const RenderPassType   &render_pass)
 {
-	return request_resource(device, recorder, framebuffer_mutex, state.framebuffers, render_target, render_pass);
+	return reinterpret_cast<FramebufferType &>(request_resource(device, recorder, framebuffer_mutex, state.framebuffers,
+	                                                            reinterpret_cast<const RenderTarget &>(render_target),
+	                                                            reinterpret_cast<const RenderPass &>(render_pass)));
 }
 
-void ResourceCache::clear_pipelines()
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::clear_pipelines()
 {
+	if (pipeline_library_cache)
+	{
+		pipeline_library_cache->clear();
+	}
+
+	if (shader_object_cache)
+	{
+		shader_object_cache->clear();
+	}
+
 	state.graphics_pipelines.clear();
 	state.compute_pipelines.clear();
 }
 
-void ResourceCache::update_descriptor_sets(const std::vector<core::ImageView> &old_views, const std::vector<core::ImageView> &new_views)
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::update_descriptor_sets(const std::vector<ImageViewType> &old_views, const std::vector<ImageViewType> &new_views)
 {
 	// Find descriptor sets referring to the old image view
 	std::vector<VkWriteDescriptorSet> set_updates;
@@ -115,8 +238,8 @@ void ResourceCache::update_descriptor_sets(const std::vector<core::ImageView> &o
 
 	for (size_t i = 0; i < old_views.size(); ++i)
 	{
-		auto &old_view = old_views[i];
-		auto &new_view = new_views[i];
+		auto old_view = static_cast<VkImageView>(old_views[i].get_handle());
+		auto new_view = static_cast<VkImageView>(new_views[i].get_handle());
 
 		for (auto &kd_pair : state.descriptor_sets)
 		{
@@ -135,13 +258,13 @@ void ResourceCache::update_descriptor_sets(const std::vector<core::ImageView> &o
 					auto &array_element = ai_pair.first;
 					auto &image_info    = ai_pair.second;
 
-					if (image_info.imageView == old_view.get_handle())
+					if (image_info.imageView == old_view)
 					{
 						// Save key to remove old descriptor set
 						matches.insert(key);
 
 						// Update image info with new view
-						image_info.imageView = new_view.get_handle();
+						image_info.imageView = new_view;
 
 						// Save struct for writing the update later
 						{
@@ -192,12 +315,14 @@ void ResourceCache::update_descriptor_sets(const std::vector<core::ImageView> &o
 	}
 }
 
-void ResourceCache::clear_framebuffers()
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::clear_framebuffers()
 {
 	state.framebuffers.clear();
 }
 
-void ResourceCache::clear()
+template <vkb::BindingType bindingType>
+void ResourceCache<bindingType>::clear()
 {
 	state.shader_modules.clear();
 	state.pipeline_layouts.clear();
@@ -208,8 +333,12 @@ void ResourceCache::clear()
 	clear_framebuffers();
 }
 
-const ResourceCacheState &ResourceCache::get_internal_state() const
+template <vkb::BindingType bindingType>
+const ResourceCacheState &ResourceCache<bindingType>::get_internal_state() const
 {
 	return state;
 }
+
+template class ResourceCache<vkb::BindingType::C>;
+template class ResourceCache<vkb::BindingType::Cpp>;
 }        // namespace vkb
@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2020, Arm Limited and Contributors
+/* Copyright (c) 2019-2025, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,10 +17,13 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include <vulkan/vulkan.hpp>
+
 #include "common/helpers.h"
 #include "core/descriptor_pool.h"
 #include "core/descriptor_set.h"
@@ -33,11 +36,40 @@
 namespace vkb
 {
 class Device;
+class PipelineLibraryCache;
+class ShaderObjectCache;
+struct ShaderObjectBinding;
+
+namespace common
+{
+struct HPPLoadStoreInfo;
+}
 
 namespace core
 {
+class HPPComputePipeline;
+class HPPDescriptorSet;
+class HPPDescriptorSetLayout;
+class HPPDevice;
+class HPPFramebuffer;
+class HPPGraphicsPipeline;
+class HPPImageView;
+class HPPPipelineLayout;
+class HPPRenderPass;
+class HPPShaderModule;
+struct HPPShaderResource;
+class HPPShaderSource;
+class HPPShaderVariant;
+struct HPPSubpassInfo;
 class ImageView;
-}
+}        // namespace core
+
+namespace rendering
+{
+struct HPPAttachment;
+class HPPPipelineState;
+class HPPRenderTarget;
+}        // namespace rendering
 
 /**
  * @brief Struct to hold the internal state of the Resource Cache
@@ -75,16 +107,48 @@ struct ResourceCacheState
  * the cache on app startup by creating all necessary objects.
  * The cache holds pointers to objects and has a mapping from such pointers to hashes.
  * It can only be destroyed in bulk, single elements cannot be removed.
+ *
+ * Both bindings share a single implementation. It works on the C types, as the vulkan.hpp core objects
+ * are facades over them, so the cached objects and their hashes are the same whichever binding requests them.
+ * The members are defined in resource_cache.cpp and explicitly instantiated for vkb::BindingType::C and vkb::BindingType::Cpp.
  */
+template <vkb::BindingType bindingType>
 class ResourceCache
 {
   public:
-	ResourceCache(Device &device);
+	using DescriptorBufferInfoType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DescriptorBufferInfo, VkDescriptorBufferInfo>::type;
+	using DescriptorImageInfoType  = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DescriptorImageInfo, VkDescriptorImageInfo>::type;
+	using PipelineCacheType        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::PipelineCache, VkPipelineCache>::type;
+	using ShaderStageFlagBitsType  = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::ShaderStageFlagBits, VkShaderStageFlagBits>::type;
+
+	using AttachmentType          = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPAttachment, vkb::Attachment>::type;
+	using ComputePipelineType     = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPComputePipeline, vkb::ComputePipeline>::type;
+	using DescriptorSetLayoutType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDescriptorSetLayout, vkb::DescriptorSetLayout>::type;
+	using DescriptorSetType       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDescriptorSet, vkb::DescriptorSet>::type;
+	using DeviceType              = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPDevice, vkb::Device>::type;
+	using FramebufferType         = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPFramebuffer, vkb::Framebuffer>::type;
+	using GraphicsPipelineType    = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPGraphicsPipeline, vkb::GraphicsPipeline>::type;
+	using ImageViewType           = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPImageView, vkb::core::ImageView>::type;
+	using LoadStoreInfoType       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::common::HPPLoadStoreInfo, vkb::LoadStoreInfo>::type;
+	using PipelineLayoutType      = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPPipelineLayout, vkb::PipelineLayout>::type;
+	using PipelineStateType       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPPipelineState, vkb::PipelineState>::type;
+	using RenderPassType          = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPRenderPass, vkb::RenderPass>::type;
+	using RenderTargetType        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::rendering::HPPRenderTarget, vkb::RenderTarget>::type;
+	using ShaderModuleType        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPShaderModule, vkb::ShaderModule>::type;
+	using ShaderResourceType      = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPShaderResource, vkb::ShaderResource>::type;
+	using ShaderSourceType        = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPShaderSource, vkb::ShaderSource>::type;
+	using ShaderVariantType       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPShaderVariant, vkb::ShaderVariant>::type;
+	using SubpassInfoType         = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPSubpassInfo, vkb::SubpassInfo>::type;
+
+  public:
+	ResourceCache(DeviceType &device);
 
 	ResourceCache(const ResourceCache &) = delete;
 
 	ResourceCache(ResourceCache &&) = delete;
 
+	~ResourceCache();
+
 	ResourceCache &operator=(const ResourceCache &) = delete;
 
 	ResourceCache &operator=(ResourceCache &&) = delete;
@@ -93,37 +157,69 @@ class ResourceCache
 
 	std::vector<uint8_t> serialize();
 
-	void set_pipeline_cache(VkPipelineCache pipeline_cache);
+	void set_pipeline_cache(PipelineCacheType pipeline_cache);
+
+	/**
+	 * @brief Links the graphics pipelines from graphics pipeline libraries, see PipelineLibraryCache
+	 *        VK_EXT_graphics_pipeline_library must be enabled
+	 */
+	void enable_pipeline_libraries();
+
+	/**
+	 * @brief Swaps in the graphics pipelines optimized in the background, once per frame
+	 * @param frames_in_flight Number of frames which may still use a replaced pipeline
+	 */
+	void update_pipelines(uint32_t frames_in_flight);
+
+	/**
+	 * @brief Makes the command buffers bind shader objects and set the pipeline state with dynamic state commands,
+	 *        instead of requesting pipelines. VK_EXT_shader_object and VK_KHR_dynamic_rendering must be enabled to use shader objects.
+	 *        Graphics shader objects are bound in render passes with a single subpass and no input attachments, which are
+	 *        begun with dynamic rendering. Other render passes keep using pipelines.
+	 */
+	void set_shader_objects(bool enabled);
+
+	bool uses_shader_objects() const;
 
-	ShaderModule &request_shader_module(VkShaderStageFlagBits stage, const ShaderSource &glsl_source, const ShaderVariant &shader_variant = {});
+	/**
+	 * @return Number of shader objects created, 0 if shader objects are not used
+	 */
+	size_t get_shader_object_count() const;
 
-	PipelineLayout &request_pipeline_layout(const std::vector<ShaderModule *> &shader_modules);
+	/**
+	 * @brief Requests the shader objects of the shader modules of a pipeline state, see ShaderObjectCache
+	 */
+	const ShaderObjectBinding &request_shader_objects(PipelineStateType &pipeline_state);
 
-	DescriptorSetLayout &request_descriptor_set_layout(const uint32_t                     set_index,
-	                                                   const std::vector<ShaderModule *> &shader_modules,
-	                                                   const std::vector<ShaderResource> &set_resources);
+	ShaderModuleType &request_shader_module(ShaderStageFlagBitsType stage, const ShaderSourceType &glsl_source, const ShaderVariantType &shader_variant = {});
 
-	GraphicsPipeline &request_graphics_pipeline(PipelineState &pipeline_state);
+	PipelineLayoutType &request_pipeline_layout(const std::vector<ShaderModuleType *> &shader_modules);
 
-	ComputePipeline &request_compute_pipeline(PipelineState &pipeline_state);
+	DescriptorSetLayoutType &request_descriptor_set_layout(const uint32_t                             set_index,
+	                                                       const std::vector<ShaderModuleType *>   &shader_modules,
+	                                                       const std::vector<ShaderResourceType>   &set_resources);
 
-	DescriptorSet &request_descriptor_set(DescriptorSetLayout &                     descriptor_set_layout,
-	                                      const BindingMap<VkDescriptorBufferInfo> &buffer_infos,
-	                                      const BindingMap<VkDescriptorImageInfo> & image_infos);
+	GraphicsPipelineType &request_graphics_pipeline(PipelineStateType &pipeline_state);
 
-	RenderPass &request_render_pass(const std::vector<Attachment> &   attachments,
-	                                const std::vector<LoadStoreInfo> &load_store_infos,
-	                                const std::vector<SubpassInfo> &  subpasses);
+	ComputePipelineType &request_compute_pipeline(PipelineStateType &pipeline_state);
 
-	Framebuffer &request_framebuffer(const RenderTarget &render_target,
-	                                 const RenderPass &  render_pass);
+	DescriptorSetType &request_descriptor_set(DescriptorSetLayoutType                    &descriptor_set_layout,
+	                                          const BindingMap<DescriptorBufferInfoType> &buffer_infos,
+	                                          const BindingMap<DescriptorImageInfoType>  &image_infos);
+
+	RenderPassType &request_render_pass(const std::vector<AttachmentType>    &attachments,
+	                                    const std::vector<LoadStoreInfoType> &load_store_infos,
+	                                    const std::vector<SubpassInfoType>   &subpasses);
+
+	FramebufferType &request_framebuffer(const RenderTargetType &render_target,
+	                                     const RenderPassType   &render_pass);
 
 	void clear_pipelines();
 
 	/// @brief Update those descriptor sets referring to old views
 	/// @param old_views Old image views referred by descriptor sets
 	/// @param new_views New image views to be referred
-	void update_descriptor_sets(const std::vector<core::ImageView> &old_views, const std::vector<core::ImageView> &new_views);
+	void update_descriptor_sets(const std::vector<ImageViewType> &old_views, const std::vector<ImageViewType> &new_views);
 
 	void clear_framebuffers();
 
@@ -132,7 +228,7 @@ class ResourceCache
 	const ResourceCacheState &get_internal_state() const;
 
   private:
-	Device &device;
+	vkb::Device &device;
 
 	ResourceRecord recorder;
 
@@ -157,5 +253,12 @@ class ResourceCache
 	std::mutex compute_pipeline_mutex;
 
 	std::mutex framebuffer_mutex;
+
+	std::unique_ptr<PipelineLibraryCache> pipeline_library_cache;
+
+	std::unique_ptr<ShaderObjectCache> shader_object_cache;
 };
+
+using ResourceCacheC   = ResourceCache<vkb::BindingType::C>;
+using ResourceCacheCpp = ResourceCache<vkb::BindingType::Cpp>;
 }        // namespace vkb
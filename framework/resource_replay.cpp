@@ -58,7 +58,7 @@ ResourceReplay::ResourceReplay()
 	stream_resources[ResourceType::GraphicsPipeline] = std::bind(&ResourceReplay::create_graphics_pipeline, this, std::placeholders::_1, std::placeholders::_2);
 }
 
-void ResourceReplay::play(ResourceCache &resource_cache, ResourceRecord &recorder)
+void ResourceReplay::play(ResourceCacheC &resource_cache, ResourceRecord &recorder)
 {
 	std::istringstream stream{recorder.get_stream().str()};
 
@@ -89,7 +89,7 @@ void ResourceReplay::play(ResourceCache &resource_cache, ResourceRecord &recorde
 	}
 }
 
-void ResourceReplay::create_shader_module(ResourceCache &resource_cache, std::istringstream &stream)
+void ResourceReplay::create_shader_module(ResourceCacheC &resource_cache, std::istringstream &stream)
 {
 	VkShaderStageFlagBits    stage{};
 	std::string              glsl_source;
@@ -114,7 +114,7 @@ void ResourceReplay::create_shader_module(ResourceCache &resource_cache, std::is
 	shader_modules.push_back(&shader_module);
 }
 
-void ResourceReplay::create_pipeline_layout(ResourceCache &resource_cache, std::istringstream &stream)
+void ResourceReplay::create_pipeline_layout(ResourceCacheC &resource_cache, std::istringstream &stream)
 {
 	std::vector<size_t> shader_indices;
 
@@ -135,7 +135,7 @@ void ResourceReplay::create_pipeline_layout(ResourceCache &resource_cache, std::
 	pipeline_layouts.push_back(&pipeline_layout);
 }
 
-void ResourceReplay::create_render_pass(ResourceCache &resource_cache, std::istringstream &stream)
+void ResourceReplay::create_render_pass(ResourceCacheC &resource_cache, std::istringstream &stream)
 {
 	std::vector<Attachment>    attachments;
 	std::vector<LoadStoreInfo> load_store_infos;
@@ -152,7 +152,7 @@ void ResourceReplay::create_render_pass(ResourceCache &resource_cache, std::istr
 	render_passes.push_back(&render_pass);
 }
 
-void ResourceReplay::create_graphics_pipeline(ResourceCache &resource_cache, std::istringstream &stream)
+void ResourceReplay::create_graphics_pipeline(ResourceCacheC &resource_cache, std::istringstream &stream)
 {
 	size_t   pipeline_layout_index{};
 	size_t   render_pass_index{};
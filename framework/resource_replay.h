@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include "common/vk_common.h"
 #include "resource_record.h"
 
 namespace vkb
 {
+template <vkb::BindingType bindingType>
 class ResourceCache;
+using ResourceCacheC = ResourceCache<vkb::BindingType::C>;
 
 /**
  * @brief Reads Vulkan objects from a memory stream and creates them in the resource cache.
@@ -31,19 +34,19 @@ class ResourceReplay
   public:
 	ResourceReplay();
 
-	void play(ResourceCache &resource_cache, ResourceRecord &recorder);
+	void play(ResourceCacheC &resource_cache, ResourceRecord &recorder);
 
   protected:
-	void create_shader_module(ResourceCache &resource_cache, std::istringstream &stream);
+	void create_shader_module(ResourceCacheC &resource_cache, std::istringstream &stream);
 
-	void create_pipeline_layout(ResourceCache &resource_cache, std::istringstream &stream);
+	void create_pipeline_layout(ResourceCacheC &resource_cache, std::istringstream &stream);
 
-	void create_render_pass(ResourceCache &resource_cache, std::istringstream &stream);
+	void create_render_pass(ResourceCacheC &resource_cache, std::istringstream &stream);
 
-	void create_graphics_pipeline(ResourceCache &resource_cache, std::istringstream &stream);
+	void create_graphics_pipeline(ResourceCacheC &resource_cache, std::istringstream &stream);
 
   private:
-	using ResourceFunc = std::function<void(ResourceCache &, std::istringstream &)>;
+	using ResourceFunc = std::function<void(ResourceCacheC &, std::istringstream &)>;
 
 	std::unordered_map<ResourceType, ResourceFunc> stream_resources;
 
@@ -25,7 +25,9 @@
 #include <stb_image_resize.h>
 
 #include "common/utils.h"
+#include "core/device.h"
 #include "filesystem/legacy.h"
+#include "memory_budget_tracker.h"
 #include "scene_graph/components/image/astc.h"
 #include "scene_graph/components/image/ktx.h"
 #include "scene_graph/components/image/stb.h"
@@ -200,10 +202,47 @@ void Image::create_vk_image(Device &device, VkImageViewType image_view_type, VkI
 {
 	assert(!vk_image && !vk_image_view && "Vulkan image already constructed");
 
+	// Near the memory budget, the finest levels are dropped rather than failing the allocation
+	if (offsets.empty() && !data.empty())
+	{
+		auto  &memory_budget_tracker = MemoryBudgetTracker::get();
+		size_t dropped_level_count   = 0;
+
+		while (mipmaps.size() > 1 && !memory_budget_tracker.can_allocate(data.size()))
+		{
+			uint32_t level_size = mipmaps[1].offset - mipmaps[0].offset;
+
+			data.erase(data.begin() + mipmaps[0].offset, data.begin() + mipmaps[1].offset);
+			mipmaps.erase(mipmaps.begin());
+
+			for (auto &mipmap : mipmaps)
+			{
+				mipmap.level--;
+				mipmap.offset -= level_size;
+			}
+
+			dropped_level_count++;
+		}
+
+		if (dropped_level_count > 0)
+		{
+			memory_budget_tracker.record_degraded_allocation();
+			LOGW("Dropped the {} finest levels of image {} to stay within the memory budget", dropped_level_count, get_name());
+		}
+	}
+
+	VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+	// Images which the device can copy to from the host skip the staging buffers, see copy_data_from_host
+	if (device.is_host_image_copy_optimal(format, usage, flags))
+	{
+		usage |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+	}
+
 	vk_image = std::make_unique<core::Image>(device,
 	                                         get_extent(),
 	                                         format,
-	                                         VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+	                                         usage,
 	                                         VMA_MEMORY_USAGE_GPU_ONLY,
 	                                         VK_SAMPLE_COUNT_1_BIT,
 	                                         to_u32(mipmaps.size()),
@@ -216,6 +255,67 @@ void Image::create_vk_image(Device &device, VkImageViewType image_view_type, VkI
 	vk_image_view->set_debug_name("View on " + get_name());
 }
 
+bool Image::copy_data_from_host()
+{
+	assert(vk_image && "Vulkan image was not created");
+
+	if ((vk_image->get_usage() & VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT) == 0)
+	{
+		return false;
+	}
+
+	std::vector<VkMemoryToImageCopyEXT> copies;
+
+	for (auto &mipmap : mipmaps)
+	{
+		VkMemoryToImageCopyEXT copy{};
+		copy.sType                       = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+		copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		copy.imageSubresource.mipLevel   = mipmap.level;
+		copy.imageExtent                 = mipmap.extent;
+
+		// Without offsets per layer, the layers of a level follow each other, as for a buffer to image copy
+		if (offsets.empty())
+		{
+			copy.imageSubresource.layerCount = layers;
+			copy.pHostPointer                = data.data() + mipmap.offset;
+			copies.push_back(copy);
+			continue;
+		}
+
+		for (uint32_t layer = 0; layer < layers; layer++)
+		{
+			copy.imageSubresource.baseArrayLayer = layer;
+			copy.imageSubresource.layerCount     = 1;
+			copy.pHostPointer                    = data.data() + offsets[layer][mipmap.level];
+			copies.push_back(copy);
+		}
+	}
+
+	// The image is transitioned on the host as well, to the layout it is copied to
+	VkHostImageLayoutTransitionInfoEXT transition_info{};
+	transition_info.sType                       = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT;
+	transition_info.image                       = vk_image->get_handle();
+	transition_info.oldLayout                   = VK_IMAGE_LAYOUT_UNDEFINED;
+	transition_info.newLayout                   = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	transition_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	transition_info.subresourceRange.levelCount = to_u32(mipmaps.size());
+	transition_info.subresourceRange.layerCount = layers;
+
+	VK_CHECK(vkTransitionImageLayoutEXT(vk_image->get_device().get_handle(), 1, &transition_info));
+
+	VkCopyMemoryToImageInfoEXT copy_info{};
+	copy_info.sType          = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT;
+	copy_info.dstImage       = vk_image->get_handle();
+	copy_info.dstImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	copy_info.regionCount    = to_u32(copies.size());
+	copy_info.pRegions       = copies.data();
+
+	VK_CHECK(vkCopyMemoryToImageEXT(vk_image->get_device().get_handle(), &copy_info));
+
+	return true;
+}
+
 const core::Image &Image::get_vk_image() const
 {
 	assert(vk_image && "Vulkan image was not created");
@@ -228,6 +328,27 @@ const core::ImageView &Image::get_vk_image_view() const
 	return *vk_image_view;
 }
 
+void Image::set_vk_image(std::unique_ptr<core::Image> &&image, std::unique_ptr<core::ImageView> &&image_view)
+{
+	vk_image      = std::move(image);
+	vk_image_view = std::move(image_view);
+}
+
+void Image::set_vk_image_view(std::unique_ptr<core::ImageView> &&image_view)
+{
+	vk_image_view = std::move(image_view);
+}
+
+std::unique_ptr<core::Image> Image::release_vk_image()
+{
+	return std::move(vk_image);
+}
+
+std::unique_ptr<core::ImageView> Image::release_vk_image_view()
+{
+	return std::move(vk_image_view);
+}
+
 Mipmap &Image::get_mipmap(const size_t index)
 {
 	assert(index < mipmaps.size());
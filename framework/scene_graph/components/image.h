@@ -96,10 +96,31 @@ class Image : public Component
 
 	void create_vk_image(Device &device, VkImageViewType image_view_type = VK_IMAGE_VIEW_TYPE_2D, VkImageCreateFlags flags = 0);
 
+	/**
+	 * @brief Copies the data to the Vulkan image from host memory with VK_EXT_host_image_copy, and leaves it in shader
+	 *        read only layout, without a staging buffer or a queue submission
+	 * @return False if the Vulkan image was not created for host transfers, its data must then go through a staging buffer
+	 */
+	bool copy_data_from_host();
+
 	const core::Image &get_vk_image() const;
 
 	const core::ImageView &get_vk_image_view() const;
 
+	/**
+	 * @brief Replaces the Vulkan image and its view, for images whose levels are streamed
+	 */
+	void set_vk_image(std::unique_ptr<core::Image> &&image, std::unique_ptr<core::ImageView> &&image_view);
+
+	/**
+	 * @brief Replaces the Vulkan image view, to sample a different range of levels of the Vulkan image
+	 */
+	void set_vk_image_view(std::unique_ptr<core::ImageView> &&image_view);
+
+	std::unique_ptr<core::Image> release_vk_image();
+
+	std::unique_ptr<core::ImageView> release_vk_image_view();
+
 	void coerce_format_to_srgb();
 
   protected:
@@ -54,6 +54,11 @@ bool SubMesh::get_attribute(const std::string &attribute_name, VertexAttribute &
 	return true;
 }
 
+const std::unordered_map<std::string, VertexAttribute> &SubMesh::get_attributes() const
+{
+	return vertex_attributes;
+}
+
 void SubMesh::set_material(const Material &new_material)
 {
 	material = &new_material;
@@ -43,6 +43,21 @@ struct VertexAttribute
 	std::uint32_t offset = 0;
 };
 
+/**
+ * @brief Simplified triangles of a sub mesh, indexing its vertex buffers
+ */
+struct SubMeshLod
+{
+	std::unique_ptr<vkb::core::BufferC> index_buffer;
+
+	VkIndexType index_type{};
+
+	std::uint32_t index_count = 0;
+
+	/// Geometric error of the simplified triangles, in the units of the vertex positions
+	float error = 0.0f;
+};
+
 class SubMesh : public Component
 {
   public:
@@ -64,10 +79,26 @@ class SubMesh : public Component
 
 	std::unique_ptr<vkb::core::BufferC> index_buffer;
 
+	/// Meshlets of the sub mesh as MeshletDescription, if the loader built them, see GLTFLoader::set_meshlets
+	std::unique_ptr<vkb::core::BufferC> meshlet_buffer;
+
+	/// Indices of the vertices of the meshlets in the vertex buffers
+	std::unique_ptr<vkb::core::BufferC> meshlet_vertex_buffer;
+
+	/// Vertices of the meshlet triangles, packed as 8 bit indices into the vertices of their meshlet
+	std::unique_ptr<vkb::core::BufferC> meshlet_triangle_buffer;
+
+	std::uint32_t meshlet_count = 0;
+
+	/// Levels of detail from the finest to the coarsest after the sub mesh itself, if the loader created them, see GLTFLoader::set_lods
+	std::vector<SubMeshLod> lods;
+
 	void set_attribute(const std::string &name, const VertexAttribute &attribute);
 
 	bool get_attribute(const std::string &name, VertexAttribute &attribute) const;
 
+	const std::unordered_map<std::string, VertexAttribute> &get_attributes() const;
+
 	void set_material(const Material &material);
 
 	const Material *get_material() const;
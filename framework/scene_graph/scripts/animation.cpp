@@ -177,5 +177,19 @@ void Animation::update_times(float new_start_time, float new_end_time)
 	}
 }
 
+const std::vector<AnimationChannel> &Animation::get_channels() const
+{
+	return channels;
+}
+
+float Animation::get_start_time() const
+{
+	return start_time;
+}
+
+float Animation::get_end_time() const
+{
+	return end_time;
+}
 }        // namespace sg
 }        // namespace vkb
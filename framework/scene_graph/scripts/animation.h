@@ -75,6 +75,12 @@ class Animation : public Script
 
 	void add_channel(Node &node, const AnimationTarget &target, const AnimationSampler &sampler);
 
+	const std::vector<AnimationChannel> &get_channels() const;
+
+	float get_start_time() const;
+
+	float get_end_time() const;
+
   private:
 	std::vector<AnimationChannel> channels;
 
@@ -0,0 +1,230 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shader_object_cache.h"
+
+#include <algorithm>
+
+#include "common/resource_caching.h"
+#include "core/device.h"
+#include "core/pipeline_layout.h"
+#include "core/shader_module.h"
+#include "core/util/logging.hpp"
+#include "rendering/pipeline_state.h"
+
+namespace vkb
+{
+ShaderObjectCache::ShaderObjectCache(Device &device) :
+    device{device}
+{
+	const auto features = device.get_gpu().get_requested_features();
+
+	graphics_stages = get_graphics_stages(features.tessellationShader, features.geometryShader, device.is_enabled(VK_EXT_MESH_SHADER_EXTENSION_NAME));
+}
+
+ShaderObjectCache::~ShaderObjectCache()
+{
+	clear();
+}
+
+std::vector<VkShaderStageFlagBits> ShaderObjectCache::get_graphics_stages(bool tessellation_shader, bool geometry_shader, bool mesh_shader)
+{
+	// Stages whose features are enabled must be bound for every draw, so they are unbound when a layout has no shader for them
+	std::vector<VkShaderStageFlagBits> stages{VK_SHADER_STAGE_VERTEX_BIT};
+	if (tessellation_shader)
+	{
+		stages.push_back(VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT);
+		stages.push_back(VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT);
+	}
+	if (geometry_shader)
+	{
+		stages.push_back(VK_SHADER_STAGE_GEOMETRY_BIT);
+	}
+	if (mesh_shader)
+	{
+		stages.push_back(VK_SHADER_STAGE_TASK_BIT_EXT);
+		stages.push_back(VK_SHADER_STAGE_MESH_BIT_EXT);
+	}
+	stages.push_back(VK_SHADER_STAGE_FRAGMENT_BIT);
+
+	return stages;
+}
+
+std::vector<VkShaderStageFlags> ShaderObjectCache::get_next_stages(const std::vector<VkShaderStageFlagBits> &graphics_stages, VkShaderStageFlags layout_stages)
+{
+	std::vector<VkShaderStageFlags> next_stages(graphics_stages.size(), 0);
+
+	for (size_t i = 0; i < graphics_stages.size(); i++)
+	{
+		if (!(layout_stages & graphics_stages[i]))
+		{
+			continue;
+		}
+
+		for (size_t j = i + 1; j < graphics_stages.size() && !next_stages[i]; j++)
+		{
+			if (layout_stages & graphics_stages[j])
+			{
+				next_stages[i] = graphics_stages[j];
+			}
+		}
+	}
+
+	return next_stages;
+}
+
+const ShaderObjectBinding &ShaderObjectCache::request_shader_objects(const PipelineState &pipeline_state)
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	const auto &pipeline_layout = pipeline_state.get_pipeline_layout();
+
+	// The layout depends on all the shader modules, only the specialization constants can differ
+	size_t hash = 0;
+	hash_combine(hash, pipeline_layout.get_handle());
+	hash_combine(hash, pipeline_state.get_specialization_constant_state());
+
+	auto it = bindings.find(hash);
+	if (it != bindings.end())
+	{
+		return it->second;
+	}
+
+	std::vector<uint8_t>                  data;
+	std::vector<VkSpecializationMapEntry> map_entries;
+
+	for (const auto &specialization_constant : pipeline_state.get_specialization_constant_state().get_specialization_constant_state())
+	{
+		map_entries.push_back({specialization_constant.first, to_u32(data.size()), specialization_constant.second.size()});
+		data.insert(data.end(), specialization_constant.second.begin(), specialization_constant.second.end());
+	}
+
+	VkSpecializationInfo specialization_info{};
+	specialization_info.mapEntryCount = to_u32(map_entries.size());
+	specialization_info.pMapEntries   = map_entries.data();
+	specialization_info.dataSize      = data.size();
+	specialization_info.pData         = data.data();
+
+	const auto &shader_modules = pipeline_layout.get_shader_modules();
+
+	ShaderObjectBinding binding;
+
+	if (shader_modules.size() == 1 && shader_modules.front()->get_stage() == VK_SHADER_STAGE_COMPUTE_BIT)
+	{
+		binding.stages  = {VK_SHADER_STAGE_COMPUTE_BIT};
+		binding.shaders = {create_shader_object(pipeline_state, *shader_modules.front(), 0, specialization_info)};
+	}
+	else
+	{
+		binding.stages = graphics_stages;
+		binding.shaders.resize(graphics_stages.size(), VK_NULL_HANDLE);
+
+		VkShaderStageFlags layout_stages = 0;
+		for (const auto *shader_module : shader_modules)
+		{
+			layout_stages |= shader_module->get_stage();
+		}
+
+		// Unlinked shaders are created for the stage they are followed by in this layout
+		auto next_stages = get_next_stages(graphics_stages, layout_stages);
+
+		for (size_t i = 0; i < graphics_stages.size(); i++)
+		{
+			auto shader_module = std::find_if(shader_modules.begin(), shader_modules.end(),
+			                                  [&](const ShaderModule *module) { return module->get_stage() == graphics_stages[i]; });
+			if (shader_module == shader_modules.end())
+			{
+				continue;
+			}
+
+			binding.shaders[i] = create_shader_object(pipeline_state, **shader_module, next_stages[i], specialization_info);
+		}
+	}
+
+	return bindings.emplace(hash, std::move(binding)).first->second;
+}
+
+size_t ShaderObjectCache::get_shader_object_count() const
+{
+	return shader_object_count;
+}
+
+void ShaderObjectCache::clear()
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	for (auto &binding : bindings)
+	{
+		for (auto shader : binding.second.shaders)
+		{
+			if (shader != VK_NULL_HANDLE)
+			{
+				vkDestroyShaderEXT(device.get_handle(), shader, nullptr);
+			}
+		}
+	}
+
+	bindings.clear();
+	shader_object_count = 0;
+}
+
+VkShaderEXT ShaderObjectCache::create_shader_object(const PipelineState &pipeline_state, const ShaderModule &shader_module, VkShaderStageFlags next_stage, const VkSpecializationInfo &specialization_info)
+{
+	const auto &pipeline_layout = pipeline_state.get_pipeline_layout();
+
+	// The set layouts and push constant ranges match the ones of the pipeline layout, so that the descriptor sets are bound with it
+	std::vector<VkDescriptorSetLayout> set_layouts;
+	for (auto &shader_set_it : pipeline_layout.get_shader_sets())
+	{
+		set_layouts.push_back(pipeline_layout.get_descriptor_set_layout(shader_set_it.first).get_handle());
+	}
+
+	std::vector<VkPushConstantRange> push_constant_ranges;
+	for (auto &push_constant_resource : pipeline_layout.get_resources(ShaderResourceType::PushConstant))
+	{
+		push_constant_ranges.push_back({push_constant_resource.stages, push_constant_resource.offset, push_constant_resource.size});
+	}
+
+	VkShaderCreateInfoEXT create_info{VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT};
+	create_info.stage                  = shader_module.get_stage();
+	create_info.nextStage              = next_stage;
+	create_info.codeType               = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+	create_info.codeSize               = shader_module.get_binary().size() * sizeof(uint32_t);
+	create_info.pCode                  = shader_module.get_binary().data();
+	create_info.pName                  = shader_module.get_entry_point().c_str();
+	create_info.setLayoutCount         = to_u32(set_layouts.size());
+	create_info.pSetLayouts            = set_layouts.data();
+	create_info.pushConstantRangeCount = to_u32(push_constant_ranges.size());
+	create_info.pPushConstantRanges    = push_constant_ranges.data();
+	create_info.pSpecializationInfo    = &specialization_info;
+
+	VkShaderEXT shader{VK_NULL_HANDLE};
+
+	VkResult result = vkCreateShadersEXT(device.get_handle(), 1, &create_info, nullptr, &shader);
+	if (result != VK_SUCCESS)
+	{
+		throw VulkanException{result, "Cannot create shader object"};
+	}
+
+	device.get_debug_utils().set_debug_name(device.get_handle(), VK_OBJECT_TYPE_SHADER_EXT, reinterpret_cast<uint64_t>(shader), shader_module.get_debug_name().c_str());
+
+	LOGD("Created #{} shader object ({})", shader_object_count, shader_module.get_debug_name());
+	shader_object_count++;
+
+	return shader;
+}
+}        // namespace vkb
@@ -0,0 +1,105 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/vk_common.h"
+
+namespace vkb
+{
+class Device;
+class PipelineState;
+class ShaderModule;
+
+/**
+ * @brief The shader objects bound for a pipeline state, with vkCmdBindShadersEXT
+ */
+struct ShaderObjectBinding
+{
+	/// Stages of the bind point, including the stages without a shader which are unbound
+	std::vector<VkShaderStageFlagBits> stages;
+
+	/// Shader object of every stage, VK_NULL_HANDLE for the stages without a shader
+	std::vector<VkShaderEXT> shaders;
+};
+
+/**
+ * @brief Caches the shader objects created from the shader modules of a pipeline layout, with VK_EXT_shader_object
+ *
+ * Shader objects replace the pipelines of the command buffers when the resource cache uses them. They are created
+ * once per pipeline layout and specialization constants, unlinked, so that every other part of the pipeline state
+ * is set with dynamic state commands instead of being hashed into a pipeline.
+ */
+class ShaderObjectCache
+{
+  public:
+	ShaderObjectCache(Device &device);
+
+	ShaderObjectCache(const ShaderObjectCache &) = delete;
+
+	ShaderObjectCache(ShaderObjectCache &&) = delete;
+
+	~ShaderObjectCache();
+
+	ShaderObjectCache &operator=(const ShaderObjectCache &) = delete;
+
+	ShaderObjectCache &operator=(ShaderObjectCache &&) = delete;
+
+	/**
+	 * @return The graphics stages bound for every draw in pipeline order, which include the stages whose features are enabled
+	 */
+	static std::vector<VkShaderStageFlagBits> get_graphics_stages(bool tessellation_shader, bool geometry_shader, bool mesh_shader);
+
+	/**
+	 * @brief Finds the stage following every stage of a layout, which unlinked shaders are created for
+	 * @param graphics_stages The graphics stages in pipeline order
+	 * @param layout_stages The stages the layout has a shader for
+	 * @return The stage following each graphics stage in the layout, 0 for the last one and the stages without a shader
+	 */
+	static std::vector<VkShaderStageFlags> get_next_stages(const std::vector<VkShaderStageFlagBits> &graphics_stages, VkShaderStageFlags layout_stages);
+
+	/**
+	 * @brief Requests the shader objects of the shader modules of a pipeline state, creating them if needed
+	 */
+	const ShaderObjectBinding &request_shader_objects(const PipelineState &pipeline_state);
+
+	/**
+	 * @return Number of shader objects created since the cache was last cleared
+	 */
+	size_t get_shader_object_count() const;
+
+	void clear();
+
+  private:
+	VkShaderEXT create_shader_object(const PipelineState &pipeline_state, const ShaderModule &shader_module, VkShaderStageFlags next_stage, const VkSpecializationInfo &specialization_info);
+
+	Device &device;
+
+	/// Graphics stages which must be bound, even without a shader, as their features are enabled
+	std::vector<VkShaderStageFlagBits> graphics_stages;
+
+	std::unordered_map<size_t, ShaderObjectBinding> bindings;
+
+	std::mutex mutex;
+
+	size_t shader_object_count{0};
+};
+}        // namespace vkb
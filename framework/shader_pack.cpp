@@ -0,0 +1,294 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shader_pack.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "common/helpers.h"
+#include "common/strings.h"
+#include "core/util/logging.hpp"
+#include "filesystem/filesystem.hpp"
+#include "filesystem/legacy.h"
+#include "glsl_compiler.h"
+
+namespace vkb
+{
+namespace
+{
+constexpr uint32_t pack_magic   = 0x4B505356;        // "VSPK"
+constexpr uint32_t pack_version = 1;
+
+/**
+ * @brief FNV-1a, as the keys must be the same for the build tool and every platform the pack is loaded on
+ */
+uint64_t hash_bytes(uint64_t hash, const void *bytes, size_t size)
+{
+	auto *begin = reinterpret_cast<const uint8_t *>(bytes);
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= begin[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+uint64_t hash_string(uint64_t hash, const std::string &value)
+{
+	// The terminator separates consecutive strings
+	return hash_bytes(hash, value.c_str(), value.size() + 1);
+}
+
+bool is_identifier_char(char c)
+{
+	return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+/**
+ * @return Whether the source refers to a macro name, as a whole identifier
+ */
+bool refers_to(const std::string &source, const std::string &name)
+{
+	for (size_t pos = source.find(name); pos != std::string::npos; pos = source.find(name, pos + 1))
+	{
+		bool starts_identifier = pos == 0 || !is_identifier_char(source[pos - 1]);
+		bool ends_identifier   = pos + name.size() == source.size() || !is_identifier_char(source[pos + name.size()]);
+		if (starts_identifier && ends_identifier)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @return The path of the pack of the framework shaders, empty if there is none
+ */
+std::string find_framework_pack()
+{
+#if defined(VKB_SHADER_PACK_FILE)
+	// Written to the build directory by the shader pack target
+	if (vkb::filesystem::get()->is_file(VKB_SHADER_PACK_FILE))
+	{
+		return VKB_SHADER_PACK_FILE;
+	}
+#endif
+
+	// A pack built on the host can be synced with the shaders, for the platforms it is not built for
+	auto path = fs::path::get(fs::path::Type::Shaders, ShaderPack::filename);
+	return fs::is_file(path) ? path : std::string{};
+}
+
+ShaderPack load_framework_pack()
+{
+	auto path = find_framework_pack();
+	if (path.empty())
+	{
+		LOGD("No shader pack found, shaders are compiled at runtime");
+		return {};
+	}
+
+	try
+	{
+		ShaderPack pack{vkb::filesystem::get()->read_file_binary(path)};
+		LOGI("Loaded {} precompiled shader variants from {}", pack.get_entry_count(), path);
+		return pack;
+	}
+	catch (const std::exception &e)
+	{
+		LOGW("Cannot load shader pack {}: {}", path, e.what());
+		return {};
+	}
+}
+}        // namespace
+
+const ShaderPack &ShaderPack::get()
+{
+	static const ShaderPack pack = load_framework_pack();
+	return pack;
+}
+
+bool ShaderPack::is_packable(const ShaderVariant &shader_variant)
+{
+	// Undefinitions depend on the order of the definitions, which the keys ignore
+	const auto &processes = shader_variant.get_processes();
+	bool        undefines = std::any_of(processes.begin(), processes.end(), [](const std::string &process) { return !process.empty() && process[0] == 'U'; });
+
+	return !undefines && shader_variant.get_runtime_array_sizes().empty() && !GLSLCompiler::has_target_environment();
+}
+
+uint64_t ShaderPack::get_key(VkShaderStageFlagBits stage, const std::vector<uint8_t> &glsl_source, const std::string &entry_point, const ShaderVariant &shader_variant)
+{
+	std::string source{glsl_source.begin(), glsl_source.end()};
+
+	// Only the definitions of the macros the source refers to can change the SPIR-V, sorted as their order does not matter
+	std::vector<std::string> definitions;
+	for (auto &line : split(shader_variant.get_preamble(), '\n'))
+	{
+		const std::string directive = "#define ";
+		if (line.compare(0, directive.size(), directive) != 0)
+		{
+			continue;
+		}
+
+		std::string name = line.substr(directive.size(), line.find(' ', directive.size()) - directive.size());
+		if (refers_to(source, name))
+		{
+			definitions.push_back(line);
+		}
+	}
+	std::sort(definitions.begin(), definitions.end());
+
+	uint64_t hash = 14695981039346656037ull;
+	hash          = hash_string(hash, source);
+	hash          = hash_bytes(hash, &stage, sizeof(stage));
+	hash          = hash_string(hash, entry_point);
+	for (auto &definition : definitions)
+	{
+		hash = hash_string(hash, definition);
+	}
+
+	return hash;
+}
+
+ShaderPack::ShaderPack(std::vector<uint8_t> &&pack_data)
+{
+	std::istringstream is{std::string{pack_data.begin(), pack_data.end()}};
+
+	uint32_t magic{0};
+	uint32_t version{0};
+	read(is, magic, version);
+
+	if (!is || magic != pack_magic || version != pack_version)
+	{
+		throw std::runtime_error{"Invalid shader pack header"};
+	}
+
+	std::vector<IndexEntry> entries;
+	read(is, entries, data);
+
+	if (!is)
+	{
+		throw std::runtime_error{"Truncated shader pack"};
+	}
+
+	for (auto &entry : entries)
+	{
+		if (entry.offset + entry.size > data.size())
+		{
+			throw std::runtime_error{"Shader pack entry out of bounds"};
+		}
+		index[entry.key] = entry;
+	}
+}
+
+void ShaderPack::add(uint64_t key, const std::vector<uint32_t> &spirv, const std::vector<ShaderResource> &resources)
+{
+	std::ostringstream os;
+
+	write(os, spirv);
+	write(os, resources.size());
+	for (auto &resource : resources)
+	{
+		write(os,
+		      resource.stages,
+		      resource.type,
+		      resource.mode,
+		      resource.set,
+		      resource.binding,
+		      resource.location,
+		      resource.input_attachment_index,
+		      resource.vec_size,
+		      resource.columns,
+		      resource.array_size,
+		      resource.offset,
+		      resource.size,
+		      resource.constant_id,
+		      resource.qualifiers,
+		      resource.name);
+	}
+
+	auto entry = os.str();
+
+	index[key] = {key, data.size(), entry.size()};
+	data.insert(data.end(), entry.begin(), entry.end());
+}
+
+bool ShaderPack::find(uint64_t key, std::vector<uint32_t> &spirv, std::vector<ShaderResource> &resources) const
+{
+	auto it = index.find(key);
+	if (it == index.end())
+	{
+		return false;
+	}
+
+	auto               begin = data.begin() + it->second.offset;
+	std::istringstream is{std::string{begin, begin + it->second.size}};
+
+	read(is, spirv);
+
+	size_t resource_count{0};
+	read(is, resource_count);
+
+	resources.resize(resource_count);
+	for (auto &resource : resources)
+	{
+		read(is,
+		     resource.stages,
+		     resource.type,
+		     resource.mode,
+		     resource.set,
+		     resource.binding,
+		     resource.location,
+		     resource.input_attachment_index,
+		     resource.vec_size,
+		     resource.columns,
+		     resource.array_size,
+		     resource.offset,
+		     resource.size,
+		     resource.constant_id,
+		     resource.qualifiers,
+		     resource.name);
+	}
+
+	return true;
+}
+
+size_t ShaderPack::get_entry_count() const
+{
+	return index.size();
+}
+
+std::vector<uint8_t> ShaderPack::serialize() const
+{
+	std::vector<IndexEntry> entries;
+	for (auto &it : index)
+	{
+		entries.push_back(it.second);
+	}
+
+	// Sorted so that the same variants always produce the same file
+	std::sort(entries.begin(), entries.end(), [](const IndexEntry &lhs, const IndexEntry &rhs) { return lhs.key < rhs.key; });
+
+	std::ostringstream os;
+	write(os, pack_magic, pack_version, entries, data);
+
+	auto pack_data = os.str();
+	return {pack_data.begin(), pack_data.end()};
+}
+}        // namespace vkb
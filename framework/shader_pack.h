@@ -0,0 +1,108 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "core/shader_module.h"
+
+namespace vkb
+{
+/**
+ * @brief SPIR-V of shader variants compiled offline, with their reflected resources
+ *
+ * The shader pack target compiles the known variants of the framework shaders at build time, so that
+ * ShaderModule only compiles the variants missing from the pack at runtime.
+ *
+ * A variant is keyed on its source with the includes expanded, its stage, its entry point and the definitions
+ * its source refers to. Definitions which cannot change the SPIR-V, such as the attributes a fragment shader
+ * does not read, do not need to be enumerated offline, and an entry whose source was edited since the pack was
+ * built is never found.
+ *
+ * The file is made of an index of the keys with the offset and size of their entry, followed by the entries.
+ * Entries are only decoded when they are found.
+ */
+class ShaderPack
+{
+  public:
+	/// Name of the pack file of the framework shaders, in the shaders directory of the build or of the assets
+	static constexpr const char *filename = "framework.spvpack";
+
+	/**
+	 * @brief Loads the pack of the framework shaders the first time it is called, from the build directory if the shader
+	 *        pack target was built, otherwise from the shaders directory
+	 * @return The pack, empty if the file does not exist or is invalid
+	 */
+	static const ShaderPack &get();
+
+	/**
+	 * @brief Whether a variant can be looked up in a pack, as the packed SPIR-V is compiled and reflected with the default settings
+	 */
+	static bool is_packable(const ShaderVariant &shader_variant);
+
+	/**
+	 * @param glsl_source The source with its includes expanded
+	 * @return The key of a variant in a pack
+	 */
+	static uint64_t get_key(VkShaderStageFlagBits stage, const std::vector<uint8_t> &glsl_source, const std::string &entry_point, const ShaderVariant &shader_variant);
+
+	ShaderPack() = default;
+
+	/**
+	 * @brief Reads a pack from the contents of its file
+	 * @throws std::runtime_error if the data is not a valid pack
+	 */
+	ShaderPack(std::vector<uint8_t> &&data);
+
+	/**
+	 * @brief Adds a variant, replacing the entry with the same key if any
+	 */
+	void add(uint64_t key, const std::vector<uint32_t> &spirv, const std::vector<ShaderResource> &resources);
+
+	/**
+	 * @brief Looks up a variant
+	 * @param[out] spirv The SPIR-V of the variant
+	 * @param[out] resources The resources reflected from the SPIR-V
+	 * @return False if the pack has no entry for the key
+	 */
+	bool find(uint64_t key, std::vector<uint32_t> &spirv, std::vector<ShaderResource> &resources) const;
+
+	size_t get_entry_count() const;
+
+	/**
+	 * @return The contents of the pack file
+	 */
+	std::vector<uint8_t> serialize() const;
+
+  private:
+	struct IndexEntry
+	{
+		uint64_t key;
+
+		uint64_t offset;
+
+		uint64_t size;
+	};
+
+	/// Offset and size of the entries in data
+	std::unordered_map<uint64_t, IndexEntry> index;
+
+	std::vector<uint8_t> data;
+};
+}        // namespace vkb
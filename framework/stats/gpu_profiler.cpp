@@ -0,0 +1,609 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stats/gpu_profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+#include "core/command_buffer.h"
+#include "core/device.h"
+#include "rendering/render_context.h"
+
+#ifdef TRACY_ENABLE
+#	include <cstring>
+
+#	include <tracy/Tracy.hpp>
+#	include <tracy/TracyC.h>
+#endif
+
+namespace vkb
+{
+namespace
+{
+/// Initial number of queries of a frame, grown when a frame needs more
+constexpr uint32_t initial_query_capacity = 256;
+
+/// Weight of the latest frame in the averaged durations
+constexpr double average_alpha = 0.1;
+
+std::string escape_json(const std::string &value)
+{
+	std::string escaped;
+	escaped.reserve(value.size());
+	for (char c : value)
+	{
+		switch (c)
+		{
+			case '"':
+				escaped += "\\\"";
+				break;
+			case '\\':
+				escaped += "\\\\";
+				break;
+			case '\n':
+				escaped += "\\n";
+				break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					escaped += fmt::format("\\u{:04x}", static_cast<int>(c));
+				}
+				else
+				{
+					escaped += c;
+				}
+		}
+	}
+	return escaped;
+}
+}        // namespace
+
+GpuProfiler::GpuProfiler(vkb::rendering::RenderContextC &render_context, size_t history_size) :
+    render_context{render_context},
+    history_size{history_size}
+{
+	Device &device = render_context.get_device();
+
+	uint32_t valid_bits = device.get_suitable_graphics_queue().get_properties().timestampValidBits;
+	timestamp_mask      = valid_bits >= 64 ? ~0ull : (1ull << valid_bits) - 1;
+	timestamp_period    = device.get_gpu().get_properties().limits.timestampPeriod;
+
+	for (size_t i = 0; i < render_context.get_render_frames().size(); i++)
+	{
+		frames.emplace_back();
+	}
+
+	if (device.is_enabled(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME))
+	{
+		uint32_t count = 0;
+		VK_CHECK(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(device.get_gpu().get_handle(), &count, nullptr));
+		std::vector<VkTimeDomainEXT> time_domains(count);
+		VK_CHECK(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(device.get_gpu().get_handle(), &count, time_domains.data()));
+
+		for (auto time_domain : time_domains)
+		{
+			if (time_domain == VK_TIME_DOMAIN_DEVICE_EXT)
+			{
+				has_device_time_domain = true;
+			}
+#if defined(__linux__) || defined(__ANDROID__)
+			// steady_clock is CLOCK_MONOTONIC on these platforms, other host clocks are bracketed by steady_clock samples
+			if (time_domain == VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT)
+			{
+				host_time_domain = time_domain;
+			}
+#endif
+		}
+	}
+
+	if (!is_supported())
+	{
+		LOGW("GPU profiler: the graphics queue does not support timestamps");
+	}
+}
+
+GpuProfiler::~GpuProfiler()
+{
+	// Command buffers are profiled on the thread that destroys the profiler, so none is left on other threads
+	auto &thread_scopes = get_thread_scopes();
+	thread_scopes.erase(std::remove_if(thread_scopes.begin(), thread_scopes.end(), [this](const CommandBufferScopes &scopes) { return scopes.profiler == this; }),
+	                    thread_scopes.end());
+}
+
+std::vector<GpuProfiler::CommandBufferScopes> &GpuProfiler::get_thread_scopes()
+{
+	thread_local std::vector<CommandBufferScopes> thread_scopes;
+	return thread_scopes;
+}
+
+bool GpuProfiler::is_supported() const
+{
+	return timestamp_mask != 0;
+}
+
+void GpuProfiler::begin_frame()
+{
+	auto &frame = frames[render_context.get_active_frame_index()];
+
+	std::lock_guard<std::mutex> lock{mutex};
+
+	// The fence of the active frame has been waited, so its results are ready
+	if (!frame.scopes.empty())
+	{
+		read_back(frame);
+		frame.scopes.clear();
+	}
+
+	frame_number++;
+}
+
+void GpuProfiler::begin_command_buffer(vkb::core::CommandBufferC &command_buffer, const char *name)
+{
+	if (!is_supported())
+	{
+		return;
+	}
+
+	auto &frame = frames[render_context.get_active_frame_index()];
+
+	std::unique_lock<std::mutex> lock{mutex};
+
+	if (frame.frame_number != frame_number)
+	{
+		if (!frame.query_pool || frame.overflowed)
+		{
+			frame.capacity = frame.query_pool ? frame.capacity * 2 : initial_query_capacity;
+
+			VkQueryPoolCreateInfo query_pool_create_info{};
+			query_pool_create_info.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+			query_pool_create_info.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+			query_pool_create_info.queryCount = frame.capacity;
+
+			frame.query_pool = std::make_unique<QueryPool>(render_context.get_device(), query_pool_create_info);
+		}
+
+		command_buffer.reset_query_pool(*frame.query_pool, 0, frame.capacity);
+
+		frame.frame_number = frame_number;
+		frame.query_count  = 0;
+		frame.overflowed   = false;
+		frame.scopes.clear();
+	}
+
+	lock.unlock();
+
+	auto &thread_scopes = get_thread_scopes();
+	thread_scopes.erase(std::remove_if(thread_scopes.begin(), thread_scopes.end(),
+	                                   [&command_buffer](const CommandBufferScopes &scopes) { return scopes.command_buffer == command_buffer.get_handle(); }),
+	                    thread_scopes.end());
+
+	thread_scopes.push_back({this, command_buffer.get_handle(), &frame});
+	open_scope(thread_scopes.back(), name);
+}
+
+void GpuProfiler::end_command_buffer(vkb::core::CommandBufferC &command_buffer)
+{
+	auto &thread_scopes = get_thread_scopes();
+
+	auto it = std::find_if(thread_scopes.begin(), thread_scopes.end(), [this, &command_buffer](const CommandBufferScopes &scopes) {
+		return scopes.profiler == this && scopes.command_buffer == command_buffer.get_handle();
+	});
+	if (it == thread_scopes.end())
+	{
+		return;
+	}
+
+	// Scopes left open are closed along with the root one
+	while (!it->open_scopes.empty())
+	{
+		close_scope(*it);
+	}
+
+	// Parents are relative to the scopes of the command buffer until they join the scopes of the frame
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+
+		auto    &frame  = *it->frame;
+		uint32_t offset = to_u32(frame.scopes.size());
+		for (auto &scope : it->scopes)
+		{
+			if (scope.parent != ~0u)
+			{
+				scope.parent += offset;
+			}
+			frame.scopes.push_back(std::move(scope));
+		}
+	}
+
+	thread_scopes.erase(it);
+}
+
+bool GpuProfiler::begin_scope(VkCommandBuffer command_buffer, const char *name)
+{
+	// Secondary command buffers recorded by worker threads find no profiled command buffer on their thread
+	auto &thread_scopes = get_thread_scopes();
+
+	auto it = std::find_if(thread_scopes.begin(), thread_scopes.end(), [command_buffer](const CommandBufferScopes &scopes) { return scopes.command_buffer == command_buffer; });
+	if (it == thread_scopes.end())
+	{
+		return false;
+	}
+
+	it->profiler->open_scope(*it, name);
+	return true;
+}
+
+void GpuProfiler::end_scope(VkCommandBuffer command_buffer)
+{
+	auto &thread_scopes = get_thread_scopes();
+
+	auto it = std::find_if(thread_scopes.begin(), thread_scopes.end(), [command_buffer](const CommandBufferScopes &scopes) { return scopes.command_buffer == command_buffer; });
+	if (it != thread_scopes.end())
+	{
+		it->profiler->close_scope(*it);
+	}
+}
+
+uint64_t GpuProfiler::get_frame_number() const
+{
+	return frame_number;
+}
+
+const GpuProfilerFrame &GpuProfiler::get_latest_frame() const
+{
+	return latest_frame;
+}
+
+void GpuProfiler::open_scope(CommandBufferScopes &command_buffer_scopes, const char *name)
+{
+	auto &frame = *command_buffer_scopes.frame;
+	auto &stack = command_buffer_scopes.open_scopes;
+
+	// Command buffers profiled on other threads take their queries from the same pool
+	uint32_t begin_query = frame.query_count.fetch_add(2);
+	if (begin_query + 2 > frame.capacity)
+	{
+		frame.overflowed = true;
+		stack.push_back(~0u);
+		return;
+	}
+
+	PendingScope scope{name, ~0u, 0, begin_query, ~0u};
+
+	// Dropped scopes are skipped, so that their children are attached to the closest recorded ancestor
+	for (auto parent = stack.rbegin(); parent != stack.rend(); ++parent)
+	{
+		if (*parent != ~0u)
+		{
+			scope.parent = *parent;
+			scope.depth  = command_buffer_scopes.scopes[*parent].depth + 1;
+			break;
+		}
+	}
+
+	vkCmdWriteTimestamp(command_buffer_scopes.command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame.query_pool->get_handle(), scope.begin_query);
+
+	stack.push_back(to_u32(command_buffer_scopes.scopes.size()));
+	command_buffer_scopes.scopes.push_back(std::move(scope));
+}
+
+void GpuProfiler::close_scope(CommandBufferScopes &command_buffer_scopes)
+{
+	auto &stack = command_buffer_scopes.open_scopes;
+
+	if (stack.empty())
+	{
+		return;
+	}
+
+	uint32_t scope_index = stack.back();
+	stack.pop_back();
+
+	if (scope_index == ~0u)
+	{
+		return;
+	}
+
+	auto &scope     = command_buffer_scopes.scopes[scope_index];
+	scope.end_query = scope.begin_query + 1;
+
+	vkCmdWriteTimestamp(command_buffer_scopes.command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, command_buffer_scopes.frame->query_pool->get_handle(), scope.end_query);
+}
+
+void GpuProfiler::read_back(FrameQueries &frame)
+{
+	// Queries handed out past the capacity were dropped
+	uint32_t query_count = std::min(frame.query_count.load(), frame.capacity);
+
+	// Pairs of a timestamp and its availability
+	std::vector<uint64_t> results(query_count * 2);
+
+	VkResult result = frame.query_pool->get_results(0, query_count, results.size() * sizeof(uint64_t), results.data(), 2 * sizeof(uint64_t),
+	                                                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+	if (result != VK_SUCCESS && result != VK_NOT_READY)
+	{
+		LOGW("GPU profiler: failed to read timestamps ({})", vkb::to_string(result));
+		return;
+	}
+
+	std::vector<uint64_t> timestamps(query_count, 0);
+	for (auto &scope : frame.scopes)
+	{
+		for (uint32_t query : {scope.begin_query, scope.end_query})
+		{
+			if (query == ~0u)
+			{
+				continue;
+			}
+
+			// A command buffer of the frame was recorded but not submitted
+			if (results[query * 2 + 1] == 0)
+			{
+				return;
+			}
+			timestamps[query] = results[query * 2] & timestamp_mask;
+		}
+	}
+
+	uint64_t device_ticks = 0;
+	int64_t  host_ns      = 0;
+	bool     calibrated   = calibrate(device_ticks, host_ns);
+
+	uint64_t origin = timestamps[frame.scopes.front().begin_query];
+	for (auto &scope : frame.scopes)
+	{
+		if (to_ticks_delta(origin, timestamps[scope.begin_query]) < 0)
+		{
+			origin = timestamps[scope.begin_query];
+		}
+	}
+
+	double period = timestamp_period;
+
+	GpuProfilerFrame profiled_frame;
+	profiled_frame.frame_number = frame.frame_number;
+	profiled_frame.calibrated   = calibrated;
+	profiled_frame.scopes.reserve(frame.scopes.size());
+
+	std::vector<std::string> paths;
+	paths.reserve(frame.scopes.size());
+
+	for (auto &pending_scope : frame.scopes)
+	{
+		paths.push_back(pending_scope.parent == ~0u ? pending_scope.name : paths[pending_scope.parent] + "/" + pending_scope.name);
+
+		GpuProfilerScope scope;
+		scope.name   = pending_scope.name;
+		scope.parent = pending_scope.parent;
+		scope.depth  = pending_scope.depth;
+
+		// Only scopes closed before the end of the command buffer have an end timestamp
+		if (pending_scope.end_query != ~0u)
+		{
+			uint64_t begin = timestamps[pending_scope.begin_query];
+			uint64_t end   = timestamps[pending_scope.end_query];
+
+			scope.begin    = to_ticks_delta(origin, begin) * period * 1e-6;
+			scope.duration = std::max<int64_t>(to_ticks_delta(begin, end), 0) * period * 1e-6;
+
+			if (calibrated)
+			{
+				scope.cpu_begin_ns = host_ns + static_cast<int64_t>(to_ticks_delta(device_ticks, begin) * period);
+				scope.cpu_end_ns   = host_ns + static_cast<int64_t>(to_ticks_delta(device_ticks, end) * period);
+			}
+		}
+
+		auto average = average_durations.find(paths.back());
+		if (average == average_durations.end())
+		{
+			average = average_durations.emplace(paths.back(), scope.duration).first;
+		}
+		else
+		{
+			average->second = average->second * (1.0 - average_alpha) + scope.duration * average_alpha;
+		}
+		scope.average_duration = average->second;
+
+		profiled_frame.scopes.push_back(std::move(scope));
+	}
+
+	emit_tracy_zones(frame, timestamps, device_ticks, calibrated);
+
+	latest_frame = profiled_frame;
+
+	history.push_back(std::move(profiled_frame));
+	while (history.size() > history_size)
+	{
+		history.pop_front();
+	}
+}
+
+bool GpuProfiler::calibrate(uint64_t &device_ticks, int64_t &host_ns) const
+{
+	if (!has_device_time_domain)
+	{
+		return false;
+	}
+
+	VkDevice device = render_context.get_device().get_handle();
+
+	VkCalibratedTimestampInfoEXT timestamp_infos[2]{};
+	timestamp_infos[0].sType      = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+	timestamp_infos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+	timestamp_infos[1].sType      = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+	timestamp_infos[1].timeDomain = host_time_domain;
+
+	uint64_t timestamps[2]{};
+	uint64_t max_deviation = 0;
+
+	if (host_time_domain != VK_TIME_DOMAIN_MAX_ENUM_EXT)
+	{
+		if (vkGetCalibratedTimestampsEXT(device, 2, timestamp_infos, timestamps, &max_deviation) != VK_SUCCESS)
+		{
+			return false;
+		}
+		host_ns = static_cast<int64_t>(timestamps[1]);
+	}
+	else
+	{
+		// Without a host time domain matching steady_clock, the device one is sampled between two steady_clock samples
+		auto before = std::chrono::steady_clock::now();
+		if (vkGetCalibratedTimestampsEXT(device, 1, timestamp_infos, timestamps, &max_deviation) != VK_SUCCESS)
+		{
+			return false;
+		}
+		auto after = std::chrono::steady_clock::now();
+		host_ns    = std::chrono::duration_cast<std::chrono::nanoseconds>((before + (after - before) / 2).time_since_epoch()).count();
+	}
+
+	device_ticks = timestamps[0] & timestamp_mask;
+	return true;
+}
+
+int64_t GpuProfiler::to_ticks_delta(uint64_t from, uint64_t to) const
+{
+	// Timestamps with fewer than 64 valid bits wrap around, so the difference is sign-extended from the valid bits
+	uint64_t delta = (to - from) & timestamp_mask;
+	if (timestamp_mask != ~0ull && (delta & ((timestamp_mask >> 1) + 1)))
+	{
+		delta |= ~timestamp_mask;
+	}
+	return static_cast<int64_t>(delta);
+}
+
+void GpuProfiler::emit_tracy_zones(const FrameQueries &frame, const std::vector<uint64_t> &timestamps, uint64_t device_ticks, bool calibrated)
+{
+#ifdef TRACY_ENABLE
+	if (!tracy_context_created)
+	{
+		tracy_context = static_cast<uint8_t>(tracy::GetGpuCtxCounter().fetch_add(1, std::memory_order_relaxed));
+
+		// Tracy aligns the GPU time given here with the CPU time the context is created at
+		___tracy_gpu_new_context_data context_data{};
+		context_data.gpuTime = static_cast<int64_t>(calibrated ? device_ticks : timestamps[frame.scopes.back().begin_query]);
+		context_data.period  = timestamp_period;
+		context_data.context = tracy_context;
+		context_data.flags   = 0;
+		context_data.type    = 2;        // tracy::GpuContextType::Vulkan
+		___tracy_emit_gpu_new_context(context_data);
+
+		const char                    *context_name = "Graphics queue";
+		___tracy_gpu_context_name_data name_data{};
+		name_data.context = tracy_context;
+		name_data.name    = context_name;
+		name_data.len     = static_cast<uint16_t>(strlen(context_name));
+		___tracy_emit_gpu_context_name(name_data);
+
+		tracy_context_created = true;
+	}
+
+	auto emit_time = [this](uint64_t timestamp, uint16_t query_id) {
+		___tracy_gpu_time_data time_data{};
+		time_data.gpuTime = static_cast<int64_t>(timestamp);
+		time_data.queryId = query_id;
+		time_data.context = tracy_context;
+		___tracy_emit_gpu_time(time_data);
+	};
+
+	auto end_zone = [&](uint32_t scope_index) {
+		___tracy_gpu_zone_end_data end_data{};
+		end_data.queryId = tracy_query_id;
+		end_data.context = tracy_context;
+		___tracy_emit_gpu_zone_end(end_data);
+		emit_time(timestamps[frame.scopes[scope_index].end_query], tracy_query_id++);
+	};
+
+	// Scopes are ordered depth first, so a zone ends when a scope which is not one of its children starts
+	std::vector<uint32_t> zones;
+	for (uint32_t i = 0; i < to_u32(frame.scopes.size()); i++)
+	{
+		auto &scope = frame.scopes[i];
+		if (scope.end_query == ~0u)
+		{
+			continue;
+		}
+
+		while (!zones.empty() && zones.back() != scope.parent)
+		{
+			end_zone(zones.back());
+			zones.pop_back();
+		}
+
+		___tracy_gpu_zone_begin_data begin_data{};
+		begin_data.srcloc  = tracy::Profiler::AllocSourceLocation(__LINE__, __FILE__, strlen(__FILE__), __FUNCTION__, strlen(__FUNCTION__), scope.name.c_str(), scope.name.size());
+		begin_data.queryId = tracy_query_id;
+		begin_data.context = tracy_context;
+		___tracy_emit_gpu_zone_begin_alloc(begin_data);
+		emit_time(timestamps[scope.begin_query], tracy_query_id++);
+
+		zones.push_back(i);
+	}
+
+	while (!zones.empty())
+	{
+		end_zone(zones.back());
+		zones.pop_back();
+	}
+#endif
+}
+
+bool GpuProfiler::write_json(const std::string &path) const
+{
+	std::ofstream file{path};
+	if (!file)
+	{
+		LOGW("GPU profiler: could not open {}", path);
+		return false;
+	}
+
+	file << "{\n";
+	file << fmt::format("\t\"timestamp_period\": {},\n", timestamp_period);
+	file << "\t\"frames\": [";
+
+	for (size_t i = 0; i < history.size(); i++)
+	{
+		auto &frame = history[i];
+
+		file << (i == 0 ? "\n" : ",\n");
+		file << fmt::format("\t\t{{\n\t\t\t\"frame\": {},\n\t\t\t\"calibrated\": {},\n\t\t\t\"scopes\": [", frame.frame_number, frame.calibrated);
+
+		for (size_t j = 0; j < frame.scopes.size(); j++)
+		{
+			auto &scope = frame.scopes[j];
+
+			file << (j == 0 ? "\n" : ",\n");
+			file << fmt::format("\t\t\t\t{{\"name\": \"{}\", \"parent\": {}, \"depth\": {}, \"begin_ms\": {:.6f}, \"duration_ms\": {:.6f}",
+			                    escape_json(scope.name), scope.parent == ~0u ? -1 : static_cast<int64_t>(scope.parent), scope.depth, scope.begin, scope.duration);
+			if (frame.calibrated)
+			{
+				file << fmt::format(", \"cpu_begin_ns\": {}, \"cpu_end_ns\": {}", scope.cpu_begin_ns, scope.cpu_end_ns);
+			}
+			file << "}";
+		}
+
+		file << "\n\t\t\t]\n\t\t}";
+	}
+
+	file << "\n\t]\n}\n";
+
+	LOGI("GPU profiler: wrote {} frames to {}", history.size(), path);
+
+	return static_cast<bool>(file);
+}
+}        // namespace vkb
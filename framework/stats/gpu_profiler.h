@@ -0,0 +1,278 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/helpers.h"
+#include "common/vk_common.h"
+#include "core/query_pool.h"
+
+namespace vkb
+{
+
+namespace core
+{
+template <vkb::BindingType bindingType>
+class CommandBuffer;
+using CommandBufferC = CommandBuffer<vkb::BindingType::C>;
+}        // namespace core
+
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC = RenderContext<vkb::BindingType::C>;
+}        // namespace rendering
+
+/**
+ * @brief GPU timing of a profiled scope
+ */
+struct GpuProfilerScope
+{
+	std::string name;
+
+	/// Index of the enclosing scope in the frame, or ~0 for the root scope of a command buffer
+	uint32_t parent{~0u};
+
+	uint32_t depth{0};
+
+	/// Start of the scope, relative to the start of the first scope of the frame, in milliseconds
+	double begin{0.0};
+
+	double duration{0.0};
+
+	/// Duration averaged over the previous frames, for display
+	double average_duration{0.0};
+
+	/// Start and end of the scope in the std::chrono::steady_clock time domain, only valid for calibrated frames
+	int64_t cpu_begin_ns{0};
+
+	int64_t cpu_end_ns{0};
+};
+
+/**
+ * @brief GPU timings of every profiled scope of a frame
+ */
+struct GpuProfilerFrame
+{
+	uint64_t frame_number{0};
+
+	/// Whether the timestamps could be converted to the CPU time domain
+	bool calibrated{false};
+
+	/// Scopes in the order they were opened, so that children follow their parent
+	std::vector<GpuProfilerScope> scopes;
+};
+
+/**
+ * @brief Hierarchical GPU profiler based on timestamp queries
+ *
+ * A command buffer is profiled between begin_command_buffer() and end_command_buffer(), which wrap it in a root
+ * scope. While it is, every ScopedDebugLabel recorded to it also opens a nested scope, timed by a pair of
+ * BOTTOM_OF_PIPE timestamps. Scopes recorded to secondary command buffers, or to command buffers that are not
+ * profiled, are not timed.
+ *
+ * The scopes of a command buffer are kept by the thread recording it, which must call both begin_command_buffer()
+ * and end_command_buffer(), and are merged into its frame by end_command_buffer(). Labels thus never take a lock,
+ * and threads recording secondary command buffers in parallel do not contend on the profiler.
+ *
+ * Every frame in flight has its own query pool, so the results of a frame are read back by begin_frame() once
+ * the same render frame comes around again, when its fence has already been waited and reading them never stalls.
+ * A query pool that overflows drops the scopes that do not fit, and is grown the next time it is used.
+ *
+ * When VK_EXT_calibrated_timestamps is enabled, timestamps are converted to the std::chrono::steady_clock
+ * time domain, so that GPU scopes can be lined up with CPU work. Results are also sent to Tracy as GPU zones
+ * when profiling is enabled, and can be saved as JSON with write_json().
+ */
+class GpuProfiler
+{
+  public:
+	/**
+	 * @param render_context Render context whose frames are profiled
+	 * @param history_size Number of frames kept for write_json()
+	 */
+	GpuProfiler(vkb::rendering::RenderContextC &render_context, size_t history_size = 64);
+
+	GpuProfiler(const GpuProfiler &) = delete;
+
+	GpuProfiler(GpuProfiler &&) = delete;
+
+	~GpuProfiler();
+
+	GpuProfiler &operator=(const GpuProfiler &) = delete;
+
+	GpuProfiler &operator=(GpuProfiler &&) = delete;
+
+	/**
+	 * @return Whether the queue family of the graphics queue supports timestamps
+	 */
+	bool is_supported() const;
+
+	/**
+	 * @brief Reads back the results of the active render frame, must be called once per frame after RenderContext::begin()
+	 */
+	void begin_frame();
+
+	/**
+	 * @brief Starts profiling a primary command buffer of the active frame, in a root scope
+	 *        The first command buffer profiled in a frame resets the queries of that frame, so it must be submitted first.
+	 * @param command_buffer A command buffer in the recording state, outside of a render pass
+	 */
+	void begin_command_buffer(vkb::core::CommandBufferC &command_buffer, const char *name = "Frame");
+
+	/**
+	 * @brief Closes the root scope of a command buffer and stops profiling it
+	 */
+	void end_command_buffer(vkb::core::CommandBufferC &command_buffer);
+
+	/**
+	 * @brief Opens a scope if the command buffer is being profiled by any profiler on the calling thread, called by
+	 *        ScopedDebugLabel
+	 * @return Whether a scope was opened, and end_scope() must be called
+	 */
+	static bool begin_scope(VkCommandBuffer command_buffer, const char *name);
+
+	static void end_scope(VkCommandBuffer command_buffer);
+
+	/**
+	 * @return Number of the frame being recorded, which GpuProfilerFrame::frame_number refers to once it is read back
+	 */
+	uint64_t get_frame_number() const;
+
+	/**
+	 * @return Latest frame whose results were read back, empty until one was
+	 */
+	const GpuProfilerFrame &get_latest_frame() const;
+
+	/**
+	 * @brief Writes the frames kept in history as JSON
+	 * @param path Path of the file to write
+	 * @return Whether the file could be written
+	 */
+	bool write_json(const std::string &path) const;
+
+  private:
+	struct PendingScope
+	{
+		std::string name;
+
+		uint32_t parent;
+
+		uint32_t depth;
+
+		uint32_t begin_query;
+
+		uint32_t end_query;
+	};
+
+	/// Queries of a frame in flight
+	struct FrameQueries
+	{
+		std::unique_ptr<QueryPool> query_pool;
+
+		uint32_t capacity{0};
+
+		/// Queries handed out to the scopes of the frame, may exceed the capacity once it overflowed
+		std::atomic<uint32_t> query_count{0};
+
+		/// Frame whose scopes are recorded, the queries need a reset if it is not the current one
+		uint64_t frame_number{~0ull};
+
+		std::atomic<bool> overflowed{false};
+
+		/// Scopes of the command buffers whose recording ended, guarded by the profiler mutex
+		std::vector<PendingScope> scopes;
+	};
+
+	/// Scopes of a command buffer being profiled, only accessed by the thread recording it
+	struct CommandBufferScopes
+	{
+		GpuProfiler *profiler;
+
+		VkCommandBuffer command_buffer;
+
+		FrameQueries *frame;
+
+		/// Scopes in the order they were opened, their parents index into this list until they are merged
+		std::vector<PendingScope> scopes;
+
+		/// Scopes left to close, ~0 for the ones which were dropped
+		std::vector<uint32_t> open_scopes;
+	};
+
+	/**
+	 * @return The command buffers profiled on the calling thread
+	 */
+	static std::vector<CommandBufferScopes> &get_thread_scopes();
+
+	void read_back(FrameQueries &frame);
+
+	/**
+	 * @brief Samples the device and steady_clock time domains together
+	 * @return Whether both could be sampled
+	 */
+	bool calibrate(uint64_t &device_ticks, int64_t &host_ns) const;
+
+	int64_t to_ticks_delta(uint64_t from, uint64_t to) const;
+
+	void emit_tracy_zones(const FrameQueries &frame, const std::vector<uint64_t> &timestamps, uint64_t device_ticks, bool calibrated);
+
+	void open_scope(CommandBufferScopes &command_buffer_scopes, const char *name);
+
+	void close_scope(CommandBufferScopes &command_buffer_scopes);
+
+	vkb::rendering::RenderContextC &render_context;
+
+	size_t history_size;
+
+	float timestamp_period{1.0f};
+
+	/// Mask of the valid bits of a timestamp
+	uint64_t timestamp_mask{0};
+
+	/// Host time domain sampled along with the device one, or VK_TIME_DOMAIN_MAX_ENUM_EXT if none is
+	VkTimeDomainEXT host_time_domain{VK_TIME_DOMAIN_MAX_ENUM_EXT};
+
+	bool has_device_time_domain{false};
+
+	uint64_t frame_number{0};
+
+	/// Guards the reset of the frame queries and the scopes merged into them
+	std::mutex mutex;
+
+	/// A deque, as the frames hold atomics and cannot be moved
+	std::deque<FrameQueries> frames;
+
+	/// Per scope path, the duration averaged over the previous frames
+	std::unordered_map<std::string, double> average_durations;
+
+	GpuProfilerFrame latest_frame;
+
+	std::deque<GpuProfilerFrame> history;
+
+	uint8_t tracy_context{0};
+
+	bool tracy_context_created{false};
+
+	uint16_t tracy_query_id{0};
+};
+}        // namespace vkb
@@ -19,7 +19,7 @@
 
 #include <stats/stats.h>
 
-#include <rendering/hpp_render_context.h>
+#include <rendering/render_context.h>
 
 namespace vkb
 {
@@ -34,6 +34,7 @@ class HPPStats : private vkb::Stats
 {
   public:
 	using vkb::Stats::get_data;
+	using vkb::Stats::get_gpu_profiler;
 	using vkb::Stats::get_graph_data;
 	using vkb::Stats::get_requested_stats;
 	using vkb::Stats::is_available;
@@ -41,8 +42,8 @@ class HPPStats : private vkb::Stats
 	using vkb::Stats::resize;
 	using vkb::Stats::update;
 
-	explicit HPPStats(vkb::rendering::HPPRenderContext &render_context, size_t buffer_size = 16) :
-	    vkb::Stats(reinterpret_cast<vkb::RenderContext &>(render_context), buffer_size)
+	explicit HPPStats(vkb::rendering::RenderContextCpp &render_context, size_t buffer_size = 16) :
+	    vkb::Stats(reinterpret_cast<vkb::rendering::RenderContextC &>(render_context), buffer_size)
 	{}
 
 	void begin_sampling(vkb::core::CommandBufferCpp &cb)
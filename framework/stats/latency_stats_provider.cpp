@@ -0,0 +1,71 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "latency_stats_provider.h"
+
+#include "rendering/render_context.h"
+
+namespace vkb
+{
+LatencyStatsProvider::LatencyStatsProvider(std::set<StatIndex> &requested_stats, vkb::rendering::RenderContextC &render_context) :
+    render_context{render_context}
+{
+	// The latency stats are always measured by the render context, remove them from the requested set
+	for (StatIndex index : {StatIndex::frame_latency, StatIndex::frame_cpu_latency, StatIndex::frame_present_latency, StatIndex::frame_sync_time})
+	{
+		if (requested_stats.erase(index))
+		{
+			supported_stats.insert(index);
+		}
+	}
+}
+
+bool LatencyStatsProvider::is_available(StatIndex index) const
+{
+	return supported_stats.find(index) != supported_stats.end();
+}
+
+StatsProvider::Counters LatencyStatsProvider::sample(float delta_time)
+{
+	Counters res;
+
+	const FrameLatency &latency = render_context.get_frame_pacer().get_latest_latency();
+
+	for (StatIndex index : supported_stats)
+	{
+		switch (index)
+		{
+			case StatIndex::frame_latency:
+				res[index].result = latency.total;
+				break;
+			case StatIndex::frame_cpu_latency:
+				res[index].result = latency.cpu_time;
+				break;
+			case StatIndex::frame_present_latency:
+				res[index].result = latency.present_latency;
+				break;
+			case StatIndex::frame_sync_time:
+				res[index].result = render_context.get_sync_time();
+				break;
+			default:
+				break;
+		}
+	}
+
+	return res;
+}
+}        // namespace vkb
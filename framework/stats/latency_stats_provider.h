@@ -0,0 +1,67 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "stats_provider.h"
+#include <set>
+
+namespace vkb
+{
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC = RenderContext<vkb::BindingType::C>;
+}        // namespace rendering
+
+/**
+ * @brief Latency of the frames measured by the frame pacer of the render context,
+ * and CPU time the render context spent on their synchronization
+ *
+ * The latency of a frame is only known once it has been presented, so the stats
+ * of a sample describe the last frame which completed, a frame or two behind.
+ */
+class LatencyStatsProvider : public StatsProvider
+{
+  public:
+	/**
+	 * @brief Constructs a LatencyStatsProvider
+	 * @param requested_stats Set of stats to be collected. Supported stats will be removed from the set.
+	 * @param render_context The render context whose frames are measured
+	 */
+	LatencyStatsProvider(std::set<StatIndex> &requested_stats, vkb::rendering::RenderContextC &render_context);
+
+	/**
+	 * @brief Checks if this provider can supply the given enabled stat
+	 * @param index The stat index
+	 * @return True if the stat is available, false otherwise
+	 */
+	bool is_available(StatIndex index) const override;
+
+	/**
+	 * @brief Retrieve a new sample set
+	 * @param delta_time Time since last sample
+	 */
+	Counters sample(float delta_time) override;
+
+  private:
+	vkb::rendering::RenderContextC &render_context;
+
+	std::set<StatIndex> supported_stats;
+};
+}        // namespace vkb
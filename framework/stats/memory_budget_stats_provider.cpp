@@ -0,0 +1,85 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_budget_stats_provider.h"
+
+#include <algorithm>
+
+#include "memory_budget_tracker.h"
+
+namespace vkb
+{
+MemoryBudgetStatsProvider::MemoryBudgetStatsProvider(std::set<StatIndex> &requested_stats)
+{
+	// The heap budgets are always tracked, remove them from the requested set
+	for (StatIndex index : {StatIndex::device_memory_usage, StatIndex::memory_budget_usage})
+	{
+		if (requested_stats.erase(index))
+		{
+			supported_stats.insert(index);
+		}
+	}
+}
+
+bool MemoryBudgetStatsProvider::is_available(StatIndex index) const
+{
+	return supported_stats.find(index) != supported_stats.end();
+}
+
+StatsProvider::Counters MemoryBudgetStatsProvider::sample(float delta_time)
+{
+	Counters res;
+
+	double device_memory_usage = 0.0;
+	double budget_usage        = 0.0;
+	for (auto &heap_budget : MemoryBudgetTracker::get().get_heap_budgets())
+	{
+		if (heap_budget.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+		{
+			device_memory_usage += heap_budget.usage;
+		}
+
+		if (heap_budget.budget > 0)
+		{
+			budget_usage = std::max(budget_usage, static_cast<double>(heap_budget.usage) / heap_budget.budget);
+		}
+	}
+
+	for (StatIndex index : supported_stats)
+	{
+		switch (index)
+		{
+			case StatIndex::device_memory_usage:
+				res[index].result = device_memory_usage;
+				break;
+			case StatIndex::memory_budget_usage:
+				res[index].result = budget_usage;
+				break;
+			default:
+				break;
+		}
+	}
+
+	return res;
+}
+
+StatsProvider::Counters MemoryBudgetStatsProvider::continuous_sample(float delta_time)
+{
+	// The tracker holds the budgets of the last frame, which the sampling jobs can read as well
+	return sample(delta_time);
+}
+}        // namespace vkb
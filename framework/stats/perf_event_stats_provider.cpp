@@ -0,0 +1,398 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "perf_event_stats_provider.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "common/error.h"
+
+namespace vkb
+{
+namespace
+{
+/// Interval between two scans of the thread list, in milliseconds
+constexpr double refresh_interval = 100.0;
+
+constexpr uint64_t hw_cache_read_access(uint64_t cache)
+{
+	return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16);
+}
+
+struct EventConfig
+{
+	uint32_t type;
+
+	uint64_t config;
+
+	const char *name;
+};
+
+// clang-format off
+// Indexed by PerfEventStatsProvider::Event
+const EventConfig event_configs[] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,                      "cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,                    "instructions"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES,                "cache references"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,                    "cache misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS,             "branch instructions"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES,                   "branch misses"},
+    {PERF_TYPE_HW_CACHE, hw_cache_read_access(PERF_COUNT_HW_CACHE_L1D), "L1 data cache reads"},
+    {PERF_TYPE_HW_CACHE, hw_cache_read_access(PERF_COUNT_HW_CACHE_LL),  "last level cache reads"},
+};
+// clang-format on
+
+pid_t get_thread_id()
+{
+	return static_cast<pid_t>(syscall(SYS_gettid));
+}
+
+int open_event(const EventConfig &event_config, pid_t tid)
+{
+	perf_event_attr attr{};
+	attr.size           = sizeof(perf_event_attr);
+	attr.type           = event_config.type;
+	attr.config         = event_config.config;
+	attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv     = 1;
+
+	return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+std::set<pid_t> get_thread_ids()
+{
+	std::set<pid_t> thread_ids;
+
+	if (DIR *dir = opendir("/proc/self/task"))
+	{
+		while (dirent *entry = readdir(dir))
+		{
+			if (entry->d_name[0] != '.')
+			{
+				thread_ids.insert(static_cast<pid_t>(std::atoi(entry->d_name)));
+			}
+		}
+		closedir(dir);
+	}
+
+	return thread_ids;
+}
+
+std::string get_paranoid_level()
+{
+	std::ifstream file{"/proc/sys/kernel/perf_event_paranoid"};
+	std::string   level;
+	if (!(file >> level))
+	{
+		level = "unknown";
+	}
+	return level;
+}
+}        // namespace
+
+PerfEventStatsProvider::PerfEventStatsProvider(std::set<StatIndex> &requested_stats)
+{
+	// clang-format off
+	StatDataMap perf_event_stats = {
+	    {StatIndex::cpu_cycles,              {Cycles,         StatScaling::ByDeltaTime, EventCount,         false}},
+	    {StatIndex::cpu_instructions,        {Instructions,   StatScaling::ByDeltaTime, EventCount,         false}},
+	    {StatIndex::cpu_instr_retired,       {Instructions,   StatScaling::ByDeltaTime, EventCount,         false}},
+	    {StatIndex::cpu_cache_miss_ratio,    {CacheMisses,    StatScaling::ByCounter,   CacheReferences,    false}},
+	    {StatIndex::cpu_branch_miss_ratio,   {BranchMisses,   StatScaling::ByCounter,   BranchInstructions, false}},
+	    {StatIndex::cpu_l1_accesses,         {L1DataReads,    StatScaling::ByDeltaTime, EventCount,         false}},
+	    {StatIndex::cpu_l3_accesses,         {LastLevelReads, StatScaling::ByDeltaTime, EventCount,         false}},
+	    {StatIndex::cpu_thread_cycles,       {Cycles,         StatScaling::ByDeltaTime, EventCount,         true}},
+	    {StatIndex::cpu_thread_instructions, {Instructions,   StatScaling::ByDeltaTime, EventCount,         true}}};
+	// clang-format on
+
+	render_thread_id = get_thread_id();
+
+	// Probe every event on the render thread, and keep the stats whose events can be counted
+	std::array<int, EventCount> probe_fds;
+	probe_fds.fill(-1);
+
+	for (const auto &stat : requested_stats)
+	{
+		auto it = perf_event_stats.find(stat);
+		if (it == perf_event_stats.end())
+		{
+			continue;
+		}
+
+		bool supported = true;
+		for (Event event : {it->second.event, it->second.divisor})
+		{
+			if (event == EventCount || probe_fds[event] >= 0)
+			{
+				continue;
+			}
+
+			probe_fds[event] = open_event(event_configs[event], render_thread_id);
+			if (probe_fds[event] < 0)
+			{
+				if (errno == EACCES || errno == EPERM)
+				{
+					LOGW("perf_event: access denied (perf_event_paranoid is {}), CPU counters are not available", get_paranoid_level());
+					stat_data.clear();
+					for (int fd : probe_fds)
+					{
+						if (fd >= 0)
+						{
+							close(fd);
+						}
+					}
+					return;
+				}
+
+				LOGW("perf_event: {} counter not supported ({})", event_configs[event].name, strerror(errno));
+				supported = false;
+			}
+		}
+
+		if (supported)
+		{
+			stat_data[stat] = it->second;
+		}
+	}
+
+	for (const auto &iter : stat_data)
+	{
+		enabled_events[iter.second.event] = true;
+		if (iter.second.divisor != EventCount)
+		{
+			enabled_events[iter.second.divisor] = true;
+		}
+	}
+
+	// The probes of the enabled events become the counters of the render thread
+	ThreadCounters render_thread;
+	render_thread.fds.fill(-1);
+	for (uint32_t event = 0; event < EventCount; event++)
+	{
+		if (enabled_events[event])
+		{
+			render_thread.fds[event] = probe_fds[event];
+		}
+		else if (probe_fds[event] >= 0)
+		{
+			close(probe_fds[event]);
+		}
+	}
+
+	if (stat_data.empty())
+	{
+		return;
+	}
+
+	read_deltas(render_thread);
+	threads.emplace(render_thread_id, render_thread);
+	refresh_threads();
+	refresh_timer.start();
+
+	LOGI("perf_event: counting {} CPU stats on {} threads", stat_data.size(), threads.size());
+
+	// Remove any supported stats from the requested set.
+	// Subsequent providers will then only look for things that aren't already supported.
+	for (const auto &iter : stat_data)
+	{
+		requested_stats.erase(iter.first);
+	}
+}
+
+PerfEventStatsProvider::~PerfEventStatsProvider()
+{
+	for (auto &thread : threads)
+	{
+		close_thread(thread.second);
+	}
+}
+
+bool PerfEventStatsProvider::is_available(StatIndex index) const
+{
+	return stat_data.find(index) != stat_data.end();
+}
+
+bool PerfEventStatsProvider::open_thread(pid_t tid, ThreadCounters &counters)
+{
+	counters.fds.fill(-1);
+
+	for (uint32_t event = 0; event < EventCount; event++)
+	{
+		if (enabled_events[event])
+		{
+			counters.fds[event] = open_event(event_configs[event], tid);
+			if (counters.fds[event] < 0)
+			{
+				// The thread has exited in the meantime
+				close_thread(counters);
+				return false;
+			}
+		}
+	}
+
+	read_deltas(counters);
+	return true;
+}
+
+void PerfEventStatsProvider::refresh_threads()
+{
+	auto thread_ids = get_thread_ids();
+
+	for (auto it = threads.begin(); it != threads.end();)
+	{
+		if (thread_ids.find(it->first) == thread_ids.end())
+		{
+			// Counters of exited threads keep their final value, which is accounted for before they are closed
+			auto deltas = read_deltas(it->second);
+			for (uint32_t event = 0; event < EventCount; event++)
+			{
+				exited_deltas[event] += deltas[event];
+			}
+
+			close_thread(it->second);
+			it = threads.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	for (pid_t tid : thread_ids)
+	{
+		if (threads.find(tid) == threads.end())
+		{
+			ThreadCounters counters;
+			if (open_thread(tid, counters))
+			{
+				threads.emplace(tid, counters);
+			}
+		}
+	}
+}
+
+PerfEventStatsProvider::EventValues PerfEventStatsProvider::read_deltas(ThreadCounters &counters)
+{
+	EventValues deltas{};
+
+	for (uint32_t event = 0; event < EventCount; event++)
+	{
+		if (counters.fds[event] < 0)
+		{
+			continue;
+		}
+
+		// Value, time enabled and time running, as requested by the read format
+		uint64_t data[3]{};
+		if (read(counters.fds[event], data, sizeof(data)) != sizeof(data))
+		{
+			continue;
+		}
+
+		// The counter is only running part of the time when the PMU is multiplexed between more events than it has counters
+		double value = data[2] > 0 ? static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]) : 0.0;
+
+		deltas[event]          = std::max(value - counters.values[event], 0.0);
+		counters.values[event] = value;
+	}
+
+	return deltas;
+}
+
+void PerfEventStatsProvider::close_thread(ThreadCounters &counters)
+{
+	for (int &fd : counters.fds)
+	{
+		if (fd >= 0)
+		{
+			close(fd);
+			fd = -1;
+		}
+	}
+}
+
+StatsProvider::Counters PerfEventStatsProvider::sample(float delta_time)
+{
+	Counters res;
+
+	if (stat_data.empty())
+	{
+		return res;
+	}
+
+	if (refresh_timer.elapsed<Timer::Milliseconds>() > refresh_interval)
+	{
+		refresh_threads();
+		refresh_timer.lap();
+	}
+
+	EventValues process_deltas = exited_deltas;
+	EventValues render_thread_deltas{};
+	exited_deltas = {};
+
+	for (auto &thread : threads)
+	{
+		auto deltas = read_deltas(thread.second);
+		for (uint32_t event = 0; event < EventCount; event++)
+		{
+			process_deltas[event] += deltas[event];
+		}
+
+		if (thread.first == render_thread_id)
+		{
+			render_thread_deltas = deltas;
+		}
+	}
+
+	for (const auto &iter : stat_data)
+	{
+		const StatData &data   = iter.second;
+		const auto     &deltas = data.render_thread ? render_thread_deltas : process_deltas;
+
+		double d = deltas[data.event];
+
+		if (data.scaling == StatScaling::ByDeltaTime && delta_time != 0.0f)
+		{
+			d /= delta_time;
+		}
+		else if (data.scaling == StatScaling::ByCounter)
+		{
+			double divisor = deltas[data.divisor];
+			d              = divisor != 0.0 ? d / divisor : 0.0;
+		}
+
+		res[iter.first].result = d;
+	}
+
+	return res;
+}
+
+StatsProvider::Counters PerfEventStatsProvider::continuous_sample(float delta_time)
+{
+	return sample(delta_time);
+}
+}        // namespace vkb
@@ -0,0 +1,150 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <set>
+#include <unordered_map>
+
+#include <sys/types.h>
+
+#include "stats_provider.h"
+#include "timer.h"
+
+namespace vkb
+{
+/**
+ * @brief CPU counters read from the Linux perf_event interface
+ *
+ * Counters are opened for every thread of the process, including the ones started after the provider,
+ * such as worker pools, which are picked up when the thread list is refreshed. The CPU stats sum every
+ * thread, while the render thread stats only count the thread which created the provider.
+ *
+ * Only user space is counted, so that the counters are available with the default perf_event_paranoid
+ * level. When perf_event_open is restricted or the counters are not supported, e.g. in some virtual
+ * machines, the stats are left for other providers to supply.
+ */
+class PerfEventStatsProvider : public StatsProvider
+{
+  private:
+	/// Hardware events the stats are computed from
+	enum Event : uint32_t
+	{
+		Cycles,
+		Instructions,
+		CacheReferences,
+		CacheMisses,
+		BranchInstructions,
+		BranchMisses,
+		L1DataReads,
+		LastLevelReads,
+		EventCount
+	};
+
+	using EventValues = std::array<double, EventCount>;
+
+	struct StatData
+	{
+		Event event;
+
+		StatScaling scaling;
+
+		Event divisor;
+
+		/// Whether the stat only counts the render thread
+		bool render_thread;
+	};
+
+	/// Counters of one thread
+	struct ThreadCounters
+	{
+		std::array<int, EventCount> fds;
+
+		/// Values at the last sample, scaled for multiplexing
+		EventValues values{};
+	};
+
+	using StatDataMap = std::unordered_map<StatIndex, StatData, StatIndexHash>;
+
+  public:
+	/**
+	 * @brief Constructs a PerfEventStatsProvider
+	 * @param requested_stats Set of stats to be collected. Supported stats will be removed from the set.
+	 */
+	PerfEventStatsProvider(std::set<StatIndex> &requested_stats);
+
+	/**
+	 * @brief Closes the counters of every thread
+	 */
+	~PerfEventStatsProvider();
+
+	/**
+	 * @brief Checks if this provider can supply the given enabled stat
+	 * @param index The stat index
+	 * @return True if the stat is available, false otherwise
+	 */
+	bool is_available(StatIndex index) const override;
+
+	/**
+	 * @brief Retrieve a new sample set from polled sampling
+	 * @param delta_time Time since last sample
+	 */
+	Counters sample(float delta_time) override;
+
+	/**
+	 * @brief Retrieve a new sample set from continuous sampling
+	 * @param delta_time Time since last sample
+	 */
+	Counters continuous_sample(float delta_time) override;
+
+  private:
+	/**
+	 * @brief Opens the enabled events for a thread
+	 * @return Whether every enabled event could be opened
+	 */
+	bool open_thread(pid_t tid, ThreadCounters &counters);
+
+	/**
+	 * @brief Opens counters for the threads started since the last refresh, and closes the ones of exited threads
+	 */
+	void refresh_threads();
+
+	/**
+	 * @brief Reads the counters of a thread and returns how much they increased since the last read
+	 */
+	EventValues read_deltas(ThreadCounters &counters);
+
+	void close_thread(ThreadCounters &counters);
+
+	// Only stats which are available and were requested end up in stat_data
+	StatDataMap stat_data;
+
+	// Events at least one stat needs
+	std::array<bool, EventCount> enabled_events{};
+
+	pid_t render_thread_id{0};
+
+	std::unordered_map<pid_t, ThreadCounters> threads;
+
+	// Deltas of the threads which exited since the last sample
+	EventValues exited_deltas{};
+
+	// Throttles the scan of the thread list
+	Timer refresh_timer;
+};
+}        // namespace vkb
@@ -24,16 +24,21 @@
 
 #include "core/device.h"
 #include "frame_time_stats_provider.h"
+#include "latency_stats_provider.h"
+#include "memory_budget_stats_provider.h"
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 #	include "hwcpipe_stats_provider.h"
 #endif
+#ifdef __linux__
+#	include "perf_event_stats_provider.h"
+#endif
 #include "core/allocated.h"
 #include "rendering/render_context.h"
 #include "vulkan_stats_provider.h"
 
 namespace vkb
 {
-Stats::Stats(RenderContext &render_context, size_t buffer_size) :
+Stats::Stats(vkb::rendering::RenderContextC &render_context, size_t buffer_size) :
     render_context(render_context),
     buffer_size(buffer_size)
 {
@@ -42,14 +47,17 @@ Stats::Stats(RenderContext &render_context, size_t buffer_size) :
 
 Stats::~Stats()
 {
-	if (stop_worker)
+	JobHandle last_sampling_job;
 	{
-		stop_worker->set_value();
+		std::lock_guard<std::mutex> lock(sampling_job_mutex);
+		stop_sampling     = true;
+		last_sampling_job = sampling_job;
 	}
 
-	if (worker_thread.joinable())
+	// The last job does not schedule another one, and is dropped if it has not started yet
+	if (last_sampling_job.is_valid() && !JobSystem::get().cancel(last_sampling_job))
 	{
-		worker_thread.join();
+		JobSystem::get().wait(last_sampling_job);
 	}
 }
 
@@ -71,14 +79,26 @@ void Stats::request_stats(const std::set<StatIndex> &wanted_stats,
 	// All supported stats will be removed from the given 'stats' set by the provider's constructor
 	// so subsequent providers only see requests for stats that aren't already supported.
 	providers.emplace_back(std::make_unique<FrameTimeStatsProvider>(stats));
+	providers.emplace_back(std::make_unique<LatencyStatsProvider>(stats, render_context));
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 	providers.emplace_back(std::make_unique<HWCPipeStatsProvider>(stats));
+#endif
+#ifdef __linux__
+	providers.emplace_back(std::make_unique<PerfEventStatsProvider>(stats));
 #endif
 	providers.emplace_back(std::make_unique<VulkanStatsProvider>(stats, sampling_config, render_context));
+	providers.emplace_back(std::make_unique<MemoryBudgetStatsProvider>(stats));
+
+	gpu_profiler = std::make_unique<GpuProfiler>(render_context);
+	if (!gpu_profiler->is_supported())
+	{
+		gpu_profiler.reset();
+	}
 
 	// In continuous sampling mode we still need to update the frame times as if we are polling
 	// Store the frame time provider here so we can easily access it later.
 	frame_time_provider = providers[0].get();
+	latency_provider    = providers[1].get();
 
 	for (const auto &stat : requested_stats)
 	{
@@ -87,12 +107,16 @@ void Stats::request_stats(const std::set<StatIndex> &wanted_stats,
 
 	if (sampling_config.mode == CounterSamplingMode::Continuous)
 	{
-		// Start a thread for continuous sample capture
-		stop_worker = std::make_unique<std::promise<void>>();
+		// Capture continuous samples with jobs repeated at the sampling interval
+		worker_timer.tick();
+
+		for (auto &p : providers)
+		{
+			p->continuous_sample(0.0f);
+		}
 
-		worker_thread = std::thread([this] {
-			continuous_sampling_worker(stop_worker->get_future());
-		});
+		next_sample_time = JobSystem::Clock::now();
+		schedule_continuous_sampling();
 
 		// Reduce smoothing for continuous sampling
 		alpha_smoothing = 0.6f;
@@ -148,6 +172,11 @@ static void add_smoothed_value(std::vector<float> &values, float value, float al
 
 void Stats::update(float delta_time)
 {
+	if (gpu_profiler)
+	{
+		gpu_profiler->begin_frame();
+	}
+
 	switch (sampling_config.mode)
 	{
 		case CounterSamplingMode::Polling:
@@ -170,13 +199,13 @@ void Stats::update(float delta_time)
 				std::unique_lock<std::mutex> lock(continuous_sampling_mutex);
 				if (!should_add_to_continuous_samples)
 				{
-					// If we have no pending samples, we let the worker thread
+					// If we have no pending samples, we let the sampling jobs
 					// capture samples for the next frame
 					should_add_to_continuous_samples = true;
 				}
 				else
 				{
-					// The worker thread has captured a frame, so we stop it
+					// The sampling jobs have captured a frame, so we stop them
 					// and read the samples
 					should_add_to_continuous_samples = false;
 					pending_samples.clear();
@@ -212,8 +241,10 @@ void Stats::update(float delta_time)
 			// Clamp the number of samples
 			sample_count = std::max<size_t>(1, std::min<size_t>(sample_count, pending_samples.size()));
 
-			// Get the frame time stats (not a continuous stat)
+			// Get the frame time and latency stats (not continuous stats)
 			StatsProvider::Counters frame_time_sample = frame_time_provider->sample(delta_time);
+			StatsProvider::Counters latency_sample    = latency_provider->sample(delta_time);
+			frame_time_sample.insert(latency_sample.begin(), latency_sample.end());
 
 			// Push the samples to circular buffers
 			std::for_each(pending_samples.begin(), pending_samples.begin() + sample_count, [this, frame_time_sample](auto &s) {
@@ -231,44 +262,44 @@ void Stats::update(float delta_time)
 	profile_counters();
 }
 
-void Stats::continuous_sampling_worker(std::future<void> should_terminate)
+void Stats::continuous_sampling_job()
 {
-	worker_timer.tick();
+	auto delta_time = static_cast<float>(worker_timer.tick());
 
+	// Sample counters
+	StatsProvider::Counters sample;
 	for (auto &p : providers)
 	{
-		p->continuous_sample(0.0f);
+		StatsProvider::Counters s = p->continuous_sample(delta_time);
+		sample.insert(s.begin(), s.end());
 	}
 
-	while (should_terminate.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+	// Add the new sample to the vector of continuous samples
 	{
-		auto delta_time = static_cast<float>(worker_timer.tick());
-		auto interval   = std::chrono::duration_cast<std::chrono::duration<float>>(sampling_config.interval).count();
-
-		// Ensure we wait for the interval specified in config
-		if (delta_time < interval)
+		std::unique_lock<std::mutex> lock(continuous_sampling_mutex);
+		if (should_add_to_continuous_samples)
 		{
-			std::this_thread::sleep_for(std::chrono::duration<float>(interval - delta_time));
-			delta_time += static_cast<float>(worker_timer.tick());
+			continuous_samples.push_back(sample);
 		}
+	}
 
-		// Sample counters
-		StatsProvider::Counters sample;
-		for (auto &p : providers)
-		{
-			StatsProvider::Counters s = p->continuous_sample(delta_time);
-			sample.insert(s.begin(), s.end());
-		}
+	schedule_continuous_sampling();
+}
 
-		// Add the new sample to the vector of continuous samples
-		{
-			std::unique_lock<std::mutex> lock(continuous_sampling_mutex);
-			if (should_add_to_continuous_samples)
-			{
-				continuous_samples.push_back(sample);
-			}
-		}
+void Stats::schedule_continuous_sampling()
+{
+	std::lock_guard<std::mutex> lock(sampling_job_mutex);
+
+	if (stop_sampling)
+	{
+		return;
 	}
+
+	// Ensure we wait for the interval specified in config, without accumulating the time spent sampling
+	auto now         = JobSystem::Clock::now();
+	next_sample_time = std::max(next_sample_time + sampling_config.interval, now);
+
+	sampling_job = JobSystem::get().schedule_after(next_sample_time - now, [this]() { continuous_sampling_job(); });
 }
 
 void Stats::push_sample(const StatsProvider::Counters &sample)
@@ -300,6 +331,14 @@ const char *to_string(StatIndex index)
 	{
 		case StatIndex::frame_times:
 			return "Frame Times (ms)";
+		case StatIndex::frame_latency:
+			return "Frame Latency (ms)";
+		case StatIndex::frame_cpu_latency:
+			return "Frame CPU Latency (ms)";
+		case StatIndex::frame_present_latency:
+			return "Frame Present Latency (ms)";
+		case StatIndex::frame_sync_time:
+			return "Frame Sync CPU Time (ms)";
 		case StatIndex::cpu_cycles:
 			return "CPU Cycles (M/s)";
 		case StatIndex::cpu_instructions:
@@ -330,6 +369,10 @@ const char *to_string(StatIndex index)
 			return "CPU Speculatively Exec. FP Instructions (M/s)";
 		case StatIndex::cpu_crypto_spec:
 			return "CPU Speculatively Exec. Crypto Instructions (M/s)";
+		case StatIndex::cpu_thread_cycles:
+			return "Render Thread CPU Cycles (M/s)";
+		case StatIndex::cpu_thread_instructions:
+			return "Render Thread CPU Instructions (M/s)";
 		case StatIndex::gpu_cycles:
 			return "GPU Cycles (M/s)";
 		case StatIndex::gpu_vertex_cycles:
@@ -358,6 +401,10 @@ const char *to_string(StatIndex index)
 			return "External Read Bytes (MiB/s)";
 		case StatIndex::gpu_ext_write_bytes:
 			return "External Write Bytes (MiB/s)";
+		case StatIndex::device_memory_usage:
+			return "Device Memory Usage (MiB)";
+		case StatIndex::memory_budget_usage:
+			return "Memory Budget Usage (%)";
 		default:
 			return nullptr;
 	}
@@ -432,6 +479,12 @@ void Stats::profile_counters() const
 
 void Stats::begin_sampling(vkb::core::CommandBufferC &cb)
 {
+	// The root scope of the profiler encloses the queries of the providers
+	if (gpu_profiler)
+	{
+		gpu_profiler->begin_command_buffer(cb);
+	}
+
 	// Inform the providers
 	for (auto &p : providers)
 	{
@@ -446,6 +499,11 @@ void Stats::end_sampling(vkb::core::CommandBufferC &cb)
 	{
 		p->end_sampling(cb);
 	}
+
+	if (gpu_profiler)
+	{
+		gpu_profiler->end_command_buffer(cb);
+	}
 }
 
 const StatGraphData &Stats::get_graph_data(StatIndex index) const
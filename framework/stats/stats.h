@@ -25,6 +25,8 @@
 #include <set>
 #include <vector>
 
+#include "gpu_profiler.h"
+#include "job_system.h"
 #include "stats_common.h"
 #include "stats_provider.h"
 #include "timer.h"
@@ -32,7 +34,6 @@
 namespace vkb
 {
 class Device;
-class RenderContext;
 
 namespace core
 {
@@ -41,6 +42,13 @@ class CommandBuffer;
 using CommandBufferC = CommandBuffer<vkb::BindingType::C>;
 }        // namespace core
 
+namespace rendering
+{
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC = RenderContext<vkb::BindingType::C>;
+}        // namespace rendering
+
 /*
  * @brief Helper class for querying statistics about the CPU and the GPU
  */
@@ -52,7 +60,7 @@ class Stats
 	 * @param render_context The RenderContext for this sample
 	 * @param buffer_size Size of the circular buffers
 	 */
-	explicit Stats(RenderContext &render_context, size_t buffer_size = 16);
+	explicit Stats(vkb::rendering::RenderContextC &render_context, size_t buffer_size = 16);
 
 	/**
 	 * @brief Destroys the Stats object
@@ -97,6 +105,15 @@ class Stats
 		return counters.at(index);
 	};
 
+	/**
+	 * @return The GPU profiler timing the debug label scopes of sampled command buffers,
+	 *         or nullptr if stats were not requested or timestamps are not supported
+	 */
+	const GpuProfiler *get_gpu_profiler() const
+	{
+		return gpu_profiler.get();
+	}
+
 	/**
 	 * @return The requested stats
 	 */
@@ -141,7 +158,7 @@ class Stats
 
   private:
 	/// The render context
-	RenderContext &render_context;
+	vkb::rendering::RenderContextC &render_context;
 
 	/// Stats that were requested - they may not all be available
 	std::set<StatIndex> requested_stats;
@@ -149,9 +166,15 @@ class Stats
 	/// Provider that tracks frame times
 	StatsProvider *frame_time_provider;
 
+	/// Provider that tracks the latency of frames
+	StatsProvider *latency_provider;
+
 	/// A list of stats providers to use in priority order
 	std::vector<std::unique_ptr<StatsProvider>> providers;
 
+	/// Profiler timing the debug label scopes of sampled command buffers
+	std::unique_ptr<GpuProfiler> gpu_profiler;
+
 	/// Counter sampling configuration
 	CounterSamplingConfig sampling_config;
 
@@ -161,7 +184,7 @@ class Stats
 	/// Timer used in the main thread to compute delta time
 	Timer main_timer;
 
-	/// Timer used by the worker thread to throttle counter sampling
+	/// Timer used by the sampling jobs to compute delta time
 	Timer worker_timer;
 
 	/// Alpha smoothing for running average
@@ -170,11 +193,17 @@ class Stats
 	/// Circular buffers for counter data
 	std::map<StatIndex, std::vector<float>> counters{};
 
-	/// Worker thread for continuous sampling
-	std::thread worker_thread;
+	/// The latest job sampling the counters in continuous sampling mode
+	JobHandle sampling_job;
 
-	/// Promise to stop the worker thread
-	std::unique_ptr<std::promise<void>> stop_worker;
+	/// Protects the sampling job, which is replaced by the job scheduling the next one
+	std::mutex sampling_job_mutex;
+
+	/// Set when destroyed, to stop scheduling sampling jobs
+	bool stop_sampling{false};
+
+	/// Time the next continuous sample is due
+	JobSystem::Clock::time_point next_sample_time;
 
 	/// A mutex for accessing measurements during continuous sampling
 	std::mutex continuous_sampling_mutex;
@@ -182,7 +211,7 @@ class Stats
 	/// The samples read during continuous sampling
 	std::vector<StatsProvider::Counters> continuous_samples;
 
-	/// A flag specifying if the worker thread should add entries to continuous_samples
+	/// A flag specifying if the sampling jobs should add entries to continuous_samples
 	bool should_add_to_continuous_samples{false};
 
 	/// The samples waiting to be displayed
@@ -191,9 +220,12 @@ class Stats
 	/// A value which helps keep a steady pace of continuous samples output.
 	float fractional_pending_samples{0.0f};
 
-	/// The worker thread function for continuous sampling;
-	/// it adds a new entry to continuous_samples at every interval
-	void continuous_sampling_worker(std::future<void> should_terminate);
+	/// The job function for continuous sampling;
+	/// it adds a new entry to continuous_samples and schedules the next job at the next interval
+	void continuous_sampling_job();
+
+	/// Schedules the next sampling job, unless sampling has stopped
+	void schedule_continuous_sampling();
 
 	/// Updates circular buffers for CPU and GPU counters
 	void push_sample(const StatsProvider::Counters &sample);
@@ -33,6 +33,10 @@ namespace vkb
 enum class StatIndex
 {
 	frame_times,
+	frame_latency,
+	frame_cpu_latency,
+	frame_present_latency,
+	frame_sync_time,
 	cpu_cycles,
 	cpu_instructions,
 	cpu_cache_miss_ratio,
@@ -48,6 +52,8 @@ enum class StatIndex
 	cpu_ase_spec,
 	cpu_vfp_spec,
 	cpu_crypto_spec,
+	cpu_thread_cycles,
+	cpu_thread_instructions,
 
 	gpu_cycles,
 	gpu_vertex_cycles,
@@ -63,6 +69,9 @@ enum class StatIndex
 	gpu_ext_read_bytes,
 	gpu_ext_write_bytes,
 	gpu_tex_cycles,
+
+	device_memory_usage,
+	memory_budget_usage,
 };
 
 struct StatIndexHash
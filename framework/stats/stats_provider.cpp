@@ -24,6 +24,10 @@ std::map<StatIndex, StatGraphData> StatsProvider::default_graph_map{
     // clang-format off
     // StatIndex                        Name shown in graph                            Format           Scale                         Fixed_max Max_value
     {StatIndex::frame_times,           {"Frame Times",                                 "{:3.1f} ms",    1000.0f}},
+    {StatIndex::frame_latency,         {"Frame Latency",                               "{:3.1f} ms",    1000.0f}},
+    {StatIndex::frame_cpu_latency,     {"Frame CPU Latency",                           "{:3.1f} ms",    1000.0f}},
+    {StatIndex::frame_present_latency, {"Frame Present Latency",                       "{:3.1f} ms",    1000.0f}},
+    {StatIndex::frame_sync_time,       {"Frame Sync CPU Time",                         "{:3.2f} ms",    1000.0f}},
     {StatIndex::cpu_cycles,            {"CPU Cycles",                                  "{:4.1f} M/s",   static_cast<float>(1e-6)}},
     {StatIndex::cpu_instructions,      {"CPU Instructions",                            "{:4.1f} M/s",   static_cast<float>(1e-6)}},
     {StatIndex::cpu_cache_miss_ratio,  {"Cache Miss Ratio",                            "{:3.1f}%",      100.0f,                       true,     100.0f}},
@@ -39,6 +43,8 @@ std::map<StatIndex, StatGraphData> StatsProvider::default_graph_map{
     {StatIndex::cpu_ase_spec,          {"CPU Speculatively Exec. SIMD Instructions",   "{:4.1f} M/s",   static_cast<float>(1e-6)}},
     {StatIndex::cpu_vfp_spec,          {"CPU Speculatively Exec. FP Instructions",     "{:4.1f} M/s",   static_cast<float>(1e-6)}},
     {StatIndex::cpu_crypto_spec,       {"CPU Speculatively Exec. Crypto Instructions", "{:4.1f} M/s",   static_cast<float>(1e-6)}},
+    {StatIndex::cpu_thread_cycles,     {"Render Thread CPU Cycles",                    "{:4.1f} M/s",   static_cast<float>(1e-6)}},
+    {StatIndex::cpu_thread_instructions, {"Render Thread CPU Instructions",            "{:4.1f} M/s",   static_cast<float>(1e-6)}},
 
     {StatIndex::gpu_cycles,            {"GPU Cycles",                                  "{:4.1f} M/s",   static_cast<float>(1e-6)}},
     {StatIndex::gpu_vertex_cycles,     {"Vertex Cycles",                               "{:4.1f} M/s",   static_cast<float>(1e-6)}},
@@ -54,6 +60,9 @@ std::map<StatIndex, StatGraphData> StatsProvider::default_graph_map{
     {StatIndex::gpu_ext_write_stalls,  {"External Write Stalls",                       "{:4.1f} M/s",   static_cast<float>(1e-6)}},
     {StatIndex::gpu_ext_read_bytes,    {"External Read Bytes",                         "{:4.1f} MiB/s", 1.0f / (1024.0f * 1024.0f)}},
     {StatIndex::gpu_ext_write_bytes,   {"External Write Bytes",                        "{:4.1f} MiB/s", 1.0f / (1024.0f * 1024.0f)}},
+
+    {StatIndex::device_memory_usage,   {"Device Memory Usage",                         "{:4.1f} MiB",   1.0f / (1024.0f * 1024.0f)}},
+    {StatIndex::memory_budget_usage,   {"Memory Budget Usage",                         "{:3.1f}%",      100.0f,                       true,     100.0f}},
     // clang-format on
 };
 
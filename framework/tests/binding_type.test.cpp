@@ -0,0 +1,53 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <core/util/error.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "buffer_pool.h"
+#include "gui.h"
+#include "rendering/render_context.h"
+#include "rendering/render_frame.h"
+#include "resource_cache.h"
+
+// The C and C++ instantiations of the unified classes share a single implementation on the C types and are cast into
+// each other at the binding boundary, so both must have the same size and alignment
+#define CHECK_SAME_LAYOUT(C, Cpp)                                               \
+	static_assert(sizeof(C) == sizeof(Cpp), #C " and " #Cpp " differ in size"); \
+	static_assert(alignof(C) == alignof(Cpp), #C " and " #Cpp " differ in alignment");
+
+TEST_CASE("C and C++ bindings share the layout of the unified classes", "[binding_type]")
+{
+	CHECK_SAME_LAYOUT(vkb::BufferAllocationC, vkb::BufferAllocationCpp)
+	CHECK_SAME_LAYOUT(vkb::BufferPoolC, vkb::BufferPoolCpp)
+	CHECK_SAME_LAYOUT(vkb::GuiC, vkb::GuiCpp)
+	CHECK_SAME_LAYOUT(vkb::ResourceCacheC, vkb::ResourceCacheCpp)
+	CHECK_SAME_LAYOUT(vkb::rendering::RenderContextC, vkb::rendering::RenderContextCpp)
+	CHECK_SAME_LAYOUT(vkb::rendering::RenderFrameC, vkb::rendering::RenderFrameCpp)
+}
+
+TEST_CASE("C and C++ bindings read the same state through a cast", "[binding_type]")
+{
+	vkb::BufferAllocationC allocation_c;
+	auto                  &allocation_cpp = reinterpret_cast<vkb::BufferAllocationCpp &>(allocation_c);
+
+	REQUIRE(allocation_c.empty());
+	REQUIRE(allocation_cpp.empty());
+	REQUIRE(allocation_cpp.get_offset() == allocation_c.get_offset());
+	REQUIRE(allocation_cpp.get_size() == allocation_c.get_size());
+}
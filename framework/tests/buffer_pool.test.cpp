@@ -0,0 +1,173 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <core/util/error.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "buffer_pool.h"
+#include "core/hpp_debug.h"
+#include "core/hpp_device.h"
+#include "core/hpp_instance.h"
+#include "memory_budget_tracker.h"
+
+using namespace vkb;
+
+namespace
+{
+constexpr vk::DeviceSize block_size = 256 * 1024;
+
+/**
+ * @brief A headless instance and device, created the way VulkanSample::prepare does
+ */
+struct TestDevice
+{
+	std::unique_ptr<core::HPPInstance> instance;
+	std::unique_ptr<core::HPPDevice>   device;
+	std::string                        error;
+};
+
+/**
+ * @return A device on the first GPU, or a TestDevice without device and the reason if Vulkan is not available
+ */
+TestDevice create_test_device()
+{
+	TestDevice test_device;
+	try
+	{
+#if defined(_HPP_VULKAN_LIBRARY)
+		static vk::detail::DynamicLoader dl(_HPP_VULKAN_LIBRARY);
+#else
+		static vk::detail::DynamicLoader dl;
+#endif
+		VULKAN_HPP_DEFAULT_DISPATCHER.init(dl.getProcAddress<PFN_vkGetInstanceProcAddr>("vkGetInstanceProcAddr"));
+
+		if (volkInitialize() != VK_SUCCESS)
+		{
+			test_device.error = "failed to initialize volk";
+			return test_device;
+		}
+
+		test_device.instance = std::make_unique<core::HPPInstance>("buffer_pool_test");
+		VULKAN_HPP_DEFAULT_DISPATCHER.init(test_device.instance->get_handle());
+
+		test_device.device = std::make_unique<core::HPPDevice>(test_device.instance->get_first_gpu(), nullptr, std::make_unique<core::HPPDummyDebugUtils>());
+		VULKAN_HPP_DEFAULT_DISPATCHER.init(test_device.device->get_handle());
+	}
+	catch (std::exception const &e)
+	{
+		test_device.error = e.what();
+		test_device.device.reset();
+	}
+	return test_device;
+}
+
+/**
+ * @brief Resets the heap budgets of the process-wide tracker when a test ends, even if one of its requirements failed
+ */
+struct HeapBudgetsGuard
+{
+	~HeapBudgetsGuard()
+	{
+		MemoryBudgetTracker::get().set_heap_budgets({});
+	}
+};
+
+/**
+ * @brief Simulates the usage of a device local heap, as a fraction of its budget
+ */
+void set_device_local_usage(VkDeviceSize usage)
+{
+	MemoryBudgetTracker::get().set_heap_budgets({{VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, usage, 1000}});
+}
+}        // namespace
+
+TEST_CASE("vkb::BufferPool keeps idle blocks for the release window", "[buffer_pool]")
+{
+	auto test_device = create_test_device();
+	if (!test_device.device)
+	{
+		SKIP("Vulkan is not available: " << test_device.error);
+	}
+
+	HeapBudgetsGuard heap_budgets_guard;
+	BufferPoolCpp    buffer_pool{*test_device.device, block_size, vk::BufferUsageFlagBits::eUniformBuffer, VMA_MEMORY_USAGE_CPU_TO_GPU, 2};
+
+	set_device_local_usage(100);
+
+	buffer_pool.request_buffer_block(block_size, true);
+	buffer_pool.request_buffer_block(block_size, true);
+	REQUIRE(buffer_pool.get_block_count() == 2);
+	REQUIRE(buffer_pool.get_allocated_size() == 2 * block_size);
+	REQUIRE(!buffer_pool.reset());
+
+	// The second block stays idle, it is released once it was not requested for more than the release window
+	for (uint32_t frame = 0; frame < 2; frame++)
+	{
+		buffer_pool.request_buffer_block(block_size, true);
+		REQUIRE(!buffer_pool.reset());
+		REQUIRE(buffer_pool.get_block_count() == 2);
+	}
+
+	buffer_pool.request_buffer_block(block_size, true);
+	REQUIRE(buffer_pool.reset());
+	REQUIRE(buffer_pool.get_block_count() == 1);
+}
+
+TEST_CASE("vkb::BufferPool releases the idle blocks under memory pressure", "[buffer_pool]")
+{
+	auto test_device = create_test_device();
+	if (!test_device.device)
+	{
+		SKIP("Vulkan is not available: " << test_device.error);
+	}
+
+	HeapBudgetsGuard heap_budgets_guard;
+	BufferPoolCpp    buffer_pool{*test_device.device, block_size, vk::BufferUsageFlagBits::eUniformBuffer};
+
+	set_device_local_usage(100);
+
+	buffer_pool.request_buffer_block(block_size, true);
+	buffer_pool.request_buffer_block(block_size, true);
+	REQUIRE(!buffer_pool.reset());
+
+	// Without pressure, an idle block is kept for the whole release window
+	buffer_pool.request_buffer_block(block_size, true);
+	REQUIRE(!buffer_pool.reset());
+	REQUIRE(buffer_pool.get_block_count() == 2);
+
+	// Under pressure, a block not requested since the previous reset is released
+	set_device_local_usage(900);
+	REQUIRE(MemoryBudgetTracker::get().get_pressure() == MemoryPressure::High);
+
+	buffer_pool.request_buffer_block(block_size, true);
+	REQUIRE(buffer_pool.reset());
+	REQUIRE(buffer_pool.get_block_count() == 1);
+	REQUIRE(buffer_pool.get_allocated_size() == block_size);
+
+	// The block requested every frame stays alive
+	buffer_pool.request_buffer_block(block_size, true);
+	REQUIRE(!buffer_pool.reset());
+	REQUIRE(buffer_pool.get_block_count() == 1);
+
+	// Under pressure, new blocks are not grown ahead of the need
+	buffer_pool.request_buffer_block(block_size, true).allocate(block_size);
+	buffer_pool.request_buffer_block(block_size / 2);
+	REQUIRE(buffer_pool.get_allocated_size() == 2 * block_size);
+
+	buffer_pool.reset();
+}
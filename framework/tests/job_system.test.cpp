@@ -0,0 +1,200 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <core/util/error.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include "job_system.h"
+
+using namespace vkb;
+
+namespace
+{
+// Waits for jobs without running them on the calling thread, so that the order in which the workers run them is observed
+void spin_until_done(const std::vector<JobHandle> &handles)
+{
+	for (const auto &handle : handles)
+	{
+		while (!handle.is_done())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+}        // namespace
+
+TEST_CASE("vkb::JobSystem runs frame-critical jobs before background jobs", "[job_system]")
+{
+	JobSystem job_system{1};
+
+	// Keep the only worker busy while the jobs are queued
+	std::promise<void>       release;
+	std::shared_future<void> released = release.get_future().share();
+	std::atomic<bool>        blocked{false};
+
+	auto blocker = job_system.schedule([&blocked, released]() {
+		blocked = true;
+		released.wait();
+	});
+	while (!blocked)
+	{
+		std::this_thread::yield();
+	}
+
+	std::mutex               mutex;
+	std::vector<std::string> order;
+
+	auto background = job_system.schedule([&]() { std::lock_guard<std::mutex> lock(mutex); order.push_back("background"); }, JobPriority::Background);
+	auto critical   = job_system.schedule([&]() { std::lock_guard<std::mutex> lock(mutex); order.push_back("critical"); }, JobPriority::FrameCritical);
+
+	release.set_value();
+	spin_until_done({blocker, background, critical});
+
+	REQUIRE(order == std::vector<std::string>{"critical", "background"});
+}
+
+TEST_CASE("vkb::JobSystem runs a job once its dependencies have run", "[job_system]")
+{
+	JobSystem job_system{2};
+
+	std::atomic<uint32_t> runs{0};
+	std::atomic<uint32_t> runs_before_last{0};
+
+	auto first  = job_system.schedule([&runs]() { runs++; });
+	auto second = job_system.schedule([&runs]() { runs++; });
+	auto last   = job_system.schedule([&]() { runs_before_last = runs.load(); }, JobPriority::Background, {first, second});
+
+	job_system.wait(last);
+
+	REQUIRE(first.is_done());
+	REQUIRE(second.is_done());
+	REQUIRE(runs_before_last == 2);
+}
+
+TEST_CASE("vkb::JobSystem::wait returns once the jobs have run", "[job_system]")
+{
+	JobSystem job_system{2};
+
+	std::atomic<uint32_t>  runs{0};
+	std::vector<JobHandle> handles;
+	for (uint32_t index = 0; index < 100; index++)
+	{
+		handles.push_back(job_system.schedule([&runs]() { runs++; }, index % 2 ? JobPriority::FrameCritical : JobPriority::Background));
+	}
+
+	job_system.wait(handles);
+	REQUIRE(runs == 100);
+
+	// An invalid handle is always done
+	job_system.wait(JobHandle{});
+
+	auto value = job_system.async([]() { return 42; });
+	REQUIRE(value.get() == 42);
+
+	auto failure = job_system.async([]() -> int { throw std::runtime_error("job failed"); });
+	REQUIRE_THROWS_AS(failure.get(), std::runtime_error);
+}
+
+TEST_CASE("vkb::JobSystem::parallel_for covers the range once", "[job_system]")
+{
+	JobSystem job_system{3};
+
+	std::vector<std::atomic<uint32_t>> visits(1000);
+	job_system.parallel_for(static_cast<uint32_t>(visits.size()), [&visits](uint32_t begin, uint32_t end) {
+		for (uint32_t index = begin; index < end; index++)
+		{
+			visits[index]++;
+		}
+	});
+
+	for (auto &count : visits)
+	{
+		REQUIRE(count == 1);
+	}
+}
+
+TEST_CASE("vkb::JobSystem::schedule_after queues a job once its delay has elapsed", "[job_system]")
+{
+	JobSystem job_system{1};
+
+	auto delay = std::chrono::milliseconds(50);
+	auto start = JobSystem::Clock::now();
+
+	JobSystem::Clock::time_point run_time;
+	auto                         delayed = job_system.schedule_after(delay, [&run_time]() { run_time = JobSystem::Clock::now(); });
+
+	job_system.wait(delayed);
+
+	REQUIRE(delayed.is_done());
+	REQUIRE(run_time - start >= delay);
+}
+
+TEST_CASE("vkb::JobSystem::cancel drops a delayed job which is not due", "[job_system]")
+{
+	JobSystem job_system{1};
+
+	std::atomic<bool> ran{false};
+	auto              delayed = job_system.schedule_after(std::chrono::hours(1), [&ran]() { ran = true; });
+
+	REQUIRE(!delayed.is_done());
+	REQUIRE(job_system.cancel(delayed));
+	REQUIRE(delayed.is_done());
+
+	// Returns immediately, instead of after the delay
+	job_system.wait(delayed);
+	REQUIRE(!ran);
+
+	// Queued jobs can not be cancelled
+	auto queued = job_system.schedule([]() {});
+	job_system.wait(queued);
+	REQUIRE(!job_system.cancel(queued));
+}
+
+TEST_CASE("vkb::JobSystem runs the queued jobs and drops the delayed jobs on shutdown", "[job_system]")
+{
+	std::atomic<uint32_t> runs{0};
+	std::atomic<bool>     delayed_ran{false};
+	std::atomic<bool>     continuation_ran{false};
+
+	std::vector<JobHandle> queued;
+	JobHandle              delayed;
+	JobHandle              continuation;
+	{
+		JobSystem job_system{2};
+
+		for (uint32_t index = 0; index < 100; index++)
+		{
+			queued.push_back(job_system.schedule([&runs]() { runs++; }));
+		}
+
+		delayed      = job_system.schedule_after(std::chrono::hours(1), [&delayed_ran]() { delayed_ran = true; });
+		continuation = job_system.schedule([&continuation_ran]() { continuation_ran = true; }, JobPriority::Background, {delayed});
+	}
+
+	REQUIRE(runs == 100);
+	REQUIRE(delayed.is_done());
+	REQUIRE(!delayed_ran);
+	REQUIRE(continuation_ran);
+
+	// A thread waiting for a dropped job returns, like the stats do once the process-wide job system was recreated
+	JobSystem job_system{1};
+	job_system.wait(delayed);
+}
@@ -0,0 +1,139 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <core/util/error.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "memory_budget_tracker.h"
+
+using namespace vkb;
+
+namespace
+{
+constexpr VkDeviceSize heap_budget = 1000;
+
+/**
+ * @brief A device local heap, and a host heap using little of its budget
+ */
+std::vector<HeapBudget> create_heap_budgets(VkDeviceSize device_local_usage)
+{
+	return {{VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, device_local_usage, heap_budget}, {0, 10, heap_budget}};
+}
+
+/**
+ * @brief Removes the callbacks of a test from the process-wide tracker and resets its heap budgets when the test ends,
+ *        even if one of its requirements failed
+ */
+struct TrackerGuard
+{
+	~TrackerGuard()
+	{
+		auto &tracker = MemoryBudgetTracker::get();
+		for (auto callback_id : callback_ids)
+		{
+			tracker.remove_pressure_callback(callback_id);
+		}
+		tracker.set_heap_budgets({});
+	}
+
+	std::vector<uint32_t> callback_ids;
+};
+}        // namespace
+
+TEST_CASE("vkb::MemoryBudgetTracker raises the pressure above the thresholds", "[memory_budget_tracker]")
+{
+	REQUIRE(MemoryBudgetTracker::get_heap_pressure(0, heap_budget) == MemoryPressure::None);
+	REQUIRE(MemoryBudgetTracker::get_heap_pressure(800, heap_budget) == MemoryPressure::None);
+	REQUIRE(MemoryBudgetTracker::get_heap_pressure(801, heap_budget) == MemoryPressure::High);
+	REQUIRE(MemoryBudgetTracker::get_heap_pressure(950, heap_budget) == MemoryPressure::High);
+	REQUIRE(MemoryBudgetTracker::get_heap_pressure(951, heap_budget) == MemoryPressure::Critical);
+	REQUIRE(MemoryBudgetTracker::get_heap_pressure(2000, heap_budget) == MemoryPressure::Critical);
+
+	// A heap without budget is not used
+	REQUIRE(MemoryBudgetTracker::get_heap_pressure(0, 0) == MemoryPressure::None);
+}
+
+TEST_CASE("vkb::MemoryBudgetTracker reports the pressure of the most used heap", "[memory_budget_tracker]")
+{
+	TrackerGuard tracker_guard;
+	auto        &tracker = MemoryBudgetTracker::get();
+
+	tracker.set_heap_budgets(create_heap_budgets(900));
+
+	auto heap_budgets = tracker.get_heap_budgets();
+	REQUIRE(heap_budgets.size() == 2);
+	REQUIRE(heap_budgets[0].pressure == MemoryPressure::High);
+	REQUIRE(heap_budgets[1].pressure == MemoryPressure::None);
+	REQUIRE(tracker.get_pressure() == MemoryPressure::High);
+
+	tracker.set_heap_budgets({});
+	REQUIRE(tracker.get_pressure() == MemoryPressure::None);
+}
+
+TEST_CASE("vkb::MemoryBudgetTracker calls the pressure callbacks when the pressure changes", "[memory_budget_tracker]")
+{
+	TrackerGuard tracker_guard;
+	auto        &tracker = MemoryBudgetTracker::get();
+
+	std::vector<MemoryPressure> pressures;
+	uint32_t                    callback_id = tracker.add_pressure_callback([&pressures](MemoryPressure pressure) { pressures.push_back(pressure); });
+	tracker_guard.callback_ids.push_back(callback_id);
+
+	tracker.set_heap_budgets(create_heap_budgets(100));
+	REQUIRE(pressures.empty());
+
+	tracker.set_heap_budgets(create_heap_budgets(900));
+	tracker.set_heap_budgets(create_heap_budgets(920));
+	tracker.set_heap_budgets(create_heap_budgets(990));
+	tracker.set_heap_budgets(create_heap_budgets(100));
+	REQUIRE(pressures == std::vector<MemoryPressure>{MemoryPressure::High, MemoryPressure::Critical, MemoryPressure::None});
+
+	tracker.remove_pressure_callback(callback_id);
+	tracker.set_heap_budgets(create_heap_budgets(990));
+	REQUIRE(pressures.size() == 3);
+}
+
+TEST_CASE("vkb::MemoryBudgetTracker lets callbacks query the tracker", "[memory_budget_tracker]")
+{
+	TrackerGuard tracker_guard;
+	auto        &tracker = MemoryBudgetTracker::get();
+
+	MemoryPressure queried_pressure = MemoryPressure::None;
+	uint32_t       callback_id      = tracker.add_pressure_callback([&tracker, &queried_pressure](MemoryPressure) { queried_pressure = tracker.get_pressure(); });
+	tracker_guard.callback_ids.push_back(callback_id);
+
+	tracker.set_heap_budgets(create_heap_budgets(990));
+	REQUIRE(queried_pressure == MemoryPressure::Critical);
+
+	tracker.remove_pressure_callback(callback_id);
+}
+
+TEST_CASE("vkb::MemoryBudgetTracker counts the degraded allocations", "[memory_budget_tracker]")
+{
+	auto &tracker = MemoryBudgetTracker::get();
+
+	uint32_t degraded_allocation_count = tracker.get_degraded_allocation_count();
+	tracker.record_degraded_allocation();
+	tracker.record_degraded_allocation();
+	REQUIRE(tracker.get_degraded_allocation_count() == degraded_allocation_count + 2);
+}
+
+TEST_CASE("vkb::MemoryBudgetTracker accepts allocations before the allocator is created", "[memory_budget_tracker]")
+{
+	REQUIRE(MemoryBudgetTracker::get().can_allocate(1024 * 1024));
+}
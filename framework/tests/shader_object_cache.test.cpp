@@ -0,0 +1,79 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <core/util/error.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "platform/application.h"
+#include "shader_object_cache.h"
+
+using namespace vkb;
+
+TEST_CASE("vkb::ShaderObjectCache binds the stages whose features are enabled", "[shader_object_cache]")
+{
+	REQUIRE(ShaderObjectCache::get_graphics_stages(false, false, false) ==
+	        std::vector<VkShaderStageFlagBits>{VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_FRAGMENT_BIT});
+
+	REQUIRE(ShaderObjectCache::get_graphics_stages(true, true, true) ==
+	        std::vector<VkShaderStageFlagBits>{VK_SHADER_STAGE_VERTEX_BIT,
+	                                           VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+	                                           VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT,
+	                                           VK_SHADER_STAGE_GEOMETRY_BIT,
+	                                           VK_SHADER_STAGE_TASK_BIT_EXT,
+	                                           VK_SHADER_STAGE_MESH_BIT_EXT,
+	                                           VK_SHADER_STAGE_FRAGMENT_BIT});
+
+	REQUIRE(ShaderObjectCache::get_graphics_stages(false, true, false) ==
+	        std::vector<VkShaderStageFlagBits>{VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_GEOMETRY_BIT, VK_SHADER_STAGE_FRAGMENT_BIT});
+}
+
+TEST_CASE("vkb::ShaderObjectCache creates every shader for the next stage of its layout", "[shader_object_cache]")
+{
+	auto stages = ShaderObjectCache::get_graphics_stages(true, true, true);
+
+	// The enabled stages without a shader are skipped
+	auto next_stages = ShaderObjectCache::get_next_stages(stages, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+	REQUIRE(next_stages == std::vector<VkShaderStageFlags>{VK_SHADER_STAGE_FRAGMENT_BIT, 0, 0, 0, 0, 0, 0});
+
+	next_stages = ShaderObjectCache::get_next_stages(stages, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+	REQUIRE(next_stages == std::vector<VkShaderStageFlags>{VK_SHADER_STAGE_GEOMETRY_BIT, 0, 0, VK_SHADER_STAGE_FRAGMENT_BIT, 0, 0, 0});
+
+	next_stages = ShaderObjectCache::get_next_stages(stages, VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT | VK_SHADER_STAGE_FRAGMENT_BIT);
+	REQUIRE(next_stages == std::vector<VkShaderStageFlags>{0, 0, 0, 0, VK_SHADER_STAGE_MESH_BIT_EXT, VK_SHADER_STAGE_FRAGMENT_BIT, 0});
+
+	// A mesh pipeline without a fragment shader
+	next_stages = ShaderObjectCache::get_next_stages(stages, VK_SHADER_STAGE_MESH_BIT_EXT);
+	REQUIRE(next_stages == std::vector<VkShaderStageFlags>{0, 0, 0, 0, 0, 0, 0});
+}
+
+TEST_CASE("vkb::Application does not select the optional framework features by default", "[framework_features]")
+{
+	auto features = Application::get_framework_features();
+
+	REQUIRE(!features.timeline_semaphore);
+	REQUIRE(!features.present_wait);
+	REQUIRE(!features.graphics_pipeline_library);
+	REQUIRE(!features.shader_object);
+
+	features.shader_object = true;
+	Application::set_framework_features(features);
+	REQUIRE(Application::get_framework_features().shader_object);
+
+	Application::set_framework_features({});
+	REQUIRE(!Application::get_framework_features().shader_object);
+}
@@ -0,0 +1,78 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timeline_semaphore.h"
+
+#include "core/device.h"
+
+namespace vkb
+{
+TimelineSemaphore::TimelineSemaphore(Device &device, uint64_t initial_value) :
+    device{device}, last_value{initial_value}
+{
+	VkSemaphoreTypeCreateInfoKHR type_create_info{VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR};
+	type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+	type_create_info.initialValue  = initial_value;
+
+	VkSemaphoreCreateInfo create_info{VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO};
+	create_info.pNext = &type_create_info;
+
+	VkResult result = vkCreateSemaphore(device.get_handle(), &create_info, nullptr, &handle);
+
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create timeline semaphore.");
+	}
+}
+
+TimelineSemaphore::~TimelineSemaphore()
+{
+	vkDestroySemaphore(device.get_handle(), handle, nullptr);
+}
+
+VkSemaphore TimelineSemaphore::get_handle() const
+{
+	return handle;
+}
+
+uint64_t TimelineSemaphore::request_value()
+{
+	return ++last_value;
+}
+
+uint64_t TimelineSemaphore::get_last_value() const
+{
+	return last_value;
+}
+
+uint64_t TimelineSemaphore::get_completed_value() const
+{
+	uint64_t value{0};
+	VK_CHECK(vkGetSemaphoreCounterValueKHR(device.get_handle(), handle, &value));
+	return value;
+}
+
+VkResult TimelineSemaphore::wait(uint64_t value, uint64_t timeout) const
+{
+	VkSemaphoreWaitInfoKHR wait_info{VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR};
+	wait_info.semaphoreCount = 1;
+	wait_info.pSemaphores    = &handle;
+	wait_info.pValues        = &value;
+
+	return vkWaitSemaphoresKHR(device.get_handle(), &wait_info, timeout);
+}
+}        // namespace vkb
@@ -0,0 +1,83 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "common/helpers.h"
+#include "common/vk_common.h"
+
+namespace vkb
+{
+class Device;
+
+/**
+ * @brief A timeline semaphore signaled by the submissions of a queue
+ *
+ * Every submission signals a new, monotonically increasing value, so a single semaphore tracks the
+ * progress of the queue: the host waits for a value instead of a fence per submission, and other
+ * queues wait for a value instead of a binary semaphore signaled for them.
+ *
+ * Requires VK_KHR_timeline_semaphore to be enabled.
+ */
+class TimelineSemaphore
+{
+  public:
+	TimelineSemaphore(Device &device, uint64_t initial_value = 0);
+
+	TimelineSemaphore(const TimelineSemaphore &) = delete;
+
+	TimelineSemaphore(TimelineSemaphore &&other) = delete;
+
+	~TimelineSemaphore();
+
+	TimelineSemaphore &operator=(const TimelineSemaphore &) = delete;
+
+	TimelineSemaphore &operator=(TimelineSemaphore &&) = delete;
+
+	VkSemaphore get_handle() const;
+
+	/**
+	 * @brief Reserves the next value, which must be signaled by a submission to the queue
+	 * @return The value to signal
+	 */
+	uint64_t request_value();
+
+	/**
+	 * @return The last value requested, which is reached once every submission so far completed
+	 */
+	uint64_t get_last_value() const;
+
+	/**
+	 * @return The value reached by the device
+	 */
+	uint64_t get_completed_value() const;
+
+	/**
+	 * @brief Waits on the host for the semaphore to reach a value
+	 * @param value The value to wait for
+	 * @param timeout Timeout in nanoseconds
+	 */
+	VkResult wait(uint64_t value, uint64_t timeout = std::numeric_limits<uint64_t>::max()) const;
+
+  private:
+	Device &device;
+
+	VkSemaphore handle{VK_NULL_HANDLE};
+
+	uint64_t last_value;
+};
+}        // namespace vkb
@@ -19,11 +19,15 @@
 #pragma once
 
 #include "common/hpp_utils.h"
+#include "glsl_compiler.h"
+#include "gui.h"
 #include "hpp_gltf_loader.h"
-#include "hpp_gui.h"
+#include "job_system.h"
 #include "platform/application.h"
 #include "platform/window.h"
 #include "rendering/hpp_render_pipeline.h"
+#include "rendering/subpasses/geometry_subpass.h"
+#include "rendering/texture_streamer.h"
 #include "stats/hpp_stats.h"
 
 #if defined(PLATFORM__MACOS)
@@ -53,7 +57,7 @@ namespace vkb
  * - setting enabled Stats
  * - creating the Device
  * - creating the Swapchain
- * - creating the RenderContext (or child class)
+ * - creating the vkb::rendering::RenderContextC (or child class)
  * - preparing the RenderContext
  * - loading the sg::Scene
  * - creating the RenderPipeline with ShaderModule (s)
@@ -72,7 +76,7 @@ namespace vkb
  * highlighted when that's the case):
  *
  * - calling sg::Script::update() for all sg::Script (s)
- * - beginning a frame in RenderContext (does the necessary waiting on fences and
+ * - beginning a frame in vkb::rendering::RenderContextC (does the necessary waiting on fences and
  *   acquires an core::Image)
  * - requesting a CommandBuffer
  * - updating Stats and Gui
@@ -100,7 +104,6 @@ namespace vkb
  * - Core classes: Classes in vkb::core wrap Vulkan objects for indexing and hashing.
  */
 
-class Gui;
 class RenderPipeline;
 class Stats;
 
@@ -113,7 +116,10 @@ class HPPPhysicalDevice;
 
 namespace rendering
 {
-class HPPRenderContext;
+template <vkb::BindingType bindingType>
+class RenderContext;
+using RenderContextC   = RenderContext<vkb::BindingType::C>;
+using RenderContextCpp = RenderContext<vkb::BindingType::Cpp>;
 class HPPRenderTarget;
 }        // namespace rendering
 
@@ -135,10 +141,10 @@ class VulkanSample : public vkb::Application
 	~VulkanSample() override;
 
 	using DeviceType         = typename std::conditional<bindingType == BindingType::Cpp, vkb::core::HPPDevice, vkb::Device>::type;
-	using GuiType            = typename std::conditional<bindingType == BindingType::Cpp, vkb::HPPGui, vkb::Gui>::type;
+	using GuiType            = vkb::Gui<bindingType>;
 	using InstanceType       = typename std::conditional<bindingType == BindingType::Cpp, vkb::core::HPPInstance, vkb::Instance>::type;
 	using PhysicalDeviceType = typename std::conditional<bindingType == BindingType::Cpp, vkb::core::HPPPhysicalDevice, vkb::PhysicalDevice>::type;
-	using RenderContextType  = typename std::conditional<bindingType == BindingType::Cpp, vkb::rendering::HPPRenderContext, vkb::RenderContext>::type;
+	using RenderContextType  = vkb::rendering::RenderContext<bindingType>;
 	using RenderPipelineType = typename std::conditional<bindingType == BindingType::Cpp, vkb::rendering::HPPRenderPipeline, vkb::RenderPipeline>::type;
 	using RenderTargetType   = typename std::conditional<bindingType == BindingType::Cpp, vkb::rendering::HPPRenderTarget, vkb::RenderTarget>::type;
 	using SceneType          = typename std::conditional<bindingType == BindingType::Cpp, vkb::scene_graph::HPPScene, vkb::sg::Scene>::type;
@@ -312,6 +318,60 @@ class VulkanSample : public vkb::Application
 
 	void set_render_pipeline(std::unique_ptr<RenderPipelineType> &&render_pipeline);
 
+	/**
+	 * @brief Streams the textures of the scenes loaded next within a memory budget, see vkb::TextureStreamer
+	 * Needs to be called before prepare(), and the render pipeline must be created after load_scene().
+	 * @param memory_budget Device memory the textures can take, in bytes
+	 */
+	void set_texture_streaming(VkDeviceSize memory_budget);
+
+	/**
+	 * @return The texture streamer of the scene, or nullptr if texture streaming is not enabled
+	 */
+	vkb::TextureStreamer *get_texture_streamer();
+
+	/**
+	 * @brief Enables VK_EXT_mesh_shader when supported, and builds the meshlets of the scenes loaded next for a
+	 *        vkb::MeshletSubpass to draw them. Task and mesh shaders need Vulkan 1.1 at least, see set_api_version.
+	 * Needs to be called before prepare().
+	 */
+	void set_meshlets(bool enabled);
+
+	/**
+	 * @return Meshlets found in the cache or built for the scene loaded last, see set_meshlets
+	 */
+	const vkb::MeshletBuildStats &get_meshlet_build_stats() const;
+
+	/**
+	 * @brief Optimizes the sub meshes of the scenes loaded next for the vertex cache, overdraw and vertex fetch, and
+	 *        interleaves their attributes, see vkb::MeshOptimizer. Samples reading the vertex buffers of the scene by
+	 *        attribute name should not enable it.
+	 * @param quantize Whether to quantize normals, tangents and texture coordinates to 16 bits
+	 */
+	void set_mesh_optimization(bool enabled, bool quantize = false);
+
+	/**
+	 * @brief Creates levels of detail of the sub meshes of the scenes loaded next, for the geometry subpasses to select
+	 *        from their projected error, see vkb::GeometrySubpass::set_lod_threshold
+	 * @param ratios Fraction of the triangles kept by every level, from the finest to the coarsest
+	 */
+	void set_lods(const std::vector<float> &ratios);
+
+	/**
+	 * @brief Cooks the scenes loaded next into a binary file next to their glTF file the first time they are loaded, and
+	 *        loads them back from it afterwards, see vkb::CookedScene. Scenes are cooked in every sample when the
+	 *        --scene-cooking option is passed, see vkb::GLTFLoader::set_default_scene_cooking.
+	 */
+	void set_scene_cooking(bool enabled);
+
+	/**
+	 * @brief Enables VK_EXT_host_image_copy when the device supports it, so that textures are copied to their images from
+	 *        host memory instead of through staging buffers, see vkb::sg::Image::copy_data_from_host
+	 *        Disabled by default, or enabled in every sample with the --host-image-copy option. To be set before the
+	 *        device is created.
+	 */
+	void set_host_image_copy(bool enabled);
+
 	/**
 	 * @brief Main loop sample events
 	 */
@@ -395,7 +455,7 @@ class VulkanSample : public vkb::Application
 	/**
 	 * @brief Context used for rendering, it is responsible for managing the frames and their underlying images
 	 */
-	std::unique_ptr<vkb::rendering::HPPRenderContext> render_context;
+	std::unique_ptr<vkb::rendering::RenderContextCpp> render_context;
 
 	/**
 	 * @brief Pipeline used for rendering, it should be set up by the concrete sample
@@ -407,10 +467,12 @@ class VulkanSample : public vkb::Application
 	 */
 	std::unique_ptr<vkb::scene_graph::HPPScene> scene;
 
-	std::unique_ptr<vkb::HPPGui> gui;
+	std::unique_ptr<vkb::GuiCpp> gui;
 
 	std::unique_ptr<vkb::stats::HPPStats> stats;
 
+	std::unique_ptr<vkb::TextureStreamer> texture_streamer;
+
 	static constexpr float STATS_VIEW_RESET_TIME{10.0f};        // 10 seconds
 
 	/**
@@ -448,6 +510,29 @@ class VulkanSample : public vkb::Application
 	/** @brief Whether or not we want a high priority graphics queue. */
 	bool high_priority_graphics_queue{false};
 
+	/** @brief Device memory the streamed textures can take, 0 if textures are not streamed. */
+	VkDeviceSize texture_streaming_budget{0};
+
+	/** @brief Whether the meshlets of the scenes are built, for a mesh shading subpass. */
+	bool meshlets{false};
+
+	/** @brief Meshlets found in the cache or built for the scene loaded last. */
+	vkb::MeshletBuildStats meshlet_build_stats;
+
+	/** @brief Whether the sub meshes of the scenes are optimized, and their normals and texture coordinates quantized. */
+	bool mesh_optimization{false};
+
+	bool mesh_quantization{false};
+
+	/** @brief Fraction of the triangles kept by the levels of detail of the scenes, none if empty. */
+	std::vector<float> lod_ratios;
+
+	/** @brief Whether the scenes are cooked, and loaded back from their cooked file. */
+	bool scene_cooking{false};
+
+	/** @brief Whether VK_EXT_host_image_copy is enabled when supported, to upload textures without staging buffers. */
+	bool host_image_copy{false};
+
 	std::unique_ptr<vkb::core::HPPDebugUtils> debug_utils;
 };
 
@@ -459,6 +544,7 @@ inline VulkanSample<bindingType>::~VulkanSample()
 		device->get_handle().waitIdle();
 	}
 
+	texture_streamer.reset();
 	scene.reset();
 	stats.reset();
 	gui.reset();
@@ -551,7 +637,7 @@ void VulkanSample<bindingType>::create_render_context_impl(const std::vector<vk:
 #endif
 
 	render_context =
-	    std::make_unique<vkb::rendering::HPPRenderContext>(*device, surface, *window, present_mode, present_mode_priority_list, surface_priority_list);
+	    std::make_unique<vkb::rendering::RenderContextCpp>(*device, surface, *window, present_mode, present_mode_priority_list, surface_priority_list);
 }
 
 template <vkb::BindingType bindingType>
@@ -621,7 +707,7 @@ inline void VulkanSample<bindingType>::draw_impl(vkb::core::CommandBufferCpp
 	{
 		vkb::common::HPPImageMemoryBarrier memory_barrier{};
 		memory_barrier.old_layout      = vk::ImageLayout::eColorAttachmentOptimal;
-		memory_barrier.new_layout      = vk::ImageLayout::ePresentSrcKHR;
+		memory_barrier.new_layout      = static_cast<vk::ImageLayout>(get_render_context().get_final_layout());
 		memory_barrier.src_access_mask = vk::AccessFlagBits::eColorAttachmentWrite;
 		memory_barrier.src_stage_mask  = vk::PipelineStageFlagBits::eColorAttachmentOutput;
 		memory_barrier.dst_stage_mask  = vk::PipelineStageFlagBits::eBottomOfPipe;
@@ -668,7 +754,23 @@ inline void VulkanSample<bindingType>::draw_renderpass_impl(vkb::core::CommandBu
 
 	if (gui)
 	{
-		gui->draw(command_buffer);
+		if (render_pipeline && render_pipeline->get_last_subpass_contents() == vk::SubpassContents::eSecondaryCommandBuffers)
+		{
+			// The last subpass was recorded in secondary command buffers, which can't be mixed with inline commands
+			auto &queue              = device->get_queue_by_flags(vk::QueueFlagBits::eGraphics, 0);
+			auto &gui_command_buffer = render_context->get_active_frame().request_command_buffer(queue, vkb::CommandBufferResetMode::ResetPool, vk::CommandBufferLevel::eSecondary);
+
+			gui_command_buffer.begin(vk::CommandBufferUsageFlagBits::eOneTimeSubmit | vk::CommandBufferUsageFlagBits::eRenderPassContinue, &command_buffer);
+			set_viewport_and_scissor_impl(gui_command_buffer, render_target.get_extent());
+			gui->draw(gui_command_buffer);
+			gui_command_buffer.end();
+
+			command_buffer.execute_commands(gui_command_buffer);
+		}
+		else
+		{
+			gui->draw(command_buffer);
+		}
 	}
 
 	command_buffer.get_handle().endRenderPass();
@@ -732,7 +834,7 @@ inline typename VulkanSample<bindingType>::GuiType &VulkanSample<bindingType>::g
 	}
 	else
 	{
-		return reinterpret_cast<vkb::Gui &>(*gui);
+		return reinterpret_cast<vkb::GuiC &>(*gui);
 	}
 }
 
@@ -745,7 +847,7 @@ inline typename VulkanSample<bindingType>::GuiType const &VulkanSample<bindingTy
 	}
 	else
 	{
-		return reinterpret_cast<vkb::Gui const &>(*gui);
+		return reinterpret_cast<vkb::GuiC const &>(*gui);
 	}
 }
 
@@ -838,7 +940,7 @@ inline typename VulkanSample<bindingType>::RenderContextType const &VulkanSample
 	assert(render_context && "Render context is not valid");
 	if constexpr (bindingType == BindingType::Cpp)
 	{
-		return reinterpret_cast<vkb::rendering::HPPRenderContext const &>(*render_context);
+		return reinterpret_cast<vkb::rendering::RenderContextCpp const &>(*render_context);
 	}
 	else
 	{
@@ -856,7 +958,7 @@ inline typename VulkanSample<bindingType>::RenderContextType &VulkanSample<bindi
 	}
 	else
 	{
-		return reinterpret_cast<vkb::RenderContext &>(*render_context);
+		return reinterpret_cast<vkb::rendering::RenderContextC &>(*render_context);
 	}
 }
 
@@ -1004,6 +1106,18 @@ template <vkb::BindingType bindingType>
 inline void VulkanSample<bindingType>::load_scene(const std::string &path)
 {
 	vkb::HPPGLTFLoader loader(*device);
+	loader.set_texture_streaming(texture_streaming_budget > 0);
+	loader.set_meshlets(meshlets && device->is_enabled(VK_EXT_MESH_SHADER_EXTENSION_NAME));
+	loader.set_mesh_optimization(mesh_optimization, mesh_quantization);
+	loader.set_lods(lod_ratios);
+	if (scene_cooking)
+	{
+		// Otherwise the scenes are cooked if selected on the command line
+		loader.set_scene_cooking(true);
+	}
+
+	// The textures of the previous scene are not streamed anymore
+	texture_streamer.reset();
 
 	scene = loader.read_scene_from_file(path);
 
@@ -1012,6 +1126,14 @@ inline void VulkanSample<bindingType>::load_scene(const std::string &path)
 		LOGE("Cannot load scene: {}", path.c_str());
 		throw std::runtime_error("Cannot load scene: " + path);
 	}
+
+	meshlet_build_stats = loader.get_meshlet_stats();
+
+	if (texture_streaming_budget > 0)
+	{
+		texture_streamer = std::make_unique<vkb::TextureStreamer>(reinterpret_cast<vkb::rendering::RenderContextC &>(*render_context), texture_streaming_budget);
+		texture_streamer->add_scene(reinterpret_cast<vkb::sg::Scene &>(*scene));
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -1077,8 +1199,10 @@ inline bool VulkanSample<bindingType>::prepare(const ApplicationOptions &options
 	VULKAN_HPP_DEFAULT_DISPATCHER.init(instance->get_handle());
 
 	// Getting a valid vulkan surface from the platform
-	surface = static_cast<vk::SurfaceKHR>(window->create_surface(reinterpret_cast<vkb::Instance &>(*instance)));
-	if (!surface)
+	// An offscreen window renders to a ring of offscreen images instead of a swapchain
+	bool offscreen = window->get_window_mode() == Window::Mode::Offscreen;
+	surface        = static_cast<vk::SurfaceKHR>(window->create_surface(reinterpret_cast<vkb::Instance &>(*instance)));
+	if (!surface && !offscreen)
 	{
 		throw std::runtime_error("Failed to create window surface.");
 	}
@@ -1092,6 +1216,20 @@ inline bool VulkanSample<bindingType>::prepare(const ApplicationOptions &options
 		gpu.get_mutable_requested_features().textureCompressionASTC_LDR = true;
 	}
 
+	// Request the features the texture streamer uses when they are available, it falls back without them
+	if (texture_streaming_budget > 0)
+	{
+		auto &features           = gpu.get_features();
+		auto &requested_features = gpu.get_mutable_requested_features();
+
+		requested_features.fragmentStoresAndAtomics = features.fragmentStoresAndAtomics;
+		if (features.sparseBinding && features.sparseResidencyImage2D)
+		{
+			requested_features.sparseBinding          = true;
+			requested_features.sparseResidencyImage2D = true;
+		}
+	}
+
 	// Request sample required GPU features
 	if constexpr (bindingType == BindingType::Cpp)
 	{
@@ -1104,8 +1242,9 @@ inline bool VulkanSample<bindingType>::prepare(const ApplicationOptions &options
 
 	// Creating vulkan device, specifying the swapchain extension always
 	// If using VK_EXT_headless_surface, we still create and use a swap-chain
+	// Offscreen rendering does not need one, but still uses it when available for the present image layout
 	{
-		add_device_extension(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+		add_device_extension(VK_KHR_SWAPCHAIN_EXTENSION_NAME, /*optional=*/offscreen);
 
 		if (instance_extensions.find(VK_KHR_DISPLAY_EXTENSION_NAME) != instance_extensions.end())
 		{
@@ -1113,6 +1252,95 @@ inline bool VulkanSample<bindingType>::prepare(const ApplicationOptions &options
 		}
 	}
 
+	// Lets the GPU profiler convert its timestamps to the CPU time domain
+	add_device_extension(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME, /*optional=*/true);
+
+	// The following features change how every sample synchronizes, presents, binds shaders and uploads textures, so they are opt-in
+	const auto framework_features = get_framework_features();
+
+	// Lets the render context track the submissions of a frame with a timeline semaphore per queue instead of fences
+	// The Vulkan 1.2 features of a sample can't be chained with the timeline semaphore features
+	if (framework_features.timeline_semaphore && instance->is_enabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+	    gpu.is_extension_supported(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) &&
+	    !gpu.has_extension_features(vk::StructureType::ePhysicalDeviceVulkan12Features) &&
+	    HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR, timelineSemaphore))
+	{
+		add_device_extension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, /*optional=*/true);
+	}
+
+	// Lets the render context wait for presentations, to pace frames and measure their latency
+	if (framework_features.present_wait && surface && instance->is_enabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+	    gpu.is_extension_supported(VK_KHR_PRESENT_ID_EXTENSION_NAME) && gpu.is_extension_supported(VK_KHR_PRESENT_WAIT_EXTENSION_NAME) &&
+	    gpu.get_extension_features<vk::PhysicalDevicePresentIdFeaturesKHR>().presentId &&
+	    gpu.get_extension_features<vk::PhysicalDevicePresentWaitFeaturesKHR>().presentWait)
+	{
+		HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDevicePresentIdFeaturesKHR, presentId);
+		HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDevicePresentWaitFeaturesKHR, presentWait);
+		add_device_extension(VK_KHR_PRESENT_ID_EXTENSION_NAME, /*optional=*/true);
+		add_device_extension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, /*optional=*/true);
+	}
+
+	// Lets the resource cache link graphics pipelines from cached pipeline libraries, and optimize them in the background
+	if (framework_features.graphics_pipeline_library && instance->is_enabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+	    gpu.is_extension_supported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) && gpu.is_extension_supported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+	    HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT, graphicsPipelineLibrary))
+	{
+		add_device_extension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, /*optional=*/true);
+		add_device_extension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, /*optional=*/true);
+	}
+
+	// Lets the resource cache bind shader objects instead of pipelines, when selected with ResourceCache::set_shader_objects
+	if (framework_features.shader_object && instance->is_enabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+	    gpu.is_extension_supported(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME) && gpu.is_extension_supported(VK_EXT_SHADER_OBJECT_EXTENSION_NAME) &&
+	    HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDeviceDynamicRenderingFeaturesKHR, dynamicRendering) &&
+	    HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDeviceShaderObjectFeaturesEXT, shaderObject))
+	{
+		// VK_EXT_shader_object depends on VK_KHR_dynamic_rendering, which depends on the following extensions before Vulkan 1.2.
+		// The command buffers begin dynamic rendering to draw with graphics shader objects
+		for (auto extension : {VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME, VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME})
+		{
+			if (gpu.is_extension_supported(extension))
+			{
+				add_device_extension(extension, /*optional=*/true);
+			}
+		}
+		add_device_extension(VK_EXT_SHADER_OBJECT_EXTENSION_NAME, /*optional=*/true);
+	}
+
+	// Lets a meshlet subpass cull and draw the meshlets of the scene with task and mesh shaders
+	if (meshlets && api_version >= VK_API_VERSION_1_1 && instance->is_enabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+	    gpu.is_extension_supported(VK_EXT_MESH_SHADER_EXTENSION_NAME) && gpu.get_extension_features<vk::PhysicalDeviceMeshShaderFeaturesEXT>().taskShader &&
+	    HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDeviceMeshShaderFeaturesEXT, meshShader))
+	{
+		HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDeviceMeshShaderFeaturesEXT, taskShader);
+
+		// VK_EXT_mesh_shader depends on VK_KHR_spirv_1_4, which depends on VK_KHR_shader_float_controls before Vulkan 1.2
+		for (auto extension : {VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME, VK_KHR_SPIRV_1_4_EXTENSION_NAME})
+		{
+			if (gpu.is_extension_supported(extension))
+			{
+				add_device_extension(extension, /*optional=*/true);
+			}
+		}
+		add_device_extension(VK_EXT_MESH_SHADER_EXTENSION_NAME, /*optional=*/true);
+	}
+
+	// Lets the texture loaders copy images from host memory, without staging buffers or queue submissions
+	if ((host_image_copy || framework_features.host_image_copy) && instance->is_enabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+	    gpu.is_extension_supported(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME) &&
+	    HPP_REQUEST_OPTIONAL_FEATURE(gpu, vk::PhysicalDeviceHostImageCopyFeaturesEXT, hostImageCopy))
+	{
+		// VK_EXT_host_image_copy depends on the following extensions before Vulkan 1.3
+		for (auto extension : {VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME, VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME})
+		{
+			if (gpu.is_extension_supported(extension))
+			{
+				add_device_extension(extension, /*optional=*/true);
+			}
+		}
+		add_device_extension(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME, /*optional=*/true);
+	}
+
 #ifdef VKB_ENABLE_PORTABILITY
 	// VK_KHR_portability_subset must be enabled if present in the implementation (e.g on macOS/iOS with beta extensions enabled)
 	add_device_extension(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME, /*optional=*/true);
@@ -1158,6 +1386,12 @@ inline bool VulkanSample<bindingType>::prepare(const ApplicationOptions &options
 	// initialize C++-Bindings default dispatcher, optional third step
 	VULKAN_HPP_DEFAULT_DISPATCHER.init(device->get_handle());
 
+	// Task and mesh shaders need SPIR-V 1.4, the target environment is reset when the sample closes
+	if (device->is_enabled(VK_EXT_MESH_SHADER_EXTENSION_NAME))
+	{
+		vkb::GLSLCompiler::set_target_environment(glslang::EShTargetSpv, glslang::EShTargetSpv_1_4);
+	}
+
 	create_render_context();
 	prepare_render_context();
 
@@ -1174,11 +1408,11 @@ inline void VulkanSample<bindingType>::create_gui(const Window &window, StatsTyp
 {
 	if constexpr (bindingType == BindingType::Cpp)
 	{
-		gui = std::make_unique<vkb::HPPGui>(*this, window, stats, font_size, explicit_update);
+		gui = std::make_unique<vkb::GuiCpp>(*this, window, stats, font_size, explicit_update);
 	}
 	else
 	{
-		gui = std::make_unique<vkb::HPPGui>(
+		gui = std::make_unique<vkb::GuiCpp>(
 		    *reinterpret_cast<VulkanSampleCpp *>(this), window, reinterpret_cast<vkb::stats::HPPStats const *>(stats), font_size, explicit_update);
 	}
 }
@@ -1186,7 +1420,9 @@ inline void VulkanSample<bindingType>::create_gui(const Window &window, StatsTyp
 template <vkb::BindingType bindingType>
 inline void VulkanSample<bindingType>::prepare_render_context()
 {
-	render_context->prepare();
+	// Room for the resources of every thread of the job system, the frames only create the command pools of the threads
+	// recording subpasses in parallel once they record
+	render_context->prepare(vkb::JobSystem::get().get_worker_count() + 1);
 }
 
 template <vkb::BindingType bindingType>
@@ -1264,6 +1500,55 @@ inline void VulkanSample<bindingType>::set_high_priority_graphics_queue_enable(b
 	high_priority_graphics_queue = enable;
 }
 
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_texture_streaming(VkDeviceSize memory_budget)
+{
+	texture_streaming_budget = memory_budget;
+}
+
+template <vkb::BindingType bindingType>
+inline vkb::TextureStreamer *VulkanSample<bindingType>::get_texture_streamer()
+{
+	return texture_streamer.get();
+}
+
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_meshlets(bool enabled)
+{
+	meshlets = enabled;
+}
+
+template <vkb::BindingType bindingType>
+inline const vkb::MeshletBuildStats &VulkanSample<bindingType>::get_meshlet_build_stats() const
+{
+	return meshlet_build_stats;
+}
+
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_mesh_optimization(bool enabled, bool quantize)
+{
+	mesh_optimization = enabled;
+	mesh_quantization = quantize;
+}
+
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_lods(const std::vector<float> &ratios)
+{
+	lod_ratios = ratios;
+}
+
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_scene_cooking(bool enabled)
+{
+	scene_cooking = enabled;
+}
+
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_host_image_copy(bool enabled)
+{
+	host_image_copy = enabled;
+}
+
 template <vkb::BindingType bindingType>
 inline void VulkanSample<bindingType>::set_render_context(std::unique_ptr<RenderContextType> &&rc)
 {
@@ -1273,7 +1558,7 @@ inline void VulkanSample<bindingType>::set_render_context(std::unique_ptr<Render
 	}
 	else
 	{
-		render_context.reset(reinterpret_cast<vkb::rendering::HPPRenderContext *>(rc.release()));
+		render_context.reset(reinterpret_cast<vkb::rendering::RenderContextCpp *>(rc.release()));
 	}
 }
 
@@ -1288,6 +1573,17 @@ inline void VulkanSample<bindingType>::set_render_pipeline(std::unique_ptr<Rende
 	{
 		render_pipeline.reset(reinterpret_cast<vkb::rendering::HPPRenderPipeline *>(rp.release()));
 	}
+
+	if (render_pipeline && texture_streamer)
+	{
+		for (auto &subpass : reinterpret_cast<vkb::RenderPipeline &>(*render_pipeline).get_subpasses())
+		{
+			if (auto *geometry_subpass = dynamic_cast<vkb::GeometrySubpass *>(subpass.get()))
+			{
+				geometry_subpass->set_texture_streamer(texture_streamer.get());
+			}
+		}
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -1329,6 +1625,11 @@ inline void VulkanSample<bindingType>::update(float delta_time)
 	command_buffer.begin(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
 	stats->begin_sampling(command_buffer);
 
+	if (texture_streamer)
+	{
+		texture_streamer->update(reinterpret_cast<vkb::core::CommandBufferC &>(command_buffer));
+	}
+
 	if constexpr (bindingType == BindingType::Cpp)
 	{
 		draw(command_buffer, render_context->get_active_frame().get_render_target());
@@ -1353,10 +1654,10 @@ inline void VulkanSample<bindingType>::update_debug_window()
 
 	get_debug_info().template insert<field::Static, std::string>("driver_version", driver_version_str);
 	get_debug_info().template insert<field::Static, std::string>("resolution",
-	                                                             to_string(static_cast<VkExtent2D const &>(render_context->get_swapchain().get_extent())));
+	                                                             to_string(static_cast<VkExtent2D const &>(render_context->get_surface_extent())));
 	get_debug_info().template insert<field::Static, std::string>("surface_format",
-	                                                             to_string(render_context->get_swapchain().get_format()) + " (" +
-	                                                                 to_string(vkb::common::get_bits_per_pixel(render_context->get_swapchain().get_format())) +
+	                                                             to_string(render_context->get_format()) + " (" +
+	                                                                 to_string(vkb::common::get_bits_per_pixel(render_context->get_format())) +
 	                                                                 "bpp)");
 
 	if (scene != nullptr)
@@ -1008,7 +1008,7 @@ bool HelloTriangle::prepare(const vkb::ApplicationOptions &options)
 {
 	// Headless is not supported to keep this sample as simple as possible
 	assert(options.window != nullptr);
-	assert(options.window->get_window_mode() != vkb::Window::Mode::Headless);
+	assert(options.window->get_window_mode() != vkb::Window::Mode::Headless && options.window->get_window_mode() != vkb::Window::Mode::Offscreen);
 
 	init_instance();
 
@@ -142,7 +142,7 @@ bool HPPHelloTriangle::prepare(const vkb::ApplicationOptions &options)
 {
 	// Headless is not supported to keep this sample as simple as possible
 	assert(options.window != nullptr);
-	assert(options.window->get_window_mode() != vkb::Window::Mode::Headless);
+	assert(options.window->get_window_mode() != vkb::Window::Mode::Headless && options.window->get_window_mode() != vkb::Window::Mode::Offscreen);
 
 	if (Application::prepare(options))
 	{
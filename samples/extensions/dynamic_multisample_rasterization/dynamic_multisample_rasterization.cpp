@@ -321,7 +321,7 @@ void DynamicMultisampleRasterization::draw_ui(VkCommandBuffer &cmd_buffer)
 {
 	if (has_gui())
 	{
-		get_gui().draw(cmd_buffer, pipeline_gui, pipeline_layout_gui, descriptor_set_gui);
+		get_gui().draw(cmd_buffer, pipeline_gui, pipeline_layout_gui, descriptor_set_gui, get_frame_index(cmd_buffer));
 	}
 }
 
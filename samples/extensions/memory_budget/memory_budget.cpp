@@ -23,6 +23,8 @@
 
 #include "memory_budget.h"
 #include "benchmark_mode/benchmark_mode.h"
+#include "buffer_pool.h"
+#include "memory_budget_tracker.h"
 
 MemoryBudget::MemoryBudget()
 {
@@ -40,6 +42,7 @@ MemoryBudget::~MemoryBudget()
 {
 	if (has_device())
 	{
+		stress_buffers.clear();
 		vkDestroyPipeline(get_device().get_handle(), pipelines.instanced_rocks, nullptr);
 		vkDestroyPipeline(get_device().get_handle(), pipelines.planet, nullptr);
 		vkDestroyPipeline(get_device().get_handle(), pipelines.starfield, nullptr);
@@ -579,6 +582,81 @@ void MemoryBudget::render(float delta_time)
 	}
 }
 
+/**
+ * @brief Allocates device local buffers as long as the memory budget tracker allows it
+ *        The allocations should stop before the driver runs out of device memory, which would throw.
+ */
+void MemoryBudget::allocate_stress_buffers()
+{
+	auto &memory_budget_tracker = vkb::MemoryBudgetTracker::get();
+
+	stress_out_of_memory = false;
+
+	try
+	{
+		while (memory_budget_tracker.can_allocate(stress_buffer_size))
+		{
+			stress_buffers.push_back(std::make_unique<vkb::core::BufferC>(get_device(),
+			                                                              stress_buffer_size,
+			                                                              VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+			                                                              VMA_MEMORY_USAGE_GPU_ONLY));
+		}
+	}
+	catch (const vkb::VulkanException &exception)
+	{
+		stress_out_of_memory = true;
+		LOGE("Stress test ran out of memory before the budget was reached: {}", exception.what());
+	}
+
+	LOGI("Stress test allocated {} buffers of {} MB", stress_buffers.size(), stress_buffer_size / (1024 * 1024));
+
+	if (!stress_out_of_memory)
+	{
+		allocate_stress_resources();
+	}
+}
+
+/**
+ * @brief Allocates through the framework paths which follow the memory budget tracker, at the budget left by the
+ *        stress buffers: a buffer pool releases its idle blocks, and a texture loader drops the finest mip levels
+ */
+void MemoryBudget::allocate_stress_resources()
+{
+	auto &memory_budget_tracker = vkb::MemoryBudgetTracker::get();
+
+	// Account for the stress buffers without waiting for the next frame
+	memory_budget_tracker.update();
+
+	vkb::BufferPoolC buffer_pool{get_device(), stress_block_size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT};
+
+	const size_t block_count = 4;
+	for (size_t i = 0; i < block_count; i++)
+	{
+		buffer_pool.request_buffer_block(stress_block_size, true);
+	}
+	buffer_pool.reset();
+
+	// A single block is used in the next frame, the others are released at once under pressure
+	buffer_pool.request_buffer_block(stress_block_size, true);
+	buffer_pool.reset();
+	stress_released_block_count = block_count - buffer_pool.get_block_count();
+
+	uint32_t degraded_allocation_count = memory_budget_tracker.get_degraded_allocation_count();
+
+	Texture texture            = load_texture("textures/lavaplanet_color_rgba.ktx", vkb::sg::Image::Color);
+	stress_texture_level_count = vkb::to_u32(texture.image->get_mipmaps().size());
+	vkDestroySampler(get_device().get_handle(), texture.sampler, nullptr);
+
+	const char *pressure_names[] = {"none", "high", "critical"};
+	LOGI("Stress test at {} pressure: released {} of {} buffer pool blocks, loaded {} of {} texture levels ({} degraded allocations)",
+	     pressure_names[static_cast<int>(memory_budget_tracker.get_pressure())],
+	     stress_released_block_count,
+	     block_count,
+	     stress_texture_level_count,
+	     textures.planet.image->get_mipmaps().size(),
+	     memory_budget_tracker.get_degraded_allocation_count() - degraded_allocation_count);
+}
+
 void MemoryBudget::on_update_ui_overlay(vkb::Drawer &drawer)
 {
 	converted_memory = update_converted_memory(device_memory_total_usage);
@@ -603,6 +681,31 @@ void MemoryBudget::on_update_ui_overlay(vkb::Drawer &drawer)
 			}
 		}
 	}
+
+	if (drawer.header("Memory Pressure Stress Test"))
+	{
+		const char *pressure_names[] = {"None", "High", "Critical"};
+
+		auto &memory_budget_tracker = vkb::MemoryBudgetTracker::get();
+		drawer.text("Pressure: %s", pressure_names[static_cast<int>(memory_budget_tracker.get_pressure())]);
+		drawer.text("Degraded allocations: %u", memory_budget_tracker.get_degraded_allocation_count());
+
+		converted_memory = update_converted_memory(stress_buffers.size() * stress_buffer_size);
+		drawer.text("Stress buffers: %zu (%.2f %s)", stress_buffers.size(), converted_memory.data, converted_memory.units.c_str());
+		drawer.text("Out of memory: %s", stress_out_of_memory ? "yes" : "no");
+		drawer.text("Buffer pool blocks released: %zu", stress_released_block_count);
+		drawer.text("Texture levels loaded: %u of %zu", stress_texture_level_count, textures.planet.image->get_mipmaps().size());
+
+		if (drawer.button("Allocate"))
+		{
+			allocate_stress_buffers();
+		}
+		ImGui::SameLine();
+		if (drawer.button("Release"))
+		{
+			stress_buffers.clear();
+		}
+	}
 }
 
 bool MemoryBudget::resize(uint32_t width, uint32_t height)
@@ -49,6 +49,18 @@ class MemoryBudget : public ApiVulkanSample
 	VkDeviceSize device_memory_total_usage  = 0;
 	VkDeviceSize device_memory_total_budget = 0;
 
+	// Stress test of the framework memory budget tracker, allocates device local buffers until the budget is reached
+	const VkDeviceSize stress_buffer_size = 64 * 1024 * 1024;
+
+	std::vector<std::unique_ptr<vkb::core::BufferC>> stress_buffers;
+	bool                                             stress_out_of_memory = false;
+
+	// Framework allocations made at the budget, after the stress buffers
+	const VkDeviceSize stress_block_size = 256 * 1024;
+
+	size_t   stress_released_block_count = 0;
+	uint32_t stress_texture_level_count  = 0;
+
   public:
 	struct Textures
 	{
@@ -114,6 +126,8 @@ class MemoryBudget : public ApiVulkanSample
 	MemoryBudget::ConvertedMemory update_converted_memory(uint64_t input_memory) const;
 	static std::string            read_memoryHeap_flags(VkMemoryHeapFlags inputVkMemoryFlag);
 	void                          update_device_memory_properties();
+	void                          allocate_stress_buffers();
+	void                          allocate_stress_resources();
 
   public:
 	MemoryBudget();
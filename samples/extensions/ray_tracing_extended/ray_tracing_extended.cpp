@@ -1,4 +1,4 @@
-/* Copyright (c) 2021-2024 Holochip Corporation
+/* Copyright (c) 2021-2025 Holochip Corporation
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -368,6 +368,14 @@ void RaytracingExtended::create_bottom_level_acceleration_structure(bool is_upda
 	               dynamic_vertex_handle = dynamic_vertex_buffer ? get_buffer_device_address(dynamic_vertex_buffer->get_handle()) : 0,
 	               dynamic_index_handle  = dynamic_index_buffer ? get_buffer_device_address(dynamic_index_buffer->get_handle()) : 0;
 	auto &model_buffers                  = raytracing_scene->model_buffers;
+#ifdef USE_FRAMEWORK_ACCELERATION_STRUCTURE
+	// The initial builds are batched into a single submission, and the static structures compacted.
+	// The per-frame refits of the dynamic structures are batched the same way.
+	if (!acceleration_structure_builder)
+	{
+		acceleration_structure_builder = std::make_unique<vkb::core::AccelerationStructureBuilder>(get_device());
+	}
+#endif
 	for (auto &model_buffer : model_buffers)
 	{
 		if (model_buffer.is_static && is_update)
@@ -417,9 +425,15 @@ void RaytracingExtended::create_bottom_level_acceleration_structure(bool is_upda
 			    model_buffer.vertex_offset + (model_buffer.is_static ? static_vertex_handle : dynamic_vertex_handle),
 			    model_buffer.index_offset + (model_buffer.is_static ? static_index_handle : dynamic_index_handle));
 		}
-		model_buffer.bottom_level_acceleration_structure->build(queue,
-		                                                        model_buffer.is_static ? VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR : VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR,
-		                                                        is_update ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR);
+		const VkBuildAccelerationStructureFlagsKHR build_flags = model_buffer.is_static ? VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR : VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
+		if (is_update)
+		{
+			acceleration_structure_builder->add_update(*model_buffer.bottom_level_acceleration_structure);
+		}
+		else
+		{
+			acceleration_structure_builder->add(*model_buffer.bottom_level_acceleration_structure, build_flags);
+		}
 #else
 		VkDeviceOrHostAddressConstKHR vertex_data_device_address{};
 		VkDeviceOrHostAddressConstKHR index_data_device_address{};
@@ -543,6 +557,9 @@ void RaytracingExtended::create_bottom_level_acceleration_structure(bool is_upda
 		    vkGetAccelerationStructureDeviceAddressKHR(get_device().get_handle(), &acceleration_device_address_info);
 #endif
 	}
+#ifdef USE_FRAMEWORK_ACCELERATION_STRUCTURE
+	acceleration_structure_builder->build(queue);
+#endif
 }
 
 VkTransformMatrixKHR RaytracingExtended::calculate_rotation(glm::vec3 pt, float scale, bool freeze_z)
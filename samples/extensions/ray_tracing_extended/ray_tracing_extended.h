@@ -1,4 +1,4 @@
-/* Copyright (c) 2021-2024 Holochip Corporation
+/* Copyright (c) 2021-2025 Holochip Corporation
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -26,6 +26,7 @@
 #include "api_vulkan_sample.h"
 #include "glsl_compiler.h"
 #include <core/acceleration_structure.h>
+#include <core/acceleration_structure_builder.h>
 
 class RaytracingExtended : public ApiVulkanSample
 {
@@ -208,6 +209,9 @@ class RaytracingExtended : public ApiVulkanSample
 
 #ifdef USE_FRAMEWORK_ACCELERATION_STRUCTURE
 	std::unique_ptr<vkb::core::AccelerationStructure> top_level_acceleration_structure = nullptr;
+
+	// Kept for the lifetime of the sample so that the per-frame refits reuse its scratch arena
+	std::unique_ptr<vkb::core::AccelerationStructureBuilder> acceleration_structure_builder;
 #else
 	AccelerationStructureExtended top_level_acceleration_structure;
 #endif
@@ -150,8 +150,9 @@ bool MobileNerfRayQuery::prepare(const vkb::ApplicationOptions &options)
 
 	camera.set_perspective(60.0f, static_cast<float>(width) / static_cast<float>(height), 0.01f, 256.0f);
 
-	// Each models may have submodels
-	int models_entry = 0;
+	// Each models may have submodels, their bottom level acceleration structures are built and compacted together
+	vkb::core::AccelerationStructureBuilder acceleration_structure_builder{get_device()};
+	int                                     models_entry = 0;
 	for (int model_index = 0; model_index < num_models; model_index++)
 	{
 		int num_sub_model = models[models_entry].sub_model_num;
@@ -161,10 +162,11 @@ bool MobileNerfRayQuery::prepare(const vkb::ApplicationOptions &options)
 			load_scene(model_index, sub_model_index, models_entry);
 			create_texture(model_index, sub_model_index, models_entry);
 			create_static_object_buffers(models_entry);
-			create_bottom_level_acceleration_structure(models_entry);
+			create_bottom_level_acceleration_structure(models_entry, acceleration_structure_builder);
 			models_entry++;
 		}
 	}
+	acceleration_structure_builder.build(queue);
 
 	create_top_level_acceleration_structure();
 	create_uniforms();
@@ -840,7 +842,7 @@ void MobileNerfRayQuery::create_top_level_acceleration_structure()
 	top_level_acceleration_structure->build(queue);
 }
 
-void MobileNerfRayQuery::create_bottom_level_acceleration_structure(int model_entry)
+void MobileNerfRayQuery::create_bottom_level_acceleration_structure(int model_entry, vkb::core::AccelerationStructureBuilder &acceleration_structure_builder)
 {
 	Model &model = models[model_entry];
 
@@ -862,8 +864,9 @@ void MobileNerfRayQuery::create_bottom_level_acceleration_structure(int model_en
 		    M[0][1], M[1][1], M[2][1], -M[3][1],
 		    M[0][2], M[1][2], M[2][2], M[3][2]};
 	}
-	std::unique_ptr<vkb::core::BufferC> transform_matrix_buffer = std::make_unique<vkb::core::BufferC>(get_device(), sizeof(transform_matrix), buffer_usage_flags, VMA_MEMORY_USAGE_CPU_TO_GPU);
-	transform_matrix_buffer->update(&transform_matrix, sizeof(transform_matrix));
+	// The build is deferred to the acceleration structure builder, so the transform has to outlive this function
+	model.transform_matrix_buffer = std::make_unique<vkb::core::BufferC>(get_device(), sizeof(transform_matrix), buffer_usage_flags, VMA_MEMORY_USAGE_CPU_TO_GPU);
+	model.transform_matrix_buffer->update(&transform_matrix, sizeof(transform_matrix));
 
 	if (model.bottom_level_acceleration_structure == nullptr)
 	{
@@ -872,7 +875,7 @@ void MobileNerfRayQuery::create_bottom_level_acceleration_structure(int model_en
 		model.bottom_level_acceleration_structure->add_triangle_geometry(
 		    *model.vertex_buffer,
 		    *model.index_buffer,
-		    *transform_matrix_buffer,
+		    *model.transform_matrix_buffer,
 		    model.indices.size(),
 		    model.vertices.size(),
 		    sizeof(Vertex),
@@ -880,7 +883,8 @@ void MobileNerfRayQuery::create_bottom_level_acceleration_structure(int model_en
 		    get_buffer_device_address(model.vertex_buffer->get_handle()),
 		    get_buffer_device_address(model.index_buffer->get_handle()));
 	}
-	model.bottom_level_acceleration_structure->build(queue, VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR, VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR);
+	acceleration_structure_builder.add(*model.bottom_level_acceleration_structure,
+	                                   VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR);
 }
 
 void MobileNerfRayQuery::create_pipeline_layout()
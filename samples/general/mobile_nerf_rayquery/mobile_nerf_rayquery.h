@@ -1,4 +1,4 @@
-/* Copyright (c) 2023-2024, Qualcomm Innovation Center, Inc. All rights reserved.
+/* Copyright (c) 2023-2025, Qualcomm Innovation Center, Inc. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -20,6 +20,7 @@
 #include "api_vulkan_sample.h"
 #include "glsl_compiler.h"
 #include <core/acceleration_structure.h>
+#include <core/acceleration_structure_builder.h>
 
 #include <json.hpp>
 
@@ -109,6 +110,7 @@ class MobileNerfRayQuery : public ApiVulkanSample
 		// Each model has its vertex buffer and index buffer. In ray query, they are storage buffers.
 		std::unique_ptr<vkb::core::BufferC> vertex_buffer{nullptr};
 		std::unique_ptr<vkb::core::BufferC> index_buffer{nullptr};
+		std::unique_ptr<vkb::core::BufferC> transform_matrix_buffer{nullptr};
 
 		// Each model has its BLAS
 		std::unique_ptr<vkb::core::AccelerationStructure> bottom_level_acceleration_structure{nullptr};
@@ -187,7 +189,7 @@ class MobileNerfRayQuery : public ApiVulkanSample
 
 	uint64_t get_buffer_device_address(VkBuffer buffer);
 	void     create_top_level_acceleration_structure();
-	void     create_bottom_level_acceleration_structure(int model_entry);
+	void     create_bottom_level_acceleration_structure(int model_entry, vkb::core::AccelerationStructureBuilder &acceleration_structure_builder);
 
 	void create_texture(int model_index, int sub_model_index, int models_entry);
 	void create_texture_helper(std::string const &texturePath, Texture &texture_input);
@@ -36,6 +36,9 @@ AsyncComputeSample::AsyncComputeSample()
 	config.insert<vkb::BoolSetting>(1, rotate_shadows, true);
 	config.insert<vkb::BoolSetting>(0, double_buffer_hdr_frames, false);
 	config.insert<vkb::BoolSetting>(1, double_buffer_hdr_frames, true);
+
+	// The render graph records its barriers with synchronization2 when available
+	add_device_extension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME, true);
 }
 
 void AsyncComputeSample::request_gpu_features(vkb::PhysicalDevice &gpu)
@@ -45,6 +48,9 @@ void AsyncComputeSample::request_gpu_features(vkb::PhysicalDevice &gpu)
 	REQUEST_REQUIRED_FEATURE(
 	    gpu, VkPhysicalDevicePortabilitySubsetFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR, mutableComparisonSamplers);
 #endif
+
+	synchronization2_supported = REQUEST_OPTIONAL_FEATURE(
+	    gpu, VkPhysicalDeviceSynchronization2FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR, synchronization2);
 }
 
 void AsyncComputeSample::draw_gui()
@@ -54,8 +60,21 @@ void AsyncComputeSample::draw_gui()
 		    ImGui::Checkbox("Enable async queues", &async_enabled);
 		    ImGui::Checkbox("Double buffer HDR", &double_buffer_hdr_frames);
 		    ImGui::Checkbox("Rotate shadows", &rotate_shadows);
+		    ImGui::Checkbox("Render graph", &use_render_graph);
+		    if (use_render_graph && render_graph)
+		    {
+			    auto &statistics = render_graph->get_statistics();
+			    ImGui::Text("%u barriers, %u semaphores, %u ownership transfers",
+			                statistics.barrier_count, statistics.semaphore_count, statistics.ownership_transfer_count);
+			    ImGui::Text("Transient memory: %.1f MiB (%.1f MiB without aliasing, %.1f MiB hand-written)",
+			                static_cast<float>(statistics.transient_memory) / (1024.0f * 1024.0f),
+			                static_cast<float>(statistics.unaliased_transient_memory) / (1024.0f * 1024.0f),
+			                static_cast<float>(hand_written_memory) / (1024.0f * 1024.0f));
+		    }
+		    ImGui::Text("Average frame time: %.2f ms hand-written, %.2f ms render graph",
+		                frame_times[0].get_average() * 1000.0f, frame_times[1].get_average() * 1000.0f);
 	    },
-	    /* lines = */ 3);
+	    /* lines = */ use_render_graph ? 7 : 5);
 }
 
 static VkExtent3D downsample_extent(const VkExtent3D &extent, uint32_t level)
@@ -99,7 +118,7 @@ void AsyncComputeSample::prepare_render_targets()
 
 	// 8K shadow-map overkill to stress devices.
 	// Min-spec is 4K however, so clamp to that if required.
-	VkExtent3D              shadow_resolution{8 * 1024, 8 * 1024, 1};
+	shadow_resolution = {8 * 1024, 8 * 1024, 1};
 	VkImageFormatProperties depth_properties{};
 	vkGetPhysicalDeviceImageFormatProperties(get_device().get_gpu().get_handle(), VK_FORMAT_D16_UNORM, VK_IMAGE_TYPE_2D,
 	                                         VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
@@ -158,6 +177,20 @@ void AsyncComputeSample::prepare_render_targets()
 	std::vector<vkb::core::Image> shadow_attachments;
 	shadow_attachments.push_back(std::move(shadow_target));
 	shadow_render_target = std::make_unique<vkb::RenderTarget>(std::move(shadow_attachments));
+
+	// Memory of the hand-written render targets, to compare against the transient memory of the render graph
+	hand_written_memory = shadow_render_target->get_views()[0].get_image().get_image_required_size();
+	for (auto &forward_render_target : forward_render_targets)
+	{
+		for (auto &view : forward_render_target->get_views())
+		{
+			hand_written_memory += view.get_image().get_image_required_size();
+		}
+	}
+	for (auto &image : blur_chain)
+	{
+		hand_written_memory += image->get_image_required_size();
+	}
 }
 
 void AsyncComputeSample::setup_queues()
@@ -372,7 +405,7 @@ vkb::RenderTarget &AsyncComputeSample::get_current_forward_render_target()
 	return *forward_render_targets[forward_render_target_index];
 }
 
-VkSemaphore AsyncComputeSample::render_forward_offscreen_pass(VkSemaphore hdr_wait_semaphore)
+vkb::core::CommandBufferC &AsyncComputeSample::record_forward_offscreen_pass()
 {
 	auto &queue          = *early_graphics_queue;
 	auto &command_buffer = get_render_context().get_active_frame().request_command_buffer(queue);
@@ -437,9 +470,16 @@ VkSemaphore AsyncComputeSample::render_forward_offscreen_pass(VkSemaphore hdr_wa
 
 	command_buffer.end();
 
+	return command_buffer;
+}
+
+VkSemaphore AsyncComputeSample::render_forward_offscreen_pass(VkSemaphore hdr_wait_semaphore)
+{
+	auto &command_buffer = record_forward_offscreen_pass();
+
 	// Conditionally waits on hdr_wait_semaphore.
 	// This resolves the write-after-read hazard where previous frame tonemap read from HDR buffer.
-	auto signal_semaphore = get_render_context().submit(queue, {&command_buffer},
+	auto signal_semaphore = get_render_context().submit(*early_graphics_queue, {&command_buffer},
 	                                                    hdr_wait_semaphore, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
 
 	if (hdr_wait_semaphore)
@@ -450,7 +490,7 @@ VkSemaphore AsyncComputeSample::render_forward_offscreen_pass(VkSemaphore hdr_wa
 	return signal_semaphore;
 }
 
-VkSemaphore AsyncComputeSample::render_swapchain(VkSemaphore post_semaphore)
+vkb::core::CommandBufferC &AsyncComputeSample::record_swapchain()
 {
 	auto &queue          = *present_graphics_queue;
 	auto &command_buffer = get_render_context().get_active_frame().request_command_buffer(queue);
@@ -478,6 +518,14 @@ VkSemaphore AsyncComputeSample::render_swapchain(VkSemaphore post_semaphore)
 
 	command_buffer.end();
 
+	return command_buffer;
+}
+
+VkSemaphore AsyncComputeSample::render_swapchain(VkSemaphore post_semaphore)
+{
+	auto &queue          = *present_graphics_queue;
+	auto &command_buffer = record_swapchain();
+
 	// We're going to wait on this semaphore in different frame,
 	// so we need to hold ownership of the semaphore until we complete the wait.
 	hdr_wait_semaphores[forward_render_target_index] = get_render_context().request_semaphore_with_ownership();
@@ -518,7 +566,33 @@ VkSemaphore AsyncComputeSample::render_swapchain(VkSemaphore post_semaphore)
 	return signal_semaphores[0];
 }
 
-VkSemaphore AsyncComputeSample::render_compute_post(VkSemaphore wait_graphics_semaphore, VkSemaphore wait_present_semaphore)
+void AsyncComputeSample::dispatch_blur_pass(vkb::core::CommandBufferC &command_buffer, const vkb::core::ImageView &dst, const vkb::core::ImageView &src)
+{
+	struct Push
+	{
+		uint32_t width, height;
+		float    inv_width, inv_height;
+		float    inv_input_width, inv_input_height;
+	};
+
+	auto dst_extent = downsample_extent(dst.get_image().get_extent(), dst.get_subresource_range().baseMipLevel);
+	auto src_extent = downsample_extent(src.get_image().get_extent(), src.get_subresource_range().baseMipLevel);
+
+	Push push{};
+	push.width            = dst_extent.width;
+	push.height           = dst_extent.height;
+	push.inv_width        = 1.0f / static_cast<float>(push.width);
+	push.inv_height       = 1.0f / static_cast<float>(push.height);
+	push.inv_input_width  = 1.0f / static_cast<float>(src_extent.width);
+	push.inv_input_height = 1.0f / static_cast<float>(src_extent.height);
+
+	command_buffer.push_constants(push);
+	command_buffer.bind_image(src, *linear_sampler, 0, 0, 0);
+	command_buffer.bind_image(dst, 0, 1, 0);
+	command_buffer.dispatch((push.width + 7) / 8, (push.height + 7) / 8, 1);
+}
+
+vkb::core::CommandBufferC &AsyncComputeSample::record_compute_post()
 {
 	auto &queue          = *post_compute_queue;
 	auto &command_buffer = get_render_context().get_active_frame().request_command_buffer(queue);
@@ -571,32 +645,9 @@ VkSemaphore AsyncComputeSample::render_compute_post(VkSemaphore wait_graphics_se
 		command_buffer.image_memory_barrier(view, memory_barrier);
 	};
 
-	struct Push
-	{
-		uint32_t width, height;
-		float    inv_width, inv_height;
-		float    inv_input_width, inv_input_height;
-	};
-
 	const auto dispatch_pass = [&](const vkb::core::ImageView &dst, const vkb::core::ImageView &src, bool final = false) {
 		discard_blur_view(dst);
-
-		auto dst_extent = downsample_extent(dst.get_image().get_extent(), dst.get_subresource_range().baseMipLevel);
-		auto src_extent = downsample_extent(src.get_image().get_extent(), src.get_subresource_range().baseMipLevel);
-
-		Push push{};
-		push.width            = dst_extent.width;
-		push.height           = dst_extent.height;
-		push.inv_width        = 1.0f / static_cast<float>(push.width);
-		push.inv_height       = 1.0f / static_cast<float>(push.height);
-		push.inv_input_width  = 1.0f / static_cast<float>(src_extent.width);
-		push.inv_input_height = 1.0f / static_cast<float>(src_extent.height);
-
-		command_buffer.push_constants(push);
-		command_buffer.bind_image(src, *linear_sampler, 0, 0, 0);
-		command_buffer.bind_image(dst, 0, 1, 0);
-		command_buffer.dispatch((push.width + 7) / 8, (push.height + 7) / 8, 1);
-
+		dispatch_blur_pass(command_buffer, dst, src);
 		read_only_blur_view(dst, final);
 	};
 
@@ -639,6 +690,14 @@ VkSemaphore AsyncComputeSample::render_compute_post(VkSemaphore wait_graphics_se
 
 	command_buffer.end();
 
+	return command_buffer;
+}
+
+VkSemaphore AsyncComputeSample::render_compute_post(VkSemaphore wait_graphics_semaphore, VkSemaphore wait_present_semaphore)
+{
+	auto &queue          = *post_compute_queue;
+	auto &command_buffer = record_compute_post();
+
 	VkPipelineStageFlags wait_stages[]     = {VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT};
 	VkSemaphore          wait_semaphores[] = {wait_graphics_semaphore, wait_present_semaphore};
 	VkSemaphore          signal_semaphore  = get_render_context().request_semaphore();
@@ -661,6 +720,135 @@ VkSemaphore AsyncComputeSample::render_compute_post(VkSemaphore wait_graphics_se
 	return signal_semaphore;
 }
 
+VkSemaphore AsyncComputeSample::render_timeline()
+{
+	auto &render_context = get_render_context();
+
+	render_shadow_pass();
+
+	// Resolves the write-after-read hazard where previous frame tonemap read from HDR buffer, as hdr_wait_semaphores do
+	auto    &forward_command_buffer = record_forward_offscreen_pass();
+	uint64_t forward_value          = render_context.submit_timeline(*early_graphics_queue, {&forward_command_buffer},
+	                                                                 {{present_graphics_queue, hdr_read_values[forward_render_target_index], VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT}});
+
+	// Waits for the HDR buffer, and for the previous frame to read the blur results, as compute_post_semaphore does
+	auto    &post_command_buffer = record_compute_post();
+	uint64_t post_value          = render_context.submit_timeline(*post_compute_queue, {&post_command_buffer},
+	                                                              {{early_graphics_queue, forward_value, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT},
+	                                                               {present_graphics_queue, compute_post_read_value, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT}});
+
+	// A single value covers both reads of the next frames, which no semaphore has to be kept alive for
+	VkSemaphore present_semaphore        = VK_NULL_HANDLE;
+	auto       &swapchain_command_buffer = record_swapchain();
+	uint64_t    present_value            = render_context.submit_timeline(*present_graphics_queue, {&swapchain_command_buffer},
+	                                                                      {{post_compute_queue, post_value, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT}}, &present_semaphore);
+	hdr_read_values[forward_render_target_index] = present_value;
+	compute_post_read_value                      = present_value;
+
+	return present_semaphore;
+}
+
+void AsyncComputeSample::prepare_render_graph()
+{
+	render_graph = std::make_unique<vkb::RenderGraph>(get_render_context(),
+	                                                  synchronization2_supported && get_device().is_enabled(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME));
+
+	// Same resources as prepare_render_targets(), except that the graph owns them
+	VkExtent3D size = {3840, 2160, 1};
+
+	graph_shadow_map = render_graph->create_image("shadow_map", {shadow_resolution, VK_FORMAT_D16_UNORM});
+	graph_hdr        = render_graph->create_image("hdr", {size, VK_FORMAT_R16G16B16A16_SFLOAT});
+	graph_depth      = render_graph->create_image("depth", {size, VK_FORMAT_D32_SFLOAT});
+
+	graph_blur_chain.clear();
+	for (uint32_t level = 1; level < 7; level++)
+	{
+		graph_blur_chain.push_back(render_graph->create_image(fmt::format("blur_chain[{}]", level - 1),
+		                                                      {downsample_extent(size, level), VK_FORMAT_R16G16B16A16_SFLOAT}));
+	}
+
+	render_graph->add_pass(
+	    "shadow_pass", vkb::RenderGraphQueue::Graphics,
+	    [this](vkb::RenderGraph::PassBuilder &builder) {
+		    builder.write(graph_shadow_map, vkb::RenderGraphAccess::DepthStencilAttachmentWrite);
+	    },
+	    [this](vkb::core::CommandBufferC &command_buffer) {
+		    set_viewport_and_scissor(command_buffer, graph_shadow_render_target->get_extent());
+		    shadow_render_pipeline.draw(command_buffer, *graph_shadow_render_target, VK_SUBPASS_CONTENTS_INLINE);
+		    command_buffer.end_render_pass();
+	    });
+
+	render_graph->add_pass(
+	    "forward_pass", vkb::RenderGraphQueue::Graphics,
+	    [this](vkb::RenderGraph::PassBuilder &builder) {
+		    builder.read(graph_shadow_map, vkb::RenderGraphAccess::FragmentShaderSampled);
+		    builder.write(graph_hdr, vkb::RenderGraphAccess::ColorAttachmentWrite);
+		    builder.write(graph_depth, vkb::RenderGraphAccess::DepthStencilAttachmentWrite);
+	    },
+	    [this](vkb::core::CommandBufferC &command_buffer) {
+		    set_viewport_and_scissor(command_buffer, graph_forward_render_target->get_extent());
+		    forward_render_pipeline.draw(command_buffer, *graph_forward_render_target, VK_SUBPASS_CONTENTS_INLINE);
+		    command_buffer.end_render_pass();
+	    });
+
+	const auto add_blur_pass = [this](const std::string &name, vkb::PipelineLayout *pipeline_layout,
+	                                  vkb::RenderGraphImage dst, vkb::RenderGraphImage src) {
+		render_graph->add_pass(
+		    name, vkb::RenderGraphQueue::AsyncCompute,
+		    [dst, src](vkb::RenderGraph::PassBuilder &builder) {
+			    builder.read(src, vkb::RenderGraphAccess::ComputeShaderSampled);
+			    builder.write(dst, vkb::RenderGraphAccess::ComputeShaderStorageWrite);
+		    },
+		    [this, pipeline_layout, dst, src](vkb::core::CommandBufferC &command_buffer) {
+			    command_buffer.bind_pipeline_layout(*pipeline_layout);
+			    dispatch_blur_pass(command_buffer, render_graph->get_image_view(dst), render_graph->get_image_view(src));
+		    });
+	};
+
+	add_blur_pass("threshold", threshold_pipeline, graph_blur_chain[0], graph_hdr);
+	for (uint32_t index = 1; index < graph_blur_chain.size(); index++)
+	{
+		add_blur_pass(fmt::format("blur_down[{}]", index), blur_down_pipeline, graph_blur_chain[index], graph_blur_chain[index - 1]);
+	}
+	for (uint32_t index = static_cast<uint32_t>(graph_blur_chain.size() - 2); index >= 1; index--)
+	{
+		add_blur_pass(fmt::format("blur_up[{}]", index), blur_up_pipeline, graph_blur_chain[index], graph_blur_chain[index + 1]);
+	}
+
+	render_graph->add_pass(
+	    "composite", vkb::RenderGraphQueue::Graphics,
+	    [this](vkb::RenderGraph::PassBuilder &builder) {
+		    builder.read(graph_hdr, vkb::RenderGraphAccess::FragmentShaderSampled);
+		    builder.read(graph_blur_chain[1], vkb::RenderGraphAccess::FragmentShaderSampled);
+		    builder.write_backbuffer();
+	    },
+	    [this](vkb::core::CommandBufferC &command_buffer) {
+		    draw(command_buffer, get_render_context().get_active_frame().get_render_target());
+	    });
+
+	compile_render_graph();
+}
+
+void AsyncComputeSample::compile_render_graph()
+{
+	// The render targets refer to the transient images, which compile() recreates
+	get_device().wait_idle();
+	graph_shadow_render_target.reset();
+	graph_forward_render_target.reset();
+
+	render_graph->set_async_compute_enabled(async_enabled);
+	render_graph->compile();
+
+	std::vector<vkb::core::ImageView> shadow_views;
+	shadow_views.emplace_back(render_graph->get_image(graph_shadow_map), VK_IMAGE_VIEW_TYPE_2D);
+	graph_shadow_render_target = std::make_unique<vkb::RenderTarget>(std::move(shadow_views));
+
+	std::vector<vkb::core::ImageView> forward_views;
+	forward_views.emplace_back(render_graph->get_image(graph_hdr), VK_IMAGE_VIEW_TYPE_2D);
+	forward_views.emplace_back(render_graph->get_image(graph_depth), VK_IMAGE_VIEW_TYPE_2D);
+	graph_forward_render_target = std::make_unique<vkb::RenderTarget>(std::move(forward_views));
+}
+
 void AsyncComputeSample::update(float delta_time)
 {
 	// don't call the parent's update, because it's done differently here... but call the grandparent's update for fps logging
@@ -669,8 +857,29 @@ void AsyncComputeSample::update(float delta_time)
 	if (last_async_enabled != async_enabled)
 	{
 		setup_queues();
+
+		if (render_graph)
+		{
+			compile_render_graph();
+		}
 	}
 
+	if (use_render_graph && !render_graph)
+	{
+		prepare_render_graph();
+	}
+
+	if (last_use_render_graph != use_render_graph)
+	{
+		// Restart the average of the path we switch to, so that it does not include the frames of a previous run
+		LOGI("Average frame time: {:.2f} ms hand-written, {:.2f} ms render graph",
+		     frame_times[0].get_average() * 1000.0f, frame_times[1].get_average() * 1000.0f);
+		frame_times[use_render_graph] = {};
+		last_use_render_graph         = use_render_graph;
+	}
+	frame_times[use_render_graph].total += delta_time;
+	frame_times[use_render_graph].count++;
+
 	// We can potentially get more overlap if we double buffer the HDR render target.
 	// In this scenario, the next frame can run ahead a little further before it needs to block.
 	if (double_buffer_hdr_frames)
@@ -685,8 +894,16 @@ void AsyncComputeSample::update(float delta_time)
 	auto *forward_subpass   = static_cast<ShadowMapForwardSubpass *>(forward_render_pipeline.get_subpasses()[0].get());
 	auto *composite_subpass = static_cast<CompositeSubpass *>(get_render_pipeline().get_subpasses()[0].get());
 
-	forward_subpass->set_shadow_map(&shadow_render_target->get_views()[0], comparison_sampler.get());
-	composite_subpass->set_texture(&get_current_forward_render_target().get_views()[0], blur_chain_views[1].get(), linear_sampler.get());
+	if (use_render_graph)
+	{
+		forward_subpass->set_shadow_map(&render_graph->get_image_view(graph_shadow_map), comparison_sampler.get());
+		composite_subpass->set_texture(&render_graph->get_image_view(graph_hdr), &render_graph->get_image_view(graph_blur_chain[1]), linear_sampler.get());
+	}
+	else
+	{
+		forward_subpass->set_shadow_map(&shadow_render_target->get_views()[0], comparison_sampler.get());
+		composite_subpass->set_texture(&get_current_forward_render_target().get_views()[0], blur_chain_views[1].get(), linear_sampler.get());
+	}
 
 	float rotation_factor = std::chrono::duration<float>(std::chrono::system_clock::now() - start_time).count();
 
@@ -721,17 +938,29 @@ void AsyncComputeSample::update(float delta_time)
 	// Collect the performance data for the sample graphs
 	update_stats(delta_time);
 
-	// Setup render pipeline:
-	// - Shadow pass
-	// - HDR
-	// - Async compute post
-	// - Composite
-	render_shadow_pass();
-	VkSemaphore graphics_semaphore                   = render_forward_offscreen_pass(hdr_wait_semaphores[forward_render_target_index]);
-	hdr_wait_semaphores[forward_render_target_index] = VK_NULL_HANDLE;
-	VkSemaphore post_semaphore                       = render_compute_post(graphics_semaphore, compute_post_semaphore);
-	compute_post_semaphore                           = VK_NULL_HANDLE;
-	VkSemaphore present_semaphore                    = render_swapchain(post_semaphore);
+	VkSemaphore present_semaphore = VK_NULL_HANDLE;
+	if (use_render_graph)
+	{
+		present_semaphore = render_graph->execute();
+	}
+	else if (get_render_context().uses_timeline_synchronization())
+	{
+		present_semaphore = render_timeline();
+	}
+	else
+	{
+		// Setup render pipeline:
+		// - Shadow pass
+		// - HDR
+		// - Async compute post
+		// - Composite
+		render_shadow_pass();
+		VkSemaphore graphics_semaphore                   = render_forward_offscreen_pass(hdr_wait_semaphores[forward_render_target_index]);
+		hdr_wait_semaphores[forward_render_target_index] = VK_NULL_HANDLE;
+		VkSemaphore post_semaphore                       = render_compute_post(graphics_semaphore, compute_post_semaphore);
+		compute_post_semaphore                           = VK_NULL_HANDLE;
+		present_semaphore                                = render_swapchain(post_semaphore);
+	}
 
 	get_render_context().end_frame(present_semaphore);
 }
@@ -753,6 +982,10 @@ void AsyncComputeSample::finish()
 			get_device().wait_idle();
 			vkDestroySemaphore(get_device().get_handle(), compute_post_semaphore, nullptr);
 		}
+
+		graph_shadow_render_target.reset();
+		graph_forward_render_target.reset();
+		render_graph.reset();
 	}
 }
 
@@ -761,7 +994,7 @@ std::unique_ptr<vkb::VulkanSampleC> create_async_compute()
 	return std::make_unique<AsyncComputeSample>();
 }
 
-AsyncComputeSample::DepthMapSubpass::DepthMapSubpass(vkb::RenderContext &render_context,
+AsyncComputeSample::DepthMapSubpass::DepthMapSubpass(vkb::rendering::RenderContextC &render_context,
                                                      vkb::ShaderSource &&vertex_shader, vkb::ShaderSource &&fragment_shader,
                                                      vkb::sg::Scene &scene, vkb::sg::Camera &camera) :
     vkb::ForwardSubpass(render_context, std::move(vertex_shader), std::move(fragment_shader), scene, camera)
@@ -777,7 +1010,7 @@ void AsyncComputeSample::DepthMapSubpass::draw(vkb::core::CommandBufferC &comman
 	vkb::ForwardSubpass::draw(command_buffer);
 }
 
-AsyncComputeSample::ShadowMapForwardSubpass::ShadowMapForwardSubpass(vkb::RenderContext &render_context,
+AsyncComputeSample::ShadowMapForwardSubpass::ShadowMapForwardSubpass(vkb::rendering::RenderContextC &render_context,
                                                                      vkb::ShaderSource &&vertex_shader, vkb::ShaderSource &&fragment_shader,
                                                                      vkb::sg::Scene &scene, vkb::sg::Camera &camera, vkb::sg::Camera &shadow_camera_) :
     vkb::ForwardSubpass(render_context, std::move(vertex_shader), std::move(fragment_shader), scene, camera),
@@ -810,7 +1043,7 @@ void AsyncComputeSample::ShadowMapForwardSubpass::draw(vkb::core::CommandBufferC
 	vkb::ForwardSubpass::draw(command_buffer);
 }
 
-AsyncComputeSample::CompositeSubpass::CompositeSubpass(vkb::RenderContext &render_context, vkb::ShaderSource &&vertex_shader, vkb::ShaderSource &&fragment_shader) :
+AsyncComputeSample::CompositeSubpass::CompositeSubpass(vkb::rendering::RenderContextC &render_context, vkb::ShaderSource &&vertex_shader, vkb::ShaderSource &&fragment_shader) :
     vkb::rendering::SubpassC(render_context, std::move(vertex_shader), std::move(fragment_shader))
 {
 }
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "rendering/render_graph.h"
 #include "rendering/render_pipeline.h"
 #include "rendering/subpasses/forward_subpass.h"
 #include "scene_graph/components/camera.h"
@@ -49,11 +50,22 @@ class AsyncComputeSample : public vkb::VulkanSampleC
 
 	std::chrono::system_clock::time_point start_time;
 
-	void        render_shadow_pass();
-	VkSemaphore render_forward_offscreen_pass(VkSemaphore hdr_wait_semaphore);
-	VkSemaphore render_compute_post(VkSemaphore wait_graphics_semaphore, VkSemaphore wait_present_semaphore);
-	VkSemaphore render_swapchain(VkSemaphore post_semaphore);
-	void        setup_queues();
+	void                       render_shadow_pass();
+	VkSemaphore                render_forward_offscreen_pass(VkSemaphore hdr_wait_semaphore);
+	VkSemaphore                render_compute_post(VkSemaphore wait_graphics_semaphore, VkSemaphore wait_present_semaphore);
+	VkSemaphore                render_swapchain(VkSemaphore post_semaphore);
+	vkb::core::CommandBufferC &record_forward_offscreen_pass();
+	vkb::core::CommandBufferC &record_compute_post();
+	vkb::core::CommandBufferC &record_swapchain();
+	void                       setup_queues();
+
+	// With timeline synchronization, the passes wait for values of the queue timelines instead of semaphores
+	VkSemaphore render_timeline();
+	void        dispatch_blur_pass(vkb::core::CommandBufferC &command_buffer, const vkb::core::ImageView &dst, const vkb::core::ImageView &src);
+
+	// The same frame, declared as a render graph which derives the barriers, semaphores and ownership transfers above
+	void prepare_render_graph();
+	void compile_render_graph();
 
 	void                                               prepare_render_targets();
 	std::unique_ptr<vkb::RenderTarget>                 forward_render_targets[2];
@@ -64,6 +76,16 @@ class AsyncComputeSample : public vkb::VulkanSampleC
 	std::unique_ptr<vkb::core::Sampler>                linear_sampler;
 	std::vector<std::unique_ptr<vkb::core::Image>>     blur_chain;
 	std::vector<std::unique_ptr<vkb::core::ImageView>> blur_chain_views;
+	VkExtent3D                                         shadow_resolution{};
+
+	std::unique_ptr<vkb::RenderGraph>  render_graph;
+	vkb::RenderGraphImage              graph_shadow_map;
+	vkb::RenderGraphImage              graph_hdr;
+	vkb::RenderGraphImage              graph_depth;
+	std::vector<vkb::RenderGraphImage> graph_blur_chain;
+	VkDeviceSize                       hand_written_memory{0};
+	std::unique_ptr<vkb::RenderTarget> graph_shadow_render_target;
+	std::unique_ptr<vkb::RenderTarget> graph_forward_render_target;
 
 	vkb::PipelineLayout *threshold_pipeline{nullptr};
 	vkb::PipelineLayout *blur_down_pipeline{nullptr};
@@ -75,15 +97,32 @@ class AsyncComputeSample : public vkb::VulkanSampleC
 
 	VkSemaphore hdr_wait_semaphores[2]{};
 	VkSemaphore compute_post_semaphore{};
+	uint64_t    hdr_read_values[2]{};
+	uint64_t    compute_post_read_value{0};
 	bool        async_enabled{false};
 	bool        rotate_shadows{true};
 	bool        last_async_enabled{false};
 	bool        double_buffer_hdr_frames{false};
+	bool        use_render_graph{false};
+	bool        last_use_render_graph{false};
+	bool        synchronization2_supported{false};
 	unsigned    forward_render_target_index{};
 
+	// Frame times of the hand-written path and of the render graph path
+	struct FrameTimes
+	{
+		float    total{0.0f};
+		uint32_t count{0};
+
+		float get_average() const
+		{
+			return count > 0 ? total / static_cast<float>(count) : 0.0f;
+		}
+	} frame_times[2];
+
 	struct DepthMapSubpass : vkb::ForwardSubpass
 	{
-		DepthMapSubpass(vkb::RenderContext &render_context,
+		DepthMapSubpass(vkb::rendering::RenderContextC &render_context,
 		                vkb::ShaderSource &&vertex_shader, vkb::ShaderSource &&fragment_shader,
 		                vkb::sg::Scene &scene, vkb::sg::Camera &camera);
 		virtual void draw(vkb::core::CommandBufferC &command_buffer) override;
@@ -91,7 +130,7 @@ class AsyncComputeSample : public vkb::VulkanSampleC
 
 	struct ShadowMapForwardSubpass : vkb::ForwardSubpass
 	{
-		ShadowMapForwardSubpass(vkb::RenderContext &render_context,
+		ShadowMapForwardSubpass(vkb::rendering::RenderContextC &render_context,
 		                        vkb::ShaderSource &&vertex_shader, vkb::ShaderSource &&fragment_shader,
 		                        vkb::sg::Scene &scene, vkb::sg::Camera &camera, vkb::sg::Camera &shadow_camera);
 		void         set_shadow_map(const vkb::core::ImageView *view, const vkb::core::Sampler *sampler);
@@ -104,7 +143,7 @@ class AsyncComputeSample : public vkb::VulkanSampleC
 
 	struct CompositeSubpass : vkb::rendering::SubpassC
 	{
-		CompositeSubpass(vkb::RenderContext &render_context,
+		CompositeSubpass(vkb::rendering::RenderContextC &render_context,
 		                 vkb::ShaderSource &&vertex_shader, vkb::ShaderSource &&fragment_shader);
 		void         set_texture(const vkb::core::ImageView *hdr_view, const vkb::core::ImageView *bloom_view,
 		                         const vkb::core::Sampler *sampler);
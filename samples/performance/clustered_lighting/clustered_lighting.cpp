@@ -0,0 +1,174 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "clustered_lighting.h"
+
+#include "common/vk_common.h"
+#include "gltf_loader.h"
+#include "gui.h"
+#include "rendering/light_clusters.h"
+#include "scene_graph/components/light.h"
+#include "scene_graph/components/mesh.h"
+#include "scene_graph/node.h"
+#include "stats/stats.h"
+
+#include <array>
+#include <random>
+
+namespace
+{
+/// Number of point lights shaded for each step of the benchmark
+constexpr std::array<uint32_t, 5> light_counts = {8, 64, 512, 2048, 4096};
+}        // namespace
+
+ClusteredLighting::ClusteredLighting()
+{
+	auto &config = get_configuration();
+
+	// Step through every light count, first with CPU culling and then with GPU culling
+	for (size_t i = 0; i < light_counts.size(); ++i)
+	{
+		config.insert<vkb::IntSetting>(to_u32(i), light_count_index, static_cast<int>(i));
+		config.insert<vkb::IntSetting>(to_u32(i), gpu_culling, 0);
+		config.insert<vkb::IntSetting>(to_u32(i + light_counts.size()), light_count_index, static_cast<int>(i));
+		config.insert<vkb::IntSetting>(to_u32(i + light_counts.size()), gpu_culling, 1);
+	}
+}
+
+bool ClusteredLighting::prepare(const vkb::ApplicationOptions &options)
+{
+	if (!VulkanSample::prepare(options))
+	{
+		return false;
+	}
+
+	load_scene("scenes/sponza/Sponza01.gltf");
+
+	auto &camera_node = vkb::add_free_camera(get_scene(), "main_camera", get_render_context().get_surface_extent());
+	camera            = &camera_node.get_component<vkb::sg::Camera>();
+
+	// Scatter the lights inside the bounds of the scene, with a fixed seed so that runs are comparable
+	vkb::sg::AABB scene_bounds;
+	for (auto mesh : get_scene().get_components<vkb::sg::Mesh>())
+	{
+		for (auto node : mesh->get_nodes())
+		{
+			vkb::sg::AABB mesh_bounds{mesh->get_bounds().get_min(), mesh->get_bounds().get_max()};
+			auto          world_matrix = node->get_transform().get_world_matrix();
+			mesh_bounds.transform(world_matrix);
+			scene_bounds.update(mesh_bounds.get_min());
+			scene_bounds.update(mesh_bounds.get_max());
+		}
+	}
+
+	std::mt19937                          generator{42};
+	std::uniform_real_distribution<float> unit_distribution{0.0f, 1.0f};
+
+	float light_range = glm::length(scene_bounds.get_scale()) * 0.05f;
+	for (auto light_count : light_counts)
+	{
+		while (point_lights.size() < light_count)
+		{
+			glm::vec3 position = scene_bounds.get_min() + scene_bounds.get_scale() * glm::vec3(unit_distribution(generator), unit_distribution(generator), unit_distribution(generator));
+
+			vkb::sg::LightProperties properties;
+			properties.color     = glm::vec3(unit_distribution(generator), unit_distribution(generator), unit_distribution(generator));
+			properties.intensity = 0.5f;
+			properties.range     = light_range;
+
+			point_lights.push_back(&vkb::add_point_light(get_scene(), position, properties));
+		}
+	}
+
+	vkb::ShaderSource vert_shader("base.vert");
+	vkb::ShaderSource frag_shader("base.frag");
+	auto              scene_subpass = std::make_unique<vkb::ForwardSubpass>(get_render_context(), std::move(vert_shader), std::move(frag_shader), get_scene(), *camera);
+	scene_subpass->enable_clustered_lighting();
+
+	forward_subpass = scene_subpass.get();
+
+	auto render_pipeline = std::make_unique<vkb::RenderPipeline>();
+	render_pipeline->add_subpass(std::move(scene_subpass));
+	set_render_pipeline(std::move(render_pipeline));
+
+	get_stats().request_stats({vkb::StatIndex::frame_times});
+
+	create_gui(*window, &get_stats());
+
+	return true;
+}
+
+void ClusteredLighting::update(float delta_time)
+{
+	if (light_count_index != last_light_count_index)
+	{
+		select_lights();
+		last_light_count_index = light_count_index;
+	}
+
+	forward_subpass->get_light_clusters()->set_culling_mode(gpu_culling ? vkb::LightCullingMode::GPU : vkb::LightCullingMode::CPU);
+
+	VulkanSample::update(delta_time);
+}
+
+void ClusteredLighting::draw(vkb::core::CommandBufferC &command_buffer, vkb::RenderTarget &render_target)
+{
+	// GPU culling has to be recorded before the render pass begins, the subpass updates the clusters itself with CPU culling
+	auto &light_clusters = *forward_subpass->get_light_clusters();
+	if (light_clusters.get_culling_mode() == vkb::LightCullingMode::GPU)
+	{
+		light_clusters.update(get_scene().get_components<vkb::sg::Light>(), *camera, render_target.get_extent());
+		light_clusters.record_culling(command_buffer);
+	}
+
+	VulkanSample::draw(command_buffer, render_target);
+}
+
+void ClusteredLighting::select_lights()
+{
+	light_count_index = std::clamp(light_count_index, 0, static_cast<int>(light_counts.size() - 1));
+
+	forward_subpass->get_light_clusters()->set_lights({point_lights.begin(), point_lights.begin() + light_counts[light_count_index]});
+}
+
+void ClusteredLighting::draw_gui()
+{
+	auto &light_clusters = *forward_subpass->get_light_clusters();
+
+	get_gui().show_options_window(
+	    /* body = */ [&]() {
+		    ImGui::SliderInt("##lightCount", &light_count_index, 0, static_cast<int>(light_counts.size() - 1), fmt::format("Lights: {}", light_counts[light_count_index]).c_str());
+		    ImGui::SameLine();
+		    ImGui::RadioButton("CPU", &gpu_culling, 0);
+		    ImGui::SameLine();
+		    ImGui::RadioButton("GPU", &gpu_culling, 1);
+		    if (light_clusters.get_culling_mode() == vkb::LightCullingMode::CPU)
+		    {
+			    ImGui::Text("Culling: %.2f ms, %.1f lights per cluster", light_clusters.get_cpu_culling_time(), light_clusters.get_average_lights_per_cluster());
+		    }
+		    else
+		    {
+			    ImGui::Text("Culling on the GPU");
+		    }
+	    },
+	    /* lines = */ 2);
+}
+
+std::unique_ptr<vkb::VulkanSampleC> create_clustered_lighting()
+{
+	return std::make_unique<ClusteredLighting>();
+}
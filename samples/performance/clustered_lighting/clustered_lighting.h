@@ -0,0 +1,60 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rendering/render_pipeline.h"
+#include "rendering/subpasses/forward_subpass.h"
+#include "scene_graph/components/camera.h"
+#include "vulkan_sample.h"
+
+/**
+ * @brief Scaling the number of point lights shaded by a forward renderer with clustered light culling
+ */
+class ClusteredLighting : public vkb::VulkanSampleC
+{
+  public:
+	ClusteredLighting();
+
+	virtual ~ClusteredLighting() = default;
+
+	virtual bool prepare(const vkb::ApplicationOptions &options) override;
+
+	virtual void update(float delta_time) override;
+
+	virtual void draw(vkb::core::CommandBufferC &command_buffer, vkb::RenderTarget &render_target) override;
+
+  private:
+	virtual void draw_gui() override;
+
+	void select_lights();
+
+	vkb::sg::Camera *camera{nullptr};
+
+	vkb::ForwardSubpass *forward_subpass{nullptr};
+
+	std::vector<vkb::sg::Light *> point_lights;
+
+	/// Index into the light counts the benchmark steps through
+	int light_count_index{0};
+
+	int gpu_culling{0};
+
+	int last_light_count_index{-1};
+};
+
+std::unique_ptr<vkb::VulkanSampleC> create_clustered_lighting();
@@ -66,7 +66,7 @@ class CommandBufferUsage : public vkb::VulkanSampleC
 	class ForwardSubpassSecondary : public vkb::ForwardSubpass
 	{
 	  public:
-		ForwardSubpassSecondary(vkb::RenderContext &render_context,
+		ForwardSubpassSecondary(vkb::rendering::RenderContextC &render_context,
 		                        vkb::ShaderSource &&vertex_source, vkb::ShaderSource &&fragment_source,
 		                        vkb::sg::Scene &scene, vkb::sg::Camera &camera);
 
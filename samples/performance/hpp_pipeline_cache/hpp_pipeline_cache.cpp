@@ -18,7 +18,7 @@
 #include "hpp_pipeline_cache.h"
 
 #include "common/hpp_utils.h"
-#include "hpp_gui.h"
+#include "gui.h"
 #include "rendering/subpasses/hpp_forward_subpass.h"
 
 HPPPipelineCache::HPPPipelineCache()
@@ -75,7 +75,7 @@ bool HPPPipelineCache::prepare(const vkb::ApplicationOptions &options)
 	/* Create Vulkan pipeline cache */
 	pipeline_cache = get_device().get_handle().createPipelineCache(pipeline_cache_create_info);
 
-	vkb::HPPResourceCache &resource_cache = get_device().get_resource_cache();
+	vkb::ResourceCacheCpp &resource_cache = get_device().get_resource_cache();
 
 	/* Use pipeline cache to store pipelines */
 	resource_cache.set_pipeline_cache(pipeline_cache);
@@ -40,6 +40,9 @@ ImageCompressionControlSample::ImageCompressionControlSample()
 	config.insert<vkb::IntSetting>(0, static_cast<int>(gui_target_compression), 0);
 	config.insert<vkb::IntSetting>(1, static_cast<int>(gui_target_compression), 1);
 	config.insert<vkb::IntSetting>(2, static_cast<int>(gui_target_compression), 2);
+	config.insert<vkb::BoolSetting>(0, gui_use_render_graph, false);
+	config.insert<vkb::BoolSetting>(1, gui_use_render_graph, true);
+	config.insert<vkb::BoolSetting>(2, gui_use_render_graph, false);
 }
 
 void ImageCompressionControlSample::request_gpu_features(vkb::PhysicalDevice &gpu)
@@ -88,10 +91,13 @@ bool ImageCompressionControlSample::prepare(const vkb::ApplicationOptions &optio
 	vkb::ShaderSource postprocessing_vs("postprocessing/postprocessing.vert");
 	postprocessing_pipeline = std::make_unique<vkb::PostProcessingPipeline>(get_render_context(), std::move(postprocessing_vs));
 	postprocessing_pipeline->add_pass().add_subpass(vkb::ShaderSource("postprocessing/chromatic_aberration.frag"));
+	postprocessing_pipeline->get_pass(0).get_subpass(0).bind_sampled_image("color_sampler", static_cast<int>(Attachments::Color));
 
 	// Trigger recreation of Swapchain and render targets, with initial compression parameters
 	update_render_targets();
 
+	prepare_render_graph();
+
 	get_stats().request_stats({vkb::StatIndex::frame_times,
 	                           vkb::StatIndex::gpu_ext_write_bytes});
 
@@ -354,10 +360,70 @@ std::unique_ptr<vkb::RenderTarget> ImageCompressionControlSample::create_render_
 	return std::make_unique<vkb::RenderTarget>(std::move(images));
 }
 
+void ImageCompressionControlSample::prepare_render_graph()
+{
+	render_graph = std::make_unique<vkb::RenderGraph>(get_render_context());
+
+	// The color attachment is the only image both passes access, the swapchain and depth images are transitioned by VulkanSample::draw(),
+	// which leaves the color attachment in COLOR_ATTACHMENT_OPTIMAL. Its view changes every frame, see render().
+	auto &render_target = get_render_context().get_render_frames()[0]->get_render_target();
+	graph_color         = render_graph->import_image("color", render_target.get_views()[static_cast<int>(Attachments::Color)],
+	                                                 VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_UNDEFINED);
+
+	render_graph->add_pass(
+	    "scene", vkb::RenderGraphQueue::Graphics,
+	    [this](vkb::RenderGraph::PassBuilder &builder) {
+		    builder.write(graph_color, vkb::RenderGraphAccess::ColorAttachmentWrite);
+	    },
+	    [this](vkb::core::CommandBufferC &command_buffer) {
+		    VulkanSample::render(command_buffer);
+		    command_buffer.end_render_pass();
+	    });
+
+	// The postprocessing pass declares the accesses the pipeline leaves to the graph
+	set_render_graph_enabled(true);
+
+	render_graph->add_pass(
+	    "postprocessing", vkb::RenderGraphQueue::Graphics,
+	    [this](vkb::RenderGraph::PassBuilder &builder) {
+		    postprocessing_pipeline->declare_pass(*render_graph, builder, 0);
+		    builder.write_backbuffer();
+	    },
+	    [this](vkb::core::CommandBufferC &command_buffer) {
+		    draw_postprocessing(command_buffer);
+	    });
+
+	render_graph->compile();
+
+	set_render_graph_enabled(gui_use_render_graph);
+}
+
+void ImageCompressionControlSample::set_render_graph_enabled(bool enabled)
+{
+	if (enabled)
+	{
+		// The pipeline only leaves the color attachment of the frame's render target, the default one, to the graph
+		postprocessing_pipeline->set_render_graph_images([this](const vkb::RenderTarget *render_target, uint32_t attachment) {
+			return render_target == nullptr && attachment == static_cast<uint32_t>(Attachments::Color) ? graph_color : vkb::RenderGraphImage{};
+		});
+	}
+	else
+	{
+		postprocessing_pipeline->set_render_graph_images({});
+	}
+}
+
 void ImageCompressionControlSample::update(float delta_time)
 {
 	elapsed_time += delta_time;
 
+	if (gui_use_render_graph != last_gui_use_render_graph)
+	{
+		set_render_graph_enabled(gui_use_render_graph);
+
+		last_gui_use_render_graph = gui_use_render_graph;
+	}
+
 	if ((gui_target_compression != last_gui_target_compression) ||
 	    (gui_fixed_rate_compression_level != last_gui_fixed_rate_compression_level))
 	{
@@ -442,11 +508,24 @@ VkImageCompressionFixedRateFlagBitsEXT ImageCompressionControlSample::select_fix
 
 void ImageCompressionControlSample::render(vkb::core::CommandBufferC &command_buffer)
 {
+	if (gui_use_render_graph)
+	{
+		// Same passes as below, with the barrier between them derived by the render graph
+		render_graph->set_imported_image(graph_color, get_render_context().get_active_frame().get_render_target().get_views()[static_cast<int>(Attachments::Color)]);
+		render_graph->record(command_buffer);
+		return;
+	}
+
 	// Scene (forward rendering) pass
 	VulkanSample::render(command_buffer);
 
 	command_buffer.end_render_pass();
 
+	draw_postprocessing(command_buffer);
+}
+
+void ImageCompressionControlSample::draw_postprocessing(vkb::core::CommandBufferC &command_buffer)
+{
 	/**
 	 * Post processing pass, which applies a simple chromatic aberration effect.
 	 * The effect is animated, using elapsed time, for two reasons:
@@ -458,9 +537,6 @@ void ImageCompressionControlSample::render(vkb::core::CommandBufferC &command_bu
 	auto &postprocessing_pass = postprocessing_pipeline->get_pass(0);
 	postprocessing_pass.set_uniform_data(sin(elapsed_time));
 
-	auto &postprocessing_subpass = postprocessing_pass.get_subpass(0);
-	postprocessing_subpass.bind_sampled_image("color_sampler", static_cast<int>(Attachments::Color));
-
 	postprocessing_pipeline->draw(command_buffer, get_render_context().get_active_frame().get_render_target());
 }
 
@@ -511,7 +587,7 @@ inline T generate_combo(T current_value, const char *combo_label, const std::uno
 void ImageCompressionControlSample::draw_gui()
 {
 	const bool landscape = camera->get_aspect_ratio() > 1.0f;
-	uint32_t   lines     = 3;
+	uint32_t   lines     = 4;
 
 	if (landscape)
 	{
@@ -574,6 +650,8 @@ void ImageCompressionControlSample::draw_gui()
 		     * Display the memory footprint of the configurable targets, which will be lower if fixed-rate compression is selected.
 		     */
 		    ImGui::Text("Color attachment (%.1f MB), Swapchain (%.1f MB)", footprint_color, footprint_swapchain);
+
+		    ImGui::Checkbox("Render graph", &gui_use_render_graph);
 	    },
 	    lines);
 }
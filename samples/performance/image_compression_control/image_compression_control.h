@@ -18,6 +18,7 @@
 #pragma once
 
 #include "rendering/postprocessing_pipeline.h"
+#include "rendering/render_graph.h"
 #include "rendering/render_pipeline.h"
 #include "scene_graph/components/camera.h"
 #include "scene_graph/components/perspective_camera.h"
@@ -75,6 +76,27 @@ class ImageCompressionControlSample : public vkb::VulkanSampleC
 	 */
 	std::unique_ptr<vkb::PostProcessingPipeline> postprocessing_pipeline{};
 
+	/**
+	 * @brief Records the postprocessing pass, applying the animated effect
+	 */
+	void draw_postprocessing(vkb::core::CommandBufferC &command_buffer);
+
+	/**
+	 * @brief Render graph
+	 * Optionally, the scene and postprocessing passes are declared to a render graph, which
+	 * derives the barrier on the color attachment between them instead of the postprocessing pipeline.
+	 */
+	std::unique_ptr<vkb::RenderGraph> render_graph{};
+
+	vkb::RenderGraphImage graph_color{};
+
+	void prepare_render_graph();
+
+	/**
+	 * @brief Hands the synchronization of the color attachment over to the render graph, or back to the postprocessing pipeline
+	 */
+	void set_render_graph_enabled(bool enabled);
+
 	/**
 	 * @brief Load/store operations of the forward rendering pass attachments
 	 * Used to specify that the color output must be stored to main memory.
@@ -184,6 +206,10 @@ class ImageCompressionControlSample : public vkb::VulkanSampleC
 	FixedRateCompressionLevel gui_fixed_rate_compression_level{FixedRateCompressionLevel::High};
 
 	FixedRateCompressionLevel last_gui_fixed_rate_compression_level{gui_fixed_rate_compression_level};
+
+	bool gui_use_render_graph{false};
+
+	bool last_gui_use_render_graph{gui_use_render_graph};
 };
 
 std::unique_ptr<vkb::VulkanSampleC> create_image_compression_control();
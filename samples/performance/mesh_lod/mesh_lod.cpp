@@ -0,0 +1,195 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "mesh_lod.h"
+
+#include "common/vk_common.h"
+#include "gui.h"
+#include "memory_budget_tracker.h"
+#include "stats/stats.h"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+/// Projected errors in pixels up to which coarser levels of detail are drawn, 0 draws every sub mesh in full
+constexpr std::array<float, 5> lod_thresholds = {0.0f, 0.5f, 1.0f, 2.0f, 4.0f};
+
+/// Fraction of the triangles kept by every level of detail
+const std::vector<float> lod_ratios = {0.5f, 0.25f, 0.125f, 0.0625f};
+
+/// Device memory the streamed textures can take
+constexpr VkDeviceSize texture_memory_budget = 256 * 1024 * 1024;
+
+/// Size of the buffers taking device memory away from the streamed textures
+constexpr VkDeviceSize memory_ballast_buffer_size = 64 * 1024 * 1024;
+}        // namespace
+
+MeshLod::MeshLod()
+{
+	auto &config = get_configuration();
+
+	// Step through every threshold, starting without levels of detail
+	for (size_t i = 0; i < lod_thresholds.size(); ++i)
+	{
+		config.insert<vkb::IntSetting>(to_u32(i), threshold_index, static_cast<int>(i));
+	}
+
+	// Distant sub meshes do not need the finest levels of their textures either
+	set_texture_streaming(texture_memory_budget);
+}
+
+MeshLod::~MeshLod()
+{
+	log_threshold_stats();
+	memory_ballast.clear();
+}
+
+bool MeshLod::prepare(const vkb::ApplicationOptions &options)
+{
+	set_lods(lod_ratios);
+
+	// Levels of detail are simplified from the optimized triangles, and share their interleaved vertex buffer
+	set_mesh_optimization(true);
+
+	if (!VulkanSample::prepare(options))
+	{
+		return false;
+	}
+
+	load_scene("scenes/bonza/Bonza4X.gltf");
+
+	auto &camera_node = vkb::add_free_camera(get_scene(), "main_camera", get_render_context().get_surface_extent());
+	camera            = &camera_node.get_component<vkb::sg::Camera>();
+
+	vkb::ShaderSource vert_shader("base.vert");
+	vkb::ShaderSource frag_shader("base.frag");
+	auto              scene_subpass = std::make_unique<vkb::ForwardSubpass>(get_render_context(), std::move(vert_shader), std::move(frag_shader), get_scene(), *camera);
+
+	forward_subpass = scene_subpass.get();
+
+	auto render_pipeline = std::make_unique<vkb::RenderPipeline>();
+	render_pipeline->add_subpass(std::move(scene_subpass));
+	set_render_pipeline(std::move(render_pipeline));
+
+	get_stats().request_stats({vkb::StatIndex::frame_times});
+
+	create_gui(*window, &get_stats());
+
+	return true;
+}
+
+void MeshLod::update(float delta_time)
+{
+	threshold_index = std::clamp(threshold_index, 0, static_cast<int>(lod_thresholds.size() - 1));
+
+	if (threshold_index != last_threshold_index)
+	{
+		log_threshold_stats();
+
+		forward_subpass->set_lod_threshold(lod_thresholds[threshold_index]);
+		last_threshold_index = threshold_index;
+		frame_count          = 0;
+		total_triangle_count = 0;
+		total_frame_time     = 0.0;
+	}
+	else
+	{
+		// The triangles of the previous frame, recorded with the same threshold
+		frame_count++;
+		total_triangle_count += forward_subpass->get_submitted_triangle_count();
+		total_frame_time += delta_time;
+	}
+
+	update_memory_ballast();
+
+	VulkanSample::update(delta_time);
+}
+
+void MeshLod::log_threshold_stats()
+{
+	if (frame_count == 0 || last_threshold_index < 0)
+	{
+		return;
+	}
+
+	LOGI("LOD threshold {:.1f} px: {} triangles and {:.3f} ms per frame over {} frames",
+	     lod_thresholds[last_threshold_index],
+	     total_triangle_count / frame_count,
+	     total_frame_time * 1000.0 / frame_count,
+	     frame_count);
+}
+
+void MeshLod::update_memory_ballast()
+{
+	if (!memory_ballast_enabled)
+	{
+		memory_ballast.clear();
+		return;
+	}
+
+	if (!memory_ballast.empty())
+	{
+		return;
+	}
+
+	// Stops short of critical pressure, the streamer defers its uploads while the pressure is high
+	try
+	{
+		while (vkb::MemoryBudgetTracker::get().can_allocate(memory_ballast_buffer_size))
+		{
+			memory_ballast.push_back(std::make_unique<vkb::core::BufferC>(get_device(),
+			                                                              memory_ballast_buffer_size,
+			                                                              VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+			                                                              VMA_MEMORY_USAGE_GPU_ONLY));
+		}
+	}
+	catch (const vkb::VulkanException &exception)
+	{
+		LOGE("Memory ballast ran out of memory before the budget was reached: {}", exception.what());
+	}
+
+	LOGI("Memory ballast allocated {} buffers of {} MB", memory_ballast.size(), memory_ballast_buffer_size / (1024 * 1024));
+}
+
+void MeshLod::draw_gui()
+{
+	get_gui().show_options_window(
+	    /* body = */ [&]() {
+		    float threshold = lod_thresholds[threshold_index];
+		    ImGui::SliderInt("##lodThreshold", &threshold_index, 0, static_cast<int>(lod_thresholds.size() - 1),
+		                     threshold > 0.0f ? fmt::format("LOD threshold: {:.1f} px", threshold).c_str() : "LOD off");
+		    ImGui::Text("Triangles: %llu", static_cast<unsigned long long>(forward_subpass->get_submitted_triangle_count()));
+		    if (auto *texture_streamer = get_texture_streamer())
+		    {
+			    ImGui::Text("Textures: %.1f / %.1f MB, %zu refining", texture_streamer->get_resident_size() / (1024.0f * 1024.0f),
+			                texture_streamer->get_memory_budget() / (1024.0f * 1024.0f), texture_streamer->get_pending_count());
+		    }
+		    const char *pressure_names[] = {"none", "high", "critical"};
+		    ImGui::Checkbox("Memory ballast", &memory_ballast_enabled);
+		    ImGui::SameLine();
+		    ImGui::Text("Pressure: %s", pressure_names[static_cast<int>(vkb::MemoryBudgetTracker::get().get_pressure())]);
+	    },
+	    /* lines = */ 4);
+}
+
+std::unique_ptr<vkb::VulkanSampleC> create_mesh_lod()
+{
+	return std::make_unique<MeshLod>();
+}
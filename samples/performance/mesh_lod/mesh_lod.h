@@ -0,0 +1,77 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "core/buffer.h"
+#include "rendering/render_pipeline.h"
+#include "rendering/subpasses/forward_subpass.h"
+#include "scene_graph/components/camera.h"
+#include "vulkan_sample.h"
+
+/**
+ * @brief Drawing a large outdoor scene, optimized for the vertex cache, with levels of detail selected from their
+ *        projected geometric error, and its textures streamed up to the level of detail their fragments need
+ */
+class MeshLod : public vkb::VulkanSampleC
+{
+  public:
+	MeshLod();
+
+	virtual ~MeshLod();
+
+	virtual bool prepare(const vkb::ApplicationOptions &options) override;
+
+	virtual void update(float delta_time) override;
+
+  private:
+	virtual void draw_gui() override;
+
+	/**
+	 * @brief Logs the mean triangles submitted and frame time since the threshold was selected
+	 */
+	void log_threshold_stats();
+
+	/**
+	 * @brief Allocates device local buffers as long as the memory budget tracker allows it, so that the texture
+	 *        streamer runs under memory pressure, or releases them
+	 */
+	void update_memory_ballast();
+
+	vkb::sg::Camera *camera{nullptr};
+
+	vkb::ForwardSubpass *forward_subpass{nullptr};
+
+	/// Index into the thresholds the benchmark steps through
+	int threshold_index{0};
+
+	int last_threshold_index{-1};
+
+	uint64_t frame_count{0};
+
+	uint64_t total_triangle_count{0};
+
+	/// Sum of the frame times since the threshold was selected, in seconds
+	double total_frame_time{0.0};
+
+	bool memory_ballast_enabled{false};
+
+	std::vector<std::unique_ptr<vkb::core::BufferC>> memory_ballast;
+};
+
+std::unique_ptr<vkb::VulkanSampleC> create_mesh_lod();
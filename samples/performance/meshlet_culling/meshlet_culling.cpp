@@ -0,0 +1,136 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "meshlet_culling.h"
+
+#include "common/vk_common.h"
+#include "gui.h"
+#include "rendering/subpasses/forward_subpass.h"
+#include "stats/stats.h"
+
+MeshletCulling::MeshletCulling()
+{
+	// Task and mesh shaders are compiled for SPIR-V 1.4
+	set_api_version(VK_API_VERSION_1_2);
+	set_meshlets(true);
+
+	auto &config = get_configuration();
+
+	config.insert<vkb::BoolSetting>(0, use_meshlets, false);
+	config.insert<vkb::BoolSetting>(1, use_meshlets, true);
+}
+
+bool MeshletCulling::prepare(const vkb::ApplicationOptions &options)
+{
+	if (!VulkanSample::prepare(options))
+	{
+		return false;
+	}
+
+	load_scene("scenes/bonza/Bonza4X.gltf");
+
+	auto &camera_node = vkb::add_free_camera(get_scene(), "main_camera", get_render_context().get_surface_extent());
+	camera            = &camera_node.get_component<vkb::sg::Camera>();
+
+	create_render_pipeline();
+
+	get_stats().request_stats({vkb::StatIndex::frame_times});
+
+	create_gui(*window, &get_stats());
+
+	return true;
+}
+
+void MeshletCulling::update(float delta_time)
+{
+	if (use_meshlets != last_use_meshlets)
+	{
+		get_device().wait_idle();
+
+		create_render_pipeline();
+	}
+
+	VulkanSample::update(delta_time);
+}
+
+void MeshletCulling::create_render_pipeline()
+{
+	vkb::ShaderSource vert_shader("base.vert");
+	vkb::ShaderSource frag_shader("base.frag");
+
+	auto render_pipeline = std::make_unique<vkb::RenderPipeline>();
+
+	if (use_meshlets)
+	{
+		auto scene_subpass = std::make_unique<vkb::MeshletSubpass>(get_render_context(), std::move(vert_shader), std::move(frag_shader), get_scene(), *camera);
+		meshlet_subpass    = scene_subpass.get();
+		render_pipeline->add_subpass(std::move(scene_subpass));
+	}
+	else
+	{
+		meshlet_subpass = nullptr;
+		render_pipeline->add_subpass(std::make_unique<vkb::ForwardSubpass>(get_render_context(), std::move(vert_shader), std::move(frag_shader), get_scene(), *camera));
+	}
+
+	set_render_pipeline(std::move(render_pipeline));
+
+	last_use_meshlets = use_meshlets;
+}
+
+void MeshletCulling::draw_gui()
+{
+	get_gui().show_options_window(
+	    /* body = */ [this]() {
+		    if (get_device().is_enabled(VK_EXT_MESH_SHADER_EXTENSION_NAME))
+		    {
+			    ImGui::Checkbox("Cull and draw meshlets", &use_meshlets);
+		    }
+		    else
+		    {
+			    ImGui::Text("VK_EXT_mesh_shader not supported, drawing through the vertex shader");
+		    }
+
+		    const auto &build_stats = get_meshlet_build_stats();
+		    if (build_stats.built_meshlet_count > 0)
+		    {
+			    ImGui::Text("Built %zu meshlets in %.1f ms (%.1f M triangles/s)", build_stats.built_meshlet_count,
+			                build_stats.build_time * 1000.0, build_stats.get_triangles_per_second() / 1000000.0);
+		    }
+		    else
+		    {
+			    ImGui::Text("Loaded %zu meshlets from the cache", build_stats.cached_meshlet_count);
+		    }
+
+		    const vkb::MeshletCullingStats culling_stats = meshlet_subpass ? meshlet_subpass->get_culling_stats() : vkb::MeshletCullingStats{};
+		    if (culling_stats.meshlets > 0)
+		    {
+			    ImGui::Text("Culled: %.1f%% of the meshlets, %.1f%% of the triangles",
+			                100.0 * (culling_stats.meshlets - culling_stats.visible_meshlets) / culling_stats.meshlets,
+			                100.0 * (culling_stats.triangles - culling_stats.visible_triangles) / culling_stats.triangles);
+		    }
+		    else
+		    {
+			    ImGui::Text("Culled: -");
+		    }
+	    },
+	    /* lines = */ 3);
+}
+
+std::unique_ptr<vkb::VulkanSampleC> create_meshlet_culling()
+{
+	return std::make_unique<MeshletCulling>();
+}
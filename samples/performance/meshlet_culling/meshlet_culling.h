@@ -0,0 +1,56 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rendering/render_pipeline.h"
+#include "rendering/subpasses/meshlet_subpass.h"
+#include "scene_graph/components/camera.h"
+#include "vulkan_sample.h"
+
+/**
+ * @brief Drawing a scene split into meshlets, culled against the view frustum and their normal cones by a task shader
+ *        and drawn by mesh shaders, or drawn through the vertex shader for comparison
+ */
+class MeshletCulling : public vkb::VulkanSampleC
+{
+  public:
+	MeshletCulling();
+
+	virtual bool prepare(const vkb::ApplicationOptions &options) override;
+
+	virtual void update(float delta_time) override;
+
+  private:
+	virtual void draw_gui() override;
+
+	/**
+	 * @brief Replaces the render pipeline with a subpass drawing meshlets, or a forward subpass drawing every triangle
+	 */
+	void create_render_pipeline();
+
+	vkb::sg::Camera *camera{nullptr};
+
+	/// The subpass of the render pipeline, if it draws meshlets
+	vkb::MeshletSubpass *meshlet_subpass{nullptr};
+
+	bool use_meshlets{true};
+
+	bool last_use_meshlets{true};
+};
+
+std::unique_ptr<vkb::VulkanSampleC> create_meshlet_culling();
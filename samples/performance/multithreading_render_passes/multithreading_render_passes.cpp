@@ -452,7 +452,7 @@ void MultithreadingRenderPasses::draw_main_pass(vkb::core::CommandBufferC &comma
 	}
 }
 
-MultithreadingRenderPasses::MainSubpass::MainSubpass(vkb::RenderContext                              &render_context,
+MultithreadingRenderPasses::MainSubpass::MainSubpass(vkb::rendering::RenderContextC                              &render_context,
                                                      vkb::ShaderSource                              &&vertex_source,
                                                      vkb::ShaderSource                              &&fragment_source,
                                                      vkb::sg::Scene                                  &scene,
@@ -509,7 +509,7 @@ void MultithreadingRenderPasses::MainSubpass::draw(vkb::core::CommandBufferC &co
 	ForwardSubpass::draw(command_buffer);
 }
 
-MultithreadingRenderPasses::ShadowSubpass::ShadowSubpass(vkb::RenderContext &render_context,
+MultithreadingRenderPasses::ShadowSubpass::ShadowSubpass(vkb::rendering::RenderContextC &render_context,
                                                          vkb::ShaderSource &&vertex_source,
                                                          vkb::ShaderSource &&fragment_source,
                                                          vkb::sg::Scene     &scene,
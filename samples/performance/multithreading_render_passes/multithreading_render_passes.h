@@ -63,7 +63,7 @@ class MultithreadingRenderPasses : public vkb::VulkanSampleC
 	class ShadowSubpass : public vkb::GeometrySubpass
 	{
 	  public:
-		ShadowSubpass(vkb::RenderContext &render_context,
+		ShadowSubpass(vkb::rendering::RenderContextC &render_context,
 		              vkb::ShaderSource &&vertex_source,
 		              vkb::ShaderSource &&fragment_source,
 		              vkb::sg::Scene     &scene,
@@ -86,7 +86,7 @@ class MultithreadingRenderPasses : public vkb::VulkanSampleC
 	class MainSubpass : public vkb::ForwardSubpass
 	{
 	  public:
-		MainSubpass(vkb::RenderContext                              &render_context,
+		MainSubpass(vkb::rendering::RenderContextC                              &render_context,
 		            vkb::ShaderSource                              &&vertex_source,
 		            vkb::ShaderSource                              &&fragment_source,
 		            vkb::sg::Scene                                  &scene,
@@ -100,7 +100,7 @@ bool PipelineCache::prepare(const vkb::ApplicationOptions &options)
 	/* Create Vulkan pipeline cache */
 	VK_CHECK(vkCreatePipelineCache(get_device().get_handle(), &create_info, nullptr, &pipeline_cache));
 
-	vkb::ResourceCache &resource_cache = get_device().get_resource_cache();
+	vkb::ResourceCacheC &resource_cache = get_device().get_resource_cache();
 
 	// Use pipeline cache to store pipelines
 	resource_cache.set_pipeline_cache(pipeline_cache);
@@ -151,7 +151,7 @@ void PipelineCache::draw_gui()
 	    /* body = */ [this]() {
 		    if (ImGui::Checkbox("Pipeline cache", &enable_pipeline_cache))
 		    {
-			    vkb::ResourceCache &resource_cache = get_device().get_resource_cache();
+			    vkb::ResourceCacheC &resource_cache = get_device().get_resource_cache();
 
 			    if (enable_pipeline_cache)
 			    {
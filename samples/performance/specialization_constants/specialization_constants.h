@@ -52,7 +52,7 @@ class SpecializationConstants : public vkb::VulkanSampleC
 	class ForwardSubpassCustomLights : public vkb::ForwardSubpass
 	{
 	  public:
-		ForwardSubpassCustomLights(vkb::RenderContext &render_context,
+		ForwardSubpassCustomLights(vkb::rendering::RenderContextC &render_context,
 		                           vkb::ShaderSource &&vertex_source, vkb::ShaderSource &&fragment_source,
 		                           vkb::sg::Scene &scene, vkb::sg::Camera &camera);
 
@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+
+# Copyright (c) 2025, Arm Limited and Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 the "License";
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import glob
+import json
+import os
+import sys
+
+# Times reported by the benchmark mode plugin, a higher value is a regression
+METRICS = ["frame_time", "cpu_time", "gpu_time"]
+STATISTICS = ["p50", "p90", "p99", "max"]
+
+
+def load_reports(path):
+    """Loads a benchmark report, or every report of a directory, keyed by app id"""
+    if os.path.isdir(path):
+        files = sorted(glob.glob(os.path.join(path, "benchmark_*.json")))
+    else:
+        files = [path]
+
+    reports = {}
+    for file in files:
+        with open(file) as f:
+            report = json.load(f)
+        reports[report["app"]] = report
+    return reports
+
+
+def compare(baseline, current, threshold, statistics):
+    """Prints the difference of every statistic and returns the regressions"""
+    regressions = []
+
+    for app in sorted(set(baseline) | set(current)):
+        if app not in baseline:
+            print("{}: only in current".format(app))
+            continue
+        if app not in current:
+            print("{}: only in baseline".format(app))
+            continue
+
+        print("{}:".format(app))
+        for metric in METRICS:
+            before = baseline[app].get(metric)
+            after = current[app].get(metric)
+            if not before or not after:
+                continue
+
+            for statistic in statistics:
+                if before[statistic] <= 0.0:
+                    continue
+
+                change = (after[statistic] - before[statistic]) / before[statistic] * 100.0
+                flag = ""
+                if change > threshold:
+                    flag = "  REGRESSION"
+                    regressions.append((app, metric, statistic, change))
+                elif change < -threshold:
+                    flag = "  improvement"
+
+                print(
+                    "    {:<10} {:<3} {:>10.3f} ms -> {:>10.3f} ms ({:+.1f}%){}".format(
+                        metric, statistic, before[statistic], after[statistic], change, flag
+                    )
+                )
+
+    return regressions
+
+
+if __name__ == "__main__":
+    argparser = argparse.ArgumentParser(description="Compare two benchmark reports written by the benchmark mode plugin")
+    argparser.add_argument("baseline", help="A benchmark_<app>.json report, or a directory of reports")
+    argparser.add_argument("current", help="A benchmark_<app>.json report, or a directory of reports")
+    argparser.add_argument("--threshold", type=float, default=5.0, help="Relative increase in percent above which a time is flagged as a regression")
+    argparser.add_argument("--statistics", nargs="+", choices=STATISTICS, default=STATISTICS, help="Statistics to compare")
+    args = argparser.parse_args()
+
+    baseline = load_reports(args.baseline)
+    current = load_reports(args.current)
+
+    if not baseline or not current:
+        print("No benchmark reports found")
+        sys.exit(1)
+
+    regressions = compare(baseline, current, args.threshold, args.statistics)
+
+    if regressions:
+        print("")
+        print("{} regressions above {:.1f}%:".format(len(regressions), args.threshold))
+        for app, metric, statistic, change in regressions:
+            print("    {} {} {} {:+.1f}%".format(app, metric, statistic, change))
+        sys.exit(1)
+
+    print("")
+    print("No regressions above {:.1f}%".format(args.threshold))
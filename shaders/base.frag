@@ -1,5 +1,5 @@
 #version 320 es
-/* Copyright (c) 2019-2020, Arm Limited and Contributors
+/* Copyright (c) 2019-2025, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -43,6 +43,9 @@ layout(push_constant, std430) uniform PBRMaterialUniform
 	vec4  base_color_factor;
 	float metallic_factor;
 	float roughness_factor;
+#ifdef TEXTURE_STREAMING
+	uint texture_feedback_index;
+#endif
 }
 pbr_material_uniform;
 
@@ -56,6 +59,14 @@ layout(set = 0, binding = 4) uniform LightsInfo
 }
 lights_info;
 
+#ifdef CLUSTERED_LIGHTING
+#include "clustered_lighting.h"
+#endif
+
+#ifdef TEXTURE_STREAMING
+#include "texture_streaming.h"
+#endif
+
 layout(constant_id = 0) const uint DIRECTIONAL_LIGHT_COUNT = 0U;
 layout(constant_id = 1) const uint POINT_LIGHT_COUNT       = 0U;
 layout(constant_id = 2) const uint SPOT_LIGHT_COUNT        = 0U;
@@ -81,6 +92,14 @@ void main(void)
 		light_contribution += apply_spot_light(lights_info.spot_lights[i], in_pos.xyz, normal);
 	}
 
+#ifdef CLUSTERED_LIGHTING
+	light_contribution += apply_clustered_lights(gl_FragCoord.xy, in_pos.xyz, normal);
+#endif
+
+#ifdef TEXTURE_STREAMING
+	write_texture_feedback(pbr_material_uniform.texture_feedback_index, in_uv);
+#endif
+
 	vec4 base_color = vec4(1.0, 0.0, 0.0, 1.0);
 
 #ifdef HAS_BASE_COLOR_TEXTURE
@@ -0,0 +1,108 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Point and spot lights binned into a view-space cluster grid by vkb::LightClusters.
+// Requires lighting.h to be included first.
+
+layout(set = 0, binding = 5) uniform LightClusterUniform
+{
+	mat4  view;
+	mat4  inv_projection;
+	uvec4 grid_size;            // xyz represents the number of clusters per axis, w represents the maximum number of lights per cluster
+	vec4  cluster_scale;        // xy represents clusters per pixel, z and w represent the logarithmic depth slice scale and bias
+	vec4  depth_range;          // x represents the near plane, y represents the far plane
+	uvec4 light_count;          // x represents the number of clustered lights
+}
+light_clusters;
+
+layout(set = 0, binding = 6, std430) readonly buffer ClusteredLights
+{
+	Light clustered_lights[];
+};
+
+layout(set = 0, binding = 7, std430) readonly buffer ClusterRanges
+{
+	uvec2 cluster_ranges[];        // x represents the offset in light_indices, y represents the number of lights
+};
+
+layout(set = 0, binding = 8, std430) readonly buffer LightIndices
+{
+	uint light_indices[];
+};
+
+// Inverse square falloff, smoothly windowed to zero at the light radius so that culled lights leave no seams
+float get_clustered_light_attenuation(Light light, float light_distance)
+{
+	float dist   = light_distance * 0.005;
+	float ratio  = light_distance / get_light_radius(light);
+	float window = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);
+	return window * window / (dist * dist);
+}
+
+vec3 apply_clustered_point_light(Light light, vec3 pos, vec3 normal)
+{
+	vec3  world_to_light = light.position.xyz - pos;
+	float atten          = get_clustered_light_attenuation(light, length(world_to_light));
+	world_to_light       = normalize(world_to_light);
+	float ndotl          = clamp(dot(normal, world_to_light), 0.0, 1.0);
+	return ndotl * light.color.w * atten * light.color.rgb;
+}
+
+// Spot lights fall off with distance as well, so that they stop lighting at the radius they are culled with
+vec3 apply_clustered_spot_light(Light light, vec3 pos, vec3 normal)
+{
+	vec3  light_to_pixel   = pos - light.position.xyz;
+	float atten            = get_clustered_light_attenuation(light, length(light_to_pixel));
+	light_to_pixel         = normalize(light_to_pixel);
+	float theta            = dot(light_to_pixel, normalize(light.direction.xyz));
+	float inner_cone_angle = light.info.x;
+	float outer_cone_angle = light.info.y;
+	float intensity        = (theta - outer_cone_angle) / (inner_cone_angle - outer_cone_angle);
+	return smoothstep(0.0, 1.0, intensity) * light.color.w * atten * light.color.rgb;
+}
+
+uint get_cluster_index(vec2 frag_coord, vec3 pos)
+{
+	float depth = -(light_clusters.view * vec4(pos, 1.0)).z;
+	float slice = floor(log(max(depth, light_clusters.depth_range.x)) * light_clusters.cluster_scale.z - light_clusters.cluster_scale.w);
+
+	uvec3 grid_size = light_clusters.grid_size.xyz;
+	uvec3 cluster   = uvec3(clamp(frag_coord * light_clusters.cluster_scale.xy, vec2(0.0), vec2(grid_size.xy - 1U)),
+	                        clamp(slice, 0.0, float(grid_size.z - 1U)));
+
+	return cluster.x + grid_size.x * (cluster.y + grid_size.y * cluster.z);
+}
+
+vec3 apply_clustered_lights(vec2 frag_coord, vec3 pos, vec3 normal)
+{
+	uvec2 range = cluster_ranges[get_cluster_index(frag_coord, pos)];
+
+	vec3 light_contribution = vec3(0.0);
+	for (uint i = 0U; i < range.y; ++i)
+	{
+		Light light = clustered_lights[light_indices[range.x + i]];
+		if (light.position.w == POINT_LIGHT)
+		{
+			light_contribution += apply_clustered_point_light(light, pos, normal);
+		}
+		else
+		{
+			light_contribution += apply_clustered_spot_light(light, pos, normal);
+		}
+	}
+	return light_contribution;
+}
@@ -49,4 +49,15 @@ vec3 apply_spot_light(Light light, vec3 pos, vec3 normal)
 	float outer_cone_angle = light.info.y;
 	float intensity        = (theta - outer_cone_angle) / (inner_cone_angle - outer_cone_angle);
 	return smoothstep(0.0, 1.0, intensity) * light.color.w * light.color.rgb;
-}
\ No newline at end of file
+}
+
+// Distance beyond which a clustered point or spot light contributes nothing, must match light_radius() in light_clusters.cpp.
+// Lights without a range are cut off where their inverse square falloff, intensity / dist^2, drops below 1/256.
+float get_light_radius(Light light)
+{
+	if (light.direction.w > 0.0)
+	{
+		return light.direction.w;
+	}
+	return sqrt(max(light.color.w, 0.0) * 256.0) / 0.005;
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Meshlets of a sub mesh, built by vkb::MeshletBuilder
+
+// Meshlets tested by a task shader workgroup
+#define MESHLETS_PER_TASK 32
+
+struct Meshlet
+{
+	// Center and radius of the bounding sphere
+	vec4 bounding_sphere;
+
+	// Axis and cutoff of the normal cone, the cutoff is 1 if the meshlet can't be backface culled
+	vec4 normal_cone;
+
+	uint vertex_offset;
+	uint triangle_offset;
+	uint vertex_count;
+	uint triangle_count;
+};
+
+// Indices of the meshlets a task shader workgroup left visible
+struct MeshletPayload
+{
+	uint meshlet_indices[MESHLETS_PER_TASK];
+};
+
+layout(set = 0, binding = 1) uniform GlobalUniform
+{
+	mat4 model;
+	mat4 view_proj;
+	vec3 camera_position;
+}
+global_uniform;
+
+layout(set = 0, binding = 10, std430) readonly buffer Meshlets
+{
+	Meshlet meshlets[];
+};
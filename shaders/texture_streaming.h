@@ -0,0 +1,39 @@
+/* Copyright (c) 2025, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Level of detail needed by the fragments of every material, read back by vkb::TextureStreamer.
+// Every value is the lowest level of detail a fragment of the material has written, relative to a 1x1 texture.
+
+layout(set = 0, binding = 9, std430) buffer TextureFeedback
+{
+	uint texture_feedback[];
+};
+
+void write_texture_feedback(uint index, vec2 uv)
+{
+	// Derivatives are taken before the branch, where they are defined for the whole quad
+	vec2  dx  = dFdx(uv);
+	vec2  dy  = dFdy(uv);
+	float lod = 0.5 * log2(max(dot(dx, dx), dot(dy, dy)));
+
+	// One fragment in 16 is enough to estimate the level of detail, and keeps the atomics cheap
+	uvec2 coord = uvec2(gl_FragCoord.xy);
+	if ((coord.x & 3U) == 0U && (coord.y & 3U) == 0U)
+	{
+		atomicMin(texture_feedback[index], uint(clamp((lod + 32.0) * 16.0, 0.0, 1023.0)));
+	}
+}